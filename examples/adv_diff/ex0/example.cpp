@@ -156,6 +156,10 @@ main(int argc, char* argv[])
         // Initialize hierarchy configuration and data on all patches.
         time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
 
+        // Write a per-time step performance report if one is requested.
+        Pointer<PerformanceReportWriter> performance_report_writer = app_initializer->getPerformanceReportWriter();
+        if (performance_report_writer) time_integrator->registerPerformanceReportWriter(performance_report_writer);
+
         // Close the restart manager.
         RestartManager::getManager()->closeRestartFile();
 
@@ -0,0 +1,312 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_CCPoissonGMGLevelSolver
+#define included_IBTK_CCPoissonGMGLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/CartCellRobinPhysBdryOp.h"
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "BoxList.h"
+#include "CoarseFineBoundary.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "RefineSchedule.h"
+#include "VariableContext.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CCPoissonGMGLevelSolver is a concrete LinearSolver for solving
+ * elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I + \nabla \cdot
+ * D \nabla) u$} = f \f$ on a \em single SAMRAI::hier::PatchLevel using a
+ * matrix-free geometric multigrid method that operates directly on SAMRAI patch
+ * data.
+ *
+ * The multigrid hierarchy is obtained by repeatedly coarsening the patch level
+ * by a factor of two in each direction, for as long as all of the patch boxes
+ * can be coarsened.  Because each coarse patch is the coarsening of a single
+ * fine patch and is owned by the same process, restriction (cell averaging)
+ * and prolongation (cell-centered linear interpolation) are local to each
+ * patch; only ghost cell values are communicated.  The operator on each
+ * multigrid level is obtained by rediscretization, using the same
+ * second-order accurate stencil and boundary treatment as
+ * CCPoissonHypreLevelSolver, and red-black Gauss-Seidel is used as the
+ * smoother.  Variable coefficients \f$C\f$ and \f$D\f$ are rediscretized on
+ * the coarser multigrid levels from their cell and side averages.  The
+ * coarsest multigrid level is solved with BiCGStab to the coarse solver
+ * tolerances.
+ *
+ * When the nullspace of the operator is set to contain the constant vector
+ * (see LinearSolver::setNullspace()), the constant is projected out of the
+ * right-hand side and of the solution on the finest and coarsest multigrid
+ * levels.  No other nullspace basis vectors are supported.  Robin boundary
+ * conditions may be specified through the interface class
+ * SAMRAI::solv::RobinBcCoefStrategy.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE             // see setLoggingEnabled()
+ max_iterations = 25                // see setMaxIterations()
+ abs_residual_tol = 1.e-50          // see setAbsoluteTolerance()
+ rel_residual_tol = 1.0e-5          // see setRelativeTolerance()
+ initial_guess_nonzero = FALSE      // see setInitialGuessNonzero()
+ num_pre_relax_steps = 2            // number of pre-smoothing sweeps
+ num_post_relax_steps = 2           // number of post-smoothing sweeps
+ max_multigrid_levels = 20          // maximum number of multigrid levels
+ coarse_solver_max_iterations = 1000     // maximum number of BiCGStab iterations on the coarsest level
+ coarse_solver_abs_residual_tol = 1.0e-50 // absolute tolerance for the coarsest level solver
+ coarse_solver_rel_residual_tol = 1.0e-10 // relative tolerance for the coarsest level solver
+ \endverbatim
+ */
+class CCPoissonGMGLevelSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    CCPoissonGMGLevelSolver(const std::string& object_name,
+                            SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                            const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CCPoissonGMGLevelSolver();
+
+    /*!
+     * \brief Static function to construct a CCPoissonGMGLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new CCPoissonGMGLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \see CCPoissonHypreLevelSolver::solveSystem()
+     *
+     * \return \p true if the solver converged to the specified tolerances, \p
+     * false otherwise
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                     SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$,
+     * including the multigrid levels and the operator coefficients on each
+     * multigrid level.
+     *
+     * \note It is safe to call initializeSolverState() when the state is
+     * already initialized.  In this case, the solver state is first deallocated
+     * and then reinitialized.
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \note It is safe to call deallocateSolverState() when the solver state is
+     * already deallocated.
+     */
+    void deallocateSolverState() override;
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CCPoissonGMGLevelSolver() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CCPoissonGMGLevelSolver(const CCPoissonGMGLevelSolver& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CCPoissonGMGLevelSolver& operator=(const CCPoissonGMGLevelSolver& that) = delete;
+
+    /*!
+     * \brief Perform one V-cycle for data depth \a depth starting on multigrid
+     * level \a mg_ln.
+     */
+    void applyVCycle(int mg_ln, int depth);
+
+    /*!
+     * \brief Solve the problem on the coarsest multigrid level for data depth
+     * \a depth.
+     */
+    void solveCoarsestLevel(int depth);
+
+    /*!
+     * \brief Perform red-black Gauss-Seidel sweeps on multigrid level \a mg_ln.
+     */
+    void smooth(int mg_ln, int depth, int num_sweeps);
+
+    /*!
+     * \brief Compute the residual on multigrid level \a mg_ln and return its
+     * discrete l2 norm.
+     */
+    double computeResidual(int mg_ln, int depth);
+
+    /*!
+     * \brief Apply the operator on multigrid level \a mg_ln to the data \a
+     * src_idx and store the result in \a dst_idx.
+     */
+    void applyOperator(int mg_ln, int depth, int dst_idx, int src_idx);
+
+    /*!
+     * \brief Compute the discrete l2 inner product of two scratch data on
+     * multigrid level \a mg_ln.
+     */
+    double computeInnerProduct(int mg_ln, int idx1, int idx2);
+
+    /*!
+     * \brief Set dst = alpha src1 + beta src2 on multigrid level \a mg_ln.
+     */
+    void levelLinearSum(int mg_ln, int dst_idx, double alpha, int src1_idx, double beta, int src2_idx);
+
+    /*!
+     * \brief Subtract the mean value of the data \a data_idx on multigrid level
+     * \a mg_ln.
+     */
+    void projectOutConstant(int mg_ln, int data_idx);
+
+    /*!
+     * \brief Fill the ghost cell values of the data \a data_idx on multigrid
+     * level \a mg_ln.
+     *
+     * Ghost cells that are not filled by neighboring patches are set to zero
+     * (the value implied by the operator coefficients).  When \a
+     * homogeneous_physical_bc is true, ghost cells at physical boundaries are
+     * instead set using the homogeneous form of the physical boundary
+     * conditions, which is how the coarse-grid correction is extended before
+     * it is interpolated.
+     */
+    void fillGhostCells(int mg_ln, int data_idx, bool homogeneous_physical_bc);
+
+    /*!
+     * \brief Associated hierarchy.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    /*!
+     * \brief Associated patch level and C-F boundary (for level numbers > 0).
+     */
+    int d_level_num = IBTK::invalid_level_number;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::CoarseFineBoundary<NDIM> > d_cf_boundary;
+
+    /*!
+     * \name Multigrid data.
+     */
+    //\{
+    int d_num_pre_relax_steps = 2, d_num_post_relax_steps = 2;
+    int d_max_multigrid_levels = 20;
+    int d_coarse_solver_max_iterations = 1000;
+    double d_coarse_solver_abs_residual_tol = 1.0e-50, d_coarse_solver_rel_residual_tol = 1.0e-10;
+    unsigned int d_depth = 0;
+
+    // The multigrid levels, ordered from finest (the level on which the system
+    // is solved) to coarsest.
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > d_mg_levels;
+
+    // Stencil offsets and operator coefficients, indexed by multigrid level
+    // number and patch number.
+    std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > > > d_stencil_coefs;
+
+    // Portions of the patch ghost boxes that are not interior to the patch,
+    // indexed by multigrid level number and patch number.
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_ghost_boxes;
+
+    // Schedules to fill the ghost cell values of the scratch data, indexed by
+    // multigrid level number and patch data index.
+    std::vector<std::map<int, SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > > d_ghost_fill_scheds;
+
+    // Boundary operator that sets physical boundary ghost cell values of the
+    // solution data using homogeneous boundary conditions for the data depth
+    // currently being solved.
+    SAMRAI::tbox::Pointer<CartCellRobinPhysBdryOp> d_sol_bc_op;
+
+    // Scratch data.  The BiCGStab vectors are only allocated on the coarsest
+    // multigrid level.
+    SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> d_context;
+    int d_sol_idx = IBTK::invalid_index, d_rhs_idx = IBTK::invalid_index, d_res_idx = IBTK::invalid_index;
+    int d_aux_idx = IBTK::invalid_index, d_r_hat_idx = IBTK::invalid_index, d_p_idx = IBTK::invalid_index,
+        d_v_idx = IBTK::invalid_index, d_s_idx = IBTK::invalid_index, d_t_idx = IBTK::invalid_index;
+    //\}
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CCPoissonGMGLevelSolver
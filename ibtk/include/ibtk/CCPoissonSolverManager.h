@@ -63,6 +63,7 @@ public:
      * Default level solver types automatically provided by the manager class.
      */
     static const std::string DEFAULT_LEVEL_SOLVER;
+    static const std::string GMG_LEVEL_SOLVER;
     static const std::string HYPRE_LEVEL_SOLVER;
     static const std::string PETSC_LEVEL_SOLVER;
 
@@ -22,6 +22,7 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PerformanceReportWriter.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "BasePatchHierarchy.h"
@@ -362,6 +363,17 @@ public:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > getVisItDataWriter() const;
 
+    /*!
+     * Register a writer for the per-time step performance report.  A record is
+     * written at the end of each call to advanceHierarchy().  The writer is
+     * also registered with all child integrators, and each integrator adds the
+     * number of iterations taken by its linear solvers to the report.
+     *
+     * @note This method should be called after all child integrators have been
+     * registered with this integrator, e.g., after initializePatchHierarchy().
+     */
+    void registerPerformanceReportWriter(SAMRAI::tbox::Pointer<PerformanceReportWriter> report_writer);
+
     /*!
      * Prepare variables for plotting.
      *
@@ -773,6 +785,29 @@ protected:
      */
     virtual void setupPlotDataSpecialized();
 
+    /*!
+     * Virtual method to register implementation-specific quantities, such as
+     * solver iteration counts, with the performance report writer
+     * d_performance_report_writer.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void registerPerformanceReportValuesSpecialized();
+
+    /*!
+     * Register the number of iterations taken by the solver with the specified
+     * name with the performance report writer.  This method should be called by
+     * implementations of registerPerformanceReportValuesSpecialized().
+     */
+    void registerSolverIterationsWithPerformanceReport(const std::string& solver_name);
+
+    /*!
+     * Add the number of iterations taken by a solve to the performance report,
+     * if a performance report writer has been registered.  The number of
+     * iterations is accumulated over all of the solves between records.
+     */
+    void addSolverIterationsToPerformanceReport(const std::string& solver_name, int num_iterations);
+
     /*!
      * Virtual method to perform implementation-specific data initialization
      * after the entire hierarchy has been constructed.
@@ -1044,6 +1079,11 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*
+     * The object used to write the per-time step performance report.
+     */
+    SAMRAI::tbox::Pointer<PerformanceReportWriter> d_performance_report_writer;
+
     /*
      * Time and time step size data read from input or set at initialization.
      */
@@ -0,0 +1,321 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_LHDF5DataWriter
+#define included_IBTK_LHDF5DataWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+#include "tbox/Serializable.h"
+
+#include "petscao.h"
+#include "petscvec.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace IBTK
+{
+class LData;
+} // namespace IBTK
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LHDF5DataWriter provides functionality to output Lagrangian
+ * data for visualization in the HDF5 data format, along with an <A
+ * HREF="https://www.xdmf.org">XDMF</A> index that may be read by ParaView and
+ * VisIt.
+ *
+ * Unlike LSiloDataWriter, which writes one file per MPI process, all MPI
+ * processes write the plot data for each time step to a single shared HDF5
+ * file.  For each patch level that contains Lagrangian data, the file contains
+ * the datasets
+ *
+ * - <tt>/level_<ln>/coordinates</tt>: the coordinates of all of the plotted
+ *   points on the level,
+ * - <tt>/level_<ln>/<var_name></tt>: the values of each registered variable at
+ *   those points, and
+ * - <tt>/level_<ln>/connectivity</tt>: the edges of all of the unstructured
+ *   meshes on the level, stored in terms of the vertex numbers of each mesh.
+ *
+ * Each MPI process writes a contiguous range of rows of each dataset.  When
+ * HDF5 is built with MPI support, the data are written using collective MPI-IO
+ * operations; otherwise, the processes write to the file one at a time.  The
+ * datasets are chunked and may optionally be compressed.
+ *
+ * The registration interface is the same as that of LSiloDataWriter, except
+ * that logically Cartesian blocks are not supported.
+ */
+class LHDF5DataWriter : public SAMRAI::tbox::Serializable
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name           String used for error reporting.
+     * \param dump_directory_name   String indicating the directory where visualization data is
+     *to
+     *be written.
+     * \param register_for_restart  Boolean indicating whether to register this object with the
+     *restart manager.
+     */
+    LHDF5DataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart = true);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LHDF5DataWriter();
+
+    /*!
+     * \name Methods to set the hierarchy and range of levels.
+     */
+    //\{
+
+    /*!
+     * \brief Reset the patch hierarchy over which operations occur.
+     */
+    void setPatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Reset range of patch levels over which operations occur.
+     */
+    void resetLevels(int coarsest_ln, int finest_ln);
+
+    //\}
+
+    /*!
+     * \brief Register or update a range of Lagrangian indices that are to be
+     * visualized as a cloud of marker particles.
+     *
+     * \note This method is not collective over all MPI processes.  A particular
+     * cloud of markers must be registered on only \em one MPI process.
+     */
+    void registerMarkerCloud(const std::string& name, int nmarks, int first_lag_idx, int level_number);
+
+    /*!
+     * \brief Register or update an unstructured mesh.
+     *
+     * \note This method is not collective over all MPI processes.  A particular
+     * collection of indices must be registered on only \em one MPI process.
+     */
+    void registerUnstructuredMesh(const std::string& name,
+                                  const std::multimap<int, std::pair<int, int> >& edge_map,
+                                  int level_number);
+
+    /*!
+     * \brief Register the coordinates of the Lagrangian mesh with the HDF5
+     * data writer.
+     */
+    void registerCoordsData(SAMRAI::tbox::Pointer<LData> coords_data, int level_number);
+
+    /*!
+     * \brief Register a variable for plotting with the HDF5 data writer.
+     */
+    void registerVariableData(const std::string& var_name, SAMRAI::tbox::Pointer<LData> var_data, int level_number);
+
+    /*!
+     * \brief Register a variable for plotting with the HDF5 data writer with a
+     * specified starting depth and data depth.
+     */
+    void registerVariableData(const std::string& var_name,
+                              SAMRAI::tbox::Pointer<LData> var_data,
+                              int start_depth,
+                              int var_depth,
+                              int level_number);
+
+    /*!
+     * \brief Register or update a single Lagrangian AO (application ordering)
+     * objects with the HDF5 data writer.
+     *
+     * These AO objects are used to map between (fixed) Lagrangian indices and
+     * (time-dependent) PETSc indices.  Each time that the AO objects are reset
+     * (e.g., during adaptive regridding), the new AO objects must be supplied
+     * to the HDF5 data writer.
+     */
+    void registerLagrangianAO(AO& ao, int level_number);
+
+    /*!
+     * \brief Register or update a collection of Lagrangian AO (application
+     * ordering) objects with the HDF5 data writer.
+     *
+     * These AO objects are used to map between (fixed) Lagrangian indices and
+     * (time-dependent) PETSc indices.  Each time that the AO objects are reset
+     * (e.g., during adaptive regridding), the new AO objects must be supplied
+     * to the HDF5 data writer.
+     */
+    void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
+
+    /*!
+     * \brief Set the maximum number of rows in each chunk of the HDF5 datasets.
+     */
+    void setChunkSize(int chunk_size);
+
+    /*!
+     * \brief Set the level of the gzip compression applied to the HDF5
+     * datasets, between 0 (the default, no compression) and 9.
+     *
+     * \note Writing compressed data in parallel requires HDF5 1.10.2 or later.
+     * With older versions of parallel HDF5, the data are written uncompressed.
+     */
+    void setCompressionLevel(int compression_level);
+
+    /*!
+     * \brief Write the plot data to disk.
+     */
+    void writePlotData(int time_step_number, double simulation_time);
+
+    /*!
+     * Write out object state to the given database.
+     *
+     * When assertion checking is active, database pointer must be non-null.
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
+
+protected:
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LHDF5DataWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LHDF5DataWriter(const LHDF5DataWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LHDF5DataWriter& operator=(const LHDF5DataWriter& that) = delete;
+
+    /*!
+     * \brief Build the VecScatter objects required to communicate data for
+     * plotting.
+     */
+    void buildVecScatters(AO& ao, int level_number);
+
+    /*!
+     * \brief Destroy the VecScatter objects and Vecs associated with a level.
+     */
+    void destroyVecScatters(int level_number);
+
+    /*!
+     * Read object state from the restart file and initialize class data
+     * members.  The database from which the restart data is read is
+     * determined by the object_name specified in the constructor.
+     *
+     * Unrecoverable Errors:
+     *
+     *    -   The database corresponding to object_name is not found
+     *        in the restart file.
+     *
+     *    -   The class version number and restart version number do not
+     *        match.
+     *
+     */
+    void getFromRestart();
+
+    /*
+     * The object name is used for error reporting purposes.
+     */
+    std::string d_object_name;
+    bool d_registered_for_restart;
+
+    /*
+     * The directory where data is to be dumped and the most recent timestep
+     * number.
+     */
+    std::string d_dump_directory_name;
+    int d_time_step_number = -1;
+
+    /*
+     * Output options.
+     */
+    int d_chunk_size = 65536;
+    int d_compression_level = 0;
+
+    /*
+     * Grid hierarchy information.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    int d_coarsest_ln = 0, d_finest_ln = 0;
+
+    /*
+     * Information about the indices in the local marker clouds.
+     */
+    std::vector<int> d_nclouds;
+    std::vector<std::vector<std::string> > d_cloud_names;
+    std::vector<std::vector<int> > d_cloud_nmarks, d_cloud_first_lag_idx;
+
+    /*
+     * Information about the indices in the unstructured meshes.
+     */
+    std::vector<int> d_nucd_meshes;
+    std::vector<std::vector<std::string> > d_ucd_mesh_names;
+    std::vector<std::vector<std::set<int> > > d_ucd_mesh_vertices;
+    std::vector<std::vector<std::multimap<int, std::pair<int, int> > > > d_ucd_mesh_edge_maps;
+
+    /*
+     * Coordinates and variable data for plotting.
+     */
+    std::vector<SAMRAI::tbox::Pointer<LData> > d_coords_data;
+
+    std::vector<int> d_nvars;
+    std::vector<std::vector<std::string> > d_var_names;
+    std::vector<std::vector<int> > d_var_start_depths, d_var_plot_depths, d_var_depths;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<LData> > > d_var_data;
+
+    /*
+     * Data for obtaining local data.
+     */
+    std::vector<AO> d_ao;
+    std::vector<bool> d_build_vec_scatters;
+    std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
+    std::vector<std::map<int, VecScatter> > d_vec_scatter;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LHDF5DataWriter
@@ -97,6 +97,11 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered Laplacian of a side-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \p reuse_nonzero_structure is true and \p mat has already been
+     * constructed by this function for the same DOF indices, the nonzero
+     * structure of \p mat is kept and only its values are reset.  Otherwise,
+     * any existing matrix is destroyed and a new one is created.
      */
     static void constructPatchLevelSCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -104,7 +109,8 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
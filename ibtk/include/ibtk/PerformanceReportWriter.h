@@ -0,0 +1,229 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_PerformanceReportWriter
+#define included_IBTK_PerformanceReportWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PerformanceReportWriter writes a machine-readable, per-time step
+ * performance report.
+ *
+ * At each call to writeStepReport(), the wallclock time accumulated by each of
+ * a collection of SAMRAI timers since the previous report is determined on
+ * every MPI process, along with the values of any registered step quantities
+ * (e.g., the number of Krylov iterations taken by a solver).  The minimum,
+ * maximum, and average of each quantity over all MPI processes is then
+ * written by the root process as one record, either as a line of JSON (the <A
+ * HREF="https://jsonlines.org">JSON Lines</A> format) or as a row of a CSV
+ * file.  The cost of each report is three small reductions, so the report may
+ * be left enabled in production runs.
+ *
+ * The following input options are read from the database supplied to the
+ * constructor:
+ *
+ * - <tt>file_name</tt>: the name of the report file.  Default is
+ *   "performance_report.jsonl" for JSON and "performance_report.csv" for CSV
+ *   output.
+ * - <tt>format</tt>: either "JSON" (the default) or "CSV".
+ * - <tt>report_interval</tt>: the number of time steps between records.  Each
+ *   record contains the times accumulated since the previous record.  Default
+ *   is 1.
+ * - <tt>timer_names</tt>: an array of the names of the timers to report.  If
+ *   this is not provided, a default list including IB spreading and
+ *   interpolation, Krylov solves, Lagrangian data redistribution, and ghost
+ *   cell filling is used.
+ *
+ * Typically, the writer is obtained from AppInitializer and is registered with
+ * the top-level HierarchyIntegrator via
+ * HierarchyIntegrator::registerPerformanceReportWriter().  The integrator then
+ * writes a record at the end of each time step, and the integrator and its
+ * child integrators add the number of iterations taken by their Krylov solvers
+ * to the report.
+ *
+ * \note SAMRAI only accumulates time for timers that are activated through the
+ * <tt>timer_list</tt> entry of the <tt>TimerManager</tt> input database.  Times
+ * for inactive timers are reported as zero.
+ *
+ * \note The timers and step quantities must be registered in the same order on
+ * all MPI processes, and writeStepReport() must be called collectively.
+ *
+ * \note The columns of a CSV report are determined by the first record, so all
+ * timers and step quantities must be registered before the first record is
+ * written.  A restarted run appends to an existing CSV report only if the
+ * registered quantities match its columns.  Each record is flushed to the file
+ * as soon as it is written.
+ */
+class PerformanceReportWriter : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PerformanceReportWriter(std::string object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PerformanceReportWriter();
+
+    /*!
+     * \brief Add a timer to the report.
+     *
+     * \note For CSV reports, timers may not be added after the first record has
+     * been written.
+     */
+    void registerTimer(const std::string& timer_name);
+
+    /*!
+     * \brief Add a quantity to the report that is evaluated by calling the
+     * provided function each time that a record is written.
+     *
+     * For instance, the number of iterations taken by a linear solver in the
+     * most recent solve may be reported via
+     * \code
+     * report_writer->registerStepValue("stokes_solver_its", [solver]() { return solver->getNumIterations(); });
+     * \endcode
+     *
+     * \note For CSV reports, step quantities may not be added after the first
+     * record has been written.
+     */
+    void registerStepValue(const std::string& name, std::function<double()> fcn);
+
+    /*!
+     * \brief Add a quantity to the report that is accumulated between records
+     * via addToStepValue().
+     */
+    void registerStepValue(const std::string& name);
+
+    /*!
+     * \brief Add to the value of a quantity registered via
+     * registerStepValue(const std::string&).  The accumulated value is reset to
+     * zero each time that a record is written.
+     */
+    void addToStepValue(const std::string& name, double value);
+
+    /*!
+     * \brief Write a record for the specified time step if the time step number
+     * is a multiple of the report interval.
+     *
+     * \note This method must be called collectively.
+     */
+    void writeStepReport(int time_step_number, double simulation_time);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PerformanceReportWriter() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PerformanceReportWriter(const PerformanceReportWriter& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PerformanceReportWriter& operator=(const PerformanceReportWriter& that) = delete;
+
+    /*!
+     * \brief Write the CSV column headers, or check that they match the headers
+     * of the report that a restarted run appends to.
+     */
+    void writeCSVHeader();
+
+    /*
+     * The object name is used for error reporting purposes.
+     */
+    std::string d_object_name;
+
+    /*
+     * Output options.
+     */
+    enum class ReportFormat
+    {
+        JSON,
+        CSV
+    };
+    ReportFormat d_format = ReportFormat::JSON;
+    std::string d_file_name;
+    int d_report_interval = 1;
+    std::ofstream d_report_stream;
+    bool d_wrote_header = false;
+    bool d_wrote_record = false;
+    std::string d_existing_csv_header;
+
+    /*
+     * The timers and the total time accumulated by each timer at the time of
+     * the most recent record.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::tbox::Timer> > d_timers;
+    std::vector<double> d_last_timer_totals;
+
+    /*
+     * The step quantities.  Accumulated quantities do not have an associated
+     * function.
+     */
+    std::vector<std::string> d_value_names;
+    std::vector<std::function<double()> > d_value_fcns;
+    std::vector<double> d_accumulated_values;
+
+    /*
+     * The wallclock time at the time of the most recent record.
+     */
+    double d_last_wallclock_time;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PerformanceReportWriter
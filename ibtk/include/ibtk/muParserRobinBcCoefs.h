@@ -29,8 +29,10 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace SAMRAI
@@ -76,6 +78,12 @@ namespace IBTK
  * `condition ? result_if_true : result_if_false`. For more exotic boundary
  * conditions, one would need to create an extension of the class `RobinBcCoefStrategy`.
  *
+ * The coefficients are evaluated at all of the points of a boundary box in a
+ * single call to the bulk evaluation mode of mu::Parser.  Coefficients that do
+ * not depend on `t` are cached for each boundary box, so that repeated ghost
+ * cell fills (e.g., in each iteration of a Krylov solver) do not reevaluate
+ * them.
+ *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
@@ -180,7 +188,21 @@ private:
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that) = delete;
 
     /*!
-     * Current time value used by the mu::Parser instances.
+     * \brief Ensure that the evaluation buffers can hold at least the specified
+     * number of points, and rebind the parser variables if the buffers are
+     * reallocated.
+     */
+    void resizeParserBuffers(int num_points) const;
+
+    /*!
+     * \brief Evaluate a coefficient function at the first num_points points of
+     * the evaluation buffers.
+     */
+    void evaluateParser(mu::Parser& parser, double* vals, int num_points, double fill_time) const;
+
+    /*!
+     * Current time values used by the mu::Parser instances, stored as an array
+     * for bulk evaluation.
      *
      * This value is mutable since the mu::Parser objects each store a pointer
      * to it but its specific value (the present time) changes during each
@@ -190,15 +212,15 @@ private:
      * this variable is only written to and subsequently read from in that
      * function this is reasonable.
      */
-    mutable double d_parser_time = 0.0;
+    mutable std::vector<double> d_parser_time;
 
     /*!
-     * Current space point used by the mu::Parser instances.
+     * Current space points used by the mu::Parser instances.
      *
      * This value is mutable for the same reasons that
      * muParserRobinBcCoefs::d_parser_time is mutable.
      */
-    mutable Point d_parser_posn;
+    mutable std::array<std::vector<double>, NDIM> d_parser_posn;
 
     /*!
      * The Cartesian grid geometry object provides the extents of the
@@ -221,10 +243,28 @@ private:
 
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
+     *
+     * These objects are mutable since bulk evaluation is a non-const
+     * operation.
+     */
+    mutable std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+
+    /*!
+     * Whether each of the data-setting functions depends on time.
+     */
+    std::array<bool, 2 * NDIM> d_acoef_time_dependent, d_bcoef_time_dependent, d_gcoef_time_dependent;
+
+    /*!
+     * Cached values of the coefficients that do not depend on time.  The key
+     * consists of the coefficient (0 for a, 1 for b, and 2 for g), the location
+     * index of the boundary box, the index range of the coefficient data and
+     * the lower index of the patch, and the lower corner and grid spacing of
+     * the patch.
      */
-    std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+    using BcCoefCacheKey = std::tuple<int, unsigned int, std::array<int, 3 * NDIM>, std::array<double, 2 * NDIM> >;
+    mutable std::map<BcCoefCacheKey, std::vector<double> > d_bc_coef_cache;
 };
 } // namespace IBTK
 
@@ -0,0 +1,49 @@
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+AC_DEFUN([CONFIGURE_OPENMP],[
+echo
+echo "==================================="
+echo "Configuring optional package OpenMP"
+echo "==================================="
+
+AC_ARG_ENABLE([openmp],
+  AS_HELP_STRING(--enable-openmp,enable the optional OpenMP-threaded kernels @<:@default=no@:>@),
+                 [case "$enableval" in
+                    yes)  OPENMP_ENABLED=yes ;;
+                    no)   OPENMP_ENABLED=no ;;
+                    *)    AC_MSG_ERROR(--enable-openmp=$enableval is invalid; choices are "yes" and "no") ;;
+                  esac],[OPENMP_ENABLED=no])
+
+if test "$OPENMP_ENABLED" = yes; then
+  AC_LANG_PUSH([C++])
+  AC_OPENMP
+  AC_LANG_POP([C++])
+  if test "x$ac_cv_prog_cxx_openmp" = "xunsupported" ; then
+    AC_MSG_ERROR([OpenMP was requested but the C++ compiler does not support it])
+  fi
+  # The Fortran kernels do not contain any OpenMP directives but they are
+  # called concurrently from threaded C++ code: compiling them with the
+  # compiler's OpenMP flag guarantees that their local variables are
+  # allocated on the stack (e.g., gfortran then implies -frecursive).
+  AC_LANG_PUSH([Fortran])
+  AC_OPENMP
+  AC_LANG_POP([Fortran])
+  CXXFLAGS_APPEND($OPENMP_CXXFLAGS)
+  FCFLAGS_APPEND($OPENMP_FCFLAGS)
+  LDFLAGS_APPEND($OPENMP_CXXFLAGS)
+  AC_DEFINE([HAVE_OPENMP],1,[Define if the optional OpenMP-threaded kernels are enabled.])
+else
+  AC_MSG_NOTICE([Optional package OpenMP is DISABLED])
+fi
+])
@@ -60,7 +60,11 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
-}
+
+// The maximum number of cached boundary boxes.  The cache is cleared when this
+// limit is reached, e.g., after repeated regridding.
+static const std::size_t MAX_CACHED_BC_COEF_BOXES = 4096;
+} // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -266,18 +270,36 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             parser->DefineConst(constant.first, constant.second);
         }
+    }
 
-        // Variables.
-        parser->DefineVar("T", &d_parser_time);
-        parser->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserBuffers(1);
+
+    // Determine which of the functions depend on time.
+    auto is_time_dependent = [](const mu::Parser& parser) -> bool {
+        try
         {
-            const std::string postfix = std::to_string(d);
-            parser->DefineVar("X" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("X_" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x_" + postfix, d_parser_posn.data() + d);
+            const mu::varmap_type& used_vars = parser.GetUsedVar();
+            return used_vars.count("T") > 0 || used_vars.count("t") > 0;
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  error: " << e.GetMsg() << "\n"
+                       << "  in:    " << e.GetExpr() << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
+        return true;
+    };
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        d_acoef_time_dependent[d] = is_time_dependent(d_acoef_parsers[d]);
+        d_bcoef_time_dependent[d] = is_time_dependent(d_bcoef_parsers[d]);
+        d_gcoef_time_dependent[d] = is_time_dependent(d_gcoef_parsers[d]);
     }
     return;
 } // muParserRobinBcCoefs
@@ -311,41 +333,73 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    const int num_points = bc_coef_box.size();
+    const std::array<ArrayData<NDIM, double>*, 3> coef_data = { { acoef_data.getPointer(),
+                                                                    bcoef_data.getPointer(),
+                                                                    gcoef_data.getPointer() } };
+    const std::array<mu::Parser*, 3> coef_parsers = { { &d_acoef_parsers[location_index],
+                                                        &d_bcoef_parsers[location_index],
+                                                        &d_gcoef_parsers[location_index] } };
+    const std::array<bool, 3> coef_time_dependent = { { d_acoef_time_dependent[location_index],
+                                                        d_bcoef_time_dependent[location_index],
+                                                        d_gcoef_time_dependent[location_index] } };
+
+    // Time-independent coefficients are cached for each boundary box.
+    std::array<int, 3 * NDIM> cache_key_idxs;
+    std::array<double, 2 * NDIM> cache_key_posns;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        const hier::Index<NDIM>& i = b();
-        for (unsigned int d = 0; d < NDIM; ++d)
+        cache_key_idxs[d] = bc_coef_box.lower(d);
+        cache_key_idxs[NDIM + d] = bc_coef_box.upper(d);
+        cache_key_idxs[2 * NDIM + d] = patch_lower(d);
+        cache_key_posns[d] = x_lower[d];
+        cache_key_posns[NDIM + d] = dx[d];
+    }
+
+    // Evaluate each coefficient at all of the points of the boundary box at
+    // once.  Note that the coefficient data are stored in the same order in
+    // which the boundary box is traversed.
+    bool set_parser_posns = false;
+    for (int k = 0; k < 3; ++k)
+    {
+        if (!coef_data[k]) continue;
+        double* const vals = coef_data[k]->getPointer(0);
+        std::vector<double>* cached_vals = nullptr;
+        if (!coef_time_dependent[k])
         {
-            if (d != bdry_normal_axis)
-            {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-            }
-            else
+            const BcCoefCacheKey key(k, location_index, cache_key_idxs, cache_key_posns);
+            const auto it = d_bc_coef_cache.find(key);
+            if (it != d_bc_coef_cache.end())
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                std::copy(it->second.begin(), it->second.end(), vals);
+                continue;
             }
+            if (d_bc_coef_cache.size() >= MAX_CACHED_BC_COEF_BOXES) d_bc_coef_cache.clear();
+            cached_vals = &d_bc_coef_cache[key];
         }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: " << e.GetMsg() << "\n"
-                       << "  in:    " << e.GetExpr() << "\n");
-        }
-        catch (...)
+        if (!set_parser_posns)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            resizeParserBuffers(num_points);
+            int idx = 0;
+            for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++idx)
+            {
+                const hier::Index<NDIM>& i = b();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d != bdry_normal_axis)
+                    {
+                        d_parser_posn[d][idx] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
+                    else
+                    {
+                        d_parser_posn[d][idx] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
+                }
+            }
+            set_parser_posns = true;
         }
+        evaluateParser(*coef_parsers[k], vals, num_points, fill_time);
+        if (cached_vals) cached_vals->assign(vals, vals + num_points);
     }
     return;
 } // setBcCoefs
@@ -360,6 +414,59 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::resizeParserBuffers(const int num_points) const
+{
+    if (num_points <= static_cast<int>(d_parser_time.size())) return;
+
+    // The parsers store pointers to the buffers, so the variables must be
+    // redefined whenever the buffers are reallocated.
+    d_parser_time.resize(num_points);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(num_points);
+    for (int k = 0; k < 2 * NDIM; ++k)
+    {
+        for (mu::Parser* parser : { &d_acoef_parsers[k], &d_bcoef_parsers[k], &d_gcoef_parsers[k] })
+        {
+            parser->DefineVar("T", d_parser_time.data());
+            parser->DefineVar("t", d_parser_time.data());
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const std::string postfix = std::to_string(d);
+                parser->DefineVar("X" + postfix, d_parser_posn[d].data());
+                parser->DefineVar("x" + postfix, d_parser_posn[d].data());
+                parser->DefineVar("X_" + postfix, d_parser_posn[d].data());
+                parser->DefineVar("x_" + postfix, d_parser_posn[d].data());
+            }
+        }
+    }
+    return;
+} // resizeParserBuffers
+
+void
+muParserRobinBcCoefs::evaluateParser(mu::Parser& parser,
+                                     double* const vals,
+                                     const int num_points,
+                                     const double fill_time) const
+{
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, fill_time);
+    try
+    {
+        parser.Eval(vals, num_points);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setBcCoefs():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setBcCoefs():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateParser
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -20,6 +20,7 @@
 #include "libmesh/compare_types.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/petsc_vector.h"
 #include "libmesh/quadrature.h"
 #include "libmesh/system.h"
 #include "libmesh/type_vector.h"
@@ -392,8 +393,67 @@ FEDataInterpolation::collectDataForInterpolation(const Elem* const elem)
         NumericVector<double>* system_vec = d_system_vecs[system_idx];
         const auto& dof_indices = system_dof_map_cache->dof_indices(d_current_elem);
         boost::multi_array<double, 2>& elem_data = d_system_elem_data[system_idx];
-        get_values_for_interpolation(elem_data, *system_vec, dof_indices);
+        if (d_system_vec_arrays.empty())
+        {
+            get_values_for_interpolation(elem_data, *system_vec, dof_indices);
+        }
+        else
+        {
+            get_values_for_interpolation(elem_data,
+                                         static_cast<const PetscVector<double>&>(*system_vec),
+                                         d_system_vec_arrays[system_idx],
+                                         dof_indices);
+        }
+    }
+    return;
+}
+
+void
+FEDataInterpolation::getSystemVectorArrays()
+{
+    TBOX_ASSERT(d_initialized);
+    TBOX_ASSERT(d_system_vec_arrays.empty());
+    d_system_vec_arrays.resize(d_system_vecs.size());
+    for (size_t system_idx = 0; system_idx < d_system_vecs.size(); ++system_idx)
+    {
+        auto system_petsc_vec = dynamic_cast<PetscVector<double>*>(d_system_vecs[system_idx]);
+        TBOX_ASSERT(system_petsc_vec);
+        d_system_vec_arrays[system_idx] = system_petsc_vec->get_array_read();
+    }
+    d_owns_system_vec_arrays = true;
+    return;
+}
+
+void
+FEDataInterpolation::shareSystemVectorArrays(const FEDataInterpolation& owner)
+{
+    TBOX_ASSERT(d_initialized);
+    TBOX_ASSERT(d_system_vec_arrays.empty());
+    TBOX_ASSERT(owner.d_owns_system_vec_arrays);
+    TBOX_ASSERT(owner.d_system_vecs == d_system_vecs);
+    d_system_vec_arrays = owner.d_system_vec_arrays;
+    d_owns_system_vec_arrays = false;
+    return;
+}
+
+void
+FEDataInterpolation::releaseSystemVectorArrays()
+{
+    TBOX_ASSERT(!d_owns_system_vec_arrays);
+    d_system_vec_arrays.clear();
+    return;
+}
+
+void
+FEDataInterpolation::restoreSystemVectorArrays()
+{
+    TBOX_ASSERT(d_owns_system_vec_arrays || d_system_vec_arrays.empty());
+    for (size_t system_idx = 0; system_idx < d_system_vec_arrays.size(); ++system_idx)
+    {
+        static_cast<PetscVector<double>*>(d_system_vecs[system_idx])->restore_array();
     }
+    d_system_vec_arrays.clear();
+    d_owns_system_vec_arrays = false;
     return;
 }
 
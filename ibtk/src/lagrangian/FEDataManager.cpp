@@ -224,6 +224,26 @@ get_JxW(quadrature_key_type key,
     }
 }
 
+/*
+ * Return the number of values in the local form of a vector, including ghost
+ * values (if any): i.e., the number of values accessible through the array
+ * returned by PetscVector::get_array_read().
+ */
+std::size_t
+get_local_form_size(PetscVector<double>& vec)
+{
+    if (vec.type() != GHOSTED) return vec.local_size();
+    Vec local_form = nullptr;
+    PetscInt local_form_size = 0;
+    int ierr = VecGhostGetLocalForm(vec.vec(), &local_form);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetSize(local_form, &local_form_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(vec.vec(), &local_form);
+    IBTK_CHKERRQ(ierr);
+    return static_cast<std::size_t>(local_form_size);
+}
+
 #if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
 // libMesh's box intersection code is slow and not in a header (i.e., cannot be
 // inlined). This is problematic for us since we presently call this function
@@ -593,6 +613,7 @@ FEDataManager::reinitElementMappings()
     d_active_elems.clear();
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
+    d_qp_geometry_cache.clear();
 
     // Reset the mappings between grid patches and active mesh
     // elements.
@@ -732,6 +753,13 @@ FEDataManager::reinitElementMappings()
     return;
 } // reinitElementMappings
 
+void
+FEDataManager::clearQuadraturePointGeometryCache()
+{
+    d_qp_geometry_cache.clear();
+    return;
+} // clearQuadraturePointGeometryCache
+
 NumericVector<double>*
 FEDataManager::getSolutionVector(const std::string& system_name) const
 {
@@ -817,6 +845,59 @@ FEDataManager::getFEData() const
     return d_fe_data;
 } // getFEData
 
+template <class Spec>
+FEDataManager::QuadraturePointGeometry*
+FEDataManager::getQuadraturePointGeometry(const Spec& spec,
+                                          PetscVector<double>& X_petsc_vec,
+                                          const double* const X_local_soln,
+                                          bool& is_current)
+{
+    is_current = false;
+    if (!d_use_qp_geometry_cache) return nullptr;
+
+    QuadraturePointGeometry& qp_geometry = d_qp_geometry_cache[std::make_tuple(spec.quad_type,
+                                                                               spec.quad_order,
+                                                                               spec.use_adaptive_quadrature,
+                                                                               spec.point_density,
+                                                                               spec.allow_rules_with_negative_weights)];
+
+    // Callers typically copy the structure positions into a scratch vector
+    // before each operation, so an unchanged object state is sufficient but
+    // not necessary for the stored data to be current: fall back to comparing
+    // the values themselves.
+    PetscObjectState X_state;
+    int ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(X_petsc_vec.vec()), &X_state);
+    IBTK_CHKERRQ(ierr);
+    const std::size_t X_local_size = get_local_form_size(X_petsc_vec);
+    if (qp_geometry.X_local_soln.size() == X_local_size)
+    {
+        is_current = (qp_geometry.X_vec == X_petsc_vec.vec() && qp_geometry.X_state == X_state) ||
+                     std::equal(X_local_soln, X_local_soln + X_local_size, qp_geometry.X_local_soln.begin());
+    }
+    qp_geometry.X_vec = X_petsc_vec.vec();
+    qp_geometry.X_state = X_state;
+    if (is_current) return &qp_geometry;
+
+    // Reset the stored data. They will be recomputed by the caller.
+    qp_geometry.X_local_soln.assign(X_local_soln, X_local_soln + X_local_size);
+    for (auto* patch_data : { &qp_geometry.X_qp, &qp_geometry.JxW_qp })
+    {
+        patch_data->resize(d_active_patch_elem_map.size());
+        for (unsigned int ln = 0; ln < d_active_patch_elem_map.size(); ++ln)
+        {
+            (*patch_data)[ln].clear();
+            (*patch_data)[ln].resize(d_active_patch_elem_map[ln].size());
+        }
+    }
+    qp_geometry.quad_keys.resize(d_active_patch_elem_map.size());
+    for (unsigned int ln = 0; ln < d_active_patch_elem_map.size(); ++ln)
+    {
+        qp_geometry.quad_keys[ln].clear();
+        qp_geometry.quad_keys[ln].resize(d_active_patch_elem_map[ln].size());
+    }
+    return &qp_geometry;
+} // getQuadraturePointGeometry
+
 /**
  * @brief Compute the product of the finite element representation of the
  * force and (optionally) a set of weights (e.g., JxW values) at all
@@ -834,9 +915,10 @@ FEDataManager::getFEData() const
  * @param[in] phi_F Values of test functions evaluated at quadrature points,
  * indexed by test function number and then quadrature point number.
  *
- * @param[in] weights Vector containing weights at quadrature points: in the
- * case of force spreading this is the standard JxW array. If
- * <code>weights_are_unity</code> is true then its values are assumed to be 1.
+ * @param[in] weights Array containing weights at the quadrature points of the
+ * current element: in the case of force spreading this is the standard JxW
+ * array. If <code>weights_are_unity</code> is true then it is not accessed and
+ * may be null.
  *
  * @param[in] F_node Values of the finite element solution (i.e., the
  * multipliers on each trial function) on the current element.
@@ -852,7 +934,7 @@ template <int n_vars, int n_basis, bool weights_are_unity = false>
 void
 sum_weighted_elem_solution_n_vars_n_basis(const int qp_offset,
                                           const std::vector<std::vector<double> >& phi_F,
-                                          const std::vector<double>& weights,
+                                          const double* const weights,
                                           const boost::multi_array<double, 2>& F_node,
                                           std::vector<double>& F_w_qp)
 {
@@ -890,7 +972,7 @@ void
 sum_weighted_elem_solution_n_vars(const int n_basis,
                                   const int qp_offset,
                                   const std::vector<std::vector<double> >& phi_F,
-                                  const std::vector<double>& weights,
+                                  const double* const weights,
                                   const boost::multi_array<double, 2>& F_node,
                                   std::vector<double>& F_w_qp)
 {
@@ -929,7 +1011,7 @@ sum_weighted_elem_solution(const int n_vars,
                            const int n_basis,
                            const int qp_offset,
                            const std::vector<std::vector<double> >& phi_F,
-                           const std::vector<double>& weights,
+                           const double* const weights,
                            const boost::multi_array<double, 2>& F_node,
                            std::vector<double>& F_w_qp)
 {
@@ -1138,11 +1220,17 @@ FEDataManager::spread(const int f_data_idx,
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
+        // Look up previously computed quadrature point geometry data.
+        bool qp_geometry_is_current = false;
+        QuadraturePointGeometry* const qp_geometry =
+            getQuadraturePointGeometry(spread_spec, *X_petsc_vec, X_local_soln, qp_geometry_is_current);
+
         // Loop over the patches to interpolate nodal values on the FE mesh to
         // the element quadrature points, then spread those values onto the
         // Eulerian grid.
         boost::multi_array<double, 2> F_node;
-        std::vector<double> F_JxW_qp, X_qp;
+        std::vector<double> F_JxW_qp, X_qp_scratch;
+        std::vector<quad_key_type> quad_keys_scratch;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1161,41 +1249,66 @@ FEDataManager::spread(const int f_data_idx,
                 const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
                 // Determining which quadrature rule should be used on which
-                // processor is surprisingly expensive, so cache the keys:
-                std::vector<quad_key_type> quad_keys(num_active_patch_elems);
+                // processor is surprisingly expensive, so cache the keys (and,
+                // if requested, keep them for subsequent calls):
+                std::vector<quad_key_type>& quad_keys =
+                    qp_geometry ? qp_geometry->quad_keys[ln][local_patch_num] : quad_keys_scratch;
+                std::vector<double>& X_qp = qp_geometry ? qp_geometry->X_qp[ln][local_patch_num] : X_qp_scratch;
+                if (!qp_geometry_is_current)
+                {
+                    quad_keys.resize(num_active_patch_elems);
 
-                // Cache interpolated positions too:
-                std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
+                    // Cache interpolated positions too:
+                    std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
 
-                // Setup vectors to store the values of F_JxW and X at the
-                // quadrature points.
-                unsigned int n_qp_patch = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-                {
-                    Elem* const elem = patch_elems[e_idx];
+                    // Setup vectors to store the values of X at the quadrature
+                    // points.
+                    unsigned int n_qp_patch = 0;
+                    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                    {
+                        Elem* const elem = patch_elems[e_idx];
 #ifndef NDEBUG
-                    TBOX_ASSERT(getPatchLevel(elem) == ln);
+                        TBOX_ASSERT(getPatchLevel(elem) == ln);
 #endif // ifndef NDEBUG
-                    const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                    const quad_key_type key = getQuadratureKey(spread_spec.quad_type,
-                                                               spread_spec.quad_order,
-                                                               spread_spec.use_adaptive_quadrature,
-                                                               spread_spec.point_density,
-                                                               spread_spec.allow_rules_with_negative_weights,
-                                                               elem,
-                                                               X_nodes[e_idx],
-                                                               patch_dx_min);
-                    quad_keys[e_idx] = key;
-                    QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
+                        const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
+                        get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
+                        const quad_key_type key = getQuadratureKey(spread_spec.quad_type,
+                                                                   spread_spec.quad_order,
+                                                                   spread_spec.use_adaptive_quadrature,
+                                                                   spread_spec.point_density,
+                                                                   spread_spec.allow_rules_with_negative_weights,
+                                                                   elem,
+                                                                   X_nodes[e_idx],
+                                                                   patch_dx_min);
+                        quad_keys[e_idx] = key;
+                        QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                        n_qp_patch += qrule.n_points();
+                    }
+                    X_qp.resize(NDIM * n_qp_patch);
+                    if (qp_geometry) qp_geometry->JxW_qp[ln][local_patch_num].resize(n_qp_patch);
+
+                    // Loop over the elements and compute the positions of the
+                    // quadrature points.
+                    int qp_offset = 0;
+                    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                    {
+                        Elem* const elem = patch_elems[e_idx];
+                        const quad_key_type& key = quad_keys[e_idx];
+                        const FEBase& X_fe = X_fe_cache(key, elem);
+                        const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+                        const unsigned int n_qp = phi_X[0].size();
+                        double* X_begin = &X_qp[NDIM * qp_offset];
+                        std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+                        sum_weighted_elem_solution</*weights_are_unity*/ true>(
+                            NDIM, phi_X.size(), qp_offset, phi_X, nullptr, X_nodes[e_idx], X_qp);
+                        qp_offset += n_qp;
+                    }
                 }
+                const std::size_t n_qp_patch = X_qp.size() / NDIM;
                 if (!n_qp_patch) continue;
                 F_JxW_qp.resize(n_vars * n_qp_patch);
-                X_qp.resize(NDIM * n_qp_patch);
 
-                // Loop over the elements and compute the values to be spread and
-                // the positions of the quadrature points.
+                // Loop over the elements and compute the values to be spread.
                 int qp_offset = 0;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
@@ -1203,29 +1316,36 @@ FEDataManager::spread(const int f_data_idx,
                     const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
                     get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
                     const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
                     const FEBase& F_fe = F_fe_cache(key, elem);
                     const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                    const unsigned int n_qp = qrule.n_points();
 
-                    // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                    // JxW depends on the element. Stored values are used in place.
+                    const double* JxW_F = nullptr;
+                    if (qp_geometry_is_current)
+                    {
+                        JxW_F = &qp_geometry->JxW_qp[ln][local_patch_num][qp_offset];
+                    }
+                    else
+                    {
+                        const std::vector<double>& JxW =
+                            get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                        TBOX_ASSERT(n_qp == JxW.size());
+                        JxW_F = JxW.data();
+                        if (qp_geometry)
+                        {
+                            std::copy(
+                                JxW.begin(), JxW.end(), qp_geometry->JxW_qp[ln][local_patch_num].begin() + qp_offset);
+                        }
+                    }
                     const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
 
-                    const unsigned int n_qp = qrule.n_points();
                     TBOX_ASSERT(n_qp == phi_F[0].size());
-                    TBOX_ASSERT(n_qp == phi_X[0].size());
-                    TBOX_ASSERT(n_qp == JxW_F.size());
                     double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-                    double* X_begin = &X_qp[NDIM * qp_offset];
                     std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
 
                     sum_weighted_elem_solution</*weights_are_unity*/ false>(
                         n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
-                    sum_weighted_elem_solution</*weights_are_unity*/ true>(
-                        NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
                     qp_offset += n_qp;
                 }
 
@@ -1568,8 +1688,8 @@ FEDataManager::prolongData(const int f_data_idx,
  * @param[in] phi_F Values of test functions evaluated at quadrature points,
  * indexed by test function number and then quadrature point number.
  *
- * @param[in] JxW_F Products of Jacobian and quadrature weight at each
- * quadrature point.
+ * @param[in] JxW_F Array containing products of Jacobian and quadrature
+ * weight at each quadrature point of the current element.
  *
  * @param[in] F_qp Globally indexed array containing function values at
  * quadrature points. The array is indexed by quadrature point and then by
@@ -1586,7 +1706,7 @@ template <int n_vars, int n_basis>
 void
 integrate_elem_rhs_n_vars_n_basis(const int qp_offset,
                                   const std::vector<std::vector<double> >& phi_F,
-                                  const std::vector<double>& JxW_F,
+                                  const double* const JxW_F,
                                   const std::vector<double>& F_qp,
                                   std::vector<double>& F_rhs_concatenated)
 {
@@ -1626,7 +1746,7 @@ void
 integrate_elem_rhs_n_vars(const int n_basis,
                           const int qp_offset,
                           const std::vector<std::vector<double> >& phi_F,
-                          const std::vector<double>& JxW_F,
+                          const double* const JxW_F,
                           const std::vector<double>& F_qp,
                           std::vector<double>& F_rhs_concatenated)
 {
@@ -1662,7 +1782,7 @@ integrate_elem_rhs(const int n_vars,
                    const int n_basis,
                    const int qp_offset,
                    const std::vector<std::vector<double> >& phi_F,
-                   const std::vector<double>& JxW_F,
+                   const double* const JxW_F,
                    const std::vector<double>& F_qp,
                    std::vector<double>& F_rhs_concatenated)
 {
@@ -1933,8 +2053,14 @@ FEDataManager::interpWeighted(const int f_data_idx,
         DenseVector<double> F_rhs;
         // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
         std::vector<double> F_rhs_concatenated;
-        std::vector<double> F_qp, X_qp;
+        std::vector<double> F_qp, X_qp_scratch;
+        std::vector<quad_key_type> quad_keys_scratch;
         std::vector<libMesh::dof_id_type> dof_id_scratch;
+
+        // Look up previously computed quadrature point geometry data.
+        bool qp_geometry_is_current = false;
+        QuadraturePointGeometry* const qp_geometry =
+            getQuadraturePointGeometry(interp_spec, *X_petsc_vec, X_local_soln, qp_geometry_is_current);
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1952,58 +2078,68 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
                 // Determining which quadrature rule should be used on which
-                // processor is surprisingly expensive, so cache the keys:
-                std::vector<quad_key_type> quad_keys(num_active_patch_elems);
+                // processor is surprisingly expensive, so cache the keys (and,
+                // if requested, keep them for subsequent calls):
+                std::vector<quad_key_type>& quad_keys =
+                    qp_geometry ? qp_geometry->quad_keys[ln][local_patch_num] : quad_keys_scratch;
+                std::vector<double>& X_qp = qp_geometry ? qp_geometry->X_qp[ln][local_patch_num] : X_qp_scratch;
+                if (!qp_geometry_is_current)
+                {
+                    quad_keys.resize(num_active_patch_elems);
 
-                // Cache interpolated positions too:
-                std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
+                    // Cache interpolated positions too:
+                    std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
 
-                // Setup vectors to store the values of F and X at the quadrature
-                // points.
-                unsigned int n_qp_patch = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-                {
-                    Elem* const elem = patch_elems[e_idx];
-                    const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                    const quad_key_type key = getQuadratureKey(interp_spec.quad_type,
-                                                               interp_spec.quad_order,
-                                                               interp_spec.use_adaptive_quadrature,
-                                                               interp_spec.point_density,
-                                                               interp_spec.allow_rules_with_negative_weights,
-                                                               elem,
-                                                               X_nodes[e_idx],
-                                                               patch_dx_min);
-                    QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
-                    quad_keys[e_idx] = key;
+                    // Setup vectors to store the values of X at the quadrature
+                    // points.
+                    unsigned int n_qp_patch = 0;
+                    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                    {
+                        Elem* const elem = patch_elems[e_idx];
+                        const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
+                        get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
+                        const quad_key_type key = getQuadratureKey(interp_spec.quad_type,
+                                                                   interp_spec.quad_order,
+                                                                   interp_spec.use_adaptive_quadrature,
+                                                                   interp_spec.point_density,
+                                                                   interp_spec.allow_rules_with_negative_weights,
+                                                                   elem,
+                                                                   X_nodes[e_idx],
+                                                                   patch_dx_min);
+                        QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                        n_qp_patch += qrule.n_points();
+                        quad_keys[e_idx] = key;
+                    }
+                    X_qp.resize(NDIM * n_qp_patch);
+                    if (qp_geometry) qp_geometry->JxW_qp[ln][local_patch_num].resize(n_qp_patch);
+
+                    // Loop over the elements and compute the positions of the
+                    // quadrature points.
+                    int qp_offset = 0;
+                    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                    {
+                        Elem* const elem = patch_elems[e_idx];
+                        TBOX_ASSERT(elem->active());
+                        const quad_key_type& key = quad_keys[e_idx];
+                        const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                        const FEBase& X_fe = X_fe_cache(key, elem);
+                        const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+
+                        const unsigned int n_node = elem->n_nodes();
+                        const unsigned int n_qp = qrule.n_points();
+                        TBOX_ASSERT(n_qp == phi_X[0].size());
+                        double* X_begin = &X_qp[NDIM * qp_offset];
+                        std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+                        sum_weighted_elem_solution<true>(
+                            NDIM, n_node, qp_offset, phi_X, nullptr, X_nodes[e_idx], X_qp);
+                        qp_offset += n_qp;
+                    }
                 }
+                const std::size_t n_qp_patch = X_qp.size() / NDIM;
                 if (!n_qp_patch) continue;
                 F_qp.resize(n_vars * n_qp_patch);
-                X_qp.resize(NDIM * n_qp_patch);
                 std::fill(F_qp.begin(), F_qp.end(), 0.0);
 
-                // Loop over the elements and compute the positions of the
-                // quadrature points.
-                int qp_offset = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-                {
-                    Elem* const elem = patch_elems[e_idx];
-                    TBOX_ASSERT(elem->active());
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
-                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                    const unsigned int n_node = elem->n_nodes();
-                    const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_X[0].size());
-                    double* X_begin = &X_qp[NDIM * qp_offset];
-                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-                    sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
-                }
-
                 // Interpolate values from the Cartesian grid patch to the
                 // quadrature points.
                 //
@@ -2025,7 +2161,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 }
 
                 // Loop over the elements and accumulate the right-hand-side values.
-                qp_offset = 0;
+                int qp_offset = 0;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
                     Elem* const elem = patch_elems[e_idx];
@@ -2042,15 +2178,29 @@ FEDataManager::interpWeighted(const int f_data_idx,
                     const quad_key_type& key = quad_keys[e_idx];
                     const FEBase& F_fe = F_fe_cache(key, elem);
                     const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                    const unsigned int n_qp = qrule.n_points();
 
-                    // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                    // JxW depends on the element. Stored values are used in place.
+                    const double* JxW_F = nullptr;
+                    if (qp_geometry_is_current)
+                    {
+                        JxW_F = &qp_geometry->JxW_qp[ln][local_patch_num][qp_offset];
+                    }
+                    else
+                    {
+                        const std::vector<double>& JxW =
+                            get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                        TBOX_ASSERT(n_qp == JxW.size());
+                        JxW_F = JxW.data();
+                        if (qp_geometry)
+                        {
+                            std::copy(
+                                JxW.begin(), JxW.end(), qp_geometry->JxW_qp[ln][local_patch_num].begin() + qp_offset);
+                        }
+                    }
                     const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
 
-                    const unsigned int n_qp = qrule.n_points();
                     TBOX_ASSERT(n_qp == phi_F[0].size());
-                    TBOX_ASSERT(n_qp == JxW_F.size());
                     const size_t n_basis = F_dof_indices[0].size();
                     integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
 
@@ -2872,6 +3022,7 @@ FEDataManager::FEDataManager(std::string object_name,
         TBOX_ERROR("unrecognized value " << input_db->getString("node_outside_patch_check")
                                          << "for input entry 'node_outside_patch_check'.");
     }
+    d_use_qp_geometry_cache = input_db->getBoolWithDefault("use_quadrature_point_geometry_cache", false);
 
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -865,6 +865,16 @@ LDataManager::registerLSiloDataWriter(Pointer<LSiloDataWriter> silo_writer)
     return;
 } // registerLSiloDataWriter
 
+void
+LDataManager::registerLHDF5DataWriter(Pointer<LHDF5DataWriter> hdf5_writer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hdf5_writer);
+#endif
+    d_hdf5_writer = hdf5_writer;
+    return;
+} // registerLHDF5DataWriter
+
 void
 LDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_idx)
 {
@@ -1528,6 +1538,9 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 #endif
 
+    // Cached interaction weights refer to the old data layout.
+    LEInteractor::clearInteractionPlans();
+
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         if (d_level_contains_lag_data[level_number] && (!d_needs_synch[level_number]))
@@ -1946,12 +1959,16 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
     }
 
-    // If a Silo data writer is registered with the manager, give it access to
-    // the new application orderings.
+    // If a Silo or HDF5 data writer is registered with the manager, give it
+    // access to the new application orderings.
     if (d_silo_writer)
     {
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
+    if (d_hdf5_writer)
+    {
+        d_hdf5_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
+    }
 
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
@@ -2323,13 +2340,18 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         IBTK_CHKERRQ(ierr);
     }
 
-    // If a Silo data writer is registered with the manager, give it access to
-    // the new application ordering.
+    // If a Silo or HDF5 data writer is registered with the manager, give it
+    // access to the new application ordering.
     if (d_silo_writer && d_level_contains_lag_data[level_number])
     {
         d_silo_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME], level_number);
         d_silo_writer->registerLagrangianAO(d_ao[level_number], level_number);
     }
+    if (d_hdf5_writer && d_level_contains_lag_data[level_number])
+    {
+        d_hdf5_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME], level_number);
+        d_hdf5_writer->registerLagrangianAO(d_ao[level_number], level_number);
+    }
 
     IBTK_TIMER_STOP(t_initialize_level_data);
     return;
@@ -2368,6 +2390,18 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
         }
     }
 
+    // Reset the HDF5 data writer.
+    if (d_hdf5_writer)
+    {
+        d_hdf5_writer->setPatchHierarchy(hierarchy);
+        d_hdf5_writer->resetLevels(d_coarsest_ln, d_finest_ln);
+        for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+        {
+            if (!d_level_contains_lag_data[level_number]) continue;
+            d_hdf5_writer->registerCoordsData(d_lag_mesh_data[level_number][POSN_DATA_NAME], level_number);
+        }
+    }
+
     // If we have added or removed a level, resize the schedule vectors.
     d_lag_node_index_bdry_fill_scheds.resize(finest_hier_level + 1);
     d_node_count_coarsen_scheds.resize(finest_hier_level + 1);
@@ -49,8 +49,11 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <map>
+#include <numeric>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 // FORTRAN ROUTINES
@@ -1312,6 +1315,330 @@ spread_data(const int stencil_sz,
 #endif
 } // spread_data
 
+// Kernel descriptions used by the specialized tensor-product interpolation
+// routines below. Each kernel provides its stencil width, the offset of the
+// stencil (relative to the lower index of the patch) for a given normalized
+// position X_o_dx = (X - x_lower)/dx, and the corresponding 1D weights. These
+// are identical to the computations done in the Fortran kernels.
+struct IB4Kernel
+{
+    static constexpr int width = 4;
+
+    static inline int stencil_offset(const double X_o_dx)
+    {
+        return NINT(X_o_dx) - 2;
+    }
+
+    static inline void weights(const double X_o_dx, const int offset, double* const w)
+    {
+        const double r = X_o_dx - ((offset + 1) + 0.5);
+        const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+        w[0] = 0.125 * (3.0 - 2.0 * r - q);
+        w[1] = 0.125 * (3.0 - 2.0 * r + q);
+        w[2] = 0.125 * (1.0 + 2.0 * r + q);
+        w[3] = 0.125 * (1.0 + 2.0 * r - q);
+    }
+};
+
+struct IB6Kernel
+{
+    static constexpr int width = 6;
+
+    static inline int stencil_offset(const double X_o_dx)
+    {
+        return NINT(X_o_dx) - 3;
+    }
+
+    static inline void weights(const double X_o_dx, const int offset, double* const w)
+    {
+        static const double K = (59.0 / 60.0) * (1.0 - std::sqrt(1.0 - (3220.0 / 3481.0)));
+        const double r = 1.0 - X_o_dx + ((offset + 2) + 0.5);
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double r4 = r2 * r2;
+        const double r6 = r3 * r3;
+        const double alpha = 28.0;
+        const double beta = (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+        const double gamma = 0.25 * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * 0.5 * r2 +
+                                     (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r4 + (5.0 / 18.0) * r6);
+        const double discr = beta * beta - 4.0 * alpha * gamma;
+        const double pm3 = (-beta + std::copysign(1.0, (3.0 / 2.0) - K) * std::sqrt(discr)) / (2.0 * alpha);
+        w[0] = pm3;
+        w[1] = -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r + (1.0 / 12.0) * r3;
+        w[2] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+        w[3] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+        w[4] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+        w[5] = pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+    }
+};
+
+struct BSpline3Kernel
+{
+    static constexpr int width = 3;
+
+    static inline int stencil_offset(const double X_o_dx)
+    {
+        return static_cast<int>(std::floor(X_o_dx)) - 1;
+    }
+
+    static inline void weights(const double X_o_dx, const int offset, double* const w)
+    {
+        for (int k = 0; k < width; ++k)
+        {
+            const double modx = std::abs(X_o_dx - ((offset + k) + 0.5));
+            const double r = modx + 1.5;
+            const double r2 = r * r;
+            if (modx <= 0.5)
+                w[k] = 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+            else if (modx <= 1.5)
+                w[k] = 0.5 * (r2 - 6.0 * r + 9.0);
+            else
+                w[k] = 0.0;
+        }
+    }
+};
+
+// Number of markers for which weights are computed simultaneously.
+constexpr int INTERP_BATCH_SIZE = 8;
+
+// The 1D kernel weights and stencil offsets of a list of markers. The entries
+// for marker l are stored at l * NDIM + d (and (l * NDIM + d) * width + k for
+// the weights). The normalized positions X_o_dx = (X - x_lower)/dx that
+// determine the weights are retained so that the weights can be reused as
+// long as the markers have not moved.
+struct InteractionPlan
+{
+    std::vector<double> X_o_dx;
+    std::vector<int> offset;
+    std::vector<double> w;
+};
+
+/*!
+ * Compute (or update) the kernel weights for the markers specified by indices.
+ * The weights are computed for batches of markers in structure-of-arrays form
+ * so that the kernel evaluations can be vectorized. Batches in which no marker
+ * has moved since the plan was last updated are skipped.
+ */
+template <class Kernel>
+void
+compute_weights(InteractionPlan& plan,
+                const double* const X,
+                const double* const x_lower,
+                const double* const dx,
+                const int* const indices,
+                const double* const X_shift,
+                const int nindices)
+{
+    constexpr int W = Kernel::width;
+    const bool reuse =
+        static_cast<int>(plan.X_o_dx.size()) == NDIM * nindices && static_cast<int>(plan.w.size()) == NDIM * W * nindices;
+    plan.X_o_dx.resize(NDIM * nindices);
+    plan.offset.resize(NDIM * nindices);
+    plan.w.resize(NDIM * W * nindices);
+
+    double X_o_dx[NDIM][INTERP_BATCH_SIZE];
+    int offset[NDIM][INTERP_BATCH_SIZE];
+    double w[NDIM][INTERP_BATCH_SIZE][W];
+    for (int l_start = 0; l_start < nindices; l_start += INTERP_BATCH_SIZE)
+    {
+        const int batch_size = std::min(INTERP_BATCH_SIZE, nindices - l_start);
+        bool unchanged = reuse;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            for (int b = 0; b < batch_size; ++b)
+            {
+                const int l = l_start + b;
+                X_o_dx[d][b] = (X[d + indices[l] * NDIM] + X_shift[d + l * NDIM] - x_lower[d]) / dx[d];
+                unchanged = unchanged && X_o_dx[d][b] == plan.X_o_dx[l * NDIM + d];
+            }
+        }
+        if (unchanged) continue;
+
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            for (int b = 0; b < batch_size; ++b)
+            {
+                offset[d][b] = Kernel::stencil_offset(X_o_dx[d][b]);
+            }
+            for (int b = 0; b < batch_size; ++b)
+            {
+                Kernel::weights(X_o_dx[d][b], offset[d][b], w[d][b]);
+            }
+        }
+
+        for (int b = 0; b < batch_size; ++b)
+        {
+            const int l = l_start + b;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                plan.X_o_dx[l * NDIM + d] = X_o_dx[d][b];
+                plan.offset[l * NDIM + d] = offset[d][b];
+                std::copy(w[d][b], w[d][b] + W, &plan.w[(l * NDIM + d) * W]);
+            }
+        }
+    }
+    return;
+} // compute_weights
+
+/*!
+ * Loop over the tensor-product stencil of a marker, calling fcn(w, idx) for
+ * each grid value within the ghost box, in which w is the product of the 1D
+ * weights (each of which is first scaled by the corresponding entry of scale)
+ * and idx is the offset of the grid value from the start of the ghost box.
+ * The loop bounds are known at compile time for markers away from the edges
+ * of the ghost box.
+ */
+template <int W, class Fcn>
+inline void
+loop_over_stencil(const int* const ic_lower,
+                  const double* const w,
+                  const double wscale,
+                  const IntVector<NDIM>& ig_lower,
+                  const IntVector<NDIM>& ig_upper,
+                  const std::array<int, NDIM + 1>& stride,
+                  Fcn fcn)
+{
+    int istart[NDIM], istop[NDIM];
+    bool interior = true;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        istart[d] = std::max(ig_lower(d) - ic_lower[d], 0);
+        istop[d] = (W - 1) - std::max(ic_lower[d] + (W - 1) - ig_upper(d), 0);
+        interior = interior && istart[d] == 0 && istop[d] == W - 1;
+    }
+    if (interior)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            istart[d] = 0;
+            istop[d] = W - 1;
+        }
+    }
+    const double* const w0 = w;
+    const double* const w1 = w + W;
+    const int idx0 = ic_lower[0] - ig_lower(0);
+#if (NDIM == 3)
+    const double* const w2 = w + 2 * W;
+    for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+    {
+        const double wz = w2[i2] * wscale;
+        const int idx2 = (ic_lower[2] + i2 - ig_lower(2)) * stride[2];
+#endif
+        for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+        {
+#if (NDIM == 2)
+            const double wy = w1[i1] * wscale;
+            const int idx1 = (ic_lower[1] + i1 - ig_lower(1)) * stride[1];
+#elif (NDIM == 3)
+        const double wy = w1[i1] * wz;
+        const int idx1 = idx2 + (ic_lower[1] + i1 - ig_lower(1)) * stride[1];
+#endif
+            if (interior)
+            {
+                for (int i0 = 0; i0 < W; ++i0) fcn(w0[i0] * wy, idx1 + idx0 + i0);
+            }
+            else
+            {
+                for (int i0 = istart[0]; i0 <= istop[0]; ++i0) fcn(w0[i0] * wy, idx1 + idx0 + i0);
+            }
+        }
+#if (NDIM == 3)
+    }
+#endif
+    return;
+} // loop_over_stencil
+
+/*!
+ * Interpolate the Fortran-ordered (i.e., SAMRAI ArrayData) values u onto the
+ * markers specified by indices using the weights stored in plan.
+ */
+template <int W>
+void
+interpolate_tensor_product(double* const V,
+                           const InteractionPlan& plan,
+                           const double* const u,
+                           const Box<NDIM>& u_box,
+                           const IntVector<NDIM>& u_gcw,
+                           const int depth,
+                           const int* const indices,
+                           const int nindices)
+{
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(u_box, u_gcw);
+    const IntVector<NDIM>& ilower = u_box.lower();
+    std::array<int, NDIM + 1> stride;
+    stride[0] = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) stride[d + 1] = stride[d] * ghost_box.numberCells(d);
+
+    for (int l = 0; l < nindices; ++l)
+    {
+        const int s = indices[l];
+        int ic_lower[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d) ic_lower[d] = plan.offset[l * NDIM + d] + ilower(d);
+        for (int k = 0; k < depth; ++k)
+        {
+            const double* const u_k = u + k * stride[NDIM];
+            double V_k = 0.0;
+            loop_over_stencil<W>(ic_lower,
+                                 &plan.w[l * NDIM * W],
+                                 1.0,
+                                 ghost_box.lower(),
+                                 ghost_box.upper(),
+                                 stride,
+                                 [&](const double w, const int idx) { V_k += w * u_k[idx]; });
+            V[k + s * depth] = V_k;
+        }
+    }
+    return;
+} // interpolate_tensor_product
+
+/*!
+ * Spread the values V from the markers specified by indices[l_begin, l_end)
+ * onto the Fortran-ordered (i.e., SAMRAI ArrayData) values u using the weights
+ * stored in plan.
+ */
+template <int W>
+void
+spread_tensor_product(double* const u,
+                      const InteractionPlan& plan,
+                      const Box<NDIM>& u_box,
+                      const IntVector<NDIM>& u_gcw,
+                      const int depth,
+                      const double* const V,
+                      const double* const dx,
+                      const int* const indices,
+                      const int l_begin,
+                      const int l_end)
+{
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(u_box, u_gcw);
+    const IntVector<NDIM>& ilower = u_box.lower();
+    std::array<int, NDIM + 1> stride;
+    stride[0] = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) stride[d + 1] = stride[d] * ghost_box.numberCells(d);
+    double wscale = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) wscale *= dx[d];
+    wscale = 1.0 / wscale;
+
+    for (int l = l_begin; l < l_end; ++l)
+    {
+        const int s = indices[l];
+        int ic_lower[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d) ic_lower[d] = plan.offset[l * NDIM + d] + ilower(d);
+        for (int k = 0; k < depth; ++k)
+        {
+            double* const u_k = u + k * stride[NDIM];
+            const double V_k = V[k + s * depth];
+            loop_over_stencil<W>(ic_lower,
+                                 &plan.w[l * NDIM * W],
+                                 wscale,
+                                 ghost_box.lower(),
+                                 ghost_box.upper(),
+                                 stride,
+                                 [&](const double w, const int idx) { u_k[idx] += w * V_k; });
+        }
+    }
+    return;
+} // spread_tensor_product
+
 // For internal use - convert to an enumeration. This may make it into the
 // public interface one day but for backwards compatibility we accept only
 // strings for now.
@@ -1410,15 +1737,158 @@ string_to_kernel(const std::string& kernel_fcn)
     TBOX_ERROR("Unknown kernel function " << kernel_fcn << std::endl);
     return INVALID;
 }
+
+// Whether or not the specified kernel has a specialized C++ implementation.
+inline bool
+is_tensor_product_kernel(const KernelType kernel)
+{
+    return kernel == IB_4 || kernel == IB_6 || kernel == BSPLINE_3;
+}
+
+// Key identifying a cached interaction plan: the owner-supplied handle and
+// version of the marker positions, the kernel, whether or not the markers are
+// sorted into bins (see LEInteractor::spreadThreaded()), and the index box of
+// the patch data (which differs between the components of side-centered data).
+struct InteractionPlanKey
+{
+    int handle;
+    unsigned int version;
+    KernelType kernel;
+    bool binned;
+    std::array<int, 2 * NDIM> box;
+
+    bool operator<(const InteractionPlanKey& that) const
+    {
+        return std::tie(handle, version, kernel, binned, box) <
+               std::tie(that.handle, that.version, that.kernel, that.binned, that.box);
+    }
+};
+
+// Maximum number of cached plans. Since plans are only cached while an owner
+// has set a handle, and those of older versions of a handle are discarded,
+// this limit is only reached if the owners of the handles never update their
+// versions; in that case all cached plans are freed.
+constexpr std::size_t MAX_NUM_INTERACTION_PLANS = 4096;
+
+std::map<InteractionPlanKey, InteractionPlan> interaction_plans;
+
+// The number of handles that have been handed out and the currently active
+// handle (or -1 if plans should not be cached) and its version.
+int num_interaction_plan_handles = 0;
+int active_interaction_plan_handle = -1;
+unsigned int active_interaction_plan_version = 0;
+
+// Get the interaction plan to use for the specified data: either the cached
+// plan (when caching is enabled and a handle is active) or the provided
+// scratch plan. The weights of the returned plan are brought up to date with
+// the current marker positions, so that a cached plan is always valid, even
+// if its owner modified the positions without updating the version.
+InteractionPlan&
+get_interaction_plan(InteractionPlan& scratch_plan,
+                     const bool use_cached_plan,
+                     const bool binned,
+                     const KernelType kernel,
+                     const double* const X,
+                     const Box<NDIM>& q_data_box,
+                     const double* const x_lower,
+                     const double* const dx,
+                     const int* const indices,
+                     const double* const X_shift,
+                     const int nindices)
+{
+    InteractionPlan* plan = &scratch_plan;
+    if (use_cached_plan && active_interaction_plan_handle >= 0)
+    {
+        InteractionPlanKey key;
+        key.handle = active_interaction_plan_handle;
+        key.version = active_interaction_plan_version;
+        key.kernel = kernel;
+        key.binned = binned;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            key.box[d] = q_data_box.lower()(d);
+            key.box[NDIM + d] = q_data_box.upper()(d);
+        }
+        auto it = interaction_plans.find(key);
+        if (it == interaction_plans.end())
+        {
+            if (interaction_plans.size() >= MAX_NUM_INTERACTION_PLANS) interaction_plans.clear();
+            it = interaction_plans.emplace(key, InteractionPlan()).first;
+        }
+        plan = &it->second;
+    }
+    switch (kernel)
+    {
+    case IB_4:
+        compute_weights<IB4Kernel>(*plan, X, x_lower, dx, indices, X_shift, nindices);
+        break;
+    case IB_6:
+        compute_weights<IB6Kernel>(*plan, X, x_lower, dx, indices, X_shift, nindices);
+        break;
+    case BSPLINE_3:
+        compute_weights<BSpline3Kernel>(*plan, X, x_lower, dx, indices, X_shift, nindices);
+        break;
+    default:
+        TBOX_ERROR("LEInteractor: no specialized implementation for kernel function " << kernel << std::endl);
+    }
+    return *plan;
+} // get_interaction_plan
+
+// Spread the values of the markers indices[l_begin, l_end) using the weights
+// stored in plan.
+void
+spread_with_plan(const KernelType kernel,
+                 double* const u,
+                 const InteractionPlan& plan,
+                 const Box<NDIM>& u_box,
+                 const IntVector<NDIM>& u_gcw,
+                 const int depth,
+                 const double* const V,
+                 const double* const dx,
+                 const int* const indices,
+                 const int l_begin,
+                 const int l_end)
+{
+    switch (kernel)
+    {
+    case IB_4:
+        spread_tensor_product<IB4Kernel::width>(u, plan, u_box, u_gcw, depth, V, dx, indices, l_begin, l_end);
+        break;
+    case IB_6:
+        spread_tensor_product<IB6Kernel::width>(u, plan, u_box, u_gcw, depth, V, dx, indices, l_begin, l_end);
+        break;
+    case BSPLINE_3:
+        spread_tensor_product<BSpline3Kernel::width>(u, plan, u_box, u_gcw, depth, V, dx, indices, l_begin, l_end);
+        break;
+    default:
+        TBOX_ERROR("LEInteractor: no specialized implementation for kernel function " << kernel << std::endl);
+    }
+    return;
+} // spread_with_plan
 } // namespace
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+bool LEInteractor::s_use_threaded_spreading = false;
+bool LEInteractor::s_use_specialized_interpolation = false;
+bool LEInteractor::s_use_interaction_plans = false;
 
 void
-LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("use_threaded_spreading")) s_use_threaded_spreading = db->getBool("use_threaded_spreading");
+    if (db->keyExists("use_specialized_interpolation"))
+        s_use_specialized_interpolation = db->getBool("use_specialized_interpolation");
+    if (db->keyExists("use_interaction_plans")) s_use_interaction_plans = db->getBool("use_interaction_plans");
+#if !defined(IBTK_HAVE_OPENMP)
+    if (s_use_threaded_spreading)
+    {
+        TBOX_WARNING("LEInteractor::setFromDatabase():\n"
+                     << "  use_threaded_spreading = TRUE but IBAMR was configured without OpenMP.\n"
+                     << "  The colored bins of markers will be spread by a single thread." << std::endl);
+    }
+#endif
     return;
 }
 
@@ -1426,6 +1896,48 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_use_threaded_spreading = " << s_use_threaded_spreading << "\n";
+    os << "  s_use_specialized_interpolation = " << s_use_specialized_interpolation << "\n";
+    os << "  s_use_interaction_plans = " << s_use_interaction_plans << "\n";
+    return;
+}
+
+int
+LEInteractor::getNewInteractionPlanHandle()
+{
+    return num_interaction_plan_handles++;
+}
+
+void
+LEInteractor::setInteractionPlanHandle(const int handle, const unsigned int version)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= handle && handle < num_interaction_plan_handles);
+#endif
+    // Discard the plans of older versions of this handle.
+    for (auto it = interaction_plans.begin(); it != interaction_plans.end();)
+    {
+        if (it->first.handle == handle && it->first.version != version)
+            it = interaction_plans.erase(it);
+        else
+            ++it;
+    }
+    active_interaction_plan_handle = handle;
+    active_interaction_plan_version = version;
+    return;
+}
+
+void
+LEInteractor::unsetInteractionPlanHandle()
+{
+    active_interaction_plan_handle = -1;
+    return;
+}
+
+void
+LEInteractor::clearInteractionPlans()
+{
+    interaction_plans.clear();
     return;
 }
 
@@ -3841,9 +4353,43 @@ LEInteractor::interpolate(double* const Q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    const KernelType kernel = string_to_kernel(interp_fcn);
+    if ((s_use_specialized_interpolation || s_use_interaction_plans) && is_tensor_product_kernel(kernel))
+    {
+        InteractionPlan scratch_plan;
+        const InteractionPlan& plan = get_interaction_plan(scratch_plan,
+                                                           s_use_interaction_plans,
+                                                           /*binned*/ false,
+                                                           kernel,
+                                                           X_data,
+                                                           q_data_box,
+                                                           x_lower,
+                                                           dx,
+                                                           &local_indices[0],
+                                                           &periodic_shifts[0],
+                                                           local_indices_size);
+        switch (kernel)
+        {
+        case IB_4:
+            interpolate_tensor_product<IB4Kernel::width>(
+                Q_data, plan, q_data, q_data_box, q_gcw, q_depth, &local_indices[0], local_indices_size);
+            break;
+        case IB_6:
+            interpolate_tensor_product<IB6Kernel::width>(
+                Q_data, plan, q_data, q_data_box, q_gcw, q_depth, &local_indices[0], local_indices_size);
+            break;
+        case BSPLINE_3:
+            interpolate_tensor_product<BSpline3Kernel::width>(
+                Q_data, plan, q_data, q_data_box, q_gcw, q_depth, &local_indices[0], local_indices_size);
+            break;
+        default:
+            TBOX_ERROR("LEInteractor::interpolate(): unreachable code\n");
+        }
+        return;
+    }
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    switch (string_to_kernel(interp_fcn))
+    switch (kernel)
     {
     case PIECEWISE_CONSTANT:
     {
@@ -4337,6 +4883,78 @@ LEInteractor::spread(double* const q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    const KernelType kernel = string_to_kernel(spread_fcn);
+    if (s_use_threaded_spreading)
+    {
+        spreadThreaded(q_data,
+                       q_data_box,
+                       q_gcw,
+                       q_depth,
+                       Q_data,
+                       Q_depth,
+                       X_data,
+                       x_lower,
+                       x_upper,
+                       dx,
+                       local_indices,
+                       periodic_shifts,
+                       spread_fcn,
+                       axis);
+        return;
+    }
+    if (s_use_interaction_plans && is_tensor_product_kernel(kernel))
+    {
+        InteractionPlan scratch_plan;
+        const InteractionPlan& plan = get_interaction_plan(scratch_plan,
+                                                           s_use_interaction_plans,
+                                                           /*binned*/ false,
+                                                           kernel,
+                                                           X_data,
+                                                           q_data_box,
+                                                           x_lower,
+                                                           dx,
+                                                           &local_indices[0],
+                                                           &periodic_shifts[0],
+                                                           local_indices_size);
+        spread_with_plan(
+            kernel, q_data, plan, q_data_box, q_gcw, q_depth, Q_data, dx, &local_indices[0], 0, local_indices_size);
+        return;
+    }
+    spreadKernel(q_data,
+                 q_data_box,
+                 q_gcw,
+                 q_depth,
+                 Q_data,
+                 Q_depth,
+                 X_data,
+                 x_lower,
+                 x_upper,
+                 dx,
+                 &local_indices[0],
+                 &periodic_shifts[0],
+                 local_indices_size,
+                 spread_fcn,
+                 axis);
+    return;
+}
+
+void
+LEInteractor::spreadKernel(double* const q_data,
+                           const Box<NDIM>& q_data_box,
+                           const IntVector<NDIM>& q_gcw,
+                           const int q_depth,
+                           const double* const Q_data,
+                           const int Q_depth,
+                           const double* const X_data,
+                           const double* const x_lower,
+                           const double* const x_upper,
+                           const double* const dx,
+                           const int* const local_indices,
+                           const double* const periodic_shifts,
+                           const int num_local_indices,
+                           const std::string& spread_fcn,
+                           const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
     switch (string_to_kernel(spread_fcn))
@@ -4347,9 +4965,9 @@ LEInteractor::spread(double* const q_data,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
+                                                local_indices,
+                                                periodic_shifts,
+                                                num_local_indices,
                                                 X_data,
                                                 Q_data,
 #if (NDIM == 2)
@@ -4381,9 +4999,9 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
-                                                  local_indices_size,
+                                                  local_indices,
+                                                  periodic_shifts,
+                                                  num_local_indices,
                                                   X_data,
                                                   Q_data,
 #if (NDIM == 2)
@@ -4414,9 +5032,9 @@ LEInteractor::spread(double* const q_data,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
+                                              local_indices,
+                                              periodic_shifts,
+                                              num_local_indices,
                                               X_data,
                                               Q_data,
 #if (NDIM == 2)
@@ -4447,9 +5065,9 @@ LEInteractor::spread(double* const q_data,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
+                                             local_indices,
+                                             periodic_shifts,
+                                             num_local_indices,
                                              X_data,
                                              Q_data,
 #if (NDIM == 2)
@@ -4480,9 +5098,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4513,9 +5131,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4546,9 +5164,9 @@ LEInteractor::spread(double* const q_data,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
+                                     local_indices,
+                                     periodic_shifts,
+                                     num_local_indices,
                                      X_data,
                                      Q_data,
 #if (NDIM == 2)
@@ -4579,9 +5197,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4612,9 +5230,9 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
+                                  local_indices,
+                                  periodic_shifts,
+                                  num_local_indices,
                                   X_data,
                                   Q_data,
 #if (NDIM == 2)
@@ -4645,9 +5263,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4678,9 +5296,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4711,9 +5329,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4744,9 +5362,9 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
+                                       local_indices,
+                                       periodic_shifts,
+                                       num_local_indices,
                                        X_data,
                                        Q_data,
 #if (NDIM == 2)
@@ -4783,21 +5401,184 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
-                          local_indices_size);
+                          local_indices,
+                          periodic_shifts,
+                          num_local_indices);
         break;
     }
     case INVALID:
     default:
     {
-        TBOX_ERROR("LEInteractor::spread()\n"
+        TBOX_ERROR("LEInteractor::spreadKernel()\n"
                    << "  Unknown spreading kernel function " << spread_fcn << std::endl);
     }
     }
     return;
 }
 
+void
+LEInteractor::spreadThreaded(double* const q_data,
+                             const Box<NDIM>& q_data_box,
+                             const IntVector<NDIM>& q_gcw,
+                             const int q_depth,
+                             const double* const Q_data,
+                             const int Q_depth,
+                             const double* const X_data,
+                             const double* const x_lower,
+                             const double* const x_upper,
+                             const double* const dx,
+                             const std::vector<int>& local_indices,
+                             const std::vector<double>& periodic_shifts,
+                             const std::string& spread_fcn,
+                             const int axis)
+{
+    // Sort the markers into bins of Cartesian grid cells. The bins are made
+    // wide enough that the kernel stencils of two markers cannot overlap
+    // whenever their bins are separated by at least one other bin along some
+    // coordinate direction. Hence, coloring the bins by the parity of their
+    // (multi-dimensional) bin index yields 2^NDIM colors, and all bins of a
+    // single color may be processed concurrently without any write conflicts.
+    //
+    // Markers that lie outside of the ghost box are assigned to the nearest
+    // bin, which is safe because their stencils then only extend further away
+    // from the other bins of the same color.
+    const int bin_width = getStencilSize(spread_fcn) + 2;
+    const Box<NDIM> ghost_box = Box<NDIM>::grow(q_data_box, q_gcw);
+    const IntVector<NDIM>& ilower = q_data_box.lower();
+    const IntVector<NDIM>& glower = ghost_box.lower();
+    std::array<int, NDIM> num_bins;
+    int total_num_bins = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_bins[d] = (ghost_box.numberCells(d) + bin_width - 1) / bin_width;
+        total_num_bins *= num_bins[d];
+    }
+
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    std::vector<int> marker_bin(num_local_indices);
+    std::vector<int> bin_offsets(total_num_bins + 1, 0);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        int bin = 0;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const int ic = static_cast<int>(std::floor((X_data[d + s * NDIM] + periodic_shifts[d + l * NDIM] -
+                                                        x_lower[d]) /
+                                                       dx[d])) +
+                           ilower(d) - glower(d);
+            const int b = std::min(std::max(ic, 0) / bin_width, num_bins[d] - 1);
+            bin = bin * num_bins[d] + b;
+        }
+        marker_bin[l] = bin;
+        ++bin_offsets[bin + 1];
+    }
+    std::partial_sum(bin_offsets.begin(), bin_offsets.end(), bin_offsets.begin());
+
+    // Reorder the local indices and periodic shifts by bin. The sort is stable
+    // so that the order in which values are accumulated (and hence the
+    // result) does not depend on the number of threads.
+    std::vector<int> binned_indices(num_local_indices);
+    std::vector<double> binned_shifts(NDIM * num_local_indices);
+    {
+        std::vector<int> bin_pos(bin_offsets.begin(), bin_offsets.end() - 1);
+        for (int l = 0; l < num_local_indices; ++l)
+        {
+            const int k = bin_pos[marker_bin[l]]++;
+            binned_indices[k] = local_indices[l];
+            std::copy(&periodic_shifts[l * NDIM], &periodic_shifts[l * NDIM] + NDIM, &binned_shifts[k * NDIM]);
+        }
+    }
+
+    // Collect the nonempty bins of each color.
+    constexpr int num_colors = 1 << NDIM;
+    std::array<std::vector<int>, num_colors> color_bins;
+    for (int bin = 0; bin < total_num_bins; ++bin)
+    {
+        if (bin_offsets[bin] == bin_offsets[bin + 1]) continue;
+        int color = 0, idx = bin;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            color |= ((idx % num_bins[d]) % 2) << d;
+            idx /= num_bins[d];
+        }
+        color_bins[color].push_back(bin);
+    }
+
+    // When interaction plans are enabled, compute (or update) the weights of
+    // the binned markers once and use them for every bin.
+    const KernelType kernel = string_to_kernel(spread_fcn);
+    InteractionPlan scratch_plan;
+    const InteractionPlan* plan = nullptr;
+    if (s_use_interaction_plans && is_tensor_product_kernel(kernel))
+    {
+        plan = &get_interaction_plan(scratch_plan,
+                                     s_use_interaction_plans,
+                                     /*binned*/ true,
+                                     kernel,
+                                     X_data,
+                                     q_data_box,
+                                     x_lower,
+                                     dx,
+                                     binned_indices.data(),
+                                     binned_shifts.data(),
+                                     num_local_indices);
+    }
+
+    // Spread one color at a time. Since the stencils of the bins of a single
+    // color are disjoint, each grid value is updated by at most one bin per
+    // color, and so the order of accumulation into each grid value (and hence
+    // the result) does not depend on which thread processes which bin.
+    //
+    // The Fortran spreading routines have no saved or common data but they do
+    // (harmlessly) assign x_upper to itself, so each thread gets its own copy.
+    for (int color = 0; color < num_colors; ++color)
+    {
+        const std::vector<int>& bins = color_bins[color];
+        const int num_color_bins = static_cast<int>(bins.size());
+#if defined(IBTK_HAVE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int k = 0; k < num_color_bins; ++k)
+        {
+            const int bin = bins[k];
+            if (plan)
+            {
+                spread_with_plan(kernel,
+                                 q_data,
+                                 *plan,
+                                 q_data_box,
+                                 q_gcw,
+                                 q_depth,
+                                 Q_data,
+                                 dx,
+                                 binned_indices.data(),
+                                 bin_offsets[bin],
+                                 bin_offsets[bin + 1]);
+                continue;
+            }
+            std::array<double, NDIM> x_upper_copy;
+            std::copy(x_upper, x_upper + NDIM, x_upper_copy.begin());
+            spreadKernel(q_data,
+                         q_data_box,
+                         q_gcw,
+                         q_depth,
+                         Q_data,
+                         Q_depth,
+                         X_data,
+                         x_lower,
+                         x_upper_copy.data(),
+                         dx,
+                         &binned_indices[bin_offsets[bin]],
+                         &binned_shifts[NDIM * bin_offsets[bin]],
+                         bin_offsets[bin + 1] - bin_offsets[bin],
+                         spread_fcn,
+                         axis);
+        }
+    }
+    return;
+}
+
 template <class T>
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
@@ -0,0 +1,1279 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/LData.h"
+#include "ibtk/LHDF5DataWriter.h"
+
+#include "PatchHierarchy.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/Utilities.h"
+
+#include "petscao.h"
+#include "petscis.h"
+#include "petscsys.h"
+#include "petscvec.h"
+
+#include <hdf5.h>
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The rank of the root MPI process.
+static const int HDF5_MPI_ROOT = 0;
+
+// The names of the HDF5 and XDMF files.
+static const int HDF5_NAME_BUFSIZE = 128;
+static const std::string VISIT_DUMPS_FILENAME = "lag_data_xdmf.visit";
+static const std::string HDF5_FILE_PREFIX = "lag_data.cycle_";
+static const std::string HDF5_FILE_POSTFIX = ".h5";
+static const std::string XDMF_FILE_POSTFIX = ".xmf";
+
+// Version of LHDF5DataWriter restart file data.
+static const int LAG_HDF5_DATA_WRITER_VERSION = 1;
+
+/*!
+ * \brief The local plot data on a single patch level, stored in the layout of
+ * the HDF5 datasets.
+ */
+struct LevelPlotData
+{
+    bool has_data = false;
+    std::vector<std::string> var_names;
+    std::vector<int> var_plot_depths;
+    std::vector<double> X;
+    std::vector<std::vector<double> > var_vals;
+    std::vector<int> connectivity;
+    hsize_t num_points = 0, num_points_total = 0, point_offset = 0;
+    hsize_t num_edges = 0, num_edges_total = 0, edge_offset = 0;
+};
+
+std::string
+get_level_group_name(const int level_number)
+{
+    return "/level_" + std::to_string(level_number);
+} // get_level_group_name
+
+/*!
+ * \brief Create a chunked two-dimensional dataset with \p nrows rows and \p
+ * ncols columns.
+ */
+void
+create_dataset(const hid_t file_id,
+               const std::string& path,
+               const hid_t type_id,
+               const hsize_t nrows,
+               const hsize_t ncols,
+               const int chunk_size,
+               const int compression_level)
+{
+    const hsize_t dims[2] = { nrows, ncols };
+    const hsize_t chunk_dims[2] = { std::min(nrows, static_cast<hsize_t>(chunk_size)), ncols };
+    hid_t space_id = H5Screate_simple(2, dims, nullptr);
+    hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcpl_id, 2, chunk_dims);
+    if (compression_level > 0) H5Pset_deflate(dcpl_id, static_cast<unsigned int>(compression_level));
+    hid_t dataset_id = H5Dcreate2(file_id, path.c_str(), type_id, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    if (dataset_id < 0)
+    {
+        TBOX_ERROR("LHDF5DataWriter::create_dataset()\n"
+                   << "  Could not create HDF5 dataset named " << path << std::endl);
+    }
+    H5Dclose(dataset_id);
+    H5Pclose(dcpl_id);
+    H5Sclose(space_id);
+    return;
+} // create_dataset
+
+/*!
+ * \brief Write rows [row_offset, row_offset + nrows) of a two-dimensional
+ * dataset.
+ *
+ * \note When HDF5 is built with MPI support, this is a collective operation,
+ * and processes without any local data must call this function with \p nrows
+ * equal to zero.
+ */
+void
+write_dataset(const hid_t file_id,
+              const std::string& path,
+              const hid_t mem_type_id,
+              const hsize_t row_offset,
+              const hsize_t nrows,
+              const hsize_t ncols,
+              const void* const buf)
+{
+    hid_t dataset_id = H5Dopen2(file_id, path.c_str(), H5P_DEFAULT);
+    if (dataset_id < 0)
+    {
+        TBOX_ERROR("LHDF5DataWriter::write_dataset()\n"
+                   << "  Could not open HDF5 dataset named " << path << std::endl);
+    }
+    hid_t file_space_id = H5Dget_space(dataset_id);
+    const hsize_t mem_dims[2] = { nrows, ncols };
+    hid_t mem_space_id = H5Screate_simple(2, mem_dims, nullptr);
+    if (nrows > 0)
+    {
+        const hsize_t start[2] = { row_offset, 0 };
+        H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start, nullptr, mem_dims, nullptr);
+    }
+    else
+    {
+        H5Sselect_none(file_space_id);
+        H5Sselect_none(mem_space_id);
+    }
+    hid_t dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+#if defined(H5_HAVE_PARALLEL)
+    H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE);
+#endif
+    if (H5Dwrite(dataset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf) < 0)
+    {
+        TBOX_ERROR("LHDF5DataWriter::write_dataset()\n"
+                   << "  Could not write HDF5 dataset named " << path << std::endl);
+    }
+    H5Pclose(dxpl_id);
+    H5Sclose(mem_space_id);
+    H5Sclose(file_space_id);
+    H5Dclose(dataset_id);
+    return;
+} // write_dataset
+
+void
+write_scalar_attribute(const hid_t file_id, const std::string& name, const hid_t type_id, const void* const value)
+{
+    hid_t space_id = H5Screate(H5S_SCALAR);
+    hid_t attr_id = H5Acreate2(file_id, name.c_str(), type_id, space_id, H5P_DEFAULT, H5P_DEFAULT);
+    H5Awrite(attr_id, type_id, value);
+    H5Aclose(attr_id);
+    H5Sclose(space_id);
+    return;
+} // write_scalar_attribute
+
+/*!
+ * \brief Create the groups, datasets, and attributes of a plot file.
+ */
+void
+create_datasets(const hid_t file_id,
+                const std::vector<LevelPlotData>& level_data,
+                const int time_step,
+                const double simulation_time,
+                const int chunk_size,
+                const int compression_level)
+{
+    write_scalar_attribute(file_id, "time", H5T_NATIVE_DOUBLE, &simulation_time);
+    write_scalar_attribute(file_id, "time_step_number", H5T_NATIVE_INT, &time_step);
+    for (unsigned int ln = 0; ln < level_data.size(); ++ln)
+    {
+        const LevelPlotData& data = level_data[ln];
+        if (!data.has_data || data.num_points_total == 0) continue;
+        const std::string group_name = get_level_group_name(ln);
+        hid_t group_id = H5Gcreate2(file_id, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        H5Gclose(group_id);
+        create_dataset(file_id,
+                       group_name + "/coordinates",
+                       H5T_IEEE_F64LE,
+                       data.num_points_total,
+                       NDIM,
+                       chunk_size,
+                       compression_level);
+        for (unsigned int v = 0; v < data.var_names.size(); ++v)
+        {
+            create_dataset(file_id,
+                           group_name + "/" + data.var_names[v],
+                           H5T_IEEE_F64LE,
+                           data.num_points_total,
+                           data.var_plot_depths[v],
+                           chunk_size,
+                           compression_level);
+        }
+        if (data.num_edges_total > 0)
+        {
+            create_dataset(file_id,
+                           group_name + "/connectivity",
+                           H5T_STD_I32LE,
+                           data.num_edges_total,
+                           2,
+                           chunk_size,
+                           compression_level);
+        }
+    }
+    return;
+} // create_datasets
+
+/*!
+ * \brief Write the local data to the datasets of a plot file.
+ */
+void
+write_datasets(const hid_t file_id, const std::vector<LevelPlotData>& level_data)
+{
+    for (unsigned int ln = 0; ln < level_data.size(); ++ln)
+    {
+        const LevelPlotData& data = level_data[ln];
+        if (!data.has_data || data.num_points_total == 0) continue;
+        const std::string group_name = get_level_group_name(ln);
+        write_dataset(file_id,
+                      group_name + "/coordinates",
+                      H5T_NATIVE_DOUBLE,
+                      data.point_offset,
+                      data.num_points,
+                      NDIM,
+                      data.X.data());
+        for (unsigned int v = 0; v < data.var_names.size(); ++v)
+        {
+            write_dataset(file_id,
+                          group_name + "/" + data.var_names[v],
+                          H5T_NATIVE_DOUBLE,
+                          data.point_offset,
+                          data.num_points,
+                          data.var_plot_depths[v],
+                          data.var_vals[v].data());
+        }
+        if (data.num_edges_total > 0)
+        {
+            write_dataset(file_id,
+                          group_name + "/connectivity",
+                          H5T_NATIVE_INT,
+                          data.edge_offset,
+                          data.num_edges,
+                          2,
+                          data.connectivity.data());
+        }
+    }
+    return;
+} // write_datasets
+
+/*!
+ * \brief Write an XDMF data item that refers to rows [offset, offset + nrows)
+ * of a two-dimensional HDF5 dataset.
+ */
+void
+write_xdmf_hyperslab(std::ostream& os,
+                     const std::string& indent,
+                     const hsize_t offset,
+                     const hsize_t nrows,
+                     const hsize_t ncols,
+                     const hsize_t nrows_total,
+                     const std::string& number_type,
+                     const int precision,
+                     const std::string& dataset)
+{
+    os << indent << "<DataItem ItemType=\"HyperSlab\" Dimensions=\"" << nrows << " " << ncols
+       << "\" Type=\"HyperSlab\">\n";
+    os << indent << "  <DataItem Dimensions=\"3 2\" Format=\"XML\">" << offset << " 0 1 1 " << nrows << " " << ncols
+       << "</DataItem>\n";
+    os << indent << "  <DataItem Dimensions=\"" << nrows_total << " " << ncols << "\" NumberType=\"" << number_type
+       << "\" Precision=\"" << precision << "\" Format=\"HDF\">" << dataset << "</DataItem>\n";
+    os << indent << "</DataItem>\n";
+    return;
+} // write_xdmf_hyperslab
+
+/*!
+ * \brief Write the XDMF grid corresponding to a single marker cloud or
+ * unstructured mesh.  Marker clouds have no edges.
+ */
+void
+write_xdmf_grid(std::ostream& os,
+                const std::string& h5_file_name,
+                const std::string& name,
+                const int level_number,
+                const LevelPlotData& data,
+                const hsize_t point_offset,
+                const hsize_t num_points,
+                const hsize_t edge_offset,
+                const hsize_t num_edges)
+{
+    const std::string group_name = h5_file_name + ":" + get_level_group_name(level_number);
+    const std::string indent = "      ";
+    os << indent << "<Grid Name=\"" << name << "\" GridType=\"Uniform\">\n";
+    if (num_edges == 0)
+    {
+        os << indent << "  <Topology TopologyType=\"Polyvertex\" NumberOfElements=\"" << num_points
+           << "\" NodesPerElement=\"1\"/>\n";
+    }
+    else
+    {
+        os << indent << "  <Topology TopologyType=\"Polyline\" NumberOfElements=\"" << num_edges
+           << "\" NodesPerElement=\"2\">\n";
+        write_xdmf_hyperslab(os,
+                             indent + "    ",
+                             edge_offset,
+                             num_edges,
+                             2,
+                             data.num_edges_total,
+                             "Int",
+                             4,
+                             group_name + "/connectivity");
+        os << indent << "  </Topology>\n";
+    }
+    os << indent << "  <Geometry GeometryType=\"" << (NDIM == 2 ? "XY" : "XYZ") << "\">\n";
+    write_xdmf_hyperslab(os,
+                         indent + "    ",
+                         point_offset,
+                         num_points,
+                         NDIM,
+                         data.num_points_total,
+                         "Float",
+                         8,
+                         group_name + "/coordinates");
+    os << indent << "  </Geometry>\n";
+    for (unsigned int v = 0; v < data.var_names.size(); ++v)
+    {
+        const int depth = data.var_plot_depths[v];
+        const std::string attribute_type = depth == 1 ? "Scalar" : (depth == NDIM ? "Vector" : "Matrix");
+        os << indent << "  <Attribute Name=\"" << data.var_names[v] << "\" AttributeType=\"" << attribute_type
+           << "\" Center=\"Node\">\n";
+        write_xdmf_hyperslab(os,
+                             indent + "    ",
+                             point_offset,
+                             num_points,
+                             depth,
+                             data.num_points_total,
+                             "Float",
+                             8,
+                             group_name + "/" + data.var_names[v]);
+        os << indent << "  </Attribute>\n";
+    }
+    os << indent << "</Grid>\n";
+    return;
+} // write_xdmf_grid
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LHDF5DataWriter::LHDF5DataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart)
+    : d_object_name(std::move(object_name)),
+      d_registered_for_restart(register_for_restart),
+      d_dump_directory_name(std::move(dump_directory_name)),
+      d_nclouds(d_finest_ln + 1, 0),
+      d_cloud_names(d_finest_ln + 1),
+      d_cloud_nmarks(d_finest_ln + 1),
+      d_cloud_first_lag_idx(d_finest_ln + 1),
+      d_nucd_meshes(d_finest_ln + 1, 0),
+      d_ucd_mesh_names(d_finest_ln + 1),
+      d_ucd_mesh_vertices(d_finest_ln + 1),
+      d_ucd_mesh_edge_maps(d_finest_ln + 1),
+      d_coords_data(d_finest_ln + 1, Pointer<LData>(nullptr)),
+      d_nvars(d_finest_ln + 1, 0),
+      d_var_names(d_finest_ln + 1),
+      d_var_start_depths(d_finest_ln + 1),
+      d_var_plot_depths(d_finest_ln + 1),
+      d_var_depths(d_finest_ln + 1),
+      d_var_data(d_finest_ln + 1),
+      d_ao(d_finest_ln + 1),
+      d_build_vec_scatters(d_finest_ln + 1),
+      d_src_vec(d_finest_ln + 1),
+      d_dst_vec(d_finest_ln + 1),
+      d_vec_scatter(d_finest_ln + 1)
+{
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->registerRestartItem(d_object_name, this);
+    }
+
+    // Initialize object with data read from the restart database.
+    const bool from_restart = RestartManager::getManager()->isFromRestart();
+    if (from_restart)
+    {
+        getFromRestart();
+    }
+    return;
+} // LHDF5DataWriter
+
+LHDF5DataWriter::~LHDF5DataWriter()
+{
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+    }
+
+    // Destroy any remaining PETSc objects.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        destroyVecScatters(ln);
+    }
+    return;
+} // ~LHDF5DataWriter
+
+void
+LHDF5DataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(hierarchy->getFinestLevelNumber() >= d_finest_ln);
+#endif
+    // Reset the hierarchy.
+    d_hierarchy = hierarchy;
+    return;
+} // setPatchHierarchy
+
+void
+LHDF5DataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
+    if (d_hierarchy)
+    {
+        TBOX_ASSERT(finest_ln <= d_hierarchy->getFinestLevelNumber());
+    }
+#endif
+    // Destroy any unneeded PETSc objects.
+    for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
+    {
+        destroyVecScatters(ln);
+    }
+    for (int ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        destroyVecScatters(ln);
+    }
+
+    // Reset the level numbers.
+    d_coarsest_ln = coarsest_ln;
+    d_finest_ln = finest_ln;
+
+    // Resize some arrays.
+    d_nclouds.resize(d_finest_ln + 1, 0);
+    d_cloud_names.resize(d_finest_ln + 1);
+    d_cloud_nmarks.resize(d_finest_ln + 1);
+    d_cloud_first_lag_idx.resize(d_finest_ln + 1);
+
+    d_nucd_meshes.resize(d_finest_ln + 1, 0);
+    d_ucd_mesh_names.resize(d_finest_ln + 1);
+    d_ucd_mesh_vertices.resize(d_finest_ln + 1);
+    d_ucd_mesh_edge_maps.resize(d_finest_ln + 1);
+
+    d_coords_data.resize(d_finest_ln + 1, nullptr);
+    d_nvars.resize(d_finest_ln + 1, 0);
+    d_var_names.resize(d_finest_ln + 1);
+    d_var_start_depths.resize(d_finest_ln + 1);
+    d_var_plot_depths.resize(d_finest_ln + 1);
+    d_var_depths.resize(d_finest_ln + 1);
+    d_var_data.resize(d_finest_ln + 1);
+
+    d_ao.resize(d_finest_ln + 1);
+    d_build_vec_scatters.resize(d_finest_ln + 1);
+    d_src_vec.resize(d_finest_ln + 1);
+    d_dst_vec.resize(d_finest_ln + 1);
+    d_vec_scatter.resize(d_finest_ln + 1);
+    return;
+} // resetLevels
+
+void
+LHDF5DataWriter::registerMarkerCloud(const std::string& name,
+                                     const int nmarks,
+                                     const int first_lag_idx,
+                                     const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(nmarks > 0);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+
+    // Check to see if the cloud name has already been registered.
+    if (find(d_ucd_mesh_names[level_number].begin(), d_ucd_mesh_names[level_number].end(), name) !=
+        d_ucd_mesh_names[level_number].end())
+    {
+        TBOX_ERROR(d_object_name << "::registerMarkerCloud()\n"
+                                 << "  marker clouds must have unique names.\n"
+                                 << "  an unstructured mesh named ``" << name << "'' has already been registered.\n");
+    }
+
+    // Check to see if we are updating a previously registered cloud.
+    for (int k = 0; k < d_nclouds[level_number]; ++k)
+    {
+        if (d_cloud_names[level_number][k] == name)
+        {
+            d_cloud_nmarks[level_number][k] = nmarks;
+            d_cloud_first_lag_idx[level_number][k] = first_lag_idx;
+            d_build_vec_scatters[level_number] = true;
+            return;
+        }
+    }
+
+    // Record the layout of the marker cloud.
+    ++d_nclouds[level_number];
+    d_cloud_names[level_number].push_back(name);
+    d_cloud_nmarks[level_number].push_back(nmarks);
+    d_cloud_first_lag_idx[level_number].push_back(first_lag_idx);
+    d_build_vec_scatters[level_number] = true;
+    return;
+} // registerMarkerCloud
+
+void
+LHDF5DataWriter::registerUnstructuredMesh(const std::string& name,
+                                          const std::multimap<int, std::pair<int, int> >& edge_map,
+                                          const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+
+    // Check to see if the unstructured mesh name has already been registered.
+    if (find(d_cloud_names[level_number].begin(), d_cloud_names[level_number].end(), name) !=
+        d_cloud_names[level_number].end())
+    {
+        TBOX_ERROR(d_object_name << "::registerUnstructuredMesh()\n"
+                                 << "  unstructured meshes must have unique names.\n"
+                                 << "  a marker cloud named ``" << name << "'' has already been registered.\n");
+    }
+
+    // Extract the list of vertices from the list of edges.
+    std::set<int> vertices;
+    for (const auto& edge_pair : edge_map)
+    {
+        const std::pair<int, int>& e = edge_pair.second;
+        vertices.insert(e.first);
+        vertices.insert(e.second);
+    }
+
+    // Check to see if we are updating a previously registered unstructured
+    // mesh.
+    for (int k = 0; k < d_nucd_meshes[level_number]; ++k)
+    {
+        if (d_ucd_mesh_names[level_number][k] == name)
+        {
+            d_ucd_mesh_vertices[level_number][k] = vertices;
+            d_ucd_mesh_edge_maps[level_number][k] = edge_map;
+            d_build_vec_scatters[level_number] = true;
+            return;
+        }
+    }
+
+    // Record the layout of the unstructured mesh.
+    ++d_nucd_meshes[level_number];
+    d_ucd_mesh_names[level_number].push_back(name);
+    d_ucd_mesh_vertices[level_number].push_back(vertices);
+    d_ucd_mesh_edge_maps[level_number].push_back(edge_map);
+    d_build_vec_scatters[level_number] = true;
+    return;
+} // registerUnstructuredMesh
+
+void
+LHDF5DataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coords_data);
+    TBOX_ASSERT(coords_data->getDepth() == NDIM);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    d_coords_data[level_number] = coords_data;
+    return;
+} // registerCoordsData
+
+void
+LHDF5DataWriter::registerVariableData(const std::string& var_name, Pointer<LData> var_data, const int level_number)
+{
+    const int start_depth = 0;
+    const int var_depth = var_data->getDepth();
+    registerVariableData(var_name, var_data, start_depth, var_depth, level_number);
+    return;
+} // registerVariableData
+
+void
+LHDF5DataWriter::registerVariableData(const std::string& var_name,
+                                      Pointer<LData> var_data,
+                                      const int start_depth,
+                                      const int var_depth,
+                                      const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!var_name.empty());
+    TBOX_ASSERT(var_data);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    if (var_name == "coordinates" || var_name == "connectivity" || var_name.find('/') != std::string::npos)
+    {
+        TBOX_ERROR(d_object_name << "::registerVariableData()\n"
+                                 << "  invalid variable name " << var_name << std::endl);
+    }
+    if (find(d_var_names[level_number].begin(), d_var_names[level_number].end(), var_name) !=
+        d_var_names[level_number].end())
+    {
+        TBOX_ERROR(d_object_name << "::registerVariableData()\n"
+                                 << "  variable with name " << var_name << " already registered for plotting\n"
+                                 << "  on patch level " << level_number << std::endl);
+    }
+    ++d_nvars[level_number];
+    d_var_names[level_number].push_back(var_name);
+    d_var_start_depths[level_number].push_back(start_depth);
+    d_var_plot_depths[level_number].push_back(var_depth);
+    d_var_depths[level_number].push_back(var_data->getDepth());
+    d_var_data[level_number].push_back(var_data);
+    d_build_vec_scatters[level_number] = true;
+    return;
+} // registerVariableData
+
+void
+LHDF5DataWriter::registerLagrangianAO(AO& ao, const int level_number)
+{
+    if (level_number < d_coarsest_ln || level_number > d_finest_ln)
+    {
+        resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    d_ao[level_number] = ao;
+    d_build_vec_scatters[level_number] = true;
+    return;
+} // registerLagrangianAO
+
+void
+LHDF5DataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln, const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsest_ln <= finest_ln);
+#endif
+
+    if (coarsest_ln < d_coarsest_ln || finest_ln > d_finest_ln)
+    {
+        resetLevels(std::min(coarsest_ln, d_coarsest_ln), std::max(finest_ln, d_finest_ln));
+    }
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        registerLagrangianAO(ao[ln], ln);
+    }
+    return;
+} // registerLagrangianAO
+
+void
+LHDF5DataWriter::setChunkSize(const int chunk_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(chunk_size > 0);
+#endif
+    d_chunk_size = chunk_size;
+    return;
+} // setChunkSize
+
+void
+LHDF5DataWriter::setCompressionLevel(const int compression_level)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(compression_level >= 0 && compression_level <= 9);
+#endif
+#if defined(H5_HAVE_PARALLEL) && !H5_VERSION_GE(1, 10, 2)
+    if (compression_level > 0)
+    {
+        TBOX_WARNING(d_object_name << "::setCompressionLevel()\n"
+                                   << "  parallel HDF5 versions prior to 1.10.2 cannot write compressed datasets.\n"
+                                   << "  writing uncompressed data." << std::endl);
+    }
+    d_compression_level = 0;
+#else
+    d_compression_level = compression_level;
+#endif
+    return;
+} // setCompressionLevel
+
+void
+LHDF5DataWriter::writePlotData(const int time_step_number, const double simulation_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(time_step_number >= 0);
+    TBOX_ASSERT(!d_dump_directory_name.empty());
+#endif
+
+    if (time_step_number <= d_time_step_number)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  data writer with name " << d_object_name << "\n"
+                                 << "  time step number: " << time_step_number
+                                 << " is <= last time step number: " << d_time_step_number << std::endl);
+    }
+    d_time_step_number = time_step_number;
+
+    int ierr;
+    char temp_buf[HDF5_NAME_BUFSIZE];
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int mpi_nodes = IBTK_MPI::getNodes();
+
+    // Construct the VecScatter objects required to write the plot data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_build_vec_scatters[ln])
+        {
+            buildVecScatters(d_ao[ln], ln);
+        }
+        d_build_vec_scatters[ln] = false;
+    }
+
+    Utilities::recursiveMkdir(d_dump_directory_name);
+
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+    const std::string h5_file_name = HDF5_FILE_PREFIX + temp_buf + HDF5_FILE_POSTFIX;
+    const std::string xdmf_file_name = HDF5_FILE_PREFIX + temp_buf + XDMF_FILE_POSTFIX;
+
+    // Copy the local data into the layout of the HDF5 datasets and describe
+    // the local marker clouds and unstructured meshes in XDMF.
+    std::vector<LevelPlotData> level_data(d_finest_ln + 1);
+    std::ostringstream xdmf_grids;
+    xdmf_grids << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (!d_coords_data[ln]) continue;
+        LevelPlotData& data = level_data[ln];
+        data.has_data = true;
+        data.var_names = d_var_names[ln];
+        data.var_plot_depths = d_var_plot_depths[ln];
+
+        // Scatter the data from "global" to "local" form.
+        Vec local_X_vec;
+        ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+        IBTK_CHKERRQ(ierr);
+        Vec global_X_vec = d_coords_data[ln]->getVec();
+        ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+
+        int local_X_size;
+        ierr = VecGetLocalSize(local_X_vec, &local_X_size);
+        IBTK_CHKERRQ(ierr);
+        const int num_points = local_X_size / NDIM;
+        data.num_points = num_points;
+
+        const double* local_X_arr;
+        ierr = VecGetArrayRead(local_X_vec, &local_X_arr);
+        IBTK_CHKERRQ(ierr);
+        data.X.assign(local_X_arr, local_X_arr + local_X_size);
+        ierr = VecRestoreArrayRead(local_X_vec, &local_X_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&local_X_vec);
+        IBTK_CHKERRQ(ierr);
+
+        data.var_vals.resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            const int var_depth = d_var_depths[ln][v];
+            const int var_start_depth = d_var_start_depths[ln][v];
+            const int var_plot_depth = d_var_plot_depths[ln][v];
+            Vec local_v_vec;
+            ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
+            IBTK_CHKERRQ(ierr);
+            Vec global_v_vec = d_var_data[ln][v]->getVec();
+            ierr = VecScatterBegin(
+                d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScatterEnd(
+                d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
+            IBTK_CHKERRQ(ierr);
+
+            const double* local_v_arr;
+            ierr = VecGetArrayRead(local_v_vec, &local_v_arr);
+            IBTK_CHKERRQ(ierr);
+            data.var_vals[v].resize(num_points * var_plot_depth);
+            for (int i = 0; i < num_points; ++i)
+            {
+                for (int d = 0; d < var_plot_depth; ++d)
+                {
+                    data.var_vals[v][var_plot_depth * i + d] = local_v_arr[var_depth * i + var_start_depth + d];
+                }
+            }
+            ierr = VecRestoreArrayRead(local_v_vec, &local_v_arr);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&local_v_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Determine the edges of the unstructured meshes in terms of the
+        // vertex numbers of each mesh, pruning duplicate edges.
+        std::vector<int> mesh_nedges(d_nucd_meshes[ln]);
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
+            std::map<int, int> local_vertex_map;
+            int offset = 0;
+            for (int idx : vertices) local_vertex_map[idx] = offset++;
+
+            std::set<std::pair<int, int> > local_edge_set;
+            for (const auto& edge_pair : d_ucd_mesh_edge_maps[ln][mesh])
+            {
+                std::pair<int, int> e = edge_pair.second;
+                if (e.first > e.second) std::swap<int>(e.first, e.second);
+                local_edge_set.insert(e);
+            }
+            for (const auto& e : local_edge_set)
+            {
+                data.connectivity.push_back(local_vertex_map[e.first]);
+                data.connectivity.push_back(local_vertex_map[e.second]);
+            }
+            mesh_nedges[mesh] = static_cast<int>(local_edge_set.size());
+        }
+        data.num_edges = data.connectivity.size() / 2;
+
+        // Determine the rows of the datasets that are written by this process.
+        // The counts are gathered as 64-bit integers so that the offsets into
+        // the datasets of large structures do not overflow.
+        const unsigned long long local_counts[2] = { data.num_points, data.num_edges };
+        std::vector<unsigned long long> counts_per_proc(2 * mpi_nodes);
+        MPI_Allgather(local_counts,
+                      2,
+                      MPI_UNSIGNED_LONG_LONG,
+                      counts_per_proc.data(),
+                      2,
+                      MPI_UNSIGNED_LONG_LONG,
+                      IBTK_MPI::getCommunicator());
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            if (proc < mpi_rank)
+            {
+                data.point_offset += counts_per_proc[2 * proc];
+                data.edge_offset += counts_per_proc[2 * proc + 1];
+            }
+            data.num_points_total += counts_per_proc[2 * proc];
+            data.num_edges_total += counts_per_proc[2 * proc + 1];
+        }
+
+        // Describe the local marker clouds and unstructured meshes, which are
+        // stored in the same order as in the local Vec data.
+        hsize_t point_offset = data.point_offset, edge_offset = data.edge_offset;
+        for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+        {
+            const hsize_t nmarks = d_cloud_nmarks[ln][cloud];
+            write_xdmf_grid(
+                xdmf_grids, h5_file_name, d_cloud_names[ln][cloud], ln, data, point_offset, nmarks, edge_offset, 0);
+            point_offset += nmarks;
+        }
+        for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+        {
+            const hsize_t nvertices = d_ucd_mesh_vertices[ln][mesh].size();
+            const hsize_t nedges = mesh_nedges[mesh];
+            write_xdmf_grid(xdmf_grids,
+                            h5_file_name,
+                            d_ucd_mesh_names[ln][mesh],
+                            ln,
+                            data,
+                            point_offset,
+                            nvertices,
+                            edge_offset,
+                            nedges);
+            point_offset += nvertices;
+            edge_offset += nedges;
+        }
+    }
+
+    // Write the HDF5 file.  When HDF5 supports MPI-IO, all processes write to
+    // the file collectively.  Otherwise, the root process creates the file and
+    // then each process writes its data in turn.
+    const std::string h5_file_path = d_dump_directory_name + "/" + h5_file_name;
+#if defined(H5_HAVE_PARALLEL)
+    hid_t fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl_id, IBTK_MPI::getCommunicator(), MPI_INFO_NULL);
+    hid_t file_id = H5Fcreate(h5_file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    H5Pclose(fapl_id);
+    if (file_id < 0)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  Could not create HDF5 file named " << h5_file_path << std::endl);
+    }
+    create_datasets(file_id, level_data, d_time_step_number, simulation_time, d_chunk_size, d_compression_level);
+    write_datasets(file_id, level_data);
+    H5Fclose(file_id);
+#else
+    if (mpi_rank == HDF5_MPI_ROOT)
+    {
+        hid_t file_id = H5Fcreate(h5_file_path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        if (file_id < 0)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not create HDF5 file named " << h5_file_path << std::endl);
+        }
+        create_datasets(file_id, level_data, d_time_step_number, simulation_time, d_chunk_size, d_compression_level);
+        H5Fclose(file_id);
+    }
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        IBTK_MPI::barrier();
+        if (proc != mpi_rank) continue;
+        hid_t file_id = H5Fopen(h5_file_path.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+        if (file_id < 0)
+        {
+            TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                     << "  Could not open HDF5 file named " << h5_file_path << std::endl);
+        }
+        write_datasets(file_id, level_data);
+        H5Fclose(file_id);
+    }
+#endif
+
+    // Send the XDMF descriptions of the local data to the root MPI process.
+    const std::string local_grids = xdmf_grids.str();
+    int local_grids_size = static_cast<int>(local_grids.size());
+    std::vector<int> grids_sizes(mpi_nodes), grids_displs(mpi_nodes);
+    MPI_Gather(
+        &local_grids_size, 1, MPI_INT, grids_sizes.data(), 1, MPI_INT, HDF5_MPI_ROOT, IBTK_MPI::getCommunicator());
+    int all_grids_size = 0;
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        grids_displs[proc] = all_grids_size;
+        all_grids_size += grids_sizes[proc];
+    }
+    std::vector<char> all_grids(std::max(all_grids_size, 1));
+    MPI_Gatherv(const_cast<char*>(local_grids.data()),
+                local_grids_size,
+                MPI_CHAR,
+                all_grids.data(),
+                grids_sizes.data(),
+                grids_displs.data(),
+                MPI_CHAR,
+                HDF5_MPI_ROOT,
+                IBTK_MPI::getCommunicator());
+
+    if (mpi_rank == HDF5_MPI_ROOT)
+    {
+        // Write the XDMF file.
+        const std::string xdmf_file_path = d_dump_directory_name + "/" + xdmf_file_name;
+        std::ofstream xfile(xdmf_file_path.c_str(), std::ios::out);
+        xfile << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+        xfile << "<?xml version=\"1.0\" ?>\n";
+        xfile << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n";
+        xfile << "<Xdmf Version=\"2.0\">\n";
+        xfile << "  <Domain>\n";
+        xfile << "    <Grid Name=\"" << d_object_name << "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n";
+        xfile << "      <Time Value=\"" << simulation_time << "\"/>\n";
+        xfile.write(all_grids.data(), all_grids_size);
+        xfile << "    </Grid>\n";
+        xfile << "  </Domain>\n";
+        xfile << "</Xdmf>\n";
+        xfile.close();
+
+        // Create or update the dumps file on the root MPI process.
+        static bool dumps_file_opened = false;
+        const std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
+        std::ofstream sfile(path.c_str(), dumps_file_opened ? std::ios::app : std::ios::out);
+        sfile << xdmf_file_name << std::endl;
+        sfile.close();
+        dumps_file_opened = true;
+    }
+    IBTK_MPI::barrier();
+    return;
+} // writePlotData
+
+void
+LHDF5DataWriter::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("LAG_HDF5_DATA_WRITER_VERSION", LAG_HDF5_DATA_WRITER_VERSION);
+
+    db->putInteger("d_coarsest_ln", d_coarsest_ln);
+    db->putInteger("d_finest_ln", d_finest_ln);
+
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const std::string ln_string = "_" + std::to_string(ln);
+
+        db->putInteger("d_nclouds" + ln_string, d_nclouds[ln]);
+        if (d_nclouds[ln] > 0)
+        {
+            db->putStringArray(
+                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
+            db->putIntegerArray(
+                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
+            db->putIntegerArray("d_cloud_first_lag_idx" + ln_string,
+                                &d_cloud_first_lag_idx[ln][0],
+                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+        }
+
+        db->putInteger("d_nucd_meshes" + ln_string, d_nucd_meshes[ln]);
+        if (d_nucd_meshes[ln] > 0)
+        {
+            db->putStringArray("d_ucd_mesh_names" + ln_string,
+                               &d_ucd_mesh_names[ln][0],
+                               static_cast<int>(d_ucd_mesh_names[ln].size()));
+
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            {
+                const std::string mesh_string = "_" + std::to_string(mesh);
+
+                std::vector<int> ucd_mesh_edge_maps_vector;
+                ucd_mesh_edge_maps_vector.reserve(3 * d_ucd_mesh_edge_maps[ln][mesh].size());
+                for (const auto& edge_pair : d_ucd_mesh_edge_maps[ln][mesh])
+                {
+                    ucd_mesh_edge_maps_vector.push_back(edge_pair.first);
+                    ucd_mesh_edge_maps_vector.push_back(edge_pair.second.first);
+                    ucd_mesh_edge_maps_vector.push_back(edge_pair.second.second);
+                }
+                db->putInteger("ucd_mesh_edge_maps_vector.size()" + ln_string + mesh_string,
+                               static_cast<int>(ucd_mesh_edge_maps_vector.size()));
+                if (!ucd_mesh_edge_maps_vector.empty())
+                {
+                    db->putIntegerArray("ucd_mesh_edge_maps_vector" + ln_string + mesh_string,
+                                        &ucd_mesh_edge_maps_vector[0],
+                                        static_cast<int>(ucd_mesh_edge_maps_vector.size()));
+                }
+            }
+        }
+    }
+    return;
+} // putToDatabase
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LHDF5DataWriter::buildVecScatters(AO& ao, const int level_number)
+{
+    if (!d_coords_data[level_number]) return;
+
+    int ierr;
+
+    // Setup the IS data used to generate the VecScatters that redistribute the
+    // distributed data into local marker clouds and local UCD meshes.
+    std::vector<int> ref_is_idxs;
+    for (int cloud = 0; cloud < d_nclouds[level_number]; ++cloud)
+    {
+        const int nmarks = d_cloud_nmarks[level_number][cloud];
+        const int first_lag_idx = d_cloud_first_lag_idx[level_number][cloud];
+        ref_is_idxs.reserve(ref_is_idxs.size() + nmarks);
+        for (int idx = first_lag_idx; idx < first_lag_idx + nmarks; ++idx)
+        {
+            ref_is_idxs.push_back(idx);
+        }
+    }
+
+    for (int mesh = 0; mesh < d_nucd_meshes[level_number]; ++mesh)
+    {
+        ref_is_idxs.insert(ref_is_idxs.end(),
+                           d_ucd_mesh_vertices[level_number][mesh].begin(),
+                           d_ucd_mesh_vertices[level_number][mesh].end());
+    }
+
+    // Map Lagrangian indices to PETSc indices.
+    std::vector<int> ao_dummy(1, -1);
+    ierr = AOApplicationToPetsc(
+        ao,
+        (!ref_is_idxs.empty() ? static_cast<int>(ref_is_idxs.size()) : static_cast<int>(ao_dummy.size())),
+        (!ref_is_idxs.empty() ? &ref_is_idxs[0] : &ao_dummy[0]));
+    IBTK_CHKERRQ(ierr);
+
+    // Setup IS indices for all necessary data depths.
+    std::map<int, std::vector<int> > src_is_idxs;
+
+    src_is_idxs[NDIM] = ref_is_idxs;
+    d_src_vec[level_number][NDIM] = d_coords_data[level_number]->getVec();
+
+    for (int v = 0; v < d_nvars[level_number]; ++v)
+    {
+        const int var_depth = d_var_depths[level_number][v];
+        if (src_is_idxs.find(var_depth) == src_is_idxs.end())
+        {
+            src_is_idxs[var_depth] = ref_is_idxs;
+            d_src_vec[level_number][var_depth] = d_var_data[level_number][v]->getVec();
+        }
+    }
+
+    // Create the VecScatters to scatter data from the global PETSc Vec to
+    // contiguous local data.  VecScatter objects are individually created for
+    // data depths as necessary.
+    for (const auto& src_is_idx : src_is_idxs)
+    {
+        const int depth = src_is_idx.first;
+        const std::vector<int>& idxs = src_is_idx.second;
+        const int idxs_sz = static_cast<int>(idxs.size());
+
+        IS src_is;
+        ierr = ISCreateBlock(
+            PETSC_COMM_WORLD, depth, idxs_sz, (idxs.empty() ? nullptr : &idxs[0]), PETSC_COPY_VALUES, &src_is);
+        IBTK_CHKERRQ(ierr);
+
+        Vec& src_vec = d_src_vec[level_number][depth];
+        Vec& dst_vec = d_dst_vec[level_number][depth];
+        if (dst_vec)
+        {
+            ierr = VecDestroy(&dst_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecCreateMPI(PETSC_COMM_WORLD, depth * idxs_sz, PETSC_DETERMINE, &dst_vec);
+        IBTK_CHKERRQ(ierr);
+
+        VecScatter& vec_scatter = d_vec_scatter[level_number][depth];
+        if (vec_scatter)
+        {
+            ierr = VecScatterDestroy(&vec_scatter);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecScatterCreate(src_vec, src_is, dst_vec, nullptr, &vec_scatter);
+        IBTK_CHKERRQ(ierr);
+
+        ierr = ISDestroy(&src_is);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // buildVecScatters
+
+void
+LHDF5DataWriter::destroyVecScatters(const int level_number)
+{
+    int ierr;
+    for (auto& vec : d_dst_vec[level_number])
+    {
+        Vec& v = vec.second;
+        if (v)
+        {
+            ierr = VecDestroy(&v);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    for (auto& vec : d_vec_scatter[level_number])
+    {
+        VecScatter& vs = vec.second;
+        if (vs)
+        {
+            ierr = VecScatterDestroy(&vs);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    return;
+} // destroyVecScatters
+
+void
+LHDF5DataWriter::getFromRestart()
+{
+    Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
+    Pointer<Database> db;
+    if (restart_db->isDatabase(d_object_name))
+    {
+        db = restart_db->getDatabase(d_object_name);
+    }
+    else
+    {
+        TBOX_ERROR("Restart database corresponding to " << d_object_name << " not found in restart file.");
+    }
+
+    int ver = db->getInteger("LAG_HDF5_DATA_WRITER_VERSION");
+    if (ver != LAG_HDF5_DATA_WRITER_VERSION)
+    {
+        TBOX_ERROR(d_object_name << ":  "
+                                 << "Restart file version different than class version.");
+    }
+
+    const int coarsest_ln = db->getInteger("d_coarsest_ln");
+    const int finest_ln = db->getInteger("d_finest_ln");
+    resetLevels(coarsest_ln, finest_ln);
+
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const std::string ln_string = "_" + std::to_string(ln);
+
+        d_nclouds[ln] = db->getInteger("d_nclouds" + ln_string);
+        if (d_nclouds[ln] > 0)
+        {
+            d_cloud_names[ln].resize(d_nclouds[ln]);
+            db->getStringArray(
+                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
+
+            d_cloud_nmarks[ln].resize(d_nclouds[ln]);
+            db->getIntegerArray(
+                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
+
+            d_cloud_first_lag_idx[ln].resize(d_nclouds[ln]);
+            db->getIntegerArray("d_cloud_first_lag_idx" + ln_string,
+                                &d_cloud_first_lag_idx[ln][0],
+                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+        }
+
+        d_nucd_meshes[ln] = db->getInteger("d_nucd_meshes" + ln_string);
+        if (d_nucd_meshes[ln] > 0)
+        {
+            d_ucd_mesh_names[ln].resize(d_nucd_meshes[ln]);
+            db->getStringArray("d_ucd_mesh_names" + ln_string,
+                               &d_ucd_mesh_names[ln][0],
+                               static_cast<int>(d_ucd_mesh_names[ln].size()));
+
+            d_ucd_mesh_vertices[ln].resize(d_nucd_meshes[ln]);
+            d_ucd_mesh_edge_maps[ln].resize(d_nucd_meshes[ln]);
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            {
+                const std::string mesh_string = "_" + std::to_string(mesh);
+
+                const int ucd_mesh_edge_maps_vector_size =
+                    db->getInteger("ucd_mesh_edge_maps_vector.size()" + ln_string + mesh_string);
+                std::vector<int> ucd_mesh_edge_maps_vector(ucd_mesh_edge_maps_vector_size);
+                if (ucd_mesh_edge_maps_vector_size > 0)
+                {
+                    db->getIntegerArray("ucd_mesh_edge_maps_vector" + ln_string + mesh_string,
+                                        &ucd_mesh_edge_maps_vector[0],
+                                        ucd_mesh_edge_maps_vector_size);
+                }
+                for (int l = 0; l < ucd_mesh_edge_maps_vector_size / 3; ++l)
+                {
+                    const int idx1 = ucd_mesh_edge_maps_vector[3 * l];
+                    const std::pair<int, int> e(ucd_mesh_edge_maps_vector[3 * l + 1],
+                                                ucd_mesh_edge_maps_vector[3 * l + 2]);
+                    d_ucd_mesh_edge_maps[ln][mesh].insert(std::make_pair(idx1, e));
+                    d_ucd_mesh_vertices[ln][mesh].insert(e.first);
+                    d_ucd_mesh_vertices[ln][mesh].insert(e.second);
+                }
+            }
+        }
+    }
+    return;
+} // getFromRestart
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -34,12 +34,16 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdio>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -599,6 +603,333 @@ build_local_ucd_mesh(DBfile* dbfile,
     }
     return;
 } // build_local_ucd_mesh
+
+// The MPI tag number used to send local data to the processes that write it.
+static const int SILO_MPI_AGGREGATION_TAG = 1;
+
+// The maximum number of bytes sent in a single MPI message when aggregating
+// local data.
+static const std::size_t SILO_MPI_AGGREGATION_CHUNK_SIZE = std::size_t(1) << 30;
+
+// The types of local data that may be staged for output.
+enum StagedPlotPieceType
+{
+    STAGED_MARKER_CLOUD,
+    STAGED_CURV_BLOCK,
+    STAGED_UCD_MESH
+};
+
+/*!
+ * \brief A copy of the local data required to write a single marker cloud,
+ * curvilinear block, or unstructured mesh.
+ */
+struct StagedPlotPiece
+{
+    int type = STAGED_MARKER_CLOUD;
+    int level_number = 0;
+    std::string dirname;
+    int nmarks = 0;
+    std::array<int, NDIM> nelem{}, periodic{};
+    std::vector<int> vertices;
+    std::vector<int> edges; // stored as (vertex, edge vertex 0, edge vertex 1) triples
+    std::vector<double> X;
+    std::vector<std::vector<double> > var_vals;
+};
+
+/*!
+ * \brief A copy of the local data owned by a single process.
+ */
+struct StagedPlotData
+{
+    int rank = 0;
+    std::vector<std::vector<std::string> > var_names;
+    std::vector<std::vector<int> > var_start_depths, var_plot_depths, var_depths;
+    std::vector<StagedPlotPiece> pieces;
+};
+
+template <typename T>
+void
+pack_value(std::vector<char>& buffer, const T& value)
+{
+    const char* const ptr = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+    return;
+} // pack_value
+
+template <typename T>
+void
+pack_vector(std::vector<char>& buffer, const std::vector<T>& values)
+{
+    pack_value(buffer, values.size());
+    const char* const ptr = reinterpret_cast<const char*>(values.data());
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T) * values.size());
+    return;
+} // pack_vector
+
+void
+pack_string(std::vector<char>& buffer, const std::string& value)
+{
+    pack_value(buffer, value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+    return;
+} // pack_string
+
+template <typename T>
+void
+unpack_value(const std::vector<char>& buffer, std::size_t& pos, T& value)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(pos + sizeof(T) <= buffer.size());
+#endif
+    std::copy(&buffer[pos], &buffer[pos] + sizeof(T), reinterpret_cast<char*>(&value));
+    pos += sizeof(T);
+    return;
+} // unpack_value
+
+template <typename T>
+void
+unpack_vector(const std::vector<char>& buffer, std::size_t& pos, std::vector<T>& values)
+{
+    std::size_t size;
+    unpack_value(buffer, pos, size);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(pos + sizeof(T) * size <= buffer.size());
+#endif
+    values.resize(size);
+    if (size > 0)
+    {
+        std::copy(&buffer[pos], &buffer[pos] + sizeof(T) * size, reinterpret_cast<char*>(values.data()));
+    }
+    pos += sizeof(T) * size;
+    return;
+} // unpack_vector
+
+void
+unpack_string(const std::vector<char>& buffer, std::size_t& pos, std::string& value)
+{
+    std::size_t size;
+    unpack_value(buffer, pos, size);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(pos + size <= buffer.size());
+#endif
+    value.assign(buffer.begin() + pos, buffer.begin() + pos + size);
+    pos += size;
+    return;
+} // unpack_string
+
+/*!
+ * \brief Serialize staged plot data so that it can be sent to another process.
+ */
+std::vector<char>
+pack_staged_plot_data(const StagedPlotData& data)
+{
+    std::vector<char> buffer;
+    pack_value(buffer, data.rank);
+    pack_value(buffer, data.var_names.size());
+    for (std::size_t ln = 0; ln < data.var_names.size(); ++ln)
+    {
+        pack_value(buffer, data.var_names[ln].size());
+        for (const std::string& var_name : data.var_names[ln]) pack_string(buffer, var_name);
+        pack_vector(buffer, data.var_start_depths[ln]);
+        pack_vector(buffer, data.var_plot_depths[ln]);
+        pack_vector(buffer, data.var_depths[ln]);
+    }
+    pack_value(buffer, data.pieces.size());
+    for (const StagedPlotPiece& piece : data.pieces)
+    {
+        pack_value(buffer, piece.type);
+        pack_value(buffer, piece.level_number);
+        pack_string(buffer, piece.dirname);
+        pack_value(buffer, piece.nmarks);
+        pack_value(buffer, piece.nelem);
+        pack_value(buffer, piece.periodic);
+        pack_vector(buffer, piece.vertices);
+        pack_vector(buffer, piece.edges);
+        pack_vector(buffer, piece.X);
+        pack_value(buffer, piece.var_vals.size());
+        for (const std::vector<double>& var_vals : piece.var_vals) pack_vector(buffer, var_vals);
+    }
+    return buffer;
+} // pack_staged_plot_data
+
+/*!
+ * \brief Deserialize staged plot data packed by pack_staged_plot_data().
+ */
+StagedPlotData
+unpack_staged_plot_data(const std::vector<char>& buffer)
+{
+    StagedPlotData data;
+    std::size_t pos = 0, size;
+    unpack_value(buffer, pos, data.rank);
+    unpack_value(buffer, pos, size);
+    data.var_names.resize(size);
+    data.var_start_depths.resize(size);
+    data.var_plot_depths.resize(size);
+    data.var_depths.resize(size);
+    for (std::size_t ln = 0; ln < data.var_names.size(); ++ln)
+    {
+        unpack_value(buffer, pos, size);
+        data.var_names[ln].resize(size);
+        for (std::string& var_name : data.var_names[ln]) unpack_string(buffer, pos, var_name);
+        unpack_vector(buffer, pos, data.var_start_depths[ln]);
+        unpack_vector(buffer, pos, data.var_plot_depths[ln]);
+        unpack_vector(buffer, pos, data.var_depths[ln]);
+    }
+    unpack_value(buffer, pos, size);
+    data.pieces.resize(size);
+    for (StagedPlotPiece& piece : data.pieces)
+    {
+        unpack_value(buffer, pos, piece.type);
+        unpack_value(buffer, pos, piece.level_number);
+        unpack_string(buffer, pos, piece.dirname);
+        unpack_value(buffer, pos, piece.nmarks);
+        unpack_value(buffer, pos, piece.nelem);
+        unpack_value(buffer, pos, piece.periodic);
+        unpack_vector(buffer, pos, piece.vertices);
+        unpack_vector(buffer, pos, piece.edges);
+        unpack_vector(buffer, pos, piece.X);
+        unpack_value(buffer, pos, size);
+        piece.var_vals.resize(size);
+        for (std::vector<double>& var_vals : piece.var_vals) unpack_vector(buffer, pos, var_vals);
+    }
+    return data;
+} // unpack_staged_plot_data
+
+/*!
+ * \brief Return the name of the local file that contains the data owned by
+ * process \p proc.
+ */
+std::string
+get_local_file_name(const int proc, const int group_size)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", (proc / group_size) * group_size);
+    return SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX;
+} // get_local_file_name
+
+/*!
+ * \brief Return the prefix of the directories in the local file that contain
+ * the data owned by process \p proc.  When each process writes its own file,
+ * the prefix is empty.
+ */
+std::string
+get_local_dir_prefix(const int proc, const int group_size)
+{
+    if (group_size == 1) return "";
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "proc_%04d_", proc);
+    return temp_buf;
+} // get_local_dir_prefix
+
+/*!
+ * \brief Write the staged data owned by a group of processes to a single local
+ * file.
+ */
+void
+write_local_file(const std::string& file_name,
+                 const std::vector<StagedPlotData>& group_data,
+                 const int group_size,
+                 const std::string& object_name,
+                 const int time_step,
+                 const double simulation_time)
+{
+    DBfile* dbfile;
+    if (!(dbfile = DBCreate(file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    {
+        TBOX_ERROR(object_name << "::writePlotData()\n"
+                               << "  Could not create DBfile named " << file_name << std::endl);
+    }
+
+    for (const StagedPlotData& data : group_data)
+    {
+        const std::string dir_prefix = get_local_dir_prefix(data.rank, group_size);
+        for (const StagedPlotPiece& piece : data.pieces)
+        {
+            const int ln = piece.level_number;
+            const int nvars = static_cast<int>(data.var_names[ln].size());
+            std::vector<const double*> var_vals(nvars);
+            for (int v = 0; v < nvars; ++v) var_vals[v] = piece.var_vals[v].data();
+
+            std::string dirname = dir_prefix + piece.dirname;
+            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+            {
+                TBOX_ERROR(object_name << "::writePlotData()\n"
+                                       << "  Could not create directory named " << dirname << std::endl);
+            }
+
+            switch (piece.type)
+            {
+            case STAGED_MARKER_CLOUD:
+                build_local_marker_cloud(dbfile,
+                                         dirname,
+                                         piece.nmarks,
+                                         piece.X.data(),
+                                         nvars,
+                                         data.var_names[ln],
+                                         data.var_start_depths[ln],
+                                         data.var_plot_depths[ln],
+                                         data.var_depths[ln],
+                                         var_vals,
+                                         time_step,
+                                         simulation_time);
+                break;
+            case STAGED_CURV_BLOCK:
+            {
+                IntVector<NDIM> nelem, periodic;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    nelem(d) = piece.nelem[d];
+                    periodic(d) = piece.periodic[d];
+                }
+                build_local_curv_block(dbfile,
+                                       dirname,
+                                       nelem,
+                                       periodic,
+                                       piece.X.data(),
+                                       nvars,
+                                       data.var_names[ln],
+                                       data.var_start_depths[ln],
+                                       data.var_plot_depths[ln],
+                                       data.var_depths[ln],
+                                       var_vals,
+                                       time_step,
+                                       simulation_time);
+                break;
+            }
+            case STAGED_UCD_MESH:
+            {
+                const std::set<int> vertices(piece.vertices.begin(), piece.vertices.end());
+                std::multimap<int, std::pair<int, int> > edge_map;
+                for (std::size_t k = 0; k < piece.edges.size(); k += 3)
+                {
+                    edge_map.insert(
+                        std::make_pair(piece.edges[k], std::make_pair(piece.edges[k + 1], piece.edges[k + 2])));
+                }
+                build_local_ucd_mesh(dbfile,
+                                     dirname,
+                                     vertices,
+                                     edge_map,
+                                     piece.X.data(),
+                                     nvars,
+                                     data.var_names[ln],
+                                     data.var_start_depths[ln],
+                                     data.var_plot_depths[ln],
+                                     data.var_depths[ln],
+                                     var_vals,
+                                     time_step,
+                                     simulation_time);
+                break;
+            }
+            default:
+                TBOX_ERROR(object_name << "::writePlotData()\n"
+                                       << "  unrecognized staged data type" << std::endl);
+            }
+        }
+    }
+
+    DBClose(dbfile);
+    return;
+} // write_local_file
 #endif // if defined(IBTK_HAVE_SILO)
 } // namespace
 
@@ -661,6 +992,8 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    waitForPendingOutput();
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -1168,6 +1501,38 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
     return;
 } // registerLagrangianAO
 
+void
+LSiloDataWriter::setUseAsynchronousOutput(const bool use_async_output)
+{
+    d_use_async_output = use_async_output;
+    return;
+} // setUseAsynchronousOutput
+
+void
+LSiloDataWriter::setNumberOfOutputFiles(const int num_output_files)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_output_files >= 0);
+#endif
+    d_num_output_files = num_output_files;
+    return;
+} // setNumberOfOutputFiles
+
+void
+LSiloDataWriter::waitForPendingOutput()
+{
+    if (d_output_thread.joinable()) d_output_thread.join();
+    return;
+} // waitForPendingOutput
+
+std::mutex&
+LSiloDataWriter::getSiloMutex()
+{
+    // The Silo library is not thread safe, so all calls to it are serialized.
+    static std::mutex silo_mutex;
+    return silo_mutex;
+} // getSiloMutex
+
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1177,6 +1542,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     TBOX_ASSERT(!d_dump_directory_name.empty());
 #endif
 
+    // Finish writing any previous plot data before the Silo files for this
+    // time step are created.
+    waitForPendingOutput();
+
     if (time_step_number <= d_time_step_number)
     {
         TBOX_ERROR(d_object_name << "::writePlotData()\n"
@@ -1194,9 +1563,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     }
 
     int ierr;
-    char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
+    char dirname_buf[SILO_NAME_BUFSIZE];
     const int mpi_rank = IBTK_MPI::getRank();
     const int mpi_nodes = IBTK_MPI::getNodes();
 
@@ -1211,28 +1578,31 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     }
 
     // Create the working directory.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-    std::string current_dump_directory_name = SILO_DUMP_DIR_PREFIX + temp_buf;
+    std::snprintf(dirname_buf, sizeof(dirname_buf), "%06d", d_time_step_number);
+    std::string current_dump_directory_name = SILO_DUMP_DIR_PREFIX + dirname_buf;
     std::string dump_dirname = d_dump_directory_name + "/" + current_dump_directory_name;
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
-    {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named " << current_file_name << std::endl);
-    }
+    // Determine which processes write local data and which files they write.
+    // By default, each process writes its own file.  When the number of output
+    // files is restricted, consecutive groups of processes send their local
+    // data to the first process in the group, which writes it to a single
+    // file.
+    const int num_files = d_num_output_files > 0 ? std::min(d_num_output_files, mpi_nodes) : mpi_nodes;
+    const int group_size = (mpi_nodes + num_files - 1) / num_files;
+    const int writer_rank = (mpi_rank / group_size) * group_size;
 
     std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
     std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
 
-    // Set the local data.
+    // Copy the local data into a staging buffer.
+    StagedPlotData local_data;
+    local_data.rank = mpi_rank;
+    local_data.var_names = d_var_names;
+    local_data.var_start_depths = d_var_start_depths;
+    local_data.var_plot_depths = d_var_plot_depths;
+    local_data.var_depths = d_var_depths;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         if (d_coords_data[ln])
@@ -1281,84 +1651,53 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             // Keep track of the current offset in the local Vec data.
             int offset = 0;
 
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
+            // Copy the values of the next npts points into a new staged piece.
+            auto stage_piece = [&](const int type, std::string dirname, const int npts) -> StagedPlotPiece& {
+                local_data.pieces.emplace_back();
+                StagedPlotPiece& piece = local_data.pieces.back();
+                piece.type = type;
+                piece.level_number = ln;
+                piece.dirname = std::move(dirname);
+                piece.X.assign(local_X_arr + NDIM * offset, local_X_arr + NDIM * (offset + npts));
+                piece.var_vals.resize(d_nvars[ln]);
                 for (int v = 0; v < d_nvars[ln]; ++v)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    const int var_depth = d_var_depths[ln][v];
+                    piece.var_vals[v].assign(local_v_arrs[v] + var_depth * offset,
+                                             local_v_arrs[v] + var_depth * (offset + npts));
                 }
+                offset += npts;
+                return piece;
+            };
 
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
+            // Stage the local clouds.
+            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+            {
+                const int nmarks = d_cloud_nmarks[ln][cloud];
+                StagedPlotPiece& piece = stage_piece(
+                    STAGED_MARKER_CLOUD, "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud), nmarks);
+                piece.nmarks = nmarks;
             }
 
-            // Add the local blocks to the local DBfile.
+            // Stage the local blocks.
             for (int block = 0; block < d_nblocks[ln]; ++block)
             {
                 const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
                 const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                StagedPlotPiece& piece =
+                    stage_piece(STAGED_CURV_BLOCK,
+                                "level_" + std::to_string(ln) + "_block_" + std::to_string(block),
+                                nelem.getProduct());
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    piece.nelem[d] = nelem(d);
+                    piece.periodic[d] = periodic(d);
                 }
-
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
                 meshtype[ln].push_back(DB_QUAD_CURV);
                 vartype[ln].push_back(DB_QUADVAR);
-
-                offset += ntot;
             }
 
-            // Add the local multiblocks to the local DBfile.
+            // Stage the local multiblocks.
             multimeshtype[ln].resize(d_nmbs[ln]);
             multivartype[ln].resize(d_nmbs[ln]);
             for (int mb = 0; mb < d_nmbs[ln]; ++mb)
@@ -1367,81 +1706,35 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 {
                     const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
                     const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
-
-                    std::string dirname =
-                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
-
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                    StagedPlotPiece& piece = stage_piece(STAGED_CURV_BLOCK,
+                                                         "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) +
+                                                             "_block_" + std::to_string(block),
+                                                         nelem.getProduct());
+                    for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << dirname << std::endl);
+                        piece.nelem[d] = nelem(d);
+                        piece.periodic[d] = periodic(d);
                     }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
-                    {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                    }
-
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
                     multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
                     multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
                 }
             }
 
-            // Add the local UCD meshes to the local DBfile.
+            // Stage the local UCD meshes.
             for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
             {
                 const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
                 const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                StagedPlotPiece& piece = stage_piece(STAGED_UCD_MESH,
+                                                     "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh),
+                                                     static_cast<int>(vertices.size()));
+                piece.vertices.assign(vertices.begin(), vertices.end());
+                for (const auto& edge : edge_map)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    piece.edges.push_back(edge.first);
+                    piece.edges.push_back(edge.second.first);
+                    piece.edges.push_back(edge.second.second);
                 }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
             }
 
             // Clean up allocated data.
@@ -1459,7 +1752,60 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         }
     }
 
-    DBClose(dbfile);
+    // Send the staged data to the writer processes.
+    auto group_data = std::make_shared<std::vector<StagedPlotData> >();
+    if (mpi_rank == writer_rank)
+    {
+        group_data->push_back(std::move(local_data));
+        for (int proc = mpi_rank + 1; proc < std::min(mpi_rank + group_size, mpi_nodes); ++proc)
+        {
+            unsigned long long num_bytes = 0;
+            MPI_Recv(&num_bytes,
+                     1,
+                     MPI_UNSIGNED_LONG_LONG,
+                     proc,
+                     SILO_MPI_AGGREGATION_TAG,
+                     IBTK_MPI::getCommunicator(),
+                     MPI_STATUS_IGNORE);
+            std::vector<char> buffer(num_bytes);
+            for (std::size_t offset = 0; offset < buffer.size(); offset += SILO_MPI_AGGREGATION_CHUNK_SIZE)
+            {
+                const std::size_t chunk_size = std::min(SILO_MPI_AGGREGATION_CHUNK_SIZE, buffer.size() - offset);
+                MPI_Recv(buffer.data() + offset,
+                         static_cast<int>(chunk_size),
+                         MPI_CHAR,
+                         proc,
+                         SILO_MPI_AGGREGATION_TAG,
+                         IBTK_MPI::getCommunicator(),
+                         MPI_STATUS_IGNORE);
+            }
+            group_data->push_back(unpack_staged_plot_data(buffer));
+        }
+    }
+    else
+    {
+        // Send the size of the packed data first and then the data itself in
+        // chunks so that message sizes always fit in an int.  MPI guarantees
+        // that messages with the same tag arrive in the order they were sent.
+        std::vector<char> buffer = pack_staged_plot_data(local_data);
+        unsigned long long num_bytes = buffer.size();
+        MPI_Send(&num_bytes,
+                 1,
+                 MPI_UNSIGNED_LONG_LONG,
+                 writer_rank,
+                 SILO_MPI_AGGREGATION_TAG,
+                 IBTK_MPI::getCommunicator());
+        for (std::size_t offset = 0; offset < buffer.size(); offset += SILO_MPI_AGGREGATION_CHUNK_SIZE)
+        {
+            const std::size_t chunk_size = std::min(SILO_MPI_AGGREGATION_CHUNK_SIZE, buffer.size() - offset);
+            MPI_Send(buffer.data() + offset,
+                     static_cast<int>(chunk_size),
+                     MPI_CHAR,
+                     writer_rank,
+                     SILO_MPI_AGGREGATION_TAG,
+                     IBTK_MPI::getCommunicator());
+        }
+    }
 
     // Send data to the root MPI process required to create the multimesh and
     // multivar objects.
@@ -1706,258 +2052,296 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         }
     }
 
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    // Write the local and summary files.  Only data owned by this function
+    // (and not by this object) may be used here, since this may be done on a
+    // background thread.
+    const std::string object_name = d_object_name;
+    const std::string dump_directory_name = d_dump_directory_name;
+    const int coarsest_ln = d_coarsest_ln, finest_ln = d_finest_ln;
+    const std::vector<int> nvars = d_nvars;
+    const std::vector<std::vector<std::string> > var_names = d_var_names;
+    auto write_files = [=]() mutable {
+        std::lock_guard<std::mutex> lock(LSiloDataWriter::getSiloMutex());
+        char temp_buf[SILO_NAME_BUFSIZE];
+        std::string current_file_name;
+        DBfile* dbfile;
+
+        if (mpi_rank == writer_rank)
         {
-            TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named " << summary_file_name << std::endl);
+            write_local_file(dump_dirname + "/" + get_local_file_name(mpi_rank, group_size),
+                             *group_data,
+                             group_size,
+                             object_name,
+                             time_step_number,
+                             simulation_time);
         }
 
-        int cycle = time_step_number;
-        auto time = static_cast<float>(simulation_time);
-        double dtime = simulation_time;
+        if (mpi_rank == SILO_MPI_ROOT)
+        {
+            // Create and initialize the multimesh Silo database on the root MPI
+            // process.
+            std::snprintf(temp_buf, sizeof(temp_buf), "%06d", time_step_number);
+            std::string summary_file_name =
+                dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+            if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+            {
+                TBOX_ERROR(object_name << "::writePlotData()\n"
+                                       << "  Could not create DBfile named " << summary_file_name << std::endl);
+            }
 
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
+            int cycle = time_step_number;
+            auto time = static_cast<float>(simulation_time);
+            double dtime = simulation_time;
 
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+            static const int MAX_OPTS = 3;
+            DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+            DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+            DBAddOption(optlist, DBOPT_TIME, &time);
+            DBAddOption(optlist, DBOPT_DTIME, &dtime);
+
+            for (int proc = 0; proc < mpi_nodes; ++proc)
             {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
                 {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                    {
+                        current_file_name =
+                            get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
 
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                           std::to_string(cloud) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
+                        std::string meshname = current_file_name + "level_" + std::to_string(ln) + "_cloud_" +
+                                               std::to_string(cloud) + "/mesh";
+                        auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                        int meshtype = DB_POINTMESH;
 
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+                        const std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
 
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+                        DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << cloud_name << std::endl);
+                        if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
+                        {
+                            TBOX_ERROR(object_name << "::writePlotData()\n"
+                                                   << "  Could not create directory named " << cloud_name << std::endl);
+                        }
                     }
-                }
 
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+                    {
+                        current_file_name =
+                            get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
 
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                           std::to_string(block) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
+                        std::string meshname = current_file_name + "level_" + std::to_string(ln) + "_block_" +
+                                               std::to_string(block) + "/mesh";
+                        auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                        int meshtype = meshtypes_per_proc[ln][proc][block];
 
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
+                        const std::string& block_name = block_names_per_proc[ln][proc][block];
 
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+                        DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << block_name << std::endl);
+                        if (DBMkDir(dbfile, block_name.c_str()) == -1)
+                        {
+                            TBOX_ERROR(object_name << "::writePlotData()\n"
+                                                   << "  Could not create directory named " << block_name << std::endl);
+                        }
                     }
-                }
 
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                    std::vector<std::string> meshnames;
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        meshnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
-                                            std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
-                    }
-                    std::vector<const char*> meshnames_ptrs;
-                    for (int block = 0; block < nblocks; ++block)
+                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                     {
-                        meshnames_ptrs.push_back(meshnames[block].c_str());
-                    }
+                        current_file_name =
+                            get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
+
+                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
+                        std::vector<std::string> meshnames;
+                        for (int block = 0; block < nblocks; ++block)
+                        {
+                            meshnames.push_back(current_file_name + "level_" + std::to_string(ln) + "_mb_" +
+                                                std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
+                        }
+                        std::vector<const char*> meshnames_ptrs;
+                        for (int block = 0; block < nblocks; ++block)
+                        {
+                            meshnames_ptrs.push_back(meshnames[block].c_str());
+                        }
 
-                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
+                        const std::string& mb_name = mb_names_per_proc[ln][proc][mb];
 
-                    DBPutMultimesh(dbfile,
-                                   mb_name.c_str(),
-                                   nblocks,
-                                   meshnames_ptrs.data(),
-                                   &multimeshtypes_per_proc[ln][proc][mb][0],
-                                   optlist);
+                        DBPutMultimesh(dbfile,
+                                       mb_name.c_str(),
+                                       nblocks,
+                                       meshnames_ptrs.data(),
+                                       &multimeshtypes_per_proc[ln][proc][mb][0],
+                                       optlist);
 
-                    if (DBMkDir(dbfile, mb_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << mb_name << std::endl);
+                        if (DBMkDir(dbfile, mb_name.c_str()) == -1)
+                        {
+                            TBOX_ERROR(object_name << "::writePlotData()\n"
+                                                   << "  Could not create directory named " << mb_name << std::endl);
+                        }
                     }
-                }
 
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    for (int v = 0; v < nvars[ln]; ++v)
+                    {
+                        for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                        {
+                            current_file_name =
+                                get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
 
-                    std::string meshname =
-                        current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_UCDMESH;
+                            std::string varname = current_file_name + "level_" + std::to_string(ln) + "_cloud_" +
+                                                  std::to_string(cloud) + "/" + var_names[ln][v];
+                            auto varname_ptr = const_cast<char*>(varname.c_str());
+                            int vartype = DB_POINTVAR;
 
-                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
+                            const std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
 
-                    DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+                            std::string var_name = cloud_name + "/" + var_names[ln][v];
 
-                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << mesh_name << std::endl);
-                    }
-                }
+                            DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                        }
 
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+                        {
+                            current_file_name =
+                                get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
 
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                              std::to_string(cloud) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_POINTVAR;
+                            std::string varname = current_file_name + "level_" + std::to_string(ln) + "_block_" +
+                                                  std::to_string(block) + "/" + var_names[ln][v];
+                            auto varname_ptr = const_cast<char*>(varname.c_str());
+                            int vartype = vartypes_per_proc[ln][proc][block];
 
-                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+                            const std::string& block_name = block_names_per_proc[ln][proc][block];
 
-                        std::string var_name = cloud_name + "/" + d_var_names[ln][v];
+                            std::string var_name = block_name + "/" + var_names[ln][v];
+
+                            DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                        }
 
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                        for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
+                        {
+                            current_file_name =
+                                get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
+
+                            const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
+
+                            std::vector<std::string> varnames;
+                            for (int block = 0; block < nblocks; ++block)
+                            {
+                                varnames.push_back(current_file_name + "level_" + std::to_string(ln) + "_mb_" +
+                                                   std::to_string(mb) + "_block_" + std::to_string(block) +
+                                                   var_names[ln][v]);
+                            }
+                            std::vector<const char*> varnames_ptrs;
+                            for (int block = 0; block < nblocks; ++block)
+                            {
+                                varnames_ptrs.push_back(varnames[block].c_str());
+                            }
+
+                            const std::string& mb_name = mb_names_per_proc[ln][proc][mb];
+
+                            std::string var_name = mb_name + "/" + var_names[ln][v];
+
+                            DBPutMultivar(dbfile,
+                                          var_name.c_str(),
+                                          nblocks,
+                                          varnames_ptrs.data(),
+                                          &multivartypes_per_proc[ln][proc][mb][0],
+                                          optlist);
+                        }
                     }
+                }
+            }
 
-                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+            // Unstructured meshes that are registered under the same name on
+            // several MPI processes (e.g., distributed structure connectivity)
+            // are combined into a single multimesh with one block per process.
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                std::vector<std::string> mesh_names;
+                std::map<std::string, std::vector<std::string> > mesh_block_dirs;
+                for (int proc = 0; proc < mpi_nodes; ++proc)
+                {
+                    current_file_name =
+                        get_local_file_name(proc, group_size) + ":" + get_local_dir_prefix(proc, group_size);
+                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                              std::to_string(block) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = vartypes_per_proc[ln][proc][block];
+                        const std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
+                        if (mesh_block_dirs.find(mesh_name) == mesh_block_dirs.end()) mesh_names.push_back(mesh_name);
+                        mesh_block_dirs[mesh_name].push_back(current_file_name + "level_" + std::to_string(ln) +
+                                                             "_mesh_" + std::to_string(mesh) + "/");
+                    }
+                }
 
-                        std::string& block_name = block_names_per_proc[ln][proc][block];
+                for (const std::string& mesh_name : mesh_names)
+                {
+                    const std::vector<std::string>& block_dirs = mesh_block_dirs[mesh_name];
+                    const int nblocks = static_cast<int>(block_dirs.size());
+                    std::vector<std::string> meshnames;
+                    for (const std::string& block_dir : block_dirs) meshnames.push_back(block_dir + "mesh");
+                    std::vector<const char*> meshnames_ptrs;
+                    for (const std::string& meshname : meshnames) meshnames_ptrs.push_back(meshname.c_str());
+                    std::vector<int> meshtypes(nblocks, DB_UCDMESH);
 
-                        std::string var_name = block_name + "/" + d_var_names[ln][v];
+                    DBPutMultimesh(
+                        dbfile, mesh_name.c_str(), nblocks, meshnames_ptrs.data(), meshtypes.data(), optlist);
 
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
+                    {
+                        TBOX_ERROR(object_name << "::writePlotData()\n"
+                                               << "  Could not create directory named " << mesh_name << std::endl);
                     }
 
-                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
+                    for (int v = 0; v < nvars[ln]; ++v)
                     {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-
                         std::vector<std::string> varnames;
-                        for (int block = 0; block < nblocks; ++block)
+                        for (const std::string& block_dir : block_dirs)
                         {
-                            varnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
-                                               std::to_string(mb) + "_block_" + std::to_string(block) +
-                                               d_var_names[ln][v]);
+                            varnames.push_back(block_dir + var_names[ln][v]);
                         }
                         std::vector<const char*> varnames_ptrs;
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            varnames_ptrs.push_back(varnames[block].c_str());
-                        }
-
-                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                        std::string var_name = mb_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile,
-                                      var_name.c_str(),
-                                      nblocks,
-                                      varnames_ptrs.data(),
-                                      &multivartypes_per_proc[ln][proc][mb][0],
-                                      optlist);
-                    }
+                        for (const std::string& varname : varnames) varnames_ptrs.push_back(varname.c_str());
+                        std::vector<int> vartypes(nblocks, DB_UCDVAR);
 
-                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" +
-                                              std::to_string(mesh) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_UCDVAR;
-
-                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                        std::string var_name = mesh_name + "/" + d_var_names[ln][v];
+                        std::string var_name = mesh_name + "/" + var_names[ln][v];
 
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                        DBPutMultivar(
+                            dbfile, var_name.c_str(), nblocks, varnames_ptrs.data(), vartypes.data(), optlist);
                     }
                 }
             }
-        }
 
-        DBFreeOptlist(optlist);
-        DBClose(dbfile);
+            DBFreeOptlist(optlist);
+            DBClose(dbfile);
 
-        // Create or update the dumps file on the root MPI process.
-        static bool summary_file_opened = false;
-        std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string file =
-            current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!summary_file_opened)
-        {
-            summary_file_opened = true;
-            std::ofstream sfile(path.c_str(), std::ios::out);
-            sfile << file << std::endl;
-            sfile.close();
-        }
-        else
-        {
-            std::ofstream sfile(path.c_str(), std::ios::app);
-            sfile << file << std::endl;
-            sfile.close();
+            // Create or update the dumps file on the root MPI process.
+            static bool summary_file_opened = false;
+            std::string path = dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
+            std::snprintf(temp_buf, sizeof(temp_buf), "%06d", time_step_number);
+            std::string file =
+                current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+            if (!summary_file_opened)
+            {
+                summary_file_opened = true;
+                std::ofstream sfile(path.c_str(), std::ios::out);
+                sfile << file << std::endl;
+                sfile.close();
+            }
+            else
+            {
+                std::ofstream sfile(path.c_str(), std::ios::app);
+                sfile << file << std::endl;
+                sfile.close();
+            }
         }
+    };
+
+    if (d_use_async_output)
+    {
+        d_output_thread = std::thread(write_files);
+    }
+    else
+    {
+        write_files();
+        IBTK_MPI::barrier();
     }
-    IBTK_MPI::barrier();
 #else
     NULL_USE(time_step_number);
     NULL_USE(simulation_time);
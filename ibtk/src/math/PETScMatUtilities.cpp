@@ -290,14 +290,16 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(bc_coefs.size() == NDIM);
 #endif
 
     int ierr;
-    if (mat)
+    const bool reuse_mat = reuse_nonzero_structure && mat;
+    if (mat && !reuse_mat)
     {
         ierr = MatDestroy(&mat);
         IBTK_CHKERRQ(ierr);
@@ -321,61 +323,66 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
     const int i_upper = i_lower + n_local;
     const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    // When the nonzero structure of an existing matrix is reused, only the
+    // matrix values are reset.
+    if (!reuse_mat)
     {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        // Determine the non-zero structure of the matrix.
+        std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
 #if !defined(NDEBUG)
-        TBOX_ASSERT(dof_index_data->getDepth() == 1);
+            TBOX_ASSERT(dof_index_data->getDepth() == 1);
 #endif
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                const int dof_index = (*dof_index_data)(i);
-                if (i_lower <= dof_index && dof_index < i_upper)
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
                 {
-                    // Stencil for finite difference operator.
-                    const int local_idx = dof_index - i_lower;
-                    d_nnz[local_idx] += 1;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                    const int dof_index = (*dof_index_data)(i);
+                    if (i_lower <= dof_index && dof_index < i_upper)
                     {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        // Stencil for finite difference operator.
+                        const int local_idx = dof_index - i_lower;
+                        d_nnz[local_idx] += 1;
+                        for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
                         {
-                            const int dof_index = (*dof_index_data)(i + stencil[stencil_index]);
-                            if (dof_index >= i_lower && dof_index < i_upper)
+                            for (int side = 0; side <= 1; ++side, ++stencil_index)
                             {
-                                d_nnz[local_idx] += 1;
-                            }
-                            else
-                            {
-                                o_nnz[local_idx] += 1;
+                                const int dof_index = (*dof_index_data)(i + stencil[stencil_index]);
+                                if (dof_index >= i_lower && dof_index < i_upper)
+                                {
+                                    d_nnz[local_idx] += 1;
+                                }
+                                else
+                                {
+                                    o_nnz[local_idx] += 1;
+                                }
                             }
                         }
+                        d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
+                        o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                     }
-                    d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
-                    o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                 }
             }
         }
-    }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        n_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        n_local ? &d_nnz[0] : nullptr,
-                        0,
-                        n_local ? &o_nnz[0] : nullptr,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            n_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            n_local ? &d_nnz[0] : nullptr,
+                            0,
+                            n_local ? &o_nnz[0] : nullptr,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
@@ -0,0 +1,1143 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/CCPoissonGMGLevelSolver.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PoissonUtilities.h"
+#include "ibtk/box_utilities.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "ArrayData.h"
+#include "BoundaryBox.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellDataFactory.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "CellVariable.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchGeometry.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "VariableDatabase.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Number of ghosts cells used for each variable quantity.
+static const int CELLG = 1;
+
+// Size of the finite difference stencil.
+static const int STENCIL_SIZE = 2 * NDIM + 1;
+
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_solve_coarsest_level;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+inline int
+coarsen_index(const int i)
+{
+    return (i < 0 ? (i + 1) / 2 - 1 : i / 2);
+} // coarsen_index
+
+// Perform one red-black Gauss-Seidel half-sweep (cells of one color) on the
+// cells of a box.  The solution data must have one layer of ghost cells.  The
+// stencil coefficients are stored at depths coef_depth, ..., coef_depth +
+// STENCIL_SIZE - 1 of the coefficient data.
+void
+smooth_patch(ArrayData<NDIM, double>& x_data,
+             const ArrayData<NDIM, double>& f_data,
+             const ArrayData<NDIM, double>& coef_data,
+             const int coef_depth,
+             const Box<NDIM>& box,
+             const int color)
+{
+    std::array<int, NDIM> x_stride, f_stride, a_stride;
+    compute_strides(x_stride, x_data.getBox());
+    compute_strides(f_stride, f_data.getBox());
+    compute_strides(a_stride, coef_data.getBox());
+    double* const x = x_data.getPointer();
+    const double* const f = f_data.getPointer();
+    std::array<const double*, STENCIL_SIZE> A;
+    for (int s = 0; s < STENCIL_SIZE; ++s) A[s] = coef_data.getPointer(coef_depth + s);
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        int parity = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) parity += i(d);
+        const int k_start = ((parity % 2) + 2 + color) % 2;
+        const int x_row = compute_offset(i, x_data.getBox().lower(), x_stride);
+        const int f_row = compute_offset(i, f_data.getBox().lower(), f_stride);
+        const int a_row = compute_offset(i, coef_data.getBox().lower(), a_stride);
+        for (int k = k_start; k < row_length; k += 2)
+        {
+            const int c = x_row + k;
+            const int l = a_row + k;
+            double r = f[f_row + k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                r -= A[2 * d + 1][l] * x[c - x_stride[d]] + A[2 * d + 2][l] * x[c + x_stride[d]];
+            }
+            x[c] = r / A[0][l];
+        }
+    }
+    return;
+} // smooth_patch
+
+// Compute y = A x (when f_data is nullptr) or y = f - A x on the cells of a
+// box.  The data x must have one layer of ghost cells.
+void
+apply_operator_patch(ArrayData<NDIM, double>& y_data,
+                     const ArrayData<NDIM, double>& x_data,
+                     const ArrayData<NDIM, double>* const f_data,
+                     const ArrayData<NDIM, double>& coef_data,
+                     const int coef_depth,
+                     const Box<NDIM>& box)
+{
+    std::array<int, NDIM> y_stride, x_stride, f_stride, a_stride;
+    compute_strides(y_stride, y_data.getBox());
+    compute_strides(x_stride, x_data.getBox());
+    if (f_data) compute_strides(f_stride, f_data->getBox());
+    compute_strides(a_stride, coef_data.getBox());
+    double* const y = y_data.getPointer();
+    const double* const x = x_data.getPointer();
+    const double* const f = f_data ? f_data->getPointer() : nullptr;
+    std::array<const double*, STENCIL_SIZE> A;
+    for (int s = 0; s < STENCIL_SIZE; ++s) A[s] = coef_data.getPointer(coef_depth + s);
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        const int y_row = compute_offset(i, y_data.getBox().lower(), y_stride);
+        const int x_row = compute_offset(i, x_data.getBox().lower(), x_stride);
+        const int f_row = f ? compute_offset(i, f_data->getBox().lower(), f_stride) : 0;
+        const int a_row = compute_offset(i, coef_data.getBox().lower(), a_stride);
+        for (int k = 0; k < row_length; ++k)
+        {
+            const int c = x_row + k;
+            const int l = a_row + k;
+            double Ax = A[0][l] * x[c];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                Ax += A[2 * d + 1][l] * x[c - x_stride[d]] + A[2 * d + 2][l] * x[c + x_stride[d]];
+            }
+            y[y_row + k] = f ? f[f_row + k] - Ax : Ax;
+        }
+    }
+    return;
+} // apply_operator_patch
+
+// Compute z = a x + b y on the cells of a box.
+void
+linear_sum_patch(ArrayData<NDIM, double>& z_data,
+                 const double a,
+                 const ArrayData<NDIM, double>& x_data,
+                 const double b,
+                 const ArrayData<NDIM, double>& y_data,
+                 const Box<NDIM>& box)
+{
+    std::array<int, NDIM> z_stride, x_stride, y_stride;
+    compute_strides(z_stride, z_data.getBox());
+    compute_strides(x_stride, x_data.getBox());
+    compute_strides(y_stride, y_data.getBox());
+    double* const z = z_data.getPointer();
+    const double* const x = x_data.getPointer();
+    const double* const y = y_data.getPointer();
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        double* const z_row = z + compute_offset(i, z_data.getBox().lower(), z_stride);
+        const double* const x_row = x + compute_offset(i, x_data.getBox().lower(), x_stride);
+        const double* const y_row = y + compute_offset(i, y_data.getBox().lower(), y_stride);
+        for (int k = 0; k < row_length; ++k)
+        {
+            z_row[k] = a * x_row[k] + b * y_row[k];
+        }
+    }
+    return;
+} // linear_sum_patch
+
+// Return the sum of x * y over the cells of a box.
+double
+dot_patch(const ArrayData<NDIM, double>& x_data, const ArrayData<NDIM, double>& y_data, const Box<NDIM>& box)
+{
+    std::array<int, NDIM> x_stride, y_stride;
+    compute_strides(x_stride, x_data.getBox());
+    compute_strides(y_stride, y_data.getBox());
+    const double* const x = x_data.getPointer();
+    const double* const y = y_data.getPointer();
+
+    double dot = 0.0;
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        const double* const x_row = x + compute_offset(i, x_data.getBox().lower(), x_stride);
+        const double* const y_row = y + compute_offset(i, y_data.getBox().lower(), y_stride);
+        for (int k = 0; k < row_length; ++k) dot += x_row[k] * y_row[k];
+    }
+    return dot;
+} // dot_patch
+
+// Return the sum of x over the cells of a box.
+double
+sum_patch(const ArrayData<NDIM, double>& x_data, const Box<NDIM>& box)
+{
+    std::array<int, NDIM> x_stride;
+    compute_strides(x_stride, x_data.getBox());
+    const double* const x = x_data.getPointer();
+
+    double sum = 0.0;
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const double* const x_row = x + compute_offset(get_row_start(box, row), x_data.getBox().lower(), x_stride);
+        for (int k = 0; k < row_length; ++k) sum += x_row[k];
+    }
+    return sum;
+} // sum_patch
+
+// Add the scalar alpha to the values on the cells of a box.
+void
+add_scalar_patch(ArrayData<NDIM, double>& x_data, const double alpha, const Box<NDIM>& box)
+{
+    std::array<int, NDIM> x_stride;
+    compute_strides(x_stride, x_data.getBox());
+    double* const x = x_data.getPointer();
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        double* const x_row = x + compute_offset(get_row_start(box, row), x_data.getBox().lower(), x_stride);
+        for (int k = 0; k < row_length; ++k) x_row[k] += alpha;
+    }
+    return;
+} // add_scalar_patch
+
+// Restrict fine cell-centered values to the coarse cells by cell averaging.
+void
+restrict_patch(ArrayData<NDIM, double>& coarse_data,
+               const int coarse_depth,
+               const ArrayData<NDIM, double>& fine_data,
+               const int fine_depth,
+               const Box<NDIM>& coarse_box,
+               const Box<NDIM>& fine_box)
+{
+    static const double weight = 1.0 / static_cast<double>(1 << NDIM);
+    coarse_data.fill(0.0, coarse_box, coarse_depth);
+    std::array<int, NDIM> coarse_stride, fine_stride;
+    compute_strides(coarse_stride, coarse_data.getBox());
+    compute_strides(fine_stride, fine_data.getBox());
+    double* const coarse = coarse_data.getPointer(coarse_depth);
+    const double* const fine = fine_data.getPointer(fine_depth);
+
+    const int num_rows = get_number_of_rows(fine_box);
+    const int row_length = fine_box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(fine_box, row);
+        hier::Index<NDIM> i_coarse;
+        for (unsigned int d = 0; d < NDIM; ++d) i_coarse(d) = coarsen_index(i(d));
+        const int coarse_row = compute_offset(i_coarse, coarse_data.getBox().lower(), coarse_stride);
+        const int fine_row = compute_offset(i, fine_data.getBox().lower(), fine_stride);
+        for (int k = 0; k < row_length; ++k)
+        {
+            coarse[coarse_row + (coarsen_index(i(0) + k) - i_coarse(0))] += weight * fine[fine_row + k];
+        }
+    }
+    return;
+} // restrict_patch
+
+// Restrict fine side-centered values to the coarse sides by averaging the
+// values on the fine sides that cover each coarse side.
+void
+restrict_side_patch(SideData<NDIM, double>& coarse_data,
+                    const SideData<NDIM, double>& fine_data,
+                    const Box<NDIM>& coarse_box)
+{
+    static const double weight = 1.0 / static_cast<double>(1 << (NDIM - 1));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        ArrayData<NDIM, double>& coarse = coarse_data.getArrayData(axis);
+        const ArrayData<NDIM, double>& fine = fine_data.getArrayData(axis);
+        const Box<NDIM> coarse_side_box = SideGeometry<NDIM>::toSideBox(coarse_box, axis);
+        for (int depth = 0; depth < coarse_data.getDepth(); ++depth)
+        {
+            for (Box<NDIM>::Iterator b(coarse_side_box); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                double val = 0.0;
+                for (int child = 0; child < (1 << NDIM); ++child)
+                {
+                    // Only the fine sides that coincide with the coarse side
+                    // contribute.
+                    if (child & (1 << axis)) continue;
+                    hier::Index<NDIM> i_fine;
+                    for (unsigned int d = 0; d < NDIM; ++d) i_fine(d) = 2 * i(d) + ((child & (1 << d)) ? 1 : 0);
+                    val += fine(i_fine, depth);
+                }
+                coarse(i, depth) = weight * val;
+            }
+        }
+    }
+    return;
+} // restrict_side_patch
+
+// Add the cell-centered (multi)linear interpolation of the coarse correction
+// to the fine solution.  The coarse solution data must have valid ghost cell
+// values.
+void
+prolong_patch(ArrayData<NDIM, double>& fine_x_data,
+              const ArrayData<NDIM, double>& coarse_x_data,
+              const Box<NDIM>& fine_box)
+{
+    const Box<NDIM>& fine_x_box = fine_x_data.getBox();
+    const Box<NDIM>& coarse_x_box = coarse_x_data.getBox();
+    std::array<int, NDIM> fine_stride, coarse_stride;
+    compute_strides(fine_stride, fine_x_box);
+    compute_strides(coarse_stride, coarse_x_box);
+    double* const fine_x = fine_x_data.getPointer();
+    const double* const coarse_x = coarse_x_data.getPointer();
+
+    const int num_rows = get_number_of_rows(fine_box);
+    const int row_length = fine_box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        hier::Index<NDIM> i = get_row_start(fine_box, row);
+        const int fine_row = compute_offset(i, fine_x_box.lower(), fine_stride);
+        for (int k = 0; k < row_length; ++k, ++i(0))
+        {
+            // Each fine cell is interpolated from its parent (weight 3/4 in
+            // each direction) and the coarse neighbor on the same side of the
+            // parent as the fine cell (weight 1/4 in each direction).
+            hier::Index<NDIM> i_coarse;
+            std::array<int, NDIM> shift;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                i_coarse(d) = coarsen_index(i(d));
+                shift[d] = (i(d) == 2 * i_coarse(d) ? -coarse_stride[d] : coarse_stride[d]);
+            }
+            const int c = compute_offset(i_coarse, coarse_x_box.lower(), coarse_stride);
+            double val = 0.0;
+            for (int corner = 0; corner < (1 << NDIM); ++corner)
+            {
+                double w = 1.0;
+                int offset = c;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (corner & (1 << d))
+                    {
+                        w *= 0.25;
+                        offset += shift[d];
+                    }
+                    else
+                    {
+                        w *= 0.75;
+                    }
+                }
+                val += w * coarse_x[offset];
+            }
+            fine_x[fine_row + k] += val;
+        }
+    }
+    return;
+} // prolong_patch
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+CCPoissonGMGLevelSolver::CCPoissonGMGLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_rel_residual_tol = 1.0e-5;
+    d_abs_residual_tol = 1.0e-50;
+    d_max_iterations = 25;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("max_iterations")) d_max_iterations = input_db->getInteger("max_iterations");
+        if (input_db->keyExists("abs_residual_tol")) d_abs_residual_tol = input_db->getDouble("abs_residual_tol");
+        if (input_db->keyExists("rel_residual_tol")) d_rel_residual_tol = input_db->getDouble("rel_residual_tol");
+        if (input_db->keyExists("initial_guess_nonzero"))
+            d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+        if (input_db->keyExists("num_pre_relax_steps"))
+            d_num_pre_relax_steps = input_db->getInteger("num_pre_relax_steps");
+        if (input_db->keyExists("num_post_relax_steps"))
+            d_num_post_relax_steps = input_db->getInteger("num_post_relax_steps");
+        if (input_db->keyExists("max_multigrid_levels"))
+            d_max_multigrid_levels = input_db->getInteger("max_multigrid_levels");
+        if (input_db->keyExists("coarse_solver_max_iterations"))
+            d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("coarse_solver_abs_residual_tol"))
+            d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
+        if (input_db->keyExists("coarse_solver_rel_residual_tol"))
+            d_coarse_solver_rel_residual_tol = input_db->getDouble("coarse_solver_rel_residual_tol");
+    }
+    if (d_max_multigrid_levels < 1)
+    {
+        TBOX_ERROR(d_object_name << "::CCPoissonGMGLevelSolver()\n"
+                                 << "  max_multigrid_levels must be positive" << std::endl);
+    }
+
+    // Setup the stencil offsets.  This is the same ordering as the one used by
+    // CCPoissonHypreLevelSolver.
+    d_stencil_offsets.resize(STENCIL_SIZE, hier::Index<NDIM>(0));
+    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++stencil_index)
+        {
+            d_stencil_offsets[stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+
+    // Construct the scratch variables.  Only the solution and the vector to
+    // which the operator is applied by the coarsest level solver require
+    // ghost cells.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    d_context = var_db->getContext(object_name + "::CONTEXT");
+    const std::array<int*, 9> idxs = { { &d_sol_idx,
+                                         &d_rhs_idx,
+                                         &d_res_idx,
+                                         &d_aux_idx,
+                                         &d_r_hat_idx,
+                                         &d_p_idx,
+                                         &d_v_idx,
+                                         &d_s_idx,
+                                         &d_t_idx } };
+    const std::array<std::string, 9> names = {
+        { "::sol", "::rhs", "::res", "::aux", "::r_hat", "::p", "::v", "::s", "::t" }
+    };
+    const std::array<int, 9> gcws = { { CELLG, 0, 0, CELLG, 0, 0, 0, 0, 0 } };
+    for (unsigned int k = 0; k < idxs.size(); ++k)
+    {
+        Pointer<CellVariable<NDIM, double> > var = new CellVariable<NDIM, double>(object_name + names[k]);
+        if (var_db->checkVariableExists(var->getName()))
+        {
+            var = var_db->getVariable(var->getName());
+            *idxs[k] = var_db->mapVariableAndContextToIndex(var, d_context);
+            var_db->removePatchDataIndex(*idxs[k]);
+        }
+        *idxs[k] = var_db->registerVariableAndContext(var, d_context, IntVector<NDIM>(gcws[k]));
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::CCPoissonGMGLevelSolver::solveSystem()");
+                 t_solve_coarsest_level =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonGMGLevelSolver::solveCoarsestLevel()");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonGMGLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonGMGLevelSolver::deallocateSolverState()"););
+    return;
+} // CCPoissonGMGLevelSolver
+
+CCPoissonGMGLevelSolver::~CCPoissonGMGLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~CCPoissonGMGLevelSolver
+
+bool
+CCPoissonGMGLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Ensure the initial guess is zero when appropriate.
+    if (!d_initial_guess_nonzero) x.setToScalar(0.0, /*interior_only*/ false);
+
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    const int b_idx = b.getComponentDescriptorIndex(0);
+
+    // Modify right-hand-side data to account for any inhomogeneous boundary
+    // conditions, following CCPoissonHypreLevelSolver.
+    const bool level_zero = (d_level_num == 0);
+    std::vector<Pointer<CellData<NDIM, double> > > b_adj_data(d_level->getNumberOfPatches());
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+        Pointer<CellData<NDIM, double> > b_data = patch->getPatchData(b_idx);
+        const Array<BoundaryBox<NDIM> >& type_1_cf_bdry =
+            level_zero ? Array<BoundaryBox<NDIM> >() :
+                         d_cf_boundary->getBoundaries(patch->getPatchNumber(), /* boundary type */ 1);
+        const bool at_physical_bdry = pgeom->intersectsPhysicalBoundary();
+        const bool at_cf_bdry = type_1_cf_bdry.size() > 0;
+        if (at_physical_bdry || at_cf_bdry)
+        {
+            Pointer<CellData<NDIM, double> > b_adj =
+                new CellData<NDIM, double>(b_data->getBox(), b_data->getDepth(), b_data->getGhostCellWidth());
+            b_adj->copy(*b_data);
+            if (at_physical_bdry)
+            {
+                PoissonUtilities::adjustRHSAtPhysicalBoundary(
+                    *b_adj, patch, d_poisson_spec, d_bc_coefs, d_solution_time, d_homogeneous_bc);
+            }
+            if (at_cf_bdry)
+            {
+                PoissonUtilities::adjustRHSAtCoarseFineBoundary(
+                    *b_adj, *x_data, patch, d_poisson_spec, type_1_cf_bdry);
+            }
+            b_adj_data[p()] = b_adj;
+        }
+        else
+        {
+            b_adj_data[p()] = b_data;
+        }
+    }
+
+    // Solve the system for each data depth.
+    bool converged = true;
+    d_current_iterations = 0;
+    d_current_residual_norm = 0.0;
+    for (unsigned int depth = 0; depth < d_depth; ++depth)
+    {
+        d_sol_bc_op->setPhysicalBcCoef(d_bc_coefs[depth]);
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+            Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+            Pointer<CellData<NDIM, double> > rhs_data = patch->getPatchData(d_rhs_idx);
+            for (CellIterator<NDIM> b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM>& i = b();
+                (*sol_data)(i) = (*x_data)(i, depth);
+                (*rhs_data)(i) = (*b_adj_data[p()])(i, depth);
+            }
+        }
+
+        // When the operator is singular, we solve the system with the
+        // right-hand side projected onto the range of the operator and return
+        // the solution with zero mean.
+        if (d_nullspace_contains_constant_vec) projectOutConstant(0, d_rhs_idx);
+        const double rhs_norm = std::sqrt(computeInnerProduct(0, d_rhs_idx, d_rhs_idx));
+
+        // Perform V-cycles until the residual is sufficiently small.
+        bool depth_converged = false;
+        int iterations = 0;
+        double residual_norm = computeResidual(0, depth);
+        while (!depth_converged && iterations < d_max_iterations)
+        {
+            applyVCycle(0, depth);
+            if (d_nullspace_contains_constant_vec) projectOutConstant(0, d_sol_idx);
+            residual_norm = computeResidual(0, depth);
+            ++iterations;
+            depth_converged = residual_norm <= d_abs_residual_tol || residual_norm <= d_rel_residual_tol * rhs_norm;
+        }
+        converged = converged && depth_converged;
+        d_current_iterations = std::max(d_current_iterations, iterations);
+        d_current_residual_norm = std::max(d_current_residual_norm, residual_norm);
+
+        // Copy the solution back into the solution vector.
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+            Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+            for (CellIterator<NDIM> b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM>& i = b();
+                (*x_data)(i, depth) = (*sol_data)(i);
+            }
+        }
+    }
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+             << "iterations = " << d_current_iterations << "\n"
+             << "residual norm = " << d_current_residual_norm << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+CCPoissonGMGLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                               const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components" << std::endl);
+    }
+
+    const Pointer<PatchHierarchy<NDIM> >& patch_hierarchy = x.getPatchHierarchy();
+    if (patch_hierarchy != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy" << std::endl);
+    }
+
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    if (coarsest_ln < 0)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest level number must not be negative" << std::endl);
+    }
+    if (coarsest_ln != b.getCoarsestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have same coarsest level number" << std::endl);
+    }
+
+    const int finest_ln = x.getFinestLevelNumber();
+    if (finest_ln < coarsest_ln)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  finest level number must be >= coarsest level number" << std::endl);
+    }
+    if (finest_ln != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have same finest level number" << std::endl);
+    }
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!patch_hierarchy->getPatchLevel(ln))
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  hierarchy level " << ln << " does not exist" << std::endl);
+        }
+    }
+
+    if (coarsest_ln != finest_ln)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in CCPoissonGMGLevelSolver" << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    if (!d_nullspace_basis_vecs.empty())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  only the constant vector is supported as a nullspace basis vector"
+                                 << std::endl);
+    }
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+    d_level = d_hierarchy->getPatchLevel(d_level_num);
+    if (d_level_num > 0)
+    {
+        d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
+    }
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    d_depth = x_fac->getDefaultDepth();
+    if (d_bc_coefs.size() != d_depth)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  the number of boundary condition objects must equal the data depth"
+                                 << std::endl);
+    }
+
+    // Setup the boundary operator used to extend the coarse-grid correction.
+    d_sol_bc_op = new CartCellRobinPhysBdryOp(d_sol_idx, d_bc_coefs[0], /*homogeneous_bc*/ true);
+
+    // Setup the multigrid levels.  Each coarser level is obtained by
+    // coarsening all of the patch boxes of the next finer level by a factor of
+    // two; we stop once some patch box cannot be coarsened.
+    static const IntVector<NDIM> ratio = 2;
+    d_mg_levels.push_back(d_level);
+    while (static_cast<int>(d_mg_levels.size()) < d_max_multigrid_levels)
+    {
+        const BoxArray<NDIM>& boxes = d_mg_levels.back()->getBoxes();
+        bool can_coarsen = boxes.size() > 0;
+        for (int k = 0; k < boxes.size() && can_coarsen; ++k)
+        {
+            const Box<NDIM>& box = boxes[k];
+            const Box<NDIM> coarse_box = Box<NDIM>::coarsen(box, ratio);
+            can_coarsen = Box<NDIM>::refine(coarse_box, ratio) == box;
+            for (unsigned int d = 0; d < NDIM; ++d) can_coarsen = can_coarsen && box.numberCells(d) >= 4;
+        }
+        if (!can_coarsen) break;
+        Pointer<PatchLevel<NDIM> > coarse_level = new PatchLevel<NDIM>();
+        coarse_level->setCoarsenedPatchLevel(d_mg_levels.back(), ratio);
+        d_mg_levels.push_back(coarse_level);
+    }
+    const int num_mg_levels = static_cast<int>(d_mg_levels.size());
+    const int coarsest_mg_ln = num_mg_levels - 1;
+
+    // Variable coefficients are rediscretized on the coarser multigrid levels
+    // from their averages.  The coefficient data are allocated on the coarser
+    // multigrid levels using the patch data indices provided by the
+    // PoissonSpecifications object so that the same object can be used on
+    // every multigrid level.
+    const int C_idx =
+        (!d_poisson_spec.cIsZero() && !d_poisson_spec.cIsConstant()) ? d_poisson_spec.getCPatchDataId() : invalid_index;
+    const int D_idx = !d_poisson_spec.dIsConstant() ? d_poisson_spec.getDPatchDataId() : invalid_index;
+
+    // Allocate scratch data, compute the operator coefficients, and setup the
+    // ghost cell filling schedules on each multigrid level.  The vectors used
+    // by the coarsest level solver are only allocated on the coarsest level.
+    d_stencil_coefs.resize(num_mg_levels);
+    d_patch_ghost_boxes.resize(num_mg_levels);
+    d_ghost_fill_scheds.resize(num_mg_levels);
+    RefineAlgorithm<NDIM> sol_ghost_fill_alg, aux_ghost_fill_alg;
+    sol_ghost_fill_alg.registerRefine(d_sol_idx, d_sol_idx, d_sol_idx, Pointer<RefineOperator<NDIM> >());
+    aux_ghost_fill_alg.registerRefine(d_aux_idx, d_aux_idx, d_aux_idx, Pointer<RefineOperator<NDIM> >());
+    for (int mg_ln = 0; mg_ln < num_mg_levels; ++mg_ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+        level->allocatePatchData(d_sol_idx);
+        level->allocatePatchData(d_rhs_idx);
+        level->allocatePatchData(d_res_idx);
+        if (mg_ln == coarsest_mg_ln)
+        {
+            for (const int idx : { d_aux_idx, d_r_hat_idx, d_p_idx, d_v_idx, d_s_idx, d_t_idx })
+            {
+                level->allocatePatchData(idx);
+            }
+        }
+        if (mg_ln > 0)
+        {
+            if (C_idx != invalid_index) level->allocatePatchData(C_idx);
+            if (D_idx != invalid_index) level->allocatePatchData(D_idx);
+        }
+        d_stencil_coefs[mg_ln].resize(level->getNumberOfPatches());
+        d_patch_ghost_boxes[mg_ln].resize(level->getNumberOfPatches());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            if (mg_ln > 0)
+            {
+                Pointer<Patch<NDIM> > fine_patch = d_mg_levels[mg_ln - 1]->getPatch(p());
+                if (C_idx != invalid_index)
+                {
+                    Pointer<CellData<NDIM, double> > C_data = patch->getPatchData(C_idx);
+                    Pointer<CellData<NDIM, double> > fine_C_data = fine_patch->getPatchData(C_idx);
+                    for (int depth = 0; depth < C_data->getDepth(); ++depth)
+                    {
+                        restrict_patch(C_data->getArrayData(),
+                                       depth,
+                                       fine_C_data->getArrayData(),
+                                       depth,
+                                       patch_box,
+                                       fine_patch->getBox());
+                    }
+                }
+                if (D_idx != invalid_index)
+                {
+                    Pointer<SideData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+                    Pointer<SideData<NDIM, double> > fine_D_data = fine_patch->getPatchData(D_idx);
+                    restrict_side_patch(*D_data, *fine_D_data, patch_box);
+                }
+            }
+            d_stencil_coefs[mg_ln][p()] =
+                new CellData<NDIM, double>(patch_box, d_depth * STENCIL_SIZE, IntVector<NDIM>(0));
+            PoissonUtilities::computeMatrixCoefficients(
+                *d_stencil_coefs[mg_ln][p()], patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
+            d_patch_ghost_boxes[mg_ln][p()] = BoxList<NDIM>(Box<NDIM>::grow(patch_box, IntVector<NDIM>(CELLG)));
+            d_patch_ghost_boxes[mg_ln][p()].removeIntersections(patch_box);
+        }
+        d_ghost_fill_scheds[mg_ln][d_sol_idx] = sol_ghost_fill_alg.createSchedule(level);
+        if (mg_ln == coarsest_mg_ln) d_ghost_fill_scheds[mg_ln][d_aux_idx] = aux_ghost_fill_alg.createSchedule(level);
+    }
+
+    // The averaged coefficients are no longer needed once the operator
+    // coefficients have been computed.
+    for (int mg_ln = 1; mg_ln < num_mg_levels; ++mg_ln)
+    {
+        if (C_idx != invalid_index) d_mg_levels[mg_ln]->deallocatePatchData(C_idx);
+        if (D_idx != invalid_index) d_mg_levels[mg_ln]->deallocatePatchData(D_idx);
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+CCPoissonGMGLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // The coarse multigrid levels are owned by this object; only the data
+    // allocated on the patch level itself needs to be explicitly deallocated.
+    for (const int idx :
+         { d_sol_idx, d_rhs_idx, d_res_idx, d_aux_idx, d_r_hat_idx, d_p_idx, d_v_idx, d_s_idx, d_t_idx })
+    {
+        if (d_level->checkAllocated(idx)) d_level->deallocatePatchData(idx);
+    }
+    d_ghost_fill_scheds.clear();
+    d_sol_bc_op.setNull();
+    d_patch_ghost_boxes.clear();
+    d_stencil_coefs.clear();
+    d_mg_levels.clear();
+    d_cf_boundary.setNull();
+    d_level.setNull();
+    d_hierarchy.setNull();
+    d_level_num = IBTK::invalid_level_number;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+CCPoissonGMGLevelSolver::applyVCycle(const int mg_ln, const int depth)
+{
+    const int coarsest_mg_ln = static_cast<int>(d_mg_levels.size()) - 1;
+    if (mg_ln == coarsest_mg_ln)
+    {
+        solveCoarsestLevel(depth);
+        return;
+    }
+
+    // Pre-smooth and restrict the residual to the next coarser level.
+    smooth(mg_ln, depth, d_num_pre_relax_steps);
+    computeResidual(mg_ln, depth);
+    Pointer<PatchLevel<NDIM> > fine_level = d_mg_levels[mg_ln];
+    Pointer<PatchLevel<NDIM> > coarse_level = d_mg_levels[mg_ln + 1];
+    for (PatchLevel<NDIM>::Iterator p(fine_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > fine_patch = fine_level->getPatch(p());
+        Pointer<Patch<NDIM> > coarse_patch = coarse_level->getPatch(p());
+        Pointer<CellData<NDIM, double> > fine_res_data = fine_patch->getPatchData(d_res_idx);
+        Pointer<CellData<NDIM, double> > coarse_rhs_data = coarse_patch->getPatchData(d_rhs_idx);
+        Pointer<CellData<NDIM, double> > coarse_sol_data = coarse_patch->getPatchData(d_sol_idx);
+        restrict_patch(coarse_rhs_data->getArrayData(),
+                       0,
+                       fine_res_data->getArrayData(),
+                       0,
+                       coarse_patch->getBox(),
+                       fine_patch->getBox());
+        coarse_sol_data->fillAll(0.0);
+    }
+
+    // Solve for the coarse-grid correction and prolong it to this level.
+    //
+    // NOTE: The coarse correction solves the error equation, which has
+    // homogeneous boundary conditions, so the ghost cells at physical
+    // boundaries are filled using the homogeneous form of the boundary
+    // conditions before the correction is interpolated.
+    applyVCycle(mg_ln + 1, depth);
+    fillGhostCells(mg_ln + 1, d_sol_idx, /*homogeneous_physical_bc*/ true);
+    for (PatchLevel<NDIM>::Iterator p(fine_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > fine_patch = fine_level->getPatch(p());
+        Pointer<Patch<NDIM> > coarse_patch = coarse_level->getPatch(p());
+        Pointer<CellData<NDIM, double> > fine_sol_data = fine_patch->getPatchData(d_sol_idx);
+        Pointer<CellData<NDIM, double> > coarse_sol_data = coarse_patch->getPatchData(d_sol_idx);
+        prolong_patch(fine_sol_data->getArrayData(), coarse_sol_data->getArrayData(), fine_patch->getBox());
+    }
+
+    // Post-smooth.
+    smooth(mg_ln, depth, d_num_post_relax_steps);
+    return;
+} // applyVCycle
+
+void
+CCPoissonGMGLevelSolver::solveCoarsestLevel(const int depth)
+{
+    IBTK_TIMER_START(t_solve_coarsest_level);
+
+    // Solve the coarsest level problem with BiCGStab, using the current
+    // solution data as the initial guess.  The operator is symmetric for
+    // cell-centered data, but we use a nonsymmetric Krylov method so that the
+    // same coarse solver can be used for all boundary condition types.
+    const int mg_ln = static_cast<int>(d_mg_levels.size()) - 1;
+    if (d_nullspace_contains_constant_vec) projectOutConstant(mg_ln, d_rhs_idx);
+    double residual_norm = computeResidual(mg_ln, depth);
+    const double initial_residual_norm = residual_norm;
+    levelLinearSum(mg_ln, d_r_hat_idx, 1.0, d_res_idx, 0.0, d_res_idx);
+    levelLinearSum(mg_ln, d_p_idx, 1.0, d_res_idx, 0.0, d_res_idx);
+    double rho = computeInnerProduct(mg_ln, d_r_hat_idx, d_res_idx);
+    for (int k = 0; k < d_coarse_solver_max_iterations; ++k)
+    {
+        if (residual_norm <= d_coarse_solver_abs_residual_tol ||
+            residual_norm <= d_coarse_solver_rel_residual_tol * initial_residual_norm)
+        {
+            break;
+        }
+        applyOperator(mg_ln, depth, d_v_idx, d_p_idx);
+        const double r_hat_dot_v = computeInnerProduct(mg_ln, d_r_hat_idx, d_v_idx);
+        if (r_hat_dot_v == 0.0) break;
+        const double alpha = rho / r_hat_dot_v;
+        levelLinearSum(mg_ln, d_s_idx, 1.0, d_res_idx, -alpha, d_v_idx);
+        applyOperator(mg_ln, depth, d_t_idx, d_s_idx);
+        const double t_dot_t = computeInnerProduct(mg_ln, d_t_idx, d_t_idx);
+        const double omega = t_dot_t > 0.0 ? computeInnerProduct(mg_ln, d_t_idx, d_s_idx) / t_dot_t : 0.0;
+        levelLinearSum(mg_ln, d_sol_idx, 1.0, d_sol_idx, alpha, d_p_idx);
+        levelLinearSum(mg_ln, d_sol_idx, 1.0, d_sol_idx, omega, d_s_idx);
+        levelLinearSum(mg_ln, d_res_idx, 1.0, d_s_idx, -omega, d_t_idx);
+        residual_norm = std::sqrt(computeInnerProduct(mg_ln, d_res_idx, d_res_idx));
+        const double rho_new = computeInnerProduct(mg_ln, d_r_hat_idx, d_res_idx);
+        if (omega == 0.0 || rho_new == 0.0) break;
+        const double beta = (rho_new / rho) * (alpha / omega);
+        levelLinearSum(mg_ln, d_p_idx, 1.0, d_p_idx, -omega, d_v_idx);
+        levelLinearSum(mg_ln, d_p_idx, 1.0, d_res_idx, beta, d_p_idx);
+        rho = rho_new;
+    }
+    if (d_nullspace_contains_constant_vec) projectOutConstant(mg_ln, d_sol_idx);
+
+    IBTK_TIMER_STOP(t_solve_coarsest_level);
+    return;
+} // solveCoarsestLevel
+
+void
+CCPoissonGMGLevelSolver::smooth(const int mg_ln, const int depth, const int num_sweeps)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    {
+        for (int color = 0; color < 2; ++color)
+        {
+            fillGhostCells(mg_ln, d_sol_idx, /*homogeneous_physical_bc*/ false);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+                Pointer<CellData<NDIM, double> > rhs_data = patch->getPatchData(d_rhs_idx);
+                smooth_patch(sol_data->getArrayData(),
+                             rhs_data->getArrayData(),
+                             d_stencil_coefs[mg_ln][p()]->getArrayData(),
+                             depth * STENCIL_SIZE,
+                             patch->getBox(),
+                             color);
+            }
+        }
+    }
+    return;
+} // smooth
+
+double
+CCPoissonGMGLevelSolver::computeResidual(const int mg_ln, const int depth)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    fillGhostCells(mg_ln, d_sol_idx, /*homogeneous_physical_bc*/ false);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+        Pointer<CellData<NDIM, double> > rhs_data = patch->getPatchData(d_rhs_idx);
+        Pointer<CellData<NDIM, double> > res_data = patch->getPatchData(d_res_idx);
+        apply_operator_patch(res_data->getArrayData(),
+                             sol_data->getArrayData(),
+                             &rhs_data->getArrayData(),
+                             d_stencil_coefs[mg_ln][p()]->getArrayData(),
+                             depth * STENCIL_SIZE,
+                             patch->getBox());
+    }
+    return std::sqrt(computeInnerProduct(mg_ln, d_res_idx, d_res_idx));
+} // computeResidual
+
+void
+CCPoissonGMGLevelSolver::applyOperator(const int mg_ln, const int depth, const int dst_idx, const int src_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    levelLinearSum(mg_ln, d_aux_idx, 1.0, src_idx, 0.0, src_idx);
+    fillGhostCells(mg_ln, d_aux_idx, /*homogeneous_physical_bc*/ false);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > aux_data = patch->getPatchData(d_aux_idx);
+        Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+        apply_operator_patch(dst_data->getArrayData(),
+                             aux_data->getArrayData(),
+                             nullptr,
+                             d_stencil_coefs[mg_ln][p()]->getArrayData(),
+                             depth * STENCIL_SIZE,
+                             patch->getBox());
+    }
+    return;
+} // applyOperator
+
+double
+CCPoissonGMGLevelSolver::computeInnerProduct(const int mg_ln, const int idx1, const int idx2)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    double dot = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data1 = patch->getPatchData(idx1);
+        Pointer<CellData<NDIM, double> > data2 = patch->getPatchData(idx2);
+        dot += dot_patch(data1->getArrayData(), data2->getArrayData(), patch->getBox());
+    }
+    return IBTK_MPI::sumReduction(dot);
+} // computeInnerProduct
+
+void
+CCPoissonGMGLevelSolver::levelLinearSum(const int mg_ln,
+                                        const int dst_idx,
+                                        const double alpha,
+                                        const int src1_idx,
+                                        const double beta,
+                                        const int src2_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+        Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+        Pointer<CellData<NDIM, double> > src2_data = patch->getPatchData(src2_idx);
+        linear_sum_patch(dst_data->getArrayData(),
+                         alpha,
+                         src1_data->getArrayData(),
+                         beta,
+                         src2_data->getArrayData(),
+                         patch->getBox());
+    }
+    return;
+} // levelLinearSum
+
+void
+CCPoissonGMGLevelSolver::projectOutConstant(const int mg_ln, const int data_idx)
+{
+    // All cells on a multigrid level have the same volume, so the mean value
+    // is the arithmetic average of the cell values.
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    double sum = 0.0, num_cells = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        sum += sum_patch(data->getArrayData(), patch->getBox());
+        num_cells += patch->getBox().size();
+    }
+    sum = IBTK_MPI::sumReduction(sum);
+    num_cells = IBTK_MPI::sumReduction(num_cells);
+    const double mean = sum / num_cells;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        add_scalar_patch(data->getArrayData(), -mean, patch->getBox());
+    }
+    return;
+} // projectOutConstant
+
+void
+CCPoissonGMGLevelSolver::fillGhostCells(const int mg_ln, const int data_idx, const bool homogeneous_physical_bc)
+{
+    // Set the values in all ghost cells; values in ghost cells that overlap
+    // neighboring patches are subsequently overwritten by the schedule.
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (BoxList<NDIM>::Iterator bl(d_patch_ghost_boxes[mg_ln][p()]); bl; bl++)
+        {
+            data->fill(0.0, bl());
+        }
+    }
+    d_ghost_fill_scheds[mg_ln][data_idx]->fillData(d_solution_time);
+    if (!homogeneous_physical_bc) return;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data_idx == d_sol_idx);
+#endif
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (patch->getPatchGeometry()->intersectsPhysicalBoundary())
+        {
+            d_sol_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, IntVector<NDIM>(CELLG));
+        }
+    }
+    return;
+} // fillGhostCells
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
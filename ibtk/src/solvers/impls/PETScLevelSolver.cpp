@@ -62,6 +62,19 @@ static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
 
+void
+destroy_petsc_is(std::vector<IS>& petsc_is)
+{
+    int ierr;
+    for (auto& is : petsc_is)
+    {
+        ierr = ISDestroy(&is);
+        IBTK_CHKERRQ(ierr);
+    }
+    petsc_is.clear();
+    return;
+} // destroy_petsc_is
+
 void
 generate_petsc_is_from_std_is(std::vector<std::set<int> >& overlap_std,
                               std::vector<std::set<int> >& nonoverlap_std,
@@ -70,18 +83,8 @@ generate_petsc_is_from_std_is(std::vector<std::set<int> >& overlap_std,
 {
     // Destroy old IS'es and generate new ones.
     int ierr;
-    for (auto& is : overlap_petsc)
-    {
-        ierr = ISDestroy(&is);
-        IBTK_CHKERRQ(ierr);
-    }
-    overlap_petsc.clear();
-    for (auto& is : nonoverlap_petsc)
-    {
-        ierr = ISDestroy(&is);
-        IBTK_CHKERRQ(ierr);
-    }
-    nonoverlap_petsc.clear();
+    destroy_petsc_is(overlap_petsc);
+    destroy_petsc_is(nonoverlap_petsc);
 
     const int n_overlap_subdomains = static_cast<int>(overlap_std.size());
     overlap_petsc.resize(n_overlap_subdomains);
@@ -155,6 +158,8 @@ PETScLevelSolver::~PETScLevelSolver()
         ierr = ISDestroy(&is);
         IBTK_CHKERRQ(ierr);
     }
+    ierr = MatDestroy(&d_cached_petsc_mat);
+    IBTK_CHKERRQ(ierr);
     return;
 } // ~PETScLevelSolver
 
@@ -316,6 +321,23 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
+    // Reuse the matrix retained by deallocateSolverState() if the patch level
+    // has not changed since it was constructed.
+    int ierr;
+    d_reuse_level_data =
+        d_reuse_mat_structure && d_cached_petsc_mat && d_cached_level.getPointer() == d_level.getPointer();
+    if (d_reuse_level_data)
+    {
+        d_petsc_mat = d_cached_petsc_mat;
+    }
+    else
+    {
+        ierr = MatDestroy(&d_cached_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_cached_petsc_mat = nullptr;
+    d_cached_level.setNull();
+
     // Setup data cache.
     d_cached_eulerian_data.setPatchHierarchy(d_hierarchy);
     d_cached_eulerian_data.resetLevels(d_level_num, d_level_num);
@@ -324,7 +346,6 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     initializeSolverStateSpecialized(x, b);
 
     // Setup PETSc objects.
-    int ierr;
     ierr = KSPCreate(PETSC_COMM_WORLD, &d_petsc_ksp);
     IBTK_CHKERRQ(ierr);
     ierr = KSPSetOperators(d_petsc_ksp, d_petsc_mat, d_petsc_pc);
@@ -367,15 +388,8 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     // Setup the preconditioner.
     if (d_pc_type == "asm")
     {
-        // Generate user-defined subdomains.
-        std::vector<std::set<int> > overlap_is, nonoverlap_is;
-        generateASMSubdomains(overlap_is, nonoverlap_is);
-
-        // Generate PETSc IS in cases where they have not been generated directly.
-        if (!d_overlap_is.size())
-        {
-            generate_petsc_is_from_std_is(overlap_is, nonoverlap_is, d_overlap_is, d_nonoverlap_is);
-        }
+        // Generate user-defined subdomains unless they are reused.
+        if (!d_reuse_level_data) generateSubdomainIS();
 
         int num_subdomains = static_cast<int>(d_overlap_is.size());
         if (num_subdomains == 0)
@@ -434,18 +448,11 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
         ierr = MatCreateVecs(diagonal_mat_block, &d_local_x, &d_local_y);
         IBTK_CHKERRQ(ierr);
 
-        // Generate user-defined subdomains.
-        std::vector<std::set<int> > overlap_is, nonoverlap_is;
-        generateASMSubdomains(overlap_is, nonoverlap_is);
+        // Generate user-defined subdomains unless they are reused.
+        if (!d_reuse_level_data) generateSubdomainIS();
         d_n_local_subdomains = static_cast<int>(d_overlap_is.size());
         d_n_subdomains_max = IBTK_MPI::maxReduction(d_n_local_subdomains);
 
-        // Generate PETSc IS in cases where they have not been generated directly.
-        if (!d_overlap_is.size())
-        {
-            generate_petsc_is_from_std_is(overlap_is, nonoverlap_is, d_overlap_is, d_nonoverlap_is);
-        }
-
         // Get the local submatrices.
 #if PETSC_VERSION_GE(3, 8, 0)
         ierr = MatCreateSubMatrices(
@@ -662,8 +669,17 @@ PETScLevelSolver::deallocateSolverState()
         ierr = MatDestroy(&d_petsc_pc);
         IBTK_CHKERRQ(ierr);
     }
-    ierr = MatDestroy(&d_petsc_mat);
-    IBTK_CHKERRQ(ierr);
+    if (d_reuse_mat_structure)
+    {
+        // Retain the matrix so that its nonzero structure can be reused.
+        d_cached_petsc_mat = d_petsc_mat;
+        d_cached_level = d_level;
+    }
+    else
+    {
+        ierr = MatDestroy(&d_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty())
     {
         ierr = MatNullSpaceDestroy(&d_petsc_nullsp);
@@ -753,6 +769,8 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
             input_db->getIntegerArray("subdomain_box_size", d_box_size, NDIM);
         if (input_db->keyExists("subdomain_overlap_size"))
             input_db->getIntegerArray("subdomain_overlap_size", d_overlap_size, NDIM);
+        if (input_db->keyExists("reuse_matrix_structure"))
+            d_reuse_mat_structure = input_db->getBool("reuse_matrix_structure");
     }
     return;
 } // init
@@ -811,6 +829,25 @@ PETScLevelSolver::setupNullspace()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PETScLevelSolver::generateSubdomainIS()
+{
+    // Destroy IS'es generated for a previous patch level.
+    destroy_petsc_is(d_overlap_is);
+    destroy_petsc_is(d_nonoverlap_is);
+
+    // Generate user-defined subdomains.
+    std::vector<std::set<int> > overlap_is, nonoverlap_is;
+    generateASMSubdomains(overlap_is, nonoverlap_is);
+
+    // Generate PETSc IS in cases where they have not been generated directly.
+    if (!d_overlap_is.size())
+    {
+        generate_petsc_is_from_std_is(overlap_is, nonoverlap_is, d_overlap_is, d_nonoverlap_is);
+    }
+    return;
+} // generateSubdomainIS
+
 PetscErrorCode
 PETScLevelSolver::PCApply_Additive(PC pc, Vec x, Vec y)
 {
@@ -0,0 +1,1181 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PoissonUtilities.h"
+#include "ibtk/SCPoissonGMGLevelSolver.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "ArrayData.h"
+#include "BoundaryBox.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianPatchGeometry.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchGeometry.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "RefineAlgorithm.h"
+#include "RefineOperator.h"
+#include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
+#include "VariableDatabase.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Number of ghosts cells used for each variable quantity.
+static const int SIDEG = 1;
+
+// Size of the finite difference stencil.
+static const int STENCIL_SIZE = 2 * NDIM + 1;
+
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_solve_coarsest_level;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+inline void
+compute_strides(std::array<int, NDIM>& stride, const Box<NDIM>& data_box)
+{
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * data_box.numberCells(d - 1);
+    }
+    return;
+} // compute_strides
+
+inline int
+compute_offset(const hier::Index<NDIM>& i, const Box<NDIM>& data_box, const std::array<int, NDIM>& stride)
+{
+    int offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - data_box.lower()(d)) * stride[d];
+    }
+    return offset;
+} // compute_offset
+
+// Rows of a box are numbered lexicographically over the directions 1, ...,
+// NDIM-1; each row contains the indices along direction 0.
+inline int
+get_number_of_rows(const Box<NDIM>& box)
+{
+    int num_rows = 1;
+    for (unsigned int d = 1; d < NDIM; ++d) num_rows *= box.numberCells(d);
+    return num_rows;
+} // get_number_of_rows
+
+inline hier::Index<NDIM>
+get_row_start(const Box<NDIM>& box, int row)
+{
+    hier::Index<NDIM> i = box.lower();
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        const int n = box.numberCells(d);
+        i(d) += row % n;
+        row /= n;
+    }
+    return i;
+} // get_row_start
+
+inline int
+coarsen_index(const int i)
+{
+    return (i < 0 ? (i + 1) / 2 - 1 : i / 2);
+} // coarsen_index
+
+// Perform one red-black Gauss-Seidel half-sweep (indices of one color) on the
+// indices of a box.  The solution data must have one layer of ghost values.
+void
+smooth_patch(ArrayData<NDIM, double>& x_data,
+             const ArrayData<NDIM, double>& f_data,
+             const ArrayData<NDIM, double>& coef_data,
+             const Box<NDIM>& box,
+             const int color)
+{
+    std::array<int, NDIM> x_stride, f_stride, a_stride;
+    compute_strides(x_stride, x_data.getBox());
+    compute_strides(f_stride, f_data.getBox());
+    compute_strides(a_stride, coef_data.getBox());
+    double* const x = x_data.getPointer();
+    const double* const f = f_data.getPointer();
+    std::array<const double*, STENCIL_SIZE> A;
+    for (int s = 0; s < STENCIL_SIZE; ++s) A[s] = coef_data.getPointer(s);
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        int parity = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) parity += i(d);
+        const int k_start = ((parity % 2) + 2 + color) % 2;
+        const int x_row = compute_offset(i, x_data.getBox(), x_stride);
+        const int f_row = compute_offset(i, f_data.getBox(), f_stride);
+        const int a_row = compute_offset(i, coef_data.getBox(), a_stride);
+        for (int k = k_start; k < row_length; k += 2)
+        {
+            const int c = x_row + k;
+            const int l = a_row + k;
+            double r = f[f_row + k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                r -= A[2 * d + 1][l] * x[c - x_stride[d]] + A[2 * d + 2][l] * x[c + x_stride[d]];
+            }
+            x[c] = r / A[0][l];
+        }
+    }
+    return;
+} // smooth_patch
+
+// Compute y = A x (when f_data is nullptr) or y = f - A x on the indices of a
+// box.  The data x must have one layer of ghost values.
+void
+apply_operator_patch(ArrayData<NDIM, double>& y_data,
+                     const ArrayData<NDIM, double>& x_data,
+                     const ArrayData<NDIM, double>* const f_data,
+                     const ArrayData<NDIM, double>& coef_data,
+                     const Box<NDIM>& box)
+{
+    std::array<int, NDIM> y_stride, x_stride, f_stride, a_stride;
+    compute_strides(y_stride, y_data.getBox());
+    compute_strides(x_stride, x_data.getBox());
+    if (f_data) compute_strides(f_stride, f_data->getBox());
+    compute_strides(a_stride, coef_data.getBox());
+    double* const y = y_data.getPointer();
+    const double* const x = x_data.getPointer();
+    const double* const f = f_data ? f_data->getPointer() : nullptr;
+    std::array<const double*, STENCIL_SIZE> A;
+    for (int s = 0; s < STENCIL_SIZE; ++s) A[s] = coef_data.getPointer(s);
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        const int y_row = compute_offset(i, y_data.getBox(), y_stride);
+        const int x_row = compute_offset(i, x_data.getBox(), x_stride);
+        const int f_row = f ? compute_offset(i, f_data->getBox(), f_stride) : 0;
+        const int a_row = compute_offset(i, coef_data.getBox(), a_stride);
+        for (int k = 0; k < row_length; ++k)
+        {
+            const int c = x_row + k;
+            const int l = a_row + k;
+            double Ax = A[0][l] * x[c];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                Ax += A[2 * d + 1][l] * x[c - x_stride[d]] + A[2 * d + 2][l] * x[c + x_stride[d]];
+            }
+            y[y_row + k] = f ? f[f_row + k] - Ax : Ax;
+        }
+    }
+    return;
+} // apply_operator_patch
+
+// Compute z = a x + b y on the indices of a box.
+void
+linear_sum_patch(ArrayData<NDIM, double>& z_data,
+                 const double a,
+                 const ArrayData<NDIM, double>& x_data,
+                 const double b,
+                 const ArrayData<NDIM, double>& y_data,
+                 const Box<NDIM>& box)
+{
+    std::array<int, NDIM> z_stride, x_stride, y_stride;
+    compute_strides(z_stride, z_data.getBox());
+    compute_strides(x_stride, x_data.getBox());
+    compute_strides(y_stride, y_data.getBox());
+    double* const z = z_data.getPointer();
+    const double* const x = x_data.getPointer();
+    const double* const y = y_data.getPointer();
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(box, row);
+        double* const z_row = z + compute_offset(i, z_data.getBox(), z_stride);
+        const double* const x_row = x + compute_offset(i, x_data.getBox(), x_stride);
+        const double* const y_row = y + compute_offset(i, y_data.getBox(), y_stride);
+        for (int k = 0; k < row_length; ++k)
+        {
+            z_row[k] = a * x_row[k] + b * y_row[k];
+        }
+    }
+    return;
+} // linear_sum_patch
+
+// Return the sum of x * y over the sides normal to direction axis in a
+// side-centered box.  Values on the first and last sides in the normal
+// direction, which are shared with neighboring patches or lie on the physical
+// boundary, are weighted by one half.
+double
+dot_patch(const ArrayData<NDIM, double>& x_data,
+          const ArrayData<NDIM, double>& y_data,
+          const Box<NDIM>& side_box,
+          const unsigned int axis)
+{
+    std::array<int, NDIM> x_stride, y_stride;
+    compute_strides(x_stride, x_data.getBox());
+    compute_strides(y_stride, y_data.getBox());
+    const double* const x = x_data.getPointer();
+    const double* const y = y_data.getPointer();
+
+    double dot = 0.0;
+    const int num_rows = get_number_of_rows(side_box);
+    const int row_length = side_box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(side_box, row);
+        const double* const x_row = x + compute_offset(i, x_data.getBox(), x_stride);
+        const double* const y_row = y + compute_offset(i, y_data.getBox(), y_stride);
+        double row_dot = 0.0;
+        for (int k = 0; k < row_length; ++k) row_dot += x_row[k] * y_row[k];
+        if (axis == 0)
+        {
+            row_dot -= 0.5 * (x_row[0] * y_row[0] + x_row[row_length - 1] * y_row[row_length - 1]);
+        }
+        else if (i(axis) == side_box.lower()(axis) || i(axis) == side_box.upper()(axis))
+        {
+            row_dot *= 0.5;
+        }
+        dot += row_dot;
+    }
+    return dot;
+} // dot_patch
+
+// Return the sum of x over the sides normal to direction axis in a
+// side-centered box, using the same weights as dot_patch().
+double
+sum_patch(const ArrayData<NDIM, double>& x_data, const Box<NDIM>& side_box, const unsigned int axis)
+{
+    std::array<int, NDIM> x_stride;
+    compute_strides(x_stride, x_data.getBox());
+    const double* const x = x_data.getPointer();
+
+    double sum = 0.0;
+    const int num_rows = get_number_of_rows(side_box);
+    const int row_length = side_box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        const hier::Index<NDIM> i = get_row_start(side_box, row);
+        const double* const x_row = x + compute_offset(i, x_data.getBox(), x_stride);
+        double row_sum = 0.0;
+        for (int k = 0; k < row_length; ++k) row_sum += x_row[k];
+        if (axis == 0)
+        {
+            row_sum -= 0.5 * (x_row[0] + x_row[row_length - 1]);
+        }
+        else if (i(axis) == side_box.lower()(axis) || i(axis) == side_box.upper()(axis))
+        {
+            row_sum *= 0.5;
+        }
+        sum += row_sum;
+    }
+    return sum;
+} // sum_patch
+
+// Add the scalar alpha to the values on the indices of a box.
+void
+add_scalar_patch(ArrayData<NDIM, double>& x_data, const double alpha, const Box<NDIM>& box)
+{
+    std::array<int, NDIM> x_stride;
+    compute_strides(x_stride, x_data.getBox());
+    double* const x = x_data.getPointer();
+
+    const int num_rows = get_number_of_rows(box);
+    const int row_length = box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
+    {
+        double* const x_row = x + compute_offset(get_row_start(box, row), x_data.getBox(), x_stride);
+        for (int k = 0; k < row_length; ++k) x_row[k] += alpha;
+    }
+    return;
+} // add_scalar_patch
+
+// Restrict the fine residual on the sides normal to direction axis to the
+// coarse right-hand side.  In the normal direction, the fine values are
+// combined with the weights 1/4, 1/2, 1/4 (the adjoint of linear
+// interpolation), and in the tangential directions, the values on the fine
+// sides that cover each coarse side are averaged.  The fine residual data
+// must have one layer of ghost values.
+//
+// Coarse sides with Dirichlet boundary conditions, whose equations are of the
+// form u = g, get homogeneous right-hand side values because the coarse grid
+// correction must vanish there.
+void
+restrict_patch(ArrayData<NDIM, double>& coarse_f_data,
+               const ArrayData<NDIM, double>& fine_r_data,
+               const ArrayData<NDIM, double>& coarse_coef_data,
+               const Box<NDIM>& coarse_side_box,
+               const unsigned int axis)
+{
+    static const double tangential_weight = 1.0 / static_cast<double>(1 << (NDIM - 1));
+    static const std::array<double, 3> normal_weights = { { 0.25, 0.5, 0.25 } };
+    for (Box<NDIM>::Iterator b(coarse_side_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        double val = 0.0;
+        for (int child = 0; child < (1 << NDIM); ++child)
+        {
+            if (child & (1 << axis)) continue;
+            hier::Index<NDIM> i_fine;
+            for (unsigned int d = 0; d < NDIM; ++d) i_fine(d) = 2 * i(d) + ((child & (1 << d)) ? 1 : 0);
+            for (int shift = -1; shift <= 1; ++shift)
+            {
+                hier::Index<NDIM> i_shifted = i_fine;
+                i_shifted(axis) += shift;
+                val += normal_weights[shift + 1] * fine_r_data(i_shifted, 0);
+            }
+        }
+        coarse_f_data(i, 0) = tangential_weight * val;
+
+        if (i(axis) == coarse_side_box.lower()(axis) || i(axis) == coarse_side_box.upper()(axis))
+        {
+            bool is_dirichlet_row = coarse_coef_data(i, 0) == 1.0;
+            for (int s = 1; s < STENCIL_SIZE && is_dirichlet_row; ++s)
+            {
+                is_dirichlet_row = coarse_coef_data(i, s) == 0.0;
+            }
+            if (is_dirichlet_row) coarse_f_data(i, 0) = 0.0;
+        }
+    }
+    return;
+} // restrict_patch
+
+// Add the linear interpolation of the coarse correction on the sides normal
+// to direction axis to the fine solution.  In the normal direction, fine sides
+// that coincide with coarse sides take the coarse values and the other fine
+// sides take the average of the two adjacent coarse values.  In the tangential
+// directions, each fine side is interpolated from its parent (weight 3/4) and
+// the coarse neighbor on the same side of the parent as the fine side (weight
+// 1/4).  The coarse solution data must have valid ghost values.
+void
+prolong_patch(ArrayData<NDIM, double>& fine_x_data,
+              const ArrayData<NDIM, double>& coarse_x_data,
+              const Box<NDIM>& fine_side_box,
+              const unsigned int axis)
+{
+    for (Box<NDIM>::Iterator b(fine_side_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        hier::Index<NDIM> i_coarse;
+        std::array<int, NDIM> shift;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            i_coarse(d) = coarsen_index(i(d));
+            shift[d] = (i(d) == 2 * i_coarse(d) ? -1 : 1);
+        }
+        const bool on_coarse_side = i(axis) == 2 * i_coarse(axis);
+        double val = 0.0;
+        for (int corner = 0; corner < (1 << NDIM); ++corner)
+        {
+            if (on_coarse_side && (corner & (1 << axis))) continue;
+            double w = 1.0;
+            hier::Index<NDIM> i_corner = i_coarse;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (d == axis)
+                {
+                    if (!on_coarse_side) w *= 0.5;
+                    if (corner & (1 << d)) i_corner(d) += 1;
+                }
+                else if (corner & (1 << d))
+                {
+                    w *= 0.25;
+                    i_corner(d) += shift[d];
+                }
+                else
+                {
+                    w *= 0.75;
+                }
+            }
+            val += w * coarse_x_data(i_corner, 0);
+        }
+        fine_x_data(i, 0) += val;
+    }
+    return;
+} // prolong_patch
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SCPoissonGMGLevelSolver::SCPoissonGMGLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_rel_residual_tol = 1.0e-5;
+    d_abs_residual_tol = 1.0e-50;
+    d_max_iterations = 25;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("max_iterations")) d_max_iterations = input_db->getInteger("max_iterations");
+        if (input_db->keyExists("abs_residual_tol")) d_abs_residual_tol = input_db->getDouble("abs_residual_tol");
+        if (input_db->keyExists("rel_residual_tol")) d_rel_residual_tol = input_db->getDouble("rel_residual_tol");
+        if (input_db->keyExists("initial_guess_nonzero"))
+            d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
+        if (input_db->keyExists("num_pre_relax_steps"))
+            d_num_pre_relax_steps = input_db->getInteger("num_pre_relax_steps");
+        if (input_db->keyExists("num_post_relax_steps"))
+            d_num_post_relax_steps = input_db->getInteger("num_post_relax_steps");
+        if (input_db->keyExists("max_multigrid_levels"))
+            d_max_multigrid_levels = input_db->getInteger("max_multigrid_levels");
+        if (input_db->keyExists("coarse_solver_max_iterations"))
+            d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("coarse_solver_abs_residual_tol"))
+            d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
+        if (input_db->keyExists("coarse_solver_rel_residual_tol"))
+            d_coarse_solver_rel_residual_tol = input_db->getDouble("coarse_solver_rel_residual_tol");
+    }
+    if (d_max_multigrid_levels < 1)
+    {
+        TBOX_ERROR(d_object_name << "::SCPoissonGMGLevelSolver()\n"
+                                 << "  max_multigrid_levels must be positive" << std::endl);
+    }
+
+    // Setup the stencil offsets.  This is the same ordering as the one used by
+    // SCPoissonHypreLevelSolver.
+    d_stencil_offsets.resize(STENCIL_SIZE, hier::Index<NDIM>(0));
+    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+    {
+        for (int side = 0; side <= 1; ++side, ++stencil_index)
+        {
+            d_stencil_offsets[stencil_index](axis) = (side == 0 ? -1 : +1);
+        }
+    }
+
+    // Construct the scratch variables.  The solution, the residual (which is
+    // restricted using values in the normal direction), and the vector to
+    // which the operator is applied by the coarsest level solver require ghost
+    // values.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    d_context = var_db->getContext(object_name + "::CONTEXT");
+    const std::array<int*, 9> idxs = { { &d_sol_idx,
+                                         &d_rhs_idx,
+                                         &d_res_idx,
+                                         &d_aux_idx,
+                                         &d_r_hat_idx,
+                                         &d_p_idx,
+                                         &d_v_idx,
+                                         &d_s_idx,
+                                         &d_t_idx } };
+    const std::array<std::string, 9> names = {
+        { "::sol", "::rhs", "::res", "::aux", "::r_hat", "::p", "::v", "::s", "::t" }
+    };
+    const std::array<int, 9> gcws = { { SIDEG, 0, SIDEG, SIDEG, 0, 0, 0, 0, 0 } };
+    for (unsigned int k = 0; k < idxs.size(); ++k)
+    {
+        Pointer<SideVariable<NDIM, double> > var = new SideVariable<NDIM, double>(object_name + names[k]);
+        if (var_db->checkVariableExists(var->getName()))
+        {
+            var = var_db->getVariable(var->getName());
+            *idxs[k] = var_db->mapVariableAndContextToIndex(var, d_context);
+            var_db->removePatchDataIndex(*idxs[k]);
+        }
+        *idxs[k] = var_db->registerVariableAndContext(var, d_context, IntVector<NDIM>(gcws[k]));
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::SCPoissonGMGLevelSolver::solveSystem()");
+                 t_solve_coarsest_level =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonGMGLevelSolver::solveCoarsestLevel()");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonGMGLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonGMGLevelSolver::deallocateSolverState()"););
+    return;
+} // SCPoissonGMGLevelSolver
+
+SCPoissonGMGLevelSolver::~SCPoissonGMGLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~SCPoissonGMGLevelSolver
+
+bool
+SCPoissonGMGLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Ensure the initial guess is zero when appropriate.
+    if (!d_initial_guess_nonzero) x.setToScalar(0.0, /*interior_only*/ false);
+
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    const int b_idx = b.getComponentDescriptorIndex(0);
+
+    // Modify right-hand-side data to account for any inhomogeneous boundary
+    // conditions, following SCPoissonHypreLevelSolver, and copy the solution
+    // and right-hand-side data into the scratch data.
+    const bool level_zero = (d_level_num == 0);
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+        Pointer<SideData<NDIM, double> > b_data = patch->getPatchData(b_idx);
+        Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+        Pointer<SideData<NDIM, double> > rhs_data = patch->getPatchData(d_rhs_idx);
+        const Array<BoundaryBox<NDIM> >& type_1_cf_bdry =
+            level_zero ? Array<BoundaryBox<NDIM> >() :
+                         d_cf_boundary->getBoundaries(patch->getPatchNumber(), /* boundary type */ 1);
+        const bool at_physical_bdry = pgeom->intersectsPhysicalBoundary();
+        const bool at_cf_bdry = type_1_cf_bdry.size() > 0;
+        Pointer<SideData<NDIM, double> > b_adj_data = b_data;
+        if (at_physical_bdry || at_cf_bdry)
+        {
+            b_adj_data = new SideData<NDIM, double>(b_data->getBox(), b_data->getDepth(), b_data->getGhostCellWidth());
+            b_adj_data->copy(*b_data);
+            if (at_physical_bdry)
+            {
+                PoissonUtilities::adjustRHSAtPhysicalBoundary(
+                    *b_adj_data, patch, d_poisson_spec, d_bc_coefs, d_solution_time, d_homogeneous_bc);
+            }
+            if (at_cf_bdry)
+            {
+                PoissonUtilities::adjustRHSAtCoarseFineBoundary(
+                    *b_adj_data, *x_data, patch, d_poisson_spec, type_1_cf_bdry);
+            }
+        }
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            linear_sum_patch(sol_data->getArrayData(axis),
+                             1.0,
+                             x_data->getArrayData(axis),
+                             0.0,
+                             x_data->getArrayData(axis),
+                             side_box);
+            linear_sum_patch(rhs_data->getArrayData(axis),
+                             1.0,
+                             b_adj_data->getArrayData(axis),
+                             0.0,
+                             b_adj_data->getArrayData(axis),
+                             side_box);
+        }
+    }
+
+    // When the operator is singular, we solve the system with the right-hand
+    // side projected onto the range of the operator and return the solution
+    // with zero mean.
+    if (d_nullspace_contains_constant_vec) projectOutConstant(0, d_rhs_idx);
+    const double rhs_norm = std::sqrt(computeInnerProduct(0, d_rhs_idx, d_rhs_idx));
+
+    // Perform V-cycles until the residual is sufficiently small.  The
+    // components of the side-centered data are decoupled, so all components
+    // are solved for simultaneously.
+    bool converged = false;
+    d_current_iterations = 0;
+    d_current_residual_norm = computeResidual(0);
+    while (!converged && d_current_iterations < d_max_iterations)
+    {
+        applyVCycle(0);
+        if (d_nullspace_contains_constant_vec) projectOutConstant(0, d_sol_idx);
+        d_current_residual_norm = computeResidual(0);
+        ++d_current_iterations;
+        converged = d_current_residual_norm <= d_abs_residual_tol ||
+                    d_current_residual_norm <= d_rel_residual_tol * rhs_norm;
+    }
+
+    // Copy the solution back into the solution vector.
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+        Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            linear_sum_patch(x_data->getArrayData(axis),
+                             1.0,
+                             sol_data->getArrayData(axis),
+                             0.0,
+                             sol_data->getArrayData(axis),
+                             SideGeometry<NDIM>::toSideBox(patch->getBox(), axis));
+        }
+    }
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+             << "iterations = " << d_current_iterations << "\n"
+             << "residual norm = " << d_current_residual_norm << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+SCPoissonGMGLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                               const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components" << std::endl);
+    }
+
+    const Pointer<PatchHierarchy<NDIM> >& patch_hierarchy = x.getPatchHierarchy();
+    if (patch_hierarchy != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy" << std::endl);
+    }
+
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    if (coarsest_ln < 0)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest level number must not be negative" << std::endl);
+    }
+    if (coarsest_ln != b.getCoarsestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have same coarsest level number" << std::endl);
+    }
+
+    const int finest_ln = x.getFinestLevelNumber();
+    if (finest_ln < coarsest_ln)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  finest level number must be >= coarsest level number" << std::endl);
+    }
+    if (finest_ln != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have same finest level number" << std::endl);
+    }
+
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!patch_hierarchy->getPatchLevel(ln))
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  hierarchy level " << ln << " does not exist" << std::endl);
+        }
+    }
+
+    if (coarsest_ln != finest_ln)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in SCPoissonGMGLevelSolver" << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    if (!d_nullspace_basis_vecs.empty())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  only the constant vector is supported as a nullspace basis vector"
+                                 << std::endl);
+    }
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+    d_level = d_hierarchy->getPatchLevel(d_level_num);
+    if (d_level_num > 0)
+    {
+        d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
+    }
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<SideDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    if (x_fac->getDefaultDepth() != 1)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  SCPoissonGMGLevelSolver only supports data with depth 1" << std::endl);
+    }
+    if (d_bc_coefs.size() != NDIM)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  the number of boundary condition objects must equal NDIM" << std::endl);
+    }
+
+    // Setup the boundary operator used to extend the coarse-grid correction.
+    d_sol_bc_op = new CartSideRobinPhysBdryOp(d_sol_idx, d_bc_coefs, /*homogeneous_bc*/ true);
+
+    // Setup the multigrid levels.  Each coarser level is obtained by
+    // coarsening all of the patch boxes of the next finer level by a factor of
+    // two; we stop once some patch box cannot be coarsened.
+    static const IntVector<NDIM> ratio = 2;
+    d_mg_levels.push_back(d_level);
+    while (static_cast<int>(d_mg_levels.size()) < d_max_multigrid_levels)
+    {
+        const BoxArray<NDIM>& boxes = d_mg_levels.back()->getBoxes();
+        bool can_coarsen = boxes.size() > 0;
+        for (int k = 0; k < boxes.size() && can_coarsen; ++k)
+        {
+            const Box<NDIM>& box = boxes[k];
+            const Box<NDIM> coarse_box = Box<NDIM>::coarsen(box, ratio);
+            can_coarsen = Box<NDIM>::refine(coarse_box, ratio) == box;
+            for (unsigned int d = 0; d < NDIM; ++d) can_coarsen = can_coarsen && box.numberCells(d) >= 4;
+        }
+        if (!can_coarsen) break;
+        Pointer<PatchLevel<NDIM> > coarse_level = new PatchLevel<NDIM>();
+        coarse_level->setCoarsenedPatchLevel(d_mg_levels.back(), ratio);
+        d_mg_levels.push_back(coarse_level);
+    }
+    const int num_mg_levels = static_cast<int>(d_mg_levels.size());
+    const int coarsest_mg_ln = num_mg_levels - 1;
+
+    // Allocate scratch data, compute the operator coefficients, and setup the
+    // ghost cell filling schedules on each multigrid level.  The vectors used
+    // by the coarsest level solver are only allocated on the coarsest level.
+    d_stencil_coefs.resize(num_mg_levels);
+    d_patch_ghost_boxes.resize(num_mg_levels);
+    d_ghost_fill_scheds.resize(num_mg_levels);
+    RefineAlgorithm<NDIM> sol_ghost_fill_alg, res_ghost_fill_alg, aux_ghost_fill_alg;
+    sol_ghost_fill_alg.registerRefine(d_sol_idx, d_sol_idx, d_sol_idx, Pointer<RefineOperator<NDIM> >());
+    res_ghost_fill_alg.registerRefine(d_res_idx, d_res_idx, d_res_idx, Pointer<RefineOperator<NDIM> >());
+    aux_ghost_fill_alg.registerRefine(d_aux_idx, d_aux_idx, d_aux_idx, Pointer<RefineOperator<NDIM> >());
+    for (int mg_ln = 0; mg_ln < num_mg_levels; ++mg_ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+        level->allocatePatchData(d_sol_idx);
+        level->allocatePatchData(d_rhs_idx);
+        level->allocatePatchData(d_res_idx);
+        if (mg_ln == coarsest_mg_ln)
+        {
+            for (const int idx : { d_aux_idx, d_r_hat_idx, d_p_idx, d_v_idx, d_s_idx, d_t_idx })
+            {
+                level->allocatePatchData(idx);
+            }
+        }
+        d_stencil_coefs[mg_ln].resize(level->getNumberOfPatches());
+        d_patch_ghost_boxes[mg_ln].resize(level->getNumberOfPatches());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            d_stencil_coefs[mg_ln][p()] = new SideData<NDIM, double>(patch_box, STENCIL_SIZE, IntVector<NDIM>(0));
+            PoissonUtilities::computeMatrixCoefficients(
+                *d_stencil_coefs[mg_ln][p()], patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                d_patch_ghost_boxes[mg_ln][p()][axis] =
+                    BoxList<NDIM>(Box<NDIM>::grow(side_box, IntVector<NDIM>(SIDEG)));
+                d_patch_ghost_boxes[mg_ln][p()][axis].removeIntersections(side_box);
+            }
+        }
+        d_ghost_fill_scheds[mg_ln][d_sol_idx] = sol_ghost_fill_alg.createSchedule(level);
+        d_ghost_fill_scheds[mg_ln][d_res_idx] = res_ghost_fill_alg.createSchedule(level);
+        if (mg_ln == coarsest_mg_ln) d_ghost_fill_scheds[mg_ln][d_aux_idx] = aux_ghost_fill_alg.createSchedule(level);
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+SCPoissonGMGLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // The coarse multigrid levels are owned by this object; only the data
+    // allocated on the patch level itself needs to be explicitly deallocated.
+    for (const int idx :
+         { d_sol_idx, d_rhs_idx, d_res_idx, d_aux_idx, d_r_hat_idx, d_p_idx, d_v_idx, d_s_idx, d_t_idx })
+    {
+        if (d_level->checkAllocated(idx)) d_level->deallocatePatchData(idx);
+    }
+    d_ghost_fill_scheds.clear();
+    d_sol_bc_op.setNull();
+    d_patch_ghost_boxes.clear();
+    d_stencil_coefs.clear();
+    d_mg_levels.clear();
+    d_cf_boundary.setNull();
+    d_level.setNull();
+    d_hierarchy.setNull();
+    d_level_num = IBTK::invalid_level_number;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+SCPoissonGMGLevelSolver::applyVCycle(const int mg_ln)
+{
+    const int coarsest_mg_ln = static_cast<int>(d_mg_levels.size()) - 1;
+    if (mg_ln == coarsest_mg_ln)
+    {
+        solveCoarsestLevel();
+        return;
+    }
+
+    // Pre-smooth and restrict the residual to the next coarser level.
+    smooth(mg_ln, d_num_pre_relax_steps);
+    computeResidual(mg_ln);
+    fillGhostCells(mg_ln, d_res_idx, /*homogeneous_physical_bc*/ false);
+    Pointer<PatchLevel<NDIM> > fine_level = d_mg_levels[mg_ln];
+    Pointer<PatchLevel<NDIM> > coarse_level = d_mg_levels[mg_ln + 1];
+    for (PatchLevel<NDIM>::Iterator p(fine_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > fine_patch = fine_level->getPatch(p());
+        Pointer<Patch<NDIM> > coarse_patch = coarse_level->getPatch(p());
+        Pointer<SideData<NDIM, double> > fine_res_data = fine_patch->getPatchData(d_res_idx);
+        Pointer<SideData<NDIM, double> > coarse_rhs_data = coarse_patch->getPatchData(d_rhs_idx);
+        Pointer<SideData<NDIM, double> > coarse_sol_data = coarse_patch->getPatchData(d_sol_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            restrict_patch(coarse_rhs_data->getArrayData(axis),
+                           fine_res_data->getArrayData(axis),
+                           d_stencil_coefs[mg_ln + 1][p()]->getArrayData(axis),
+                           SideGeometry<NDIM>::toSideBox(coarse_patch->getBox(), axis),
+                           axis);
+        }
+        coarse_sol_data->fillAll(0.0);
+    }
+
+    // Solve for the coarse-grid correction and prolong it to this level.
+    //
+    // NOTE: The coarse correction solves the error equation, which has
+    // homogeneous boundary conditions, so the ghost values at physical
+    // boundaries are filled using the homogeneous form of the boundary
+    // conditions before the correction is interpolated.
+    applyVCycle(mg_ln + 1);
+    fillGhostCells(mg_ln + 1, d_sol_idx, /*homogeneous_physical_bc*/ true);
+    for (PatchLevel<NDIM>::Iterator p(fine_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > fine_patch = fine_level->getPatch(p());
+        Pointer<Patch<NDIM> > coarse_patch = coarse_level->getPatch(p());
+        Pointer<SideData<NDIM, double> > fine_sol_data = fine_patch->getPatchData(d_sol_idx);
+        Pointer<SideData<NDIM, double> > coarse_sol_data = coarse_patch->getPatchData(d_sol_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            prolong_patch(fine_sol_data->getArrayData(axis),
+                          coarse_sol_data->getArrayData(axis),
+                          SideGeometry<NDIM>::toSideBox(fine_patch->getBox(), axis),
+                          axis);
+        }
+    }
+
+    // Post-smooth.
+    smooth(mg_ln, d_num_post_relax_steps);
+    return;
+} // applyVCycle
+
+void
+SCPoissonGMGLevelSolver::solveCoarsestLevel()
+{
+    IBTK_TIMER_START(t_solve_coarsest_level);
+
+    // Solve the coarsest level problem with BiCGStab, using the current
+    // solution data as the initial guess.  The equations for sides with
+    // Dirichlet boundary conditions make the operator nonsymmetric.
+    const int mg_ln = static_cast<int>(d_mg_levels.size()) - 1;
+    if (d_nullspace_contains_constant_vec) projectOutConstant(mg_ln, d_rhs_idx);
+    double residual_norm = computeResidual(mg_ln);
+    const double initial_residual_norm = residual_norm;
+    levelLinearSum(mg_ln, d_r_hat_idx, 1.0, d_res_idx, 0.0, d_res_idx);
+    levelLinearSum(mg_ln, d_p_idx, 1.0, d_res_idx, 0.0, d_res_idx);
+    double rho = computeInnerProduct(mg_ln, d_r_hat_idx, d_res_idx);
+    for (int k = 0; k < d_coarse_solver_max_iterations; ++k)
+    {
+        if (residual_norm <= d_coarse_solver_abs_residual_tol ||
+            residual_norm <= d_coarse_solver_rel_residual_tol * initial_residual_norm)
+        {
+            break;
+        }
+        applyOperator(mg_ln, d_v_idx, d_p_idx);
+        const double r_hat_dot_v = computeInnerProduct(mg_ln, d_r_hat_idx, d_v_idx);
+        if (r_hat_dot_v == 0.0) break;
+        const double alpha = rho / r_hat_dot_v;
+        levelLinearSum(mg_ln, d_s_idx, 1.0, d_res_idx, -alpha, d_v_idx);
+        applyOperator(mg_ln, d_t_idx, d_s_idx);
+        const double t_dot_t = computeInnerProduct(mg_ln, d_t_idx, d_t_idx);
+        const double omega = t_dot_t > 0.0 ? computeInnerProduct(mg_ln, d_t_idx, d_s_idx) / t_dot_t : 0.0;
+        levelLinearSum(mg_ln, d_sol_idx, 1.0, d_sol_idx, alpha, d_p_idx);
+        levelLinearSum(mg_ln, d_sol_idx, 1.0, d_sol_idx, omega, d_s_idx);
+        levelLinearSum(mg_ln, d_res_idx, 1.0, d_s_idx, -omega, d_t_idx);
+        residual_norm = std::sqrt(computeInnerProduct(mg_ln, d_res_idx, d_res_idx));
+        const double rho_new = computeInnerProduct(mg_ln, d_r_hat_idx, d_res_idx);
+        if (omega == 0.0 || rho_new == 0.0) break;
+        const double beta = (rho_new / rho) * (alpha / omega);
+        levelLinearSum(mg_ln, d_p_idx, 1.0, d_p_idx, -omega, d_v_idx);
+        levelLinearSum(mg_ln, d_p_idx, 1.0, d_res_idx, beta, d_p_idx);
+        rho = rho_new;
+    }
+    if (d_nullspace_contains_constant_vec) projectOutConstant(mg_ln, d_sol_idx);
+
+    IBTK_TIMER_STOP(t_solve_coarsest_level);
+    return;
+} // solveCoarsestLevel
+
+void
+SCPoissonGMGLevelSolver::smooth(const int mg_ln, const int num_sweeps)
+{
+    // NOTE: Sides that are shared by neighboring patches are updated by each
+    // patch.  Because the ghost values and operator coefficients are the same
+    // on both patches, both updates produce the same value.
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    for (int isweep = 0; isweep < num_sweeps; ++isweep)
+    {
+        for (int color = 0; color < 2; ++color)
+        {
+            fillGhostCells(mg_ln, d_sol_idx, /*homogeneous_physical_bc*/ false);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+                Pointer<SideData<NDIM, double> > rhs_data = patch->getPatchData(d_rhs_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    smooth_patch(sol_data->getArrayData(axis),
+                                 rhs_data->getArrayData(axis),
+                                 d_stencil_coefs[mg_ln][p()]->getArrayData(axis),
+                                 SideGeometry<NDIM>::toSideBox(patch->getBox(), axis),
+                                 color);
+                }
+            }
+        }
+    }
+    return;
+} // smooth
+
+double
+SCPoissonGMGLevelSolver::computeResidual(const int mg_ln)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    fillGhostCells(mg_ln, d_sol_idx, /*homogeneous_physical_bc*/ false);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > sol_data = patch->getPatchData(d_sol_idx);
+        Pointer<SideData<NDIM, double> > rhs_data = patch->getPatchData(d_rhs_idx);
+        Pointer<SideData<NDIM, double> > res_data = patch->getPatchData(d_res_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            apply_operator_patch(res_data->getArrayData(axis),
+                                 sol_data->getArrayData(axis),
+                                 &rhs_data->getArrayData(axis),
+                                 d_stencil_coefs[mg_ln][p()]->getArrayData(axis),
+                                 SideGeometry<NDIM>::toSideBox(patch->getBox(), axis));
+        }
+    }
+    return std::sqrt(computeInnerProduct(mg_ln, d_res_idx, d_res_idx));
+} // computeResidual
+
+void
+SCPoissonGMGLevelSolver::applyOperator(const int mg_ln, const int dst_idx, const int src_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    levelLinearSum(mg_ln, d_aux_idx, 1.0, src_idx, 0.0, src_idx);
+    fillGhostCells(mg_ln, d_aux_idx, /*homogeneous_physical_bc*/ false);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > aux_data = patch->getPatchData(d_aux_idx);
+        Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            apply_operator_patch(dst_data->getArrayData(axis),
+                                 aux_data->getArrayData(axis),
+                                 nullptr,
+                                 d_stencil_coefs[mg_ln][p()]->getArrayData(axis),
+                                 SideGeometry<NDIM>::toSideBox(patch->getBox(), axis));
+        }
+    }
+    return;
+} // applyOperator
+
+double
+SCPoissonGMGLevelSolver::computeInnerProduct(const int mg_ln, const int idx1, const int idx2)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    double dot = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data1 = patch->getPatchData(idx1);
+        Pointer<SideData<NDIM, double> > data2 = patch->getPatchData(idx2);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            dot += dot_patch(data1->getArrayData(axis),
+                             data2->getArrayData(axis),
+                             SideGeometry<NDIM>::toSideBox(patch->getBox(), axis),
+                             axis);
+        }
+    }
+    return IBTK_MPI::sumReduction(dot);
+} // computeInnerProduct
+
+void
+SCPoissonGMGLevelSolver::levelLinearSum(const int mg_ln,
+                                        const int dst_idx,
+                                        const double alpha,
+                                        const int src1_idx,
+                                        const double beta,
+                                        const int src2_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+        Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+        Pointer<SideData<NDIM, double> > src2_data = patch->getPatchData(src2_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            linear_sum_patch(dst_data->getArrayData(axis),
+                             alpha,
+                             src1_data->getArrayData(axis),
+                             beta,
+                             src2_data->getArrayData(axis),
+                             SideGeometry<NDIM>::toSideBox(patch->getBox(), axis));
+        }
+    }
+    return;
+} // levelLinearSum
+
+void
+SCPoissonGMGLevelSolver::projectOutConstant(const int mg_ln, const int data_idx)
+{
+    // Each side that is shared by two patches has weight one half on each
+    // patch, so the weighted sums count every side once.
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    std::array<double, NDIM> sum, num_sides;
+    sum.fill(0.0);
+    num_sides.fill(0.0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch->getBox(), axis);
+            sum[axis] += sum_patch(data->getArrayData(axis), side_box, axis);
+            num_sides[axis] += side_box.size() - side_box.size() / side_box.numberCells(axis);
+        }
+    }
+    IBTK_MPI::sumReduction(sum.data(), NDIM);
+    IBTK_MPI::sumReduction(num_sides.data(), NDIM);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            add_scalar_patch(data->getArrayData(axis),
+                             -sum[axis] / num_sides[axis],
+                             SideGeometry<NDIM>::toSideBox(patch->getBox(), axis));
+        }
+    }
+    return;
+} // projectOutConstant
+
+void
+SCPoissonGMGLevelSolver::fillGhostCells(const int mg_ln, const int data_idx, const bool homogeneous_physical_bc)
+{
+    // Set the values in all ghost sides; values in ghost sides that overlap
+    // neighboring patches are subsequently overwritten by the schedule.
+    Pointer<PatchLevel<NDIM> > level = d_mg_levels[mg_ln];
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            ArrayData<NDIM, double>& array_data = data->getArrayData(axis);
+            for (BoxList<NDIM>::Iterator bl(d_patch_ghost_boxes[mg_ln][p()][axis]); bl; bl++)
+            {
+                array_data.fill(0.0, bl());
+            }
+        }
+    }
+    d_ghost_fill_scheds[mg_ln][data_idx]->fillData(d_solution_time);
+    if (!homogeneous_physical_bc) return;
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data_idx == d_sol_idx);
+#endif
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (patch->getPatchGeometry()->intersectsPhysicalBoundary())
+        {
+            d_sol_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, IntVector<NDIM>(SIDEG));
+        }
+    }
+    return;
+} // fillGhostCells
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -124,7 +124,10 @@ SCPoissonPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorRe
         var_db->getPatchDescriptor()->getPatchDataFactory(d_dof_index_idx);
     dof_index_fac->setDefaultDepth(depth);
     if (!d_level->checkAllocated(d_dof_index_idx)) d_level->allocatePatchData(d_dof_index_idx);
-    PETScVecUtilities::constructPatchLevelDOFIndices(d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    if (!d_reuse_level_data)
+    {
+        PETScVecUtilities::constructPatchLevelDOFIndices(d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    }
 
     // Setup PETSc objects.
     int ierr;
@@ -133,8 +136,14 @@ SCPoissonPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorRe
     IBTK_CHKERRQ(ierr);
     ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_b);
     IBTK_CHKERRQ(ierr);
-    PETScMatUtilities::constructPatchLevelSCLaplaceOp(
-        d_petsc_mat, d_poisson_spec, d_bc_coefs, d_solution_time, d_num_dofs_per_proc, d_dof_index_idx, d_level);
+    PETScMatUtilities::constructPatchLevelSCLaplaceOp(d_petsc_mat,
+                                                      d_poisson_spec,
+                                                      d_bc_coefs,
+                                                      d_solution_time,
+                                                      d_num_dofs_per_proc,
+                                                      d_dof_index_idx,
+                                                      d_level,
+                                                      d_reuse_level_data);
     d_petsc_pc = d_petsc_mat;
 
     // Setup SAMRAI communication objects.
@@ -146,7 +155,8 @@ SCPoissonPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorRe
 void
 SCPoissonPETScLevelSolver::deallocateSolverStateSpecialized()
 {
-    // Deallocate DOF index data.
+    // Deallocate DOF index data unless it may be reused.
+    if (d_reuse_mat_structure) return;
     if (d_level->checkAllocated(d_dof_index_idx)) d_level->deallocatePatchData(d_dof_index_idx);
     return;
 } // deallocateSolverStateSpecialized
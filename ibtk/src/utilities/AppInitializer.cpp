@@ -16,6 +16,7 @@
 #include "ibtk/AppInitializer.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PerformanceReportWriter.h"
 
 #include "VisItDataWriter.h"
 #include "tbox/Array.h"
@@ -145,6 +146,13 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         TimerManager::createManager(timer_manager_db);
     }
 
+    // Configure the performance report.
+    if (d_input_db->isDatabase("PerformanceReport"))
+    {
+        d_performance_report_writer =
+            new PerformanceReportWriter("PerformanceReportWriter", d_input_db->getDatabase("PerformanceReport"));
+    }
+
     // Configure visualization options.
     std::string viz_dump_interval_key_name;
     if (main_db->keyExists("viz_interval"))
@@ -246,6 +254,10 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (viz_writer == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            if (main_db->keyExists("silo_number_of_output_files"))
+                d_silo_data_writer->setNumberOfOutputFiles(main_db->getInteger("silo_number_of_output_files"));
+            if (main_db->keyExists("silo_use_asynchronous_output"))
+                d_silo_data_writer->setUseAsynchronousOutput(main_db->getBool("silo_use_asynchronous_output"));
         }
 
         if (viz_writer == "ExodusII")
@@ -259,6 +271,16 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
     }
 
+    // SAMRAI's VisItDataWriter also uses Silo but does not share the lock used
+    // by the background Lagrangian output thread.
+    if (d_visit_data_writer && d_silo_data_writer && main_db->keyExists("silo_use_asynchronous_output") &&
+        main_db->getBool("silo_use_asynchronous_output"))
+    {
+        pout << "WARNING: AppInitializer::AppInitializer(): `silo_use_asynchronous_output' is set, but the VisIt "
+                "data writer is also enabled; disabling asynchronous Silo output\n";
+        d_silo_data_writer->setUseAsynchronousOutput(false);
+    }
+
     // Configure restart options.
     std::string restart_dump_interval_key_name;
     if (main_db->keyExists("restart_interval"))
@@ -521,6 +543,12 @@ AppInitializer::getTimerDumpInterval() const
     return d_timer_dump_interval;
 } // getTimerDumpInterval
 
+Pointer<PerformanceReportWriter>
+AppInitializer::getPerformanceReportWriter() const
+{
+    return d_performance_report_writer;
+} // getPerformanceReportWriter
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
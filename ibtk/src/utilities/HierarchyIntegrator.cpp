@@ -17,6 +17,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/PerformanceReportWriter.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -336,6 +337,12 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
     IBTK_TIMER_STOP(t_advance_hierarchy);
+
+    // Report the performance of the time step.
+    if (d_performance_report_writer)
+    {
+        d_performance_report_writer->writeStepReport(d_integrator_step, d_integrator_time);
+    }
     return;
 } // advanceHierarchy
 
@@ -598,6 +605,18 @@ HierarchyIntegrator::getVisItDataWriter() const
     return d_visit_writer;
 }
 
+void
+HierarchyIntegrator::registerPerformanceReportWriter(Pointer<PerformanceReportWriter> report_writer)
+{
+    d_performance_report_writer = report_writer;
+    registerPerformanceReportValuesSpecialized();
+    for (const auto& child_integrator : d_child_integrators)
+    {
+        child_integrator->registerPerformanceReportWriter(report_writer);
+    }
+    return;
+} // registerPerformanceReportWriter
+
 void
 HierarchyIntegrator::setupPlotData()
 {
@@ -1335,6 +1354,31 @@ HierarchyIntegrator::setupPlotDataSpecialized()
     return;
 } // setupPlotDataSpecialized
 
+void
+HierarchyIntegrator::registerPerformanceReportValuesSpecialized()
+{
+    // intentionally blank
+    return;
+} // registerPerformanceReportValuesSpecialized
+
+void
+HierarchyIntegrator::registerSolverIterationsWithPerformanceReport(const std::string& solver_name)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_performance_report_writer);
+#endif
+    d_performance_report_writer->registerStepValue(d_object_name + "::" + solver_name + "_iterations");
+    return;
+} // registerSolverIterationsWithPerformanceReport
+
+void
+HierarchyIntegrator::addSolverIterationsToPerformanceReport(const std::string& solver_name, const int num_iterations)
+{
+    if (!d_performance_report_writer) return;
+    d_performance_report_writer->addToStepValue(d_object_name + "::" + solver_name + "_iterations", num_iterations);
+    return;
+} // addSolverIterationsToPerformanceReport
+
 void
 HierarchyIntegrator::initializeCompositeHierarchyDataSpecialized(double /*init_data_time*/, bool /*initial_time*/)
 {
@@ -0,0 +1,335 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PerformanceReportWriter.h"
+
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers that are reported if no timers are specified in the input database.
+static const char* const DEFAULT_TIMER_NAMES[] = { "IBTK::HierarchyIntegrator::advanceHierarchy()",
+                                                   "IBTK::HierarchyIntegrator::regridHierarchy()",
+                                                   "IBAMR::IBMethod::interpolateVelocity()",
+                                                   "IBAMR::IBMethod::spreadForce()",
+                                                   "IBTK::PETScKrylovLinearSolver::solveSystem()",
+                                                   "IBTK::LDataManager::beginDataRedistribution()",
+                                                   "IBTK::LDataManager::endDataRedistribution()",
+                                                   "IBTK::HierarchyGhostCellInterpolation::fillData()" };
+
+inline double
+get_wallclock_time()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+} // get_wallclock_time
+
+std::string
+json_string(const std::string& str)
+{
+    std::string result = "\"";
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+    }
+    result += "\"";
+    return result;
+} // json_string
+
+std::string
+csv_string(const std::string& str)
+{
+    std::string result = "\"";
+    for (const char c : str)
+    {
+        if (c == '"') result += '"';
+        result += c;
+    }
+    result += "\"";
+    return result;
+} // csv_string
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PerformanceReportWriter::PerformanceReportWriter(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name)), d_last_wallclock_time(get_wallclock_time())
+{
+    std::vector<std::string> timer_names(std::begin(DEFAULT_TIMER_NAMES), std::end(DEFAULT_TIMER_NAMES));
+    if (input_db)
+    {
+        const std::string format = input_db->getStringWithDefault("format", "JSON");
+        if (format == "JSON")
+        {
+            d_format = ReportFormat::JSON;
+        }
+        else if (format == "CSV")
+        {
+            d_format = ReportFormat::CSV;
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::PerformanceReportWriter():\n"
+                                     << "  unsupported report format: " << format << "\n"
+                                     << "  supported formats are JSON and CSV" << std::endl);
+        }
+        if (input_db->keyExists("file_name")) d_file_name = input_db->getString("file_name");
+        d_report_interval = input_db->getIntegerWithDefault("report_interval", d_report_interval);
+        if (d_report_interval < 1)
+        {
+            TBOX_ERROR(d_object_name << "::PerformanceReportWriter():\n"
+                                     << "  report_interval must be positive" << std::endl);
+        }
+        if (input_db->keyExists("timer_names"))
+        {
+            const Array<std::string> timer_names_arr = input_db->getStringArray("timer_names");
+            timer_names.clear();
+            for (int k = 0; k < timer_names_arr.size(); ++k) timer_names.push_back(timer_names_arr[k]);
+        }
+    }
+    if (d_file_name.empty())
+    {
+        d_file_name = d_format == ReportFormat::JSON ? "performance_report.jsonl" : "performance_report.csv";
+    }
+    for (const auto& timer_name : timer_names) registerTimer(timer_name);
+
+    // Only the root process writes the report.  Restarted runs append to the
+    // existing report, whose CSV columns are checked against the registered
+    // quantities when the first record is written.
+    if (IBTK_MPI::getRank() == 0)
+    {
+        const bool from_restart = RestartManager::getManager()->isFromRestart();
+        if (from_restart && d_format == ReportFormat::CSV)
+        {
+            std::ifstream existing_report(d_file_name.c_str());
+            std::getline(existing_report, d_existing_csv_header);
+        }
+        d_report_stream.open(d_file_name.c_str(), from_restart ? std::ios::app : std::ios::out);
+        if (!d_report_stream.is_open())
+        {
+            TBOX_ERROR(d_object_name << "::PerformanceReportWriter():\n"
+                                     << "  could not open report file " << d_file_name << std::endl);
+        }
+        d_report_stream << std::setprecision(std::numeric_limits<double>::digits10);
+    }
+    return;
+} // PerformanceReportWriter
+
+PerformanceReportWriter::~PerformanceReportWriter()
+{
+    if (d_report_stream.is_open()) d_report_stream.close();
+    return;
+} // ~PerformanceReportWriter
+
+void
+PerformanceReportWriter::registerTimer(const std::string& timer_name)
+{
+    if (d_format == ReportFormat::CSV && d_wrote_record)
+    {
+        TBOX_ERROR(d_object_name << "::registerTimer():\n"
+                                 << "  timer " << timer_name
+                                 << " cannot be added to a CSV report after the first record has been written"
+                                 << std::endl);
+    }
+    Pointer<Timer> timer = TimerManager::getManager()->getTimer(timer_name);
+    d_timers.push_back(timer);
+    d_last_timer_totals.push_back(timer->getTotalWallclockTime());
+    return;
+} // registerTimer
+
+void
+PerformanceReportWriter::registerStepValue(const std::string& name, std::function<double()> fcn)
+{
+    if (std::find(d_value_names.begin(), d_value_names.end(), name) != d_value_names.end())
+    {
+        TBOX_ERROR(d_object_name << "::registerStepValue():\n"
+                                 << "  step value " << name << " has already been registered" << std::endl);
+    }
+    if (d_format == ReportFormat::CSV && d_wrote_record)
+    {
+        TBOX_ERROR(d_object_name << "::registerStepValue():\n"
+                                 << "  step value " << name
+                                 << " cannot be added to a CSV report after the first record has been written"
+                                 << std::endl);
+    }
+    d_value_names.push_back(name);
+    d_value_fcns.push_back(std::move(fcn));
+    d_accumulated_values.push_back(0.0);
+    return;
+} // registerStepValue
+
+void
+PerformanceReportWriter::registerStepValue(const std::string& name)
+{
+    registerStepValue(name, std::function<double()>());
+    return;
+} // registerStepValue
+
+void
+PerformanceReportWriter::addToStepValue(const std::string& name, const double value)
+{
+    const auto it = std::find(d_value_names.begin(), d_value_names.end(), name);
+    if (it == d_value_names.end())
+    {
+        TBOX_ERROR(d_object_name << "::addToStepValue():\n"
+                                 << "  step value " << name << " has not been registered" << std::endl);
+    }
+    const auto k = std::distance(d_value_names.begin(), it);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_value_fcns[k]);
+#endif
+    d_accumulated_values[k] += value;
+    return;
+} // addToStepValue
+
+void
+PerformanceReportWriter::writeStepReport(const int time_step_number, const double simulation_time)
+{
+    if (time_step_number % d_report_interval != 0) return;
+
+    // Collect the local values: the elapsed wallclock time, the time spent in
+    // each timer, and the step quantities.
+    const int num_timers = static_cast<int>(d_timers.size());
+    const int num_values = static_cast<int>(d_value_names.size());
+    std::vector<double> local_vals;
+    local_vals.reserve(1 + num_timers + num_values);
+    const double wallclock_time = get_wallclock_time();
+    local_vals.push_back(wallclock_time - d_last_wallclock_time);
+    d_last_wallclock_time = wallclock_time;
+    for (int k = 0; k < num_timers; ++k)
+    {
+        // The timers may have been reset since the last record.
+        const double total = d_timers[k]->getTotalWallclockTime();
+        local_vals.push_back(total >= d_last_timer_totals[k] ? total - d_last_timer_totals[k] : total);
+        d_last_timer_totals[k] = total;
+    }
+    for (int k = 0; k < num_values; ++k)
+    {
+        local_vals.push_back(d_value_fcns[k] ? d_value_fcns[k]() : d_accumulated_values[k]);
+        d_accumulated_values[k] = 0.0;
+    }
+
+    // Compute the extrema and averages over all processes.
+    const int n = static_cast<int>(local_vals.size());
+    std::vector<double> min_vals(local_vals), max_vals(local_vals), avg_vals(local_vals);
+    IBTK_MPI::minReduction(min_vals.data(), n);
+    IBTK_MPI::maxReduction(max_vals.data(), n);
+    IBTK_MPI::sumReduction(avg_vals.data(), n);
+    const double num_procs = static_cast<double>(IBTK_MPI::getNodes());
+    for (double& val : avg_vals) val /= num_procs;
+
+    // The columns of a CSV report are fixed by the first record.
+    d_wrote_record = true;
+    if (IBTK_MPI::getRank() != 0) return;
+
+    if (d_format == ReportFormat::JSON)
+    {
+        auto write_stats = [&](const int k) {
+            d_report_stream << "{\"min\":" << min_vals[k] << ",\"max\":" << max_vals[k] << ",\"avg\":" << avg_vals[k]
+                            << "}";
+        };
+        d_report_stream << "{\"step\":" << time_step_number << ",\"time\":" << simulation_time << ",\"wallclock\":";
+        write_stats(0);
+        d_report_stream << ",\"timers\":{";
+        for (int k = 0; k < num_timers; ++k)
+        {
+            d_report_stream << (k > 0 ? "," : "") << json_string(d_timers[k]->getName()) << ":";
+            write_stats(1 + k);
+        }
+        d_report_stream << "},\"values\":{";
+        for (int k = 0; k < num_values; ++k)
+        {
+            d_report_stream << (k > 0 ? "," : "") << json_string(d_value_names[k]) << ":";
+            write_stats(1 + num_timers + k);
+        }
+        d_report_stream << "}}" << std::endl;
+    }
+    else
+    {
+        if (!d_wrote_header) writeCSVHeader();
+        d_report_stream << time_step_number << "," << simulation_time;
+        for (int k = 0; k < n; ++k)
+        {
+            d_report_stream << "," << min_vals[k] << "," << max_vals[k] << "," << avg_vals[k];
+        }
+        d_report_stream << std::endl;
+    }
+    return;
+} // writeStepReport
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PerformanceReportWriter::writeCSVHeader()
+{
+    std::vector<std::string> names(1, "wallclock");
+    for (const auto& timer : d_timers) names.push_back(timer->getName());
+    names.insert(names.end(), d_value_names.begin(), d_value_names.end());
+    std::string header = "step,time";
+    for (const auto& name : names)
+    {
+        header += "," + csv_string(name + " min") + "," + csv_string(name + " max") + "," + csv_string(name + " avg");
+    }
+
+    // A restarted run appends to the existing report only if its columns are
+    // the same.
+    if (!d_existing_csv_header.empty())
+    {
+        if (header != d_existing_csv_header)
+        {
+            TBOX_ERROR(d_object_name << "::writeCSVHeader():\n"
+                                     << "  the columns of the existing report " << d_file_name
+                                     << " do not match the registered timers and step values" << std::endl);
+        }
+    }
+    else
+    {
+        d_report_stream << header << "\n";
+    }
+    d_wrote_header = true;
+    return;
+} // writeCSVHeader
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
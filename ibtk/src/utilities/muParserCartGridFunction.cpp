@@ -244,17 +244,30 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
         {
             parser.DefineConst(constant.first, constant.second);
         }
+    }
 
-        // Variables.
-        parser.DefineVar("T", &d_parser_time);
-        parser.DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserBuffers(1);
+
+    // Determine whether any of the functions use the time variable.
+    d_uses_time_variable = false;
+    for (const auto& parser : d_parsers)
+    {
+        try
         {
-            const std::string postfix = std::to_string(d);
-            parser.DefineVar("X" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = parser.GetUsedVar();
+            d_uses_time_variable = d_uses_time_variable || used_vars.count("T") || used_vars.count("t");
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: " << e.GetMsg() << "\n"
+                       << "  in:    " << e.GetExpr() << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -266,6 +279,12 @@ muParserCartGridFunction::isTimeDependent() const
     return true;
 } // isTimeDependent
 
+bool
+muParserCartGridFunction::usesTimeVariable() const
+{
+    return d_uses_time_variable;
+} // usesTimeVariable
+
 void
 muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          Pointer<Variable<NDIM> > /*var*/,
@@ -274,8 +293,6 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
     const hier::Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -283,7 +300,16 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     const double* const XLower = pgeom->getXLower();
     const double* const dx = pgeom->getDx();
 
-    // Set the data in the patch.
+    // The evaluation buffers must be large enough to hold the data points of
+    // any centering.
+    Box<NDIM> node_box = patch_box;
+    node_box.growUpper(IntVector<NDIM>(1));
+    resizeParserBuffers(node_box.size());
+
+    // Set the data in the patch.  For each centering, we first compute the
+    // positions of all of the data points, then evaluate each function at all
+    // of the points at once, and finally copy the function values into the
+    // patch data in the same order.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
 #if !defined(NDEBUG)
     TBOX_ASSERT(data);
@@ -298,31 +324,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        int num_points = 0;
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++num_points)
+        {
+            const CellIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_parser_posn[d][num_points] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+            }
+        }
+        int evaluated_depth = -1;
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            if (function_depth != evaluated_depth) evaluateParser(function_depth, num_points, data_time);
+            evaluated_depth = function_depth;
+            int k = 0;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*cc_data)(ic(), data_depth) = d_parser_vals[k];
             }
         }
     }
@@ -333,9 +353,29 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(fc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(fc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            int num_points = 0;
+            for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++num_points)
+            {
+                const FaceIndex<NDIM>& i = ic();
+                const hier::Index<NDIM>& cell_idx = i.toCell(1);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d == axis)
+                    {
+                        d_parser_posn[d][num_points] =
+                            XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
+                    }
+                    else
+                    {
+                        d_parser_posn[d][num_points] =
+                            XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
+                    }
+                }
+            }
+            int evaluated_depth = -1;
+            for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
             {
                 int function_depth = -1;
                 const int parsers_size = static_cast<int>(d_parsers.size());
@@ -356,38 +396,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                 {
                     function_depth = NDIM * data_depth + axis;
                 }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                if (function_depth != evaluated_depth) evaluateParser(function_depth, num_points, data_time);
+                evaluated_depth = function_depth;
+                int k = 0;
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const hier::Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*fc_data)(ic(), data_depth) = d_parser_vals[k];
                 }
             }
         }
@@ -397,31 +411,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        int num_points = 0;
+        for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++num_points)
+        {
+            const NodeIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_parser_posn[d][num_points] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+            }
+        }
+        int evaluated_depth = -1;
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            if (function_depth != evaluated_depth) evaluateParser(function_depth, num_points, data_time);
+            evaluated_depth = function_depth;
+            int k = 0;
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*nc_data)(ic(), data_depth) = d_parser_vals[k];
             }
         }
     }
@@ -432,9 +440,27 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(sc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(sc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            int num_points = 0;
+            for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++num_points)
+            {
+                const SideIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d == axis)
+                    {
+                        d_parser_posn[d][num_points] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
+                    else
+                    {
+                        d_parser_posn[d][num_points] =
+                            XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
+                }
+            }
+            int evaluated_depth = -1;
+            for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
             {
                 int function_depth = -1;
                 const int parsers_size = static_cast<int>(d_parsers.size());
@@ -455,36 +481,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                 {
                     function_depth = NDIM * data_depth + axis;
                 }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                if (function_depth != evaluated_depth) evaluateParser(function_depth, num_points, data_time);
+                evaluated_depth = function_depth;
+                int k = 0;
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*sc_data)(ic(), data_depth) = d_parser_vals[k];
                 }
             }
         }
@@ -496,9 +498,27 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(ec_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(ec_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < ec_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            int num_points = 0;
+            for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++, ++num_points)
+            {
+                const EdgeIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d == axis)
+                    {
+                        d_parser_posn[d][num_points] =
+                            XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
+                    else
+                    {
+                        d_parser_posn[d][num_points] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
+                }
+            }
+            int evaluated_depth = -1;
+            for (int data_depth = 0; data_depth < ec_data->getDepth(); ++data_depth)
             {
                 int function_depth = -1;
                 const int parsers_size = static_cast<int>(d_parsers.size());
@@ -519,36 +539,12 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                 {
                     function_depth = NDIM * data_depth + axis;
                 }
-
-                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                if (function_depth != evaluated_depth) evaluateParser(function_depth, num_points, data_time);
+                evaluated_depth = function_depth;
+                int k = 0;
+                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
                 {
-                    const EdgeIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                    }
-                    try
-                    {
-                        (*ec_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    (*ec_data)(ic(), data_depth) = d_parser_vals[k];
                 }
             }
         }
@@ -561,7 +557,57 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
-//////////////////////////////////////////////////////////////////////////////
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::resizeParserBuffers(const int num_points)
+{
+    if (num_points <= static_cast<int>(d_parser_vals.size())) return;
+
+    // The parsers store pointers to the buffers, so the variables must be
+    // redefined whenever the buffers are reallocated.
+    d_parser_time.resize(num_points);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(num_points);
+    d_parser_vals.resize(num_points);
+    for (auto& parser : d_parsers)
+    {
+        parser.DefineVar("T", d_parser_time.data());
+        parser.DefineVar("t", d_parser_time.data());
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string postfix = std::to_string(d);
+            parser.DefineVar("X" + postfix, d_parser_posn[d].data());
+            parser.DefineVar("x" + postfix, d_parser_posn[d].data());
+            parser.DefineVar("X_" + postfix, d_parser_posn[d].data());
+            parser.DefineVar("x_" + postfix, d_parser_posn[d].data());
+        }
+    }
+    return;
+} // resizeParserBuffers
+
+void
+muParserCartGridFunction::evaluateParser(const int function_depth, const int num_points, const double data_time)
+{
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, data_time);
+    try
+    {
+        d_parsers[function_depth].Eval(d_parser_vals.data(), num_points);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateParser
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
 
@@ -514,6 +514,12 @@ protected:
      */
     void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+    /*!
+     * Register the number of iterations taken by the Helmholtz solvers with the performance
+     * report writer.
+     */
+    void registerPerformanceReportValuesSpecialized() override;
+
     /*!
      * Standard variable registration.
      */
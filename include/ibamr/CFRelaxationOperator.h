@@ -24,6 +24,8 @@
 
 #include "ibtk/CartGridFunction.h"
 
+#include "Box.h"
+#include "CellData.h"
 #include "CellVariable.h"
 #include "HierarchyDataOpsManager.h"
 #include "Patch.h"
@@ -101,6 +103,16 @@ protected:
      */
     virtual IBTK::MatrixNd convertToConformation(const IBTK::MatrixNd& mat);
 
+    /*!
+     * \brief This function converts the data stored in \p W_data on \p box to the conformation tensor, which is
+     * stored in \p C_data. The default implementation uses the batched kernels provided by CFTensorUtilities.
+     *
+     * \note Subclasses that override convertToConformation() should also override this function.
+     */
+    virtual void convertPatchDataToConformation(const SAMRAI::pdat::CellData<NDIM, double>& W_data,
+                                                SAMRAI::pdat::CellData<NDIM, double>& C_data,
+                                                const SAMRAI::hier::Box<NDIM>& box);
+
     int d_W_cc_idx = IBTK::invalid_index;
 
 private:
@@ -0,0 +1,204 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_CFTensorUtilities
+#define included_IBAMR_CFTensorUtilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class CFTensorUtilities provides batched kernels for computing
+ * functions of symmetric NDIM x NDIM tensors stored in Voigt notation, as used
+ * by the complex fluids solvers.
+ *
+ * The tensor components are ordered as (xx, yy, xy) in 2D and (xx, yy, zz,
+ * yz, xz, xy) in 3D, i.e., in the order defined by IBTK::voigt_to_tensor_idx().
+ *
+ * Matrix functions are computed from a closed-form eigendecomposition of each
+ * tensor: the eigenvalues are obtained analytically (directly in 2D and by the
+ * trigonometric solution of the characteristic polynomial in 3D), and the
+ * function is applied to the eigenvalues.  This avoids forming dense matrices
+ * and calling general-purpose matrix function routines for every cell.
+ *
+ * The slab kernels operate on data stored in structure-of-arrays form: \p
+ * in[k][i] is Voigt component \p k of tensor \p i.  The CellData kernels apply
+ * the slab kernels to each contiguous row of the specified box, using the
+ * component-major storage of SAMRAI::pdat::CellData.  Input and output data may
+ * alias.
+ */
+class CFTensorUtilities
+{
+public:
+    /*!
+     * \brief Number of independent components of a symmetric tensor.
+     */
+    static const int NUM_COMPONENTS = NDIM * (NDIM + 1) / 2;
+
+    /*!
+     * \brief Compute the eigenvalues (in ascending order) and the
+     * corresponding orthonormal eigenvectors of a single symmetric tensor.
+     *
+     * The eigenvectors are stored column-wise, so that \p eig_vecs[d][j] is
+     * component \p d of the eigenvector associated with \p eig_vals[j].
+     */
+    static void computeEigenDecomposition(const double A[NUM_COMPONENTS],
+                                          double eig_vals[NDIM],
+                                          double eig_vecs[NDIM][NDIM]);
+
+    /*!
+     * \name Slab kernels.
+     */
+    //\{
+
+    /*!
+     * \brief Compute the matrix exponential of \p n tensors.
+     */
+    static void exp(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], int n);
+
+    /*!
+     * \brief Compute the matrix logarithm of \p n symmetric positive definite
+     * tensors.
+     */
+    static void log(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], int n);
+
+    /*!
+     * \brief Compute the (symmetric positive semi-definite) square root of \p
+     * n symmetric positive semi-definite tensors.
+     */
+    static void sqrt(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], int n);
+
+    /*!
+     * \brief Compute the square of \p n tensors.
+     */
+    static void square(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], int n);
+
+    /*!
+     * \brief Project \p n tensors onto the nearest (in the Frobenius norm)
+     * tensors whose eigenvalues are no smaller than \p min_eig_val.
+     */
+    static void projectToPositiveSemiDefinite(const double* const in[NUM_COMPONENTS],
+                                              double* const out[NUM_COMPONENTS],
+                                              int n,
+                                              double min_eig_val = 0.0);
+
+    /*!
+     * \brief Compute the determinants of \p n tensors.
+     */
+    static void determinant(const double* const in[NUM_COMPONENTS], double* det, int n);
+
+    /*!
+     * \brief Return whether all \p n tensors are positive definite, as
+     * determined by Sylvester's criterion.
+     */
+    static bool isPositiveDefinite(const double* const in[NUM_COMPONENTS], int n);
+
+    //\}
+
+    /*!
+     * \name CellData kernels.
+     *
+     * The data must have depth NUM_COMPONENTS, and \p box must be contained in
+     * the ghost boxes of the input and output data.
+     */
+    //\{
+
+    static void exp(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                    SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                    const SAMRAI::hier::Box<NDIM>& box);
+
+    static void log(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                    SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                    const SAMRAI::hier::Box<NDIM>& box);
+
+    static void sqrt(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                     SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                     const SAMRAI::hier::Box<NDIM>& box);
+
+    static void square(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                       SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                       const SAMRAI::hier::Box<NDIM>& box);
+
+    static void projectToPositiveSemiDefinite(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                                              SAMRAI::pdat::CellData<NDIM, double>& out_data,
+                                              const SAMRAI::hier::Box<NDIM>& box,
+                                              double min_eig_val = 0.0);
+
+    /*!
+     * \brief Compute the minimum and maximum determinants of the tensors in
+     * \p box, and update \p min_det and \p max_det accordingly.
+     */
+    static void determinantBounds(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                                  const SAMRAI::hier::Box<NDIM>& box,
+                                  double& min_det,
+                                  double& max_det);
+
+    static bool isPositiveDefinite(const SAMRAI::pdat::CellData<NDIM, double>& in_data,
+                                   const SAMRAI::hier::Box<NDIM>& box);
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CFTensorUtilities() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CFTensorUtilities(const CFTensorUtilities& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CFTensorUtilities& operator=(const CFTensorUtilities& that) = delete;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_CFTensorUtilities
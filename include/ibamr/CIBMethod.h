@@ -439,6 +439,19 @@ public:
                                  double f_periodic_corr,
                                  const int managing_rank) override;
 
+    // \see CIBStrategy::getMatrixFreeMobilityData() method.
+    /*!
+     * \brief Gather positions and regularization weights of the prototypical
+     * structures for applying the mobility matrix without forming it.
+     */
+    void getMatrixFreeMobilityData(const std::string& mat_name,
+                                   const std::vector<unsigned>& prototype_struct_ids,
+                                   const bool initial_time,
+                                   std::vector<double>& X,
+                                   std::vector<double>& W,
+                                   std::string& kernel_fcn,
+                                   const int managing_rank) override;
+
     // \see CIBStrategy::constructGeometricMatrix() method.
     /*!
      * \brief Generate block-diagonal geometric matrix for the prototypical structures
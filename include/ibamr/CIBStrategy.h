@@ -509,6 +509,38 @@ public:
                                          double f_periodic_corr,
                                          const int managing_rank);
 
+    /*!
+     * \brief Gather the data required to apply the mobility matrix of the
+     * prototypical structures without forming it.
+     * \note A default empty implementation is provided
+     * in this class. The derived class provides the actual implementation.
+     *
+     * \param mat_name Matrix handle.
+     *
+     * \param prototype_struct_ids Indices of the structures as registered
+     * with \see IBAMR::IBStrategy class.
+     *
+     * \param initial_time Boolean to indicate if the data is to be gathered
+     * for the initial position of the structures.
+     *
+     * \param X Positions of the nodes of the structures. Filled only on the
+     * managing rank.
+     *
+     * \param W Regularization weights of the nodes of the structures. Filled
+     * only on the managing rank.
+     *
+     * \param kernel_fcn IB kernel function used to interact with the fluid.
+     *
+     * \param managing_rank Rank of the processor managing this mobility matrix.
+     */
+    virtual void getMatrixFreeMobilityData(const std::string& mat_name,
+                                           const std::vector<unsigned>& prototype_struct_ids,
+                                           const bool initial_time,
+                                           std::vector<double>& X,
+                                           std::vector<double>& W,
+                                           std::string& kernel_fcn,
+                                           const int managing_rank);
+
     /*!
      * \brief Construct a geometric matrix for the prototypical structures
      * identified by their indices. A geometric matrix maps center of mass rigid
@@ -321,10 +321,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of all self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
@@ -366,14 +367,10 @@ private:
     void interpolateFluidSolveVelocity();
 
     /*!
-     * \brief Calculate the rigid translational velocity.
+     * \brief Calculate the rigid translational and rotational velocities of all
+     * structures in a single pass over the Lagrangian data.
      */
-    void calculateRigidTranslationalMomentum();
-
-    /*!
-     * \brief Calculate the rigid rotational velocity.
-     */
-    void calculateRigidRotationalMomentum();
+    void calculateRigidMomentum();
 
     /*!
      * \brief Calculate current velocity on the material points.
@@ -0,0 +1,121 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_DenseFactorizationPreconditioner
+#define included_IBAMR_DenseFactorizationPreconditioner
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include "ibamr/ibamr_enums.h"
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class DenseFactorizationPreconditioner stores the factorization of a
+ * dense matrix and uses it to solve systems with later, slightly different,
+ * matrices of the same size.
+ *
+ * The systems are solved by iterations that start from a zero initial guess
+ * and are preconditioned by the stored factorization: the preconditioned
+ * conjugate gradient method for <tt>LAPACK_CHOLESKY</tt> factorizations, in
+ * which case only the lower triangles of the matrices are used, and iterative
+ * refinement for <tt>LAPACK_LU</tt> factorizations. The conjugate gradient
+ * iterations stop when the current matrix is not positive definite along a
+ * search direction. When the iterations do not converge, the caller is
+ * expected to factorize the current matrix.
+ *
+ * DirectMobilitySolver uses this class to reuse the factorizations of the
+ * mobility matrices across time steps.
+ */
+class DenseFactorizationPreconditioner
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param inv_type Either LAPACK_CHOLESKY or LAPACK_LU.
+     */
+    DenseFactorizationPreconditioner(MobilityMatrixInverseType inv_type = LAPACK_CHOLESKY);
+
+    /*!
+     * \brief Factorize the column-major \p mat_size x \p mat_size matrix \p
+     * mat_data and store the factorization, replacing the stored one.
+     */
+    void factorize(const double* mat_data, int mat_size);
+
+    /*!
+     * \brief Whether a factorization is stored.
+     */
+    bool isFactorized() const;
+
+    /*!
+     * \brief Solve the system with the stored factorization in place.
+     */
+    void applyInverse(double* rhs) const;
+
+    /*!
+     * \brief Solve the system with the column-major matrix \p mat_data, which
+     * has the size of the stored factorization, by iterations that are
+     * preconditioned by the stored factorization.
+     *
+     * \return Whether the relative residual norm reached \p rel_tol within \p
+     * max_iterations iterations. If so, \p rhs is replaced by the solution.
+     * Otherwise \p rhs is not modified.
+     */
+    bool solve(const double* mat_data, double* rhs, double rel_tol, int max_iterations);
+
+    /*!
+     * \brief Get the number of iterations taken by the last call to solve().
+     */
+    int getNumberOfIterations() const;
+
+    /*!
+     * \brief Get the relative residual norm reached by the last call to
+     * solve().
+     */
+    double getRelativeResidualNorm() const;
+
+private:
+    using MatrixType = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+    MobilityMatrixInverseType d_inv_type;
+    int d_mat_size = 0;
+
+    /*!
+     * The stored factorization. Only the one corresponding to d_inv_type is
+     * used.
+     */
+    Eigen::LLT<MatrixType> d_cholesky_factorization;
+    Eigen::PartialPivLU<MatrixType> d_lu_factorization;
+
+    /*!
+     * Convergence history of the last call to solve().
+     */
+    int d_num_iterations = 0;
+    double d_rel_residual_norm = 0.0;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_DenseFactorizationPreconditioner
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibamr/DenseFactorizationPreconditioner.h"
 #include "ibamr/ibamr_enums.h"
 
 #include "tbox/Database.h"
@@ -53,6 +54,35 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * When the mobility matrices are recomputed every time step (input option
+ * <tt>recompute_mob_mat_perstep = TRUE</tt>), the dense factorization of each
+ * mobility matrix can be reused across time steps by setting
+ * <tt>reuse_factorization = TRUE</tt>. The new mobility matrix is still
+ * assembled every time step, but the mobility system is solved by a few
+ * iterations (preconditioned conjugate gradient for symmetric factorizations
+ * and iterative refinement for LU factorizations) that are preconditioned by
+ * the stored factorization (see DenseFactorizationPreconditioner). The matrix
+ * is refactorized only when these iterations do not converge to the relative
+ * residual tolerance <tt>reuse_factorization_rel_tol</tt> (default 1.0e-8)
+ * within <tt>reuse_factorization_max_iterations</tt> (default 10) iterations.
+ * This reduces the cost of most time steps from \f$ O(N^3) \f$ to \f$ O(N^2)
+ * \f$. Reusing the factorization is supported only for the
+ * <tt>LAPACK_CHOLESKY</tt> and <tt>LAPACK_LU</tt> mobility matrix inverse
+ * types. The stored factorization is not rotated with the structures, so
+ * structures that rotate by more than a small angle between factorizations
+ * are refactorized.
+ *
+ * The <tt>MATRIX_FREE_CG</tt> inverse type avoids storing the dense RPY
+ * mobility matrix, but each mobility product is still a direct
+ * \f$ O(N^2) \f$ pairwise sum. This class does not provide a fast (FMM or
+ * spectral Ewald) mobility operator. Large suspensions should instead use
+ * KrylovMobilitySolver, which applies the mobility through the fluid solver.
+ *
+ * \note Rigid structures whose mobility matrices only rotate with the body
+ * should instead set <tt>recompute_mob_mat_perstep = FALSE</tt>, in which case
+ * the matrices are factorized once and the systems are rotated into the
+ * reference frame.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -81,6 +111,7 @@ public:
      * \param mat_type Matrix type to be used for dense mobility matrix.
      *
      * \param inv_type Inversion method to be used for the mobility and body-mobility matrix.
+     * \note MATRIX_FREE_CG is supported only for the mobility matrix of RPY type.
      *
      * \param filename If the mobility matrix is to be read from an input file.
      * \note The current implementation supports only binary files from PETSc I/O.
@@ -244,6 +275,32 @@ private:
      */
     void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
 
+    /*!
+     * \brief Solve the system with the mobility matrix identified by \p
+     * mat_name and store the solution in the rhs vector.
+     */
+    void solveMobilitySystem(const std::string& mat_name, double* rhs);
+
+    /*!
+     * \brief Compute solution with the current mobility matrix by iterations
+     * that are preconditioned by the stored factorization of an earlier
+     * mobility matrix, and store in the rhs vector. The current matrix is
+     * factorized if the iterations do not converge.
+     */
+    void computeReusedFactorizationSolution(const std::string& mat_name, double* rhs);
+
+    /*!
+     * \brief Replace the stored factorization of the mobility matrix by the
+     * factorization of the current mobility matrix.
+     */
+    void refactorizeMobilityMatrix(const std::string& mat_name);
+
+    /*!
+     * \brief Compute solution using the matrix-free representation of the
+     * mobility matrix and store in the rhs vector.
+     */
+    void computeMatrixFreeSolution(const std::string& mat_name, double* rhs);
+
     // Solver stuff
     std::string d_object_name;
     bool d_is_initialized = false;
@@ -265,6 +322,15 @@ private:
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<std::vector<int>, std::vector<int> > > d_ipiv_map; // permutation matrices for LU
 
+    // Data for the matrix-free mobility matrices.
+    std::map<std::string, std::vector<double> > d_mat_free_X_map, d_mat_free_W_map;
+    std::map<std::string, std::string> d_mat_free_kernel_map;
+    double d_mat_free_dx = 0.0;
+
+    // Factorizations of the mobility matrices that are reused across time
+    // steps.
+    std::map<std::string, DenseFactorizationPreconditioner> d_mob_factorization_map;
+
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
     std::map<std::string, Mat> d_petsc_geometric_mat_map;
@@ -278,6 +344,11 @@ private:
     double d_f_periodic_corr = 0.0;
     bool d_recompute_mob_mat = false;
     double d_svd_replace_value, d_svd_eps;
+    double d_cg_rel_tol = 1.0e-10;
+    int d_cg_max_iterations = 1000;
+    bool d_reuse_factorization = false;
+    double d_reuse_rel_tol = 1.0e-8;
+    int d_reuse_max_iterations = 10;
 
 }; // DirectMobilitySolver
 
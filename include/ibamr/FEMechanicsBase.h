@@ -54,6 +54,14 @@ namespace IBAMR
  *   <li>FEProjector: Input database passed along to the object responsible for
  *     computing projections onto the finite element space. See the
  *     documentation of IBTK::FEProjector for more information.</li>
+ *   <li>use_threaded_force_assembly: Whether or not to use OpenMP threads to
+ *     assemble the right-hand side of the interior force density projection
+ *     (i.e., to evaluate the PK1 stress functions concurrently). Elements are
+ *     distributed among the threads, each of which uses its own FE objects and
+ *     accumulates into a private copy of the local right-hand side vector. When
+ *     this option is enabled, all registered PK1 stress functions must be safe
+ *     to call concurrently. Has no effect if IBAMR was configured without
+ *     OpenMP. Defaults to FALSE.</li>
  * </ol>
  */
 class FEMechanicsBase : public SAMRAI::tbox::Serializable
@@ -649,6 +657,7 @@ protected:
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
     bool d_include_tangential_surface_forces_in_weak_form = true;
+    bool d_use_threaded_force_assembly = false;
 
     /*!
      * Functions used to compute the initial coordinates of the Lagrangian mesh.
@@ -41,6 +41,8 @@ namespace hier
 template <int DIM>
 class Box;
 template <int DIM>
+class Index;
+template <int DIM>
 class Patch;
 } // namespace hier
 } // namespace SAMRAI
@@ -59,6 +61,26 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * In addition to the options read by LSInitStrategy, the following input
+ * options control how the sweeps are carried out:
+ *
+ * - <tt>use_wavefront_sweeping</tt>: sweep the cells of each patch in
+ *   hyperplane (wavefront) order.  The cells on each hyperplane are independent
+ *   and are distributed among OpenMP threads when IBAMR is configured with
+ *   OpenMP.  The sweep directions are visited in the same order as by the
+ *   default lexicographic sweeps, so both orderings produce the same result.
+ *   Default is FALSE.
+ * - <tt>max_local_sweeps</tt>: the maximum number of complete sets of sweeps
+ *   performed on each patch between ghost cell fills.  Local sweeps stop early
+ *   once the largest change in a patch is at most <tt>abs_tol</tt>.  Larger
+ *   values reduce the number of (global) outer iterations.  Default is 1.
+ * - <tt>narrow_band_width</tt>: if positive, only cells that are within this
+ *   distance of the interface (or that neighbor such cells) are updated, and
+ *   the values of the remaining cells are set to plus or minus the band width.
+ *   Only the narrow band cells are visited by the sweeps, which always use
+ *   wavefront ordering.  Default is 0.0, i.e., the distance is computed
+ *   everywhere.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -91,6 +113,9 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall = false;
     int d_wall_location_idx[2 * NDIM];
+    bool d_use_wavefront_sweeping = false;
+    int d_max_local_sweeps = 1;
+    double d_narrow_band_width = 0.0;
 
 private:
     /*!
@@ -105,6 +130,43 @@ private:
                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                    const SAMRAI::hier::Box<NDIM>& domain_box) const;
 
+    /*!
+     * \brief Do one set of sweeps over a patch, visiting the cells in
+     * hyperplane order.
+     */
+    void wavefrontSweep(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
+                        const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        const SAMRAI::hier::Box<NDIM>& domain_box,
+                        int patch_touches_bdry,
+                        const int* touches_wall_loc_idx) const;
+
+    /*!
+     * \brief Do one set of sweeps over the narrow band cells of a patch,
+     * visiting the cells in hyperplane order.
+     */
+    void narrowBandSweep(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
+                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                         const SAMRAI::hier::Box<NDIM>& domain_box,
+                         int patch_touches_bdry,
+                         const int* touches_wall_loc_idx,
+                         const std::vector<SAMRAI::hier::Index<NDIM> >& band_cells) const;
+
+    /*!
+     * \brief Find the cells of a patch that may be within the narrow band.
+     *
+     * A cell is in the band if the sum of the current distance at a nearby
+     * cell, possibly a ghost cell, and the distance between the two cells
+     * (measured along grid lines) is at most the band width plus one cell.
+     * Cells adjacent to a wall are in the band.  The cells are returned in
+     * lexicographic order.
+     */
+    void findNarrowBandCells(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
+                             const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                             const SAMRAI::hier::Box<NDIM>& domain_box,
+                             int patch_touches_bdry,
+                             const int* touches_wall_loc_idx,
+                             std::vector<SAMRAI::hier::Index<NDIM> >& band_cells) const;
+
     /*!
      * Read input values from a given database.
      */
@@ -22,6 +22,7 @@
 
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "tbox/DescribedClass.h"
@@ -33,8 +34,8 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <functional>
 #include <iosfwd>
-#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace IBTK
@@ -206,6 +207,20 @@ private:
      */
     void outputLogData(std::ostream& os);
 
+    /*!
+     * Build the interpolation stencils for the specified meter.
+     */
+    void buildWebStencils(unsigned int meter_num, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * Update the interpolation weights of the stencils of the specified meter.
+     *
+     * \return false if any of the locally stored stencil points has moved to a
+     * different grid cell, in which case the stencils must be rebuilt.
+     */
+    bool updateWebStencils(unsigned int meter_num,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
     /*
      * The object name is used for error reporting purposes.
      */
@@ -228,43 +243,40 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Precomputed interpolation stencils for the meter web patches and
+     * meter centroids.
+     *
+     * Each web patch centroid and each meter centroid is assigned to the finest
+     * Cartesian grid cell that contains it, and the stencil is stored only by
+     * the process that owns the patch containing that cell.  The trilinear
+     * interpolation weights are stored in tensor-product form, i.e., as the
+     * index and weight of the lower stencil point in each coordinate
+     * direction for cell-centered data (cc_lower_idx, cc_wgt_lower) and the
+     * weight of the lower face of the assigned cell for side-centered data
+     * (sc_wgt_lower).  The stencils of each meter are sorted by level and patch
+     * number.
+     *
+     * A web_idx of -1 denotes the stencil of the meter centroid; otherwise
+     * web_idx is the index of the web patch in the flattened web arrays.
      */
-    struct IndexFortranOrder
+    struct WebStencil
     {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    || (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    || (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-            );
-        } // operator()
+        int web_idx;
+        int level_num, patch_num;
+        SAMRAI::hier::Index<NDIM> cell_idx, cc_lower_idx;
+        IBTK::Vector cc_wgt_lower, sc_wgt_lower;
     };
+    std::vector<std::vector<WebStencil> > d_web_stencils;
 
-    struct WebPatch
-    {
-        int meter_num;
-        const IBTK::Vector* X;
-        const IBTK::Vector* dA;
-    };
-
-    using WebPatchMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder>;
-    std::vector<WebPatchMap> d_web_patch_map;
-
-    struct WebCentroid
-    {
-        int meter_num;
-        const IBTK::Vector* X;
-    };
-
-    using WebCentroidMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder>;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    /*!
+     * \brief The patch boxes and their processor assignments for each level of
+     * the hierarchy at the time that the stencils were built.
+     *
+     * The stencils of a meter are only rebuilt when this configuration changes
+     * or when the meter moves to a different set of cells; otherwise, only the
+     * interpolation weights are updated.
+     */
+    std::vector<std::vector<std::pair<SAMRAI::hier::Box<NDIM>, int> > > d_stencil_level_layout;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
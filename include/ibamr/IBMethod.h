@@ -26,6 +26,7 @@
 #include "ibamr/IBLagrangianSourceStrategy.h"
 #include "ibamr/IBMethodPostProcessStrategy.h"
 
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
@@ -144,6 +145,12 @@ public:
      */
     void registerLSiloDataWriter(SAMRAI::tbox::Pointer<IBTK::LSiloDataWriter> silo_writer);
 
+    /*!
+     * Register a Lagrangian HDF5 data writer so this class will write plot
+     * files that may be postprocessed with ParaView or VisIt.
+     */
+    void registerLHDF5DataWriter(SAMRAI::tbox::Pointer<IBTK::LHDF5DataWriter> hdf5_writer);
+
     /*!
      * Return the number of ghost cells required by the Lagrangian-Eulerian
      * interaction routines.
@@ -465,6 +472,13 @@ protected:
                                    bool** X_LE_needs_ghost_fill,
                                    double data_time);
 
+    /*!
+     * Get the handle under which the interpolation and spreading weights
+     * computed for the current interpolation/spreading position data are
+     * cached, or -1 if the weights should not be cached.
+     */
+    int getLECouplingPlanHandle(double data_time) const;
+
     /*!
      * Get the current structure velocity data.
      */
@@ -554,6 +568,14 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_U_current_data, d_U_new_data, d_U_half_data, d_U_jac_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_F_current_data, d_F_new_data, d_F_half_data, d_F_jac_data;
 
+    /*
+     * Handles under which the interpolation and spreading weights computed for
+     * the current, midpoint, and new position data are cached. The version is
+     * incremented whenever the position data are reallocated.
+     */
+    int d_X_current_plan_handle, d_X_half_plan_handle, d_X_new_plan_handle;
+    unsigned int d_plan_version = 0;
+
     /*
      * List of local indices of local anchor points.
      *
@@ -600,6 +622,7 @@ protected:
      * Visualization data writers.
      */
     SAMRAI::tbox::Pointer<IBTK::LSiloDataWriter> d_silo_writer;
+    SAMRAI::tbox::Pointer<IBTK::LHDF5DataWriter> d_hdf5_writer;
 
     /*
      * Nonuniform load balancing data structures.
@@ -22,6 +22,7 @@
 
 #include "ibamr/IBRodForceSpec.h"
 
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
@@ -87,6 +88,11 @@ public:
      */
     void registerLSiloDataWriter(SAMRAI::tbox::Pointer<IBTK::LSiloDataWriter> silo_writer);
 
+    /*!
+     * \brief Register an HDF5 data writer with the IB initializer object.
+     */
+    void registerLHDF5DataWriter(SAMRAI::tbox::Pointer<IBTK::LHDF5DataWriter> hdf5_writer);
+
     /*!
      * \brief Determine whether there are any Lagrangian nodes on the specified
      * patch level.
@@ -507,11 +513,17 @@ protected:
     IBRedundantInitializer& operator=(const IBRedundantInitializer& that) = delete;
 
     /*!
-     * \brief Configure the Lagrangian Silo data writer to plot the data
-     * associated with the specified level of the locally refined Cartesian
-     * grid.
+     * \brief Configure the Lagrangian Silo and HDF5 data writers to plot the
+     * data associated with the specified level of the locally refined
+     * Cartesian grid.
+     */
+    void initializeLagrangianDataWriters(int level_number);
+
+    /*!
+     * \brief Register the springs of the specified structure that are stored
+     * on this MPI process as an unstructured mesh with the data writers.
      */
-    void initializeLSiloDataWriter(int level_number);
+    void registerSpringMesh(int level_number, unsigned int j);
 
     /*!
      * \brief Initialize vertex data programmatically.
@@ -563,6 +575,27 @@ protected:
      */
     void initializeSourceData();
 
+    /*!
+     * \brief Move the locally held vertices of the specified level, together
+     * with the springs that they own, to the MPI processes that own the patches
+     * of the given patch level in which the vertices are located. Vertices not
+     * located in any patch of the level are kept by their current process.
+     *
+     * \note This function is collective and does nothing unless vertex data is
+     * distributed.
+     */
+    void distributeVertexData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                              int patch_level_number,
+                              int vertex_level_number);
+
+    /*!
+     * \brief Send the ith buffer to MPI process i and collect the data received
+     * from all processes.
+     *
+     * \note This function is collective.
+     */
+    static void exchangeData(const std::vector<std::vector<double> >& send_data, std::vector<double>& recv_data);
+
     /*!
      * \brief Determine the indices of any vertices initially owned by the
      * specified patch.
@@ -665,9 +698,10 @@ protected:
     std::vector<bool> d_level_is_initialized;
 
     /*
-     * An (optional) Lagrangian Silo data writer.
+     * (Optional) Lagrangian Silo and HDF5 data writers.
      */
     SAMRAI::tbox::Pointer<IBTK::LSiloDataWriter> d_silo_writer;
+    SAMRAI::tbox::Pointer<IBTK::LHDF5DataWriter> d_hdf5_writer;
 
     /*
      * The base filenames of the structures are used to generate unique names
@@ -696,6 +730,17 @@ protected:
     std::vector<std::vector<int> > d_num_vertex, d_vertex_offset;
     std::vector<std::vector<std::vector<IBTK::Point> > > d_vertex_posn;
 
+    /*
+     * Distributed vertex information. When vertex data is distributed, each
+     * process holds only a subset of the vertices, indexed by their
+     * structure-local indices, and only the springs whose first vertex it
+     * holds. In this case, d_vertex_posn is not used.
+     */
+    bool d_use_distributed_vertices = false;
+    using LocalVertexMap =
+        std::map<int, IBTK::Point, std::less<int>, Eigen::aligned_allocator<std::pair<const int, IBTK::Point> > >;
+    std::vector<std::vector<LocalVertexMap> > d_local_vertex_posn;
+
     /*
      * Spring information.
      */
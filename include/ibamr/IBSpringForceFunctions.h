@@ -117,6 +117,49 @@ default_spring_force_deriv(double /*R*/, const double* params, int /*lag_mastr_i
     return params[0];
 } // default_spring_force_deriv
 
+/*!
+ * \brief Function to compute the (undirected) "tension" force generated by a
+ * piecewise linear spring that stiffens when it is stretched beyond a threshold
+ * strain.
+ *
+ * Using the notation of default_spring_force(), and letting \f$ \epsilon_{k,l}
+ * \f$ be the threshold strain and \f$ \alpha_{k,l} \f$ the ratio of the
+ * stiffness beyond the threshold to the stiffness below it, this function
+ * computes \f[
+ *
+ *      T_{k,l} = \kappa_{k,l} \left( \|\vec{X}_{l} - \vec{X}_{k}\| - r_{k,l} \right)
+ *              + (\alpha_{k,l} - 1) \kappa_{k,l}
+ *                \max\left(\|\vec{X}_{l} - \vec{X}_{k}\| - (1 + \epsilon_{k,l}) r_{k,l}, 0 \right).
+ *
+ * \f] The parameters are ordered as \f$ (\kappa_{k,l}, r_{k,l}, \epsilon_{k,l},
+ * \alpha_{k,l}) \f$.
+ *
+ * \note This function is not associated with a force function index by
+ * default.  Users must register it with
+ * IBStandardForceGen::registerSpringForceFunction(), and the corresponding
+ * springs must provide all four parameters.  When contiguous force data are
+ * used, IBStandardForceGen evaluates springs that use this function with a
+ * specialized kernel.
+ */
+inline double
+stiff_linear_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    const double stretch = R - params[1];
+    const double excess_stretch = stretch - params[2] * params[1];
+    return params[0] * (stretch + (params[3] - 1.0) * (excess_stretch > 0.0 ? excess_stretch : 0.0));
+} // stiff_linear_spring_force
+
+/*!
+ * \brief Function to compute the derivative with respect to R of the tension
+ * force generated by a piecewise linear spring that stiffens when it is
+ * stretched beyond a threshold strain.
+ */
+inline double
+stiff_linear_spring_force_deriv(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    return R - params[1] > params[2] * params[1] ? params[0] * params[3] : params[0];
+} // stiff_linear_spring_force_deriv
+
 } // namespace IBAMR
 
 //////////////////////////////////////////////////////////////////////////////
@@ -67,6 +67,16 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * \note When the input database sets <TT>use_contiguous_force_data</TT> to
+ * TRUE, the parameters of springs that use default_spring_force() or
+ * stiff_linear_spring_force(), of beams, and of target points are copied into
+ * contiguous arrays when the level data are initialized (i.e., after each
+ * regrid), and these forces are evaluated by specialized kernels. Changes made
+ * to the parameters stored in the force specification objects (e.g., moving
+ * target point positions) take effect only after a call to
+ * markForceParametersModified(). Springs that use any other force function are
+ * always evaluated through the registered function pointer.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -92,6 +102,16 @@ public:
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
                                      const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = nullptr);
 
+    /*!
+     * \brief Indicate that the parameters stored in the force specification
+     * objects have been modified.
+     *
+     * \note This is only needed when contiguous force data are used, in which
+     * case the contiguous copies of the force parameters on all levels are
+     * refreshed before the next force evaluation.
+     */
+    void markForceParametersModified();
+
     /*!
      * \brief Set a uniform body force that is applied on each point in the
      * structure with the given structure_id.
@@ -197,6 +217,18 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // Contiguous data for springs evaluated by the specialized linear and
+        // stiff linear spring kernels, and the indices of the remaining
+        // springs.
+        std::vector<int> linear_spring_idxs;
+        std::vector<int> linear_petsc_mastr_node_idxs, linear_petsc_slave_node_idxs;
+        std::vector<double> linear_stiffnesses, linear_rest_lengths;
+        std::vector<int> stiff_linear_spring_idxs;
+        std::vector<int> stiff_linear_petsc_mastr_node_idxs, stiff_linear_petsc_slave_node_idxs;
+        std::vector<double> stiff_linear_stiffnesses, stiff_linear_rest_lengths;
+        std::vector<double> stiff_linear_threshold_stretches, stiff_linear_stiffening_ratios;
+        std::vector<int> generic_spring_idxs;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -206,6 +238,9 @@ private:
         std::vector<int> petsc_global_mastr_node_idxs, petsc_global_next_node_idxs, petsc_global_prev_node_idxs;
         std::vector<const double*> rigidities;
         std::vector<const IBTK::Vector*> curvatures;
+
+        // Contiguous copies of the beam parameters.
+        std::vector<double> contiguous_rigidities, contiguous_curvatures;
     };
     std::vector<BeamData> d_beam_data;
 
@@ -214,6 +249,9 @@ private:
         std::vector<int> petsc_node_idxs, petsc_global_node_idxs;
         std::vector<const double*> kappa, eta;
         std::vector<const IBTK::Point*> X0;
+
+        // Contiguous copies of the target point parameters.
+        std::vector<double> contiguous_kappa, contiguous_eta, contiguous_X0;
     };
     std::vector<TargetPointData> d_target_point_data;
 
@@ -272,6 +310,28 @@ private:
                                            double data_time,
                                            IBTK::LDataManager* l_data_manager);
 
+    /*!
+     * Sort the springs by force function and copy the force parameters into
+     * contiguous arrays.
+     */
+    void initializeContiguousForceData(int level_number);
+
+    /*!
+     * Copy the current values of the force parameters into the contiguous
+     * arrays.
+     */
+    void updateContiguousForceData(int level_number);
+
+    /*!
+     * Specialized force routines that use the contiguous force data.
+     */
+    void computeContiguousSpringForce(double* F_node, const double* X_node, int level_number);
+    void computeContiguousBeamForce(double* F_node, const double* X_node, int level_number);
+    double computeContiguousTargetPointForce(double* F_node,
+                                             const double* X_node,
+                                             const double* U_node,
+                                             int level_number);
+
     /*!
      * Constant body force routines.
      */
@@ -291,6 +351,18 @@ private:
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements = false;
+
+    /*!
+     * \brief Whether force parameters are copied into contiguous arrays and
+     * evaluated by specialized kernels.
+     */
+    bool d_use_contiguous_force_data = false;
+
+    /*!
+     * \brief Whether the contiguous copies of the force parameters on each
+     * level are consistent with the force specification objects.
+     */
+    std::vector<bool> d_contiguous_force_data_is_current;
 };
 } // namespace IBAMR
 
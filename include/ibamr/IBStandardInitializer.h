@@ -409,6 +409,40 @@ namespace IBAMR
  D2_x_2   D2_y_2   D2_z_2  # coordinates of director D2 associated with vertex 2
  ...
  \endverbatim
+ *
+ * <HR>
+ *
+ * <B>Binary structure file format</B>
+ *
+ * For large structures, the vertex and spring data may instead be provided by
+ * a single binary file per structure ending with the extension
+ * <TT>".ibstruct"</TT>. These files are memory-mapped so that parsing is
+ * avoided and all MPI processes may read them at once. Binary files are
+ * selected by setting <TT>structure_file_format = "BINARY"</TT> in the input
+ * database. They are generated from the ASCII input files by running once with
+ * <TT>write_binary_structure_files = TRUE</TT>.
+ *
+ * A binary file consists of a header (an eight character tag, the format
+ * version, a byte order mark, NDIM, the number of sections, and flags
+ * indicating whether vertex indices are global), a table of typed sections with
+ * their byte offsets and sizes, and the section data. The header is validated
+ * before any data are read, so files written on machines with a different byte
+ * order are rejected. Positions are stored without the shift and scale factors
+ * applied and spring vertex indices are local to the structure, as in the ASCII
+ * files. Unless the structure data are distributed, every MPI process reads
+ * the complete sections directly from its own mapping of the file, so no
+ * communication is needed.
+ *
+ * \note Only vertex and spring data may be read from binary files. All other
+ * data continues to be read from the ASCII input files.
+ *
+ * When binary files are used, setting <TT>distribute_structure_data = TRUE</TT>
+ * avoids storing the complete vertex and spring data on every MPI process.
+ * Each process reads a contiguous range of the vertices and springs, which are
+ * then moved to the processes that own the patches containing the vertices.
+ * Springs are kept with their first vertex. The ranges are read through the
+ * memory mapping rather than with collective MPI-IO, so that each process only
+ * touches the pages it needs and no MPI-IO support is required.
 */
 class IBStandardInitializer : public IBAMR::IBRedundantInitializer
 {
@@ -471,11 +505,33 @@ private:
      */
     void readVertexFiles(const std::string& extension);
 
+    /*!
+     * \brief Read the vertex data of a single structure from a binary file.
+     */
+    void readBinaryVertexFile(int ln, unsigned int j, const std::string& filename);
+
+    /*!
+     * \return The half-open range of vertex indices read by the specified MPI
+     * process when vertex data is distributed.
+     */
+    std::pair<int, int> getDistributedVertexRange(int num_vertex, int rank) const;
+
     /*!
      * \brief Read the spring data from one or more input files.
      */
     void readSpringFiles(const std::string& file_extension, bool input_uses_global_idxs);
 
+    /*!
+     * \brief Read the spring data of a single structure from a binary file.
+     */
+    void readBinarySpringFile(int ln, unsigned int j, const std::string& filename, bool input_uses_global_idxs);
+
+    /*!
+     * \brief Write the vertex and spring data of all structures to binary
+     * files.
+     */
+    void writeBinaryStructureFiles(const std::string& extension);
+
     /*!
      * \brief Read the crosslink spring ("x-spring") data from one or more input
      * files.
@@ -543,6 +599,14 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * Whether vertex and spring data are read from binary structure files and
+     * whether binary structure files are written after reading the ASCII
+     * input files.
+     */
+    bool d_use_binary_structure_files = false;
+    bool d_write_binary_structure_files = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -218,6 +218,12 @@ protected:
      */
     void setupPlotDataSpecialized() override;
 
+    /*!
+     * Register the number of iterations taken by the velocity and pressure solvers with the performance
+     * report writer.
+     */
+    void registerPerformanceReportValuesSpecialized() override;
+
     /*!
      * Project the velocity field following a regridding operation.
      */
@@ -309,6 +309,12 @@ protected:
      */
     void setupPlotDataSpecialized() override;
 
+    /*!
+     * Register the number of iterations taken by the Stokes solver with the performance
+     * report writer.
+     */
+    void registerPerformanceReportValuesSpecialized() override;
+
     /*!
      * Project the velocity field following a regridding operation.
      */
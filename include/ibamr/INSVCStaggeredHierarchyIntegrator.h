@@ -504,6 +504,12 @@ protected:
      */
     virtual void setupPlotDataSpecialized() override;
 
+    /*!
+     * Register the number of iterations taken by the Stokes solver with the performance
+     * report writer.
+     */
+    void registerPerformanceReportValuesSpecialized() override;
+
     /*!
      * Copy data from a side-centered variable to a face-centered variable.
      */
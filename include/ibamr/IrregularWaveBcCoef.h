@@ -20,6 +20,9 @@
 
 #include <ibamr/config.h>
 
+#include "ibamr/IrregularWaveSpectrum.h"
+#include "ibamr/WaveInletBcCoefCache.h"
+
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserRobinBcCoefs.h"
 
@@ -28,8 +31,8 @@
 #include "RobinBcCoefStrategy.h"
 #include "tbox/Pointer.h"
 
+#include <memory>
 #include <string>
-#include <vector>
 
 namespace IBAMR
 {
@@ -204,21 +207,26 @@ private:
      * \param d_omega_begin     : Lowest angular frequency in the spectrum [$rad/s$]
      * \param d_omega_end       : Highest angular frequency in the spectrum [$rad/s$]
      * \param d_wave_spectrum   : JONSWAP/Bretschneider wave spectrum.
-     * \param d_omega           : Angular frequencies of component waves [$rad/s$]
-     * \param d_wave_number     : Wave number of component waves [$2\pi/m$]
-     * \param d_amplitude       : Amplitude of component waves [$m$]
-     * \param d_phase           : Phase (random) of component waves [$rad$]
      */
 
     int d_num_waves = 50; // default value is set to 50
     double d_depth, d_omega_begin, d_omega_end, d_Ts, d_Hs, d_gravity;
     std::string d_wave_spectrum;
-    std::vector<double> d_omega, d_wave_number, d_amplitude, d_phase;
+
+    /*!
+     * Component waves of the spectrum.
+     */
+    std::unique_ptr<IrregularWaveSpectrum> d_spectrum;
 
     /*!
      * Number of interface cells.
      */
     double d_num_interface_cells;
+
+    /*!
+     * Cached inlet boundary values.
+     */
+    mutable WaveInletBcCoefCache d_inlet_cache;
 };
 } // namespace IBAMR
 
@@ -20,14 +20,15 @@
 
 #include <ibamr/config.h>
 
+#include "ibamr/IrregularWaveSpectrum.h"
 #include "ibamr/StokesWaveGeneratorStrategy.h"
 
 #include "tbox/Pointer.h"
 
 #include <fstream>
 #include <limits>
+#include <memory>
 #include <string>
-#include <vector>
 
 namespace SAMRAI
 {
@@ -99,24 +100,9 @@ private:
     std::string d_wave_spectrum;
 
     ///
-    /// Angular frequencies of component waves [rad/time].
+    /// Component waves of the spectrum.
     ///
-    std::vector<double> d_omega;
-
-    ///
-    /// Wave number of component waves [2\f$ \pi \f$/length].
-    ///
-    std::vector<double> d_wave_number;
-
-    ///
-    /// Amplitude of component waves [length].
-    ///
-    std::vector<double> d_amplitude;
-
-    ///
-    /// Phase (random) of component waves [rad].
-    ///
-    std::vector<double> d_phase;
+    std::unique_ptr<IrregularWaveSpectrum> d_spectrum;
 };
 
 } // namespace IBAMR
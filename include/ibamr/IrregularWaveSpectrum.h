@@ -0,0 +1,154 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_IrregularWaveSpectrum
+#define included_IBAMR_IrregularWaveSpectrum
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class IrregularWaveSpectrum represents an irregular wave as the sum of
+ * linear component waves whose amplitudes are sampled from a JONSWAP or
+ * Bretschneider spectrum and whose phases are random.
+ *
+ * The phase of component wave \f$ i \f$ is \f$ \theta_i = k_i x - \omega_i t +
+ * \varphi_i \f$.  Instead of evaluating the trigonometric and hyperbolic
+ * functions of every component at every point, this class tabulates
+ *
+ * - \f$ \cos(\varphi_i - \omega_i t) \f$ and \f$ \sin(\varphi_i - \omega_i t)
+ *   \f$ for each time,
+ * - \f$ \cos(k_i x) \f$ and \f$ \sin(k_i x) \f$ for each horizontal position,
+ *   and
+ * - \f$ a_i \omega_i \cosh(k_i (z+d)) / \sinh(k_i d) \f$ and \f$ a_i \omega_i
+ *   \sinh(k_i (z+d)) / \sinh(k_i d) \f$ for each vertical position,
+ *
+ * so that evaluating the wave at a point only requires a sum of products over
+ * the components.  Because the wave is evaluated at grid points, the position
+ * tables are reused for every time step, and the time tables are reused for
+ * every evaluation at the same time.
+ */
+class IrregularWaveSpectrum
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param num_waves      Number of component waves.
+     * \param omega_begin    Lowest angular frequency in the spectrum.
+     * \param omega_end      Highest angular frequency in the spectrum.
+     * \param Hs             Significant wave height.
+     * \param Ts             Significant wave period.
+     * \param wave_spectrum  Either "JONSWAP" or "BRETSCHNEIDER".
+     * \param depth          Depth of water, from sea bed to still water level.
+     * \param gravity        Acceleration due to gravity.
+     */
+    IrregularWaveSpectrum(int num_waves,
+                          double omega_begin,
+                          double omega_end,
+                          double Hs,
+                          double Ts,
+                          const std::string& wave_spectrum,
+                          double depth,
+                          double gravity);
+
+    /*!
+     * \brief Get the number of component waves.
+     */
+    int getNumberOfWaves() const;
+
+    /*!
+     * \brief Get the amplitudes of the component waves.
+     */
+    const std::vector<double>& getAmplitudes() const;
+
+    /*!
+     * \brief Get the angular frequencies of the component waves.
+     */
+    const std::vector<double>& getAngularFrequencies() const;
+
+    /*!
+     * \brief Get the wave numbers of the component waves.
+     */
+    const std::vector<double>& getWaveNumbers() const;
+
+    /*!
+     * \brief Get the (random) phases of the component waves.
+     */
+    const std::vector<double>& getPhases() const;
+
+    /*!
+     * \brief Get the surface elevation at a specified horizontal position and
+     * time.
+     */
+    double getSurfaceElevation(double x, double time) const;
+
+    /*!
+     * \brief Get a velocity component at a specified position and time.
+     *
+     * \note As in StokesWaveGeneratorStrategy, \p z_plus_d is the vertical
+     * coordinate measured from the sea bed.
+     */
+    double getVelocity(double x, double z_plus_d, double time, int comp_idx) const;
+
+private:
+    /*!
+     * \brief Get the cosines and sines of \f$ \varphi_i - \omega_i t \f$.
+     */
+    const std::vector<double>& getTimeTable(double time) const;
+
+    /*!
+     * \brief Get the cosines and sines of \f$ k_i x \f$.
+     */
+    const std::vector<double>& getHorizontalTable(double x) const;
+
+    /*!
+     * \brief Get the scaled hyperbolic cosines and sines of \f$ k_i (z+d) \f$.
+     */
+    const std::vector<double>& getVerticalTable(double z_plus_d) const;
+
+    /*!
+     * Wave parameters.
+     */
+    int d_num_waves;
+    double d_depth;
+
+    /*!
+     * Amplitudes, angular frequencies, wave numbers, and phases of the
+     * component waves.
+     */
+    std::vector<double> d_amplitude, d_omega, d_wave_number, d_phase;
+
+    /*!
+     * Tables of the time- and position-dependent factors of the component
+     * waves.  Each table stores the values for all components of one factor
+     * followed by those of the other.
+     */
+    mutable std::map<double, std::vector<double> > d_time_tables, d_horizontal_tables, d_vertical_tables;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_IrregularWaveSpectrum
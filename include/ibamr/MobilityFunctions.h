@@ -99,6 +99,42 @@ public:
                                            const int num_nodes,
                                            const double periodic_correction,
                                            double* mm);
+
+    /*!
+     * \brief Apply the Rotne-Pragner-Yamakawa mobility matrix to a vector
+     * without forming the matrix.
+     *
+     * This computes the same product as multiplying by the matrix generated by
+     * constructRPYMobilityMatrix() but requires only O(N) storage. The pair
+     * interactions are summed directly, so each product still costs O(N^2)
+     * operations.
+     *
+     * \param kernel_name IB kernel function.
+     * \note Supported IB kernels are "IB_3", "IB_4" and "IB_6".
+     *
+     * \param mu Fluid density.
+     *
+     * \param dx Cartesian grid spacing.
+     *
+     * \param X Array of IB markers' location.
+     *
+     * \param num_nodes Number of Lagrangian markers.
+     *
+     * \param periodic_correction Input parameter for incorporating
+     * periodic domain correction. Set it to zero if not known.
+     *
+     * \param F Array of forces on the IB markers.
+     *
+     * \param U Array of velocities of the IB markers.
+     */
+    static void applyRPYMobility(const char* kernel_name,
+                                 const double mu,
+                                 const double dx,
+                                 const double* X,
+                                 const int num_nodes,
+                                 const double periodic_correction,
+                                 const double* F,
+                                 double* U);
 }; // MobilityFunctions
 
 } // namespace IBAMR
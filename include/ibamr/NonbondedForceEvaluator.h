@@ -32,6 +32,7 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <vector>
 
 namespace IBTK
@@ -69,6 +70,13 @@ public:
     using NonBddForceFcnPtr = void (*)(double* D, const SAMRAI::tbox::Array<double> params, double* out_force);
 
     // Class constructor.
+    //
+    // In addition to interaction_radius, regrid_alpha, and parameters, the
+    // input database may specify use_verlet_lists (default FALSE) and
+    // verlet_skin (default 0.0, in units of the grid spacing). With Verlet
+    // lists, only pairs within interaction_radius + verlet_skin of each other
+    // are stored, and the list is reused until some node moves by more than
+    // half of the skin width or the nodes are redistributed.
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
 
@@ -88,10 +96,45 @@ public:
                                 const double data_time,
                                 IBTK::LDataManager* const l_data_manager) override;
 
+    // Build the list of pairs of nodes on the given level that interact
+    // with each other, including periodic images.
+    void buildNeighborList(const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           const double* position,
+                           int ghosted_local_size,
+                           IBTK::LDataManager* l_data_manager);
+
+    // Add the forces between all pairs of nodes in the neighbor list, using
+    // the ghosted local forms of the position and force arrays.
+    void evaluateNeighborForces(const double* position, double* force);
+
     // Register the force function used
     void registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr);
 
 private:
+    // A pair of interacting nodes and the periodic offset of the search node.
+    struct NeighborPair
+    {
+        int mstr_petsc_idx;
+        int search_petsc_idx;
+        std::array<int, NDIM> cell_offset;
+    };
+
+    // Function to evaluate the force between a pair of nodes using raw
+    // position and force arrays.
+    void evaluateForces(int mstr_petsc_idx,
+                        int search_petsc_idx,
+                        const double* position,
+                        const int* cell_offset,
+                        double* force);
+
+    // Whether the current neighbor list may be reused for the given data.
+    bool neighborListIsCurrent(const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               int level_number,
+                               const double* position,
+                               int ghosted_local_size,
+                               IBTK::LDataManager* l_data_manager) const;
+
     // Default constructor, not implemented.
     NonbondedForceEvaluator() = delete;
 
@@ -116,6 +159,19 @@ private:
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
     NonBddForceFcnPtr d_force_fcn_ptr;
+
+    // Verlet list options:
+    bool d_use_verlet_lists = false;
+    double d_verlet_skin = 0.0;
+
+    // neighbor list, along with the data needed to determine whether it is
+    // still valid: the level number, the grid spacing, the positions at which
+    // it was built, and the (Lagrangian, local PETSc) index pairs of the nodes.
+    std::vector<NeighborPair> d_neighbor_pairs;
+    int d_neighbor_level_number = -1;
+    std::array<double, NDIM> d_neighbor_dx{};
+    std::vector<double> d_neighbor_X;
+    std::vector<int> d_neighbor_lag_idxs;
 };
 } // namespace IBAMR
 
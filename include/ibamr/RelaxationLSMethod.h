@@ -23,9 +23,11 @@
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "Box.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -39,8 +41,6 @@ class CellData;
 namespace hier
 {
 template <int DIM>
-class Box;
-template <int DIM>
 class Patch;
 } // namespace hier
 } // namespace SAMRAI
@@ -66,6 +66,20 @@ namespace IBAMR
  * constraint assumes that \f$Q^0\f$ is already close to a signed distance function and
  * is hence, by default, disabled at initial time.
  *
+ * The relaxation may optionally be restricted to a narrow band around the
+ * interface by setting the input option <tt>narrow_band_cells</tt> to a positive
+ * value k.  In that case, each patch is divided into tiles of
+ * <tt>narrow_band_tile_size</tt> cells (default 8) in each direction, and only
+ * the tiles that contain a cell within k grid cells of the interface are
+ * relaxed in place.  The list of tiles is updated from the initial level set
+ * each time the level set is reinitialized, so the band follows the interface.
+ * On patches that have not changed since the previous reinitialization, only
+ * the tiles that were in the band, their neighbors, and the tiles along the
+ * patch boundary are examined first.  If none of these tiles is within the band,
+ * or if a tile within the band has a neighbor that was not examined, the
+ * interface has moved by more than one tile, and all of the tiles of the patch
+ * are examined.  The values outside of the band are left unchanged.
+ *
  *
  * References
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
@@ -148,6 +162,11 @@ protected:
     // Relaxation weight parameter
     double d_alpha = 1.0;
 
+    // Narrow band half-width (in grid cells) and tile size.  The band is not
+    // used if the width is not positive.
+    int d_narrow_band_cells = 0;
+    int d_narrow_band_tile_size = 8;
+
 private:
     /*!
      * \brief Do one relaxation step over the hierarchy.
@@ -158,10 +177,18 @@ private:
                const int iter) const;
 
     /*!
-     * \brief Do one relaxation step over a patch.
+     * \brief Update the tiles of each local patch that are within the narrow
+     * band around the zero level set of the specified data.
+     */
+    void updateNarrowBand(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx);
+
+    /*!
+     * \brief Do one relaxation step over the cells of \p relax_box, which must
+     * be contained in the patch box.
      */
     void relax(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_init_data,
+               const SAMRAI::hier::Box<NDIM>& relax_box,
                const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                const int iter) const;
 
@@ -249,6 +276,18 @@ private:
      * \return A reference to this object.
      */
     RelaxationLSMethod& operator=(const RelaxationLSMethod& that) = delete;
+
+    /*!
+     * \brief The tiles of each local patch that are within the narrow band,
+     * indexed by level number and patch number.
+     */
+    std::vector<std::map<int, std::vector<SAMRAI::hier::Box<NDIM> > > > d_narrow_band_tiles;
+
+    /*!
+     * \brief The boxes of the local patches at the time that the narrow band
+     * was last updated, indexed by level number and patch number.
+     */
+    std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > d_narrow_band_patch_boxes;
 };
 } // namespace IBAMR
 
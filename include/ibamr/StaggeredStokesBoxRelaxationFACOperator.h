@@ -24,10 +24,6 @@
 
 #include "tbox/Pointer.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
-
 #include <array>
 #include <string>
 #include <vector>
@@ -58,6 +54,15 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * The smoother solves the local Stokes problem associated with each cell of
+ * the grid.  Because the local operator has constant coefficients on each
+ * level of the hierarchy, it is inverted once per level and the local problems
+ * are solved by a dense matrix-vector product.  By default, cells are visited
+ * in lexicographic order.  If the input database sets
+ * <TT>use_red_black_ordering</TT> to TRUE, cells are instead visited in
+ * red-black order; the local problems of cells of one color are independent,
+ * and are processed concurrently when IBAMR is configured with OpenMP.
  */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -146,10 +151,19 @@ private:
 
     /*
      * Box operator data.
+     *
+     * d_box_op_inv[ln] contains the inverse of the single-cell box operator on
+     * level ln, stored in row-major order.
+     */
+    std::vector<std::vector<double> > d_box_op_inv;
+
+    /*
+     * Whether to sweep over the cells of each patch in red-black order
+     * instead of lexicographic order, and scratch storage for the local
+     * solutions used by the red-black sweep.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    bool d_use_red_black_ordering = false;
+    std::vector<double> d_box_x_buffer;
 
     /*
      * Mappings from patch indices to patch operators.
@@ -68,6 +68,11 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to a MAC
      * discretization of the time-dependent incompressible Stokes equations on a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \p reuse_nonzero_structure is true and \p mat has already been
+     * constructed by this function for the same DOF indices, the nonzero
+     * structure of \p mat is kept and only its values are reset.  Otherwise,
+     * any existing matrix is destroyed and a new one is created.
      */
     static void constructPatchLevelMACStokesOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
@@ -76,7 +81,8 @@ public:
                                                const std::vector<int>& num_dofs_per_proc,
                                                int u_dof_index_idx,
                                                int p_dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
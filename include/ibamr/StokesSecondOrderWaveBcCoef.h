@@ -20,6 +20,8 @@
 
 #include <ibamr/config.h>
 
+#include "ibamr/WaveInletBcCoefCache.h"
+
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserRobinBcCoefs.h"
 
@@ -224,6 +226,11 @@ private:
      * Number of interface cells.
      */
     double d_num_interface_cells;
+
+    /*!
+     * Cached inlet boundary values.
+     */
+    mutable WaveInletBcCoefCache d_inlet_cache;
 };
 } // namespace IBAMR
 
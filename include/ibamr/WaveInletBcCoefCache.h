@@ -0,0 +1,107 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_WaveInletBcCoefCache
+#define included_IBAMR_WaveInletBcCoefCache
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include <array>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Patch;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class WaveInletBcCoefCache stores the inhomogeneous boundary values
+ * computed at the inlet of a wave tank.
+ *
+ * The wave inlet boundary condition classes evaluate an analytical wave at
+ * every boundary location.  Because the boundary coefficients are requested
+ * repeatedly at the same time (e.g., once per ghost cell fill in every
+ * iteration of a linear solver), the values computed for each boundary box
+ * are stored and copied on subsequent requests at the same time.  Values are
+ * kept for a few of the most recent times.
+ *
+ * The cached values are identified by the boundary box, the index and
+ * location of the patch, and the grid spacing, so the cache does not need to
+ * be reset when the patch hierarchy is regridded.
+ */
+class WaveInletBcCoefCache
+{
+public:
+    /*!
+     * \brief Copy cached boundary values into \p gcoef_data.
+     *
+     * \return true if values were found for this boundary box and time.
+     */
+    bool getCachedBcCoefs(SAMRAI::pdat::ArrayData<NDIM, double>& gcoef_data,
+                          const SAMRAI::hier::Patch<NDIM>& patch,
+                          double fill_time) const;
+
+    /*!
+     * \brief Store the boundary values in \p gcoef_data.
+     */
+    void cacheBcCoefs(const SAMRAI::pdat::ArrayData<NDIM, double>& gcoef_data,
+                      const SAMRAI::hier::Patch<NDIM>& patch,
+                      double fill_time);
+
+    /*!
+     * \brief Remove all cached values.
+     */
+    void clear();
+
+private:
+    /*!
+     * The lower and upper indices of the boundary box, the lower index of the
+     * patch, and the lower corner and grid spacing of the patch.
+     */
+    using CacheKey = std::pair<std::array<int, 3 * NDIM>, std::array<double, 2 * NDIM> >;
+
+    /*!
+     * \brief Get the key that identifies the values in \p gcoef_data.
+     */
+    static CacheKey getCacheKey(const SAMRAI::pdat::ArrayData<NDIM, double>& gcoef_data,
+                                const SAMRAI::hier::Patch<NDIM>& patch);
+
+    /*!
+     * Cached boundary values, ordered by time.
+     */
+    std::map<double, std::map<CacheKey, std::vector<double> > > d_cached_values;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_WaveInletBcCoefCache
@@ -432,12 +432,17 @@ enum_to_string<MobilityMatrixType>(MobilityMatrixType val)
 /*!
  * \brief Enumerated type for different direct methods for dense mobility
  *  matrix inversion.
+ *
+ * \note MATRIX_FREE_CG does not form the mobility matrix. Instead, the RPY
+ * mobility is applied on the fly by direct O(N^2) summation and inverted by the
+ * conjugate gradient method.
  */
 enum MobilityMatrixInverseType
 {
     LAPACK_CHOLESKY,
     LAPACK_LU,
     LAPACK_SVD,
+    MATRIX_FREE_CG,
     UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE = -1
 };
 
@@ -448,6 +453,7 @@ string_to_enum<MobilityMatrixInverseType>(const std::string& val)
     if (strcasecmp(val.c_str(), "LAPACK_CHOLESKY") == 0) return LAPACK_CHOLESKY;
     if (strcasecmp(val.c_str(), "LAPACK_LU") == 0) return LAPACK_LU;
     if (strcasecmp(val.c_str(), "LAPACK_SVD") == 0) return LAPACK_SVD;
+    if (strcasecmp(val.c_str(), "MATRIX_FREE_CG") == 0) return MATRIX_FREE_CG;
     return UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE;
 } // string_to_enum
 
@@ -458,6 +464,7 @@ enum_to_string<MobilityMatrixInverseType>(MobilityMatrixInverseType val)
     if (val == LAPACK_CHOLESKY) return "LAPACK_CHOLESKY";
     if (val == LAPACK_LU) return "LAPACK_LU";
     if (val == LAPACK_SVD) return "LAPACK_SVD";
+    if (val == MATRIX_FREE_CG) return "MATRIX_FREE_CG";
     return "UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE";
 } // enum_to_string
 
@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/PerformanceReportWriter.h"
 
 #include "VisItDataWriter.h"
 #include "tbox/Database.h"
@@ -194,6 +195,15 @@ public:
      */
     int getTimerDumpInterval() const;
 
+    /*!
+     * Return a writer for the per-time step performance report.  The writer is
+     * configured by the PerformanceReport database of the input file.
+     *
+     * If the application is not configured to write a performance report, a
+     * NULL pointer will be returned.
+     */
+    SAMRAI::tbox::Pointer<PerformanceReportWriter> getPerformanceReportWriter() const;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -253,6 +263,7 @@ private:
      * Timer options.
      */
     int d_timer_dump_interval = 0;
+    SAMRAI::tbox::Pointer<PerformanceReportWriter> d_performance_report_writer;
 };
 } // namespace IBTK
 
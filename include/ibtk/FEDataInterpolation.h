@@ -303,6 +303,39 @@ public:
      */
     void collectDataForInterpolation(const libMesh::Elem* elem);
 
+    /*!
+     * \brief Get read-only access to the local arrays of the data vectors of all interpolated systems and keep them
+     * until restoreSystemVectorArrays() is called.
+     *
+     * While the arrays are held, collectDataForInterpolation() reads from them directly instead of getting and
+     * restoring the vector arrays on each element.  This makes it safe to call collectDataForInterpolation()
+     * concurrently on several FEDataInterpolation objects that share system vectors (see shareSystemVectorArrays()),
+     * provided that the DOF caches of the systems have already been populated for the elements in question.  The
+     * vectors must not be modified while their arrays are held.
+     *
+     * NOTE: This method must be called after init().
+     */
+    void getSystemVectorArrays();
+
+    /*!
+     * \brief Use the arrays held by another object, which must have obtained them with getSystemVectorArrays() and
+     * must interpolate the same system vectors, instead of getting the arrays from the vectors again.
+     *
+     * The arrays remain owned by the other object: releaseSystemVectorArrays() must be called on this object before
+     * restoreSystemVectorArrays() is called on the other one.
+     */
+    void shareSystemVectorArrays(const FEDataInterpolation& owner);
+
+    /*!
+     * \brief Stop using the arrays obtained by shareSystemVectorArrays() without restoring them.
+     */
+    void releaseSystemVectorArrays();
+
+    /*!
+     * \brief Restore the arrays obtained by getSystemVectorArrays().
+     */
+    void restoreSystemVectorArrays();
+
     /*!
      * \brief Provide the elemental data associated with the given system index and element.
      */
@@ -350,6 +383,8 @@ private:
     std::vector<std::vector<int> > d_system_all_vars, d_system_vars, d_system_grad_vars;
     std::vector<std::vector<size_t> > d_system_var_idx, d_system_grad_var_idx;
     std::vector<libMesh::NumericVector<double>*> d_system_vecs;
+    std::vector<const double*> d_system_vec_arrays;
+    bool d_owns_system_vec_arrays = false;
     std::vector<std::vector<size_t> > d_system_var_fe_type_idx, d_system_grad_var_fe_type_idx;
     std::vector<std::vector<std::vector<double> > > d_system_var_data;
     std::vector<std::vector<std::vector<libMesh::VectorValue<double> > > > d_system_grad_var_data;
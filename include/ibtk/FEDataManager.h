@@ -54,6 +54,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -400,6 +401,16 @@ private:
  * it produces some artifacts at the coarse-fine interface, but that these
  * generally don't effect the overall solution quality.
  *
+ * <code>use_quadrature_point_geometry_cache</code>: boolean that determines
+ * whether spread() and interpWeighted() store the quadrature rules, physical
+ * quadrature point locations, and JxW values that they compute on each patch.
+ * Subsequent calls that use the same quadrature rule specification and the
+ * same structure positions (e.g., the spreading and interpolation operations
+ * performed during a single time step) then skip the element traversal
+ * required to compute these values. Stored values are discarded whenever the
+ * positions change, by reinitElementMappings(), and by
+ * clearQuadraturePointGeometryCache(). The default value is <code>false</code>.
+ *
  * <h2>Parameters effecting workload estimate calculations</h2>
  * FEDataManager can estimate the amount of work done in IBFE calculations
  * (such as FEDataManager::spread). Since most calculations use a variable
@@ -709,6 +720,16 @@ public:
      */
     void reinitElementMappings();
 
+    /*!
+     * \brief Discard the quadrature point geometry data stored by spread() and
+     * interpWeighted().
+     *
+     * @note This is usually called by the IBFEMethod which owns the current
+     * FEDataManager at the beginning of each time step. It has no effect
+     * unless <code>use_quadrature_point_geometry_cache</code> is enabled.
+     */
+    void clearQuadraturePointGeometryCache();
+
     /*!
      * \return A pointer to the unghosted solution vector associated with the
      * specified system.
@@ -1339,6 +1360,49 @@ private:
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<libMesh::Elem*> d_active_elems;
 
+    /*!
+     * Quadrature point geometry data computed by spread() and
+     * interpWeighted(). The per-patch data are indexed by level number and
+     * local patch number, and the quadrature point data on each patch are
+     * stored in the same order as the elements in d_active_patch_elem_map.
+     */
+    struct QuadraturePointGeometry
+    {
+        /*!
+         * The coordinates vector, its PETSc object state, and its (ghosted)
+         * local values at the time the data were computed.
+         */
+        Vec X_vec = nullptr;
+        PetscObjectState X_state = -1;
+        std::vector<double> X_local_soln;
+
+        std::vector<std::vector<std::vector<quadrature_key_type> > > quad_keys;
+        std::vector<std::vector<std::vector<double> > > X_qp;
+        std::vector<std::vector<std::vector<double> > > JxW_qp;
+    };
+
+    /*!
+     * Return the stored quadrature point geometry data for the quadrature
+     * rule specified by \p spec, or a null pointer if caching is disabled. If
+     * the stored data were not computed from the values in \p X_local_soln
+     * then they are reset and \p is_current is set to false.
+     */
+    template <class Spec>
+    QuadraturePointGeometry* getQuadraturePointGeometry(const Spec& spec,
+                                                        libMesh::PetscVector<double>& X_petsc_vec,
+                                                        const double* X_local_soln,
+                                                        bool& is_current);
+
+    /*!
+     * Whether or not to store quadrature point geometry data, and the data
+     * themselves, indexed by the quadrature type, quadrature order, use of
+     * adaptive quadrature, point density, and whether rules with negative
+     * weights are permitted.
+     */
+    bool d_use_qp_geometry_cache = false;
+    std::map<std::tuple<libMesh::QuadratureType, libMesh::Order, bool, double, bool>, QuadraturePointGeometry>
+        d_qp_geometry_cache;
+
     /*!
      * Ghost vectors for the various equation systems.
      */
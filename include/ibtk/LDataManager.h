@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetVariable.h"
@@ -570,6 +571,11 @@ public:
      */
     void registerLSiloDataWriter(SAMRAI::tbox::Pointer<LSiloDataWriter> silo_writer);
 
+    /*!
+     * \brief Register an HDF5 data writer with the manager.
+     */
+    void registerLHDF5DataWriter(SAMRAI::tbox::Pointer<LHDF5DataWriter> hdf5_writer);
+
     /*!
      * \brief Register a load balancer for non-uniform load balancing.
      *
@@ -1141,6 +1147,7 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
     SAMRAI::tbox::Pointer<LSiloDataWriter> d_silo_writer;
+    SAMRAI::tbox::Pointer<LHDF5DataWriter> d_hdf5_writer;
 
     /*
      * We cache a pointer to the load balancer.
@@ -78,11 +78,95 @@ public:
     static double (*s_kernel_fcn)(double r);
     static int s_kernel_fcn_stencil_size;
 
+    /*!
+     * \brief Whether to use the threaded (OpenMP) implementation of the
+     * spreading operation.
+     *
+     * When enabled, the Lagrangian markers within each patch are sorted into
+     * bins that are colored so that the kernel stencils of markers in bins of
+     * the same color cannot overlap. Bins of each color are then processed
+     * concurrently without atomic updates. Each grid value is updated by at
+     * most one bin of each color, and the colors are processed in a fixed
+     * order, so the order in which values are accumulated depends only on the
+     * marker positions: results are bitwise reproducible run-to-run and
+     * independent of the number (including one) of threads, although they may
+     * differ from those of the default implementation at the level of roundoff.
+     *
+     * \note Without OpenMP support (i.e., if IBAMR was not configured with
+     * OpenMP) the bins are processed by a single thread in the same order.
+     */
+    static bool s_use_threaded_spreading;
+
+    /*!
+     * \brief Whether to use the C++ implementations of interpolation that are
+     * specialized at compile time on the stencil width for the IB_4, IB_6, and
+     * BSPLINE_3 kernels instead of the generic Fortran routines.
+     *
+     * The specialized routines compute the kernel weights for batches of
+     * markers at once so that these computations can be vectorized. They agree
+     * with the Fortran routines up to roundoff.
+     */
+    static bool s_use_specialized_interpolation;
+
+    /*!
+     * \brief Whether to cache the kernel weights computed for the IB_4, IB_6,
+     * and BSPLINE_3 kernels so that they can be reused by later interpolation
+     * and spreading operations that use the same marker positions (e.g., the
+     * multiple interpolation and spreading operations performed at the
+     * midpoint positions within a single time step).
+     *
+     * Weights are only cached while the owner of the marker positions has set
+     * an interaction plan handle (see setInteractionPlanHandle()), and cached
+     * weights are keyed on that handle and its version, the kernel, and the
+     * patch data index box. Before they are reused, the positions of the
+     * markers are compared to those used to compute the weights, and the
+     * weights of markers that have moved are recomputed. Enabling this option
+     * also makes spreading with these kernels (including threaded spreading)
+     * use the specialized C++ implementation instead of the Fortran routines.
+     *
+     * \see clearInteractionPlans()
+     */
+    static bool s_use_interaction_plans;
+
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * Recognized options:
+     * - <code>use_threaded_spreading</code> (bool, default FALSE)
+     * - <code>use_specialized_interpolation</code> (bool, default FALSE)
+     * - <code>use_interaction_plans</code> (bool, default FALSE)
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * \brief Get a new handle with which the owner of a set of marker positions
+     * identifies the interaction plans computed for those positions.
+     */
+    static int getNewInteractionPlanHandle();
+
+    /*!
+     * \brief Cache the interaction plans of subsequent interpolation and
+     * spreading operations under the specified handle and version until
+     * unsetInteractionPlanHandle() is called.
+     *
+     * The owner of the marker positions should change the version whenever
+     * the positions are reallocated or replaced; the plans cached for all other
+     * versions of the handle are freed.
+     */
+    static void setInteractionPlanHandle(int handle, unsigned int version);
+
+    /*!
+     * \brief Stop caching interaction plans.
+     */
+    static void unsetInteractionPlanHandle();
+
+    /*!
+     * \brief Free all cached interpolation and spreading weights.
+     *
+     * This is called whenever the Lagrangian data are redistributed.
+     */
+    static void clearInteractionPlans();
+
     /*!
      * \brief Output class configuration.
      */
@@ -1270,6 +1354,45 @@ private:
                        const std::string& spread_fcn,
                        int axis = 0);
 
+    /*!
+     * Threaded implementation of the IB spreading operation that processes
+     * spatially colored bins of markers concurrently.
+     */
+    static void spreadThreaded(double* q_data,
+                               const SAMRAI::hier::Box<NDIM>& q_data_box,
+                               const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                               int q_depth,
+                               const double* Q_data,
+                               int Q_depth,
+                               const double* X_data,
+                               const double* x_lower,
+                               const double* x_upper,
+                               const double* dx,
+                               const std::vector<int>& local_indices,
+                               const std::vector<double>& periodic_shifts,
+                               const std::string& spread_fcn,
+                               int axis);
+
+    /*!
+     * Dispatch the IB spreading operation for the specified markers to the
+     * kernel-specific implementation.
+     */
+    static void spreadKernel(double* q_data,
+                             const SAMRAI::hier::Box<NDIM>& q_data_box,
+                             const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                             int q_depth,
+                             const double* Q_data,
+                             int Q_depth,
+                             const double* X_data,
+                             const double* x_lower,
+                             const double* x_upper,
+                             const double* dx,
+                             const int* local_indices,
+                             const double* periodic_shifts,
+                             int num_local_indices,
+                             const std::string& spread_fcn,
+                             int axis);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the LNodeIndexSetData values.
@@ -29,8 +29,10 @@
 #include "petscvec.h"
 
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -57,6 +59,11 @@ namespace IBTK
  *
  * For more information about Silo, see the Silo manual <A
  * HREF="http://www.llnl.gov/bdiv/meshtv/manuals/silo.pdf">here</A>.
+ *
+ * By default, each MPI process writes its local data to its own file, and
+ * writePlotData() returns only after all of the files have been written.  The
+ * number of local files may be reduced via setNumberOfOutputFiles(), and the
+ * files may be written on a background thread via setUseAsynchronousOutput().
  */
 class LSiloDataWriter : public SAMRAI::tbox::Serializable
 {
@@ -183,6 +190,44 @@ public:
      */
     void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
 
+    /*!
+     * \brief Set whether the plot data are written to disk on a background
+     * thread.
+     *
+     * When enabled, writePlotData() copies the local plot data into a staging
+     * buffer and returns without waiting for the data to be written.  The
+     * Lagrangian data may be modified as soon as writePlotData() returns.
+     *
+     * \note The Silo library is not thread safe.  Other code that calls Silo
+     * while output may be pending must hold the lock returned by
+     * getSiloMutex().  Silo writers that do not use this lock (e.g., SAMRAI's
+     * VisItDataWriter) must not be called until waitForPendingOutput() has
+     * returned.
+     */
+    void setUseAsynchronousOutput(bool use_async_output);
+
+    /*!
+     * \brief Set the number of local files written for each time step.
+     *
+     * When the number of files is smaller than the number of MPI processes,
+     * consecutive groups of processes send their local data to the first
+     * process in the group, which writes it to a single file.  A value of zero
+     * (the default) indicates that each process writes its own file.
+     */
+    void setNumberOfOutputFiles(int num_output_files);
+
+    /*!
+     * \brief Wait until any plot data being written on a background thread
+     * have been written to disk.
+     */
+    void waitForPendingOutput();
+
+    /*!
+     * \brief Return the lock that serializes calls to the Silo library made by
+     * IBAMR, including those made on the background output thread.
+     */
+    static std::mutex& getSiloMutex();
+
     /*!
      * \brief Write the plot data to disk.
      */
@@ -321,6 +366,13 @@ private:
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
+
+    /*
+     * Output options and the thread used to write data asynchronously.
+     */
+    bool d_use_async_output = false;
+    int d_num_output_files = 0;
+    std::thread d_output_thread;
 };
 } // namespace IBTK
 
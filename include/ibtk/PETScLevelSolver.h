@@ -68,8 +68,18 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ reuse_matrix_structure = FALSE
  \endverbatim
  *
+ * When \p reuse_matrix_structure is true, the PETSc Mat, the DOF indices, and
+ * the ASM subdomains constructed by initializeSolverState() are retained when
+ * the solver state is deallocated.  If the solver is subsequently initialized
+ * on the same patch level, these are reused and only the matrix values are
+ * recomputed.  This is useful when the solver is reinitialized every time step
+ * to account for changes in the problem coefficients.  Subclasses indicate that
+ * they only need to recompute the matrix values through the flag
+ * d_reuse_level_data.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -293,6 +303,18 @@ protected:
      */
     SAMRAIDataCache d_cached_eulerian_data;
 
+    /*!
+     * \brief Whether the matrix structure and level data are retained between
+     * calls to initializeSolverState(), and whether they are being reused by
+     * the current call.
+     *
+     * When d_reuse_level_data is true, d_petsc_mat is the matrix constructed by
+     * the previous call on the same patch level, and the DOF index data on the
+     * level are still valid, so that subclasses only need to reset the matrix
+     * values.
+     */
+    bool d_reuse_mat_structure = false, d_reuse_level_data = false;
+
     /*!
      * \name PETSc objects.
      */
@@ -348,6 +370,12 @@ private:
      */
     PETScLevelSolver& operator=(const PETScLevelSolver& that) = delete;
 
+    /*!
+     * \brief Generate the PETSc IS'es for the ASM subdomains of the current
+     * patch level, replacing any generated for a previous patch level.
+     */
+    void generateSubdomainIS();
+
     /*!
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
@@ -362,6 +390,13 @@ private:
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
     static PetscErrorCode PCApply_RedBlackMultiplicative(PC pc, Vec x, Vec y);
+
+    /*!
+     * \brief The matrix and patch level retained by deallocateSolverState()
+     * for reuse by the next call to initializeSolverState().
+     */
+    Mat d_cached_petsc_mat = nullptr;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_cached_level;
 };
 } // namespace IBTK
 
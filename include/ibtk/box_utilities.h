@@ -21,7 +21,9 @@
 #include <ibtk/config.h>
 
 #include <Box.h>
+#include <Index.h>
 
+#include <array>
 #include <vector>
 
 namespace IBTK
@@ -33,6 +35,69 @@ namespace IBTK
  * their longest edges.
  */
 std::vector<SAMRAI::hier::Box<NDIM> > merge_boxes_by_longest_edge(const std::vector<SAMRAI::hier::Box<NDIM> >& boxes);
+
+/**
+ * Compute the strides of an array whose index space is @p data_box and in
+ * which the first index varies fastest (i.e., the layout of SAMRAI's
+ * ArrayData).
+ */
+inline void
+compute_strides(std::array<int, NDIM>& stride, const SAMRAI::hier::Box<NDIM>& data_box)
+{
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * data_box.numberCells(d - 1);
+    }
+    return;
+} // compute_strides
+
+/**
+ * Compute the offset of index @p i in an array whose lower corner is @p lower
+ * and whose strides are @p stride.
+ */
+inline int
+compute_offset(const SAMRAI::hier::Index<NDIM>& i,
+               const SAMRAI::hier::Index<NDIM>& lower,
+               const std::array<int, NDIM>& stride)
+{
+    int offset = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - lower(d)) * stride[d];
+    }
+    return offset;
+} // compute_offset
+
+/**
+ * Return the number of rows of @p box. Rows are numbered lexicographically
+ * over the directions 1, ..., NDIM-1, and each row contains the cells of the
+ * box along direction 0.
+ */
+inline int
+get_number_of_rows(const SAMRAI::hier::Box<NDIM>& box)
+{
+    int num_rows = 1;
+    for (unsigned int d = 1; d < NDIM; ++d) num_rows *= box.numberCells(d);
+    return num_rows;
+} // get_number_of_rows
+
+/**
+ * Return the index of the first cell of row @p row of @p box. See
+ * get_number_of_rows() for the numbering of the rows.
+ */
+inline SAMRAI::hier::Index<NDIM>
+get_row_start(const SAMRAI::hier::Box<NDIM>& box, int row)
+{
+    SAMRAI::hier::Index<NDIM> i = box.lower();
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        const int n = box.numberCells(d);
+        i(d) += row % n;
+        row /= n;
+    }
+    return i;
+} // get_row_start
 } // namespace IBTK
 
 #endif
@@ -44,6 +44,9 @@
 // Whether or not Silo is available
 /* #undef IBTK_HAVE_SILO */
 
+// Whether or not OpenMP is available
+/* #undef IBTK_HAVE_OPENMP */
+
 //
 // Utility macros
 //
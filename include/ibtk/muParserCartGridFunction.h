@@ -29,6 +29,7 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -57,6 +58,16 @@ namespace IBTK
  * class CartGridFunction that allows for the run-time specification of
  * (possibly spatially- and temporally-varying) functions which are used to set
  * double precision values on standard SAMRAI SAMRAI::hier::PatchData objects.
+ *
+ * Each function is evaluated at all of the data points of a patch in a single
+ * call to the bulk evaluation mode of mu::Parser, so that the expression is
+ * compiled to bytecode once per patch instead of being dispatched once per data
+ * point.
+ *
+ * \note isTimeDependent() always returns true: callers use it to decide whether
+ * to set data in contexts (e.g., scratch or new data) that are not otherwise
+ * initialized.  Whether the functions actually use the time variable is
+ * reported separately by usesTimeVariable().
  */
 class muParserCartGridFunction : public CartGridFunction
 {
@@ -84,6 +95,13 @@ public:
      */
     bool isTimeDependent() const override;
 
+    /*!
+     * \brief Indicates whether any of the functions use the time variable
+     * (<tt>t</tt> or <tt>T</tt>).  If not, the values set by this object do not
+     * change with the data time.
+     */
+    bool usesTimeVariable() const;
+
     /*!
      * \brief Virtual function to evaluate the function on the patch interior.
      */
@@ -126,6 +144,19 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that) = delete;
 
+    /*!
+     * \brief Ensure that the evaluation buffers can hold at least the specified
+     * number of points, and rebind the parser variables if the buffers are
+     * reallocated.
+     */
+    void resizeParserBuffers(int num_points);
+
+    /*!
+     * \brief Evaluate the specified function at the first num_points points of
+     * the evaluation buffers.
+     */
+    void evaluateParser(int function_depth, int num_points, double data_time);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -149,10 +180,17 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Whether any of the functions use the time variable.
+     */
+    bool d_uses_time_variable = true;
+
+    /*!
+     * Time and position variables and the function values, stored as arrays
+     * for bulk evaluation.
      */
-    double d_parser_time = 0.0;
-    Point d_parser_posn;
+    std::vector<double> d_parser_time;
+    std::array<std::vector<double>, NDIM> d_parser_posn;
+    std::vector<double> d_parser_vals;
 };
 } // namespace IBTK
 
@@ -65,4 +65,17 @@ if test "$HDF5_VERSION_VALID" = no; then
   AC_MSG_WARN([HDF5 versions prior to 1.8.7 are likely to be usable but are not officially supported])
 fi
 
+AC_MSG_CHECKING([whether HDF5 can write compressed datasets in parallel])
+AC_COMPILE_IFELSE([AC_LANG_PROGRAM([[
+#include <hdf5.h>
+]], [[
+#if defined(H5_HAVE_PARALLEL) && !H5_VERSION_GE(1,10,2)
+asdf
+#endif
+]])],[HDF5_PARALLEL_COMPRESSION_VALID=yes],[HDF5_PARALLEL_COMPRESSION_VALID=no])
+AC_MSG_RESULT([${HDF5_PARALLEL_COMPRESSION_VALID}])
+if test "$HDF5_PARALLEL_COMPRESSION_VALID" = no; then
+  AC_MSG_WARN([parallel HDF5 versions prior to 1.10.2 cannot write compressed datasets, so LHDF5DataWriter will write uncompressed data])
+fi
+
 ])
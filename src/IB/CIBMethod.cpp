@@ -1511,6 +1511,53 @@ CIBMethod::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBMethod::getMatrixFreeMobilityData(const std::string& /*mat_name*/,
+                                     const std::vector<unsigned>& prototype_struct_ids,
+                                     const bool initial_time,
+                                     std::vector<double>& X,
+                                     std::vector<double>& W,
+                                     std::string& kernel_fcn,
+                                     const int managing_rank)
+{
+    const int struct_ln = getStructuresLevelNumber();
+    const int rank = IBTK_MPI::getRank();
+    kernel_fcn = d_l_data_manager->getDefaultInterpKernelFunction();
+
+    unsigned num_nodes = 0;
+    for (const auto& prototype_struct_id : prototype_struct_ids)
+    {
+        num_nodes += getNumberOfNodes(prototype_struct_id);
+    }
+    const int size = num_nodes * NDIM;
+    if (rank == managing_rank)
+    {
+        X.resize(size);
+        W.resize(size);
+    }
+
+    // Get the position data
+    Vec X_vec;
+    if (initial_time)
+    {
+        X_vec = d_l_data_manager->getLData("X0_unshifted", struct_ln)->getVec();
+    }
+    else
+    {
+        std::vector<Pointer<LData> >* X_half_data;
+        bool* X_half_needs_ghost_fill;
+        getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+        X_vec = (*X_half_data)[struct_ln]->getVec();
+    }
+    copyVecToArray(X_vec, X.data(), prototype_struct_ids, /*depth*/ NDIM, managing_rank);
+
+    // Get the regularization weights
+    Vec W_vec = d_l_data_manager->getLData("regulator", struct_ln)->getVec();
+    copyVecToArray(W_vec, W.data(), prototype_struct_ids, /*depth*/ NDIM, managing_rank);
+
+    return;
+} // getMatrixFreeMobilityData
+
 void
 CIBMethod::constructGeometricMatrix(const std::string& /*mat_name*/,
                                     Mat& geometric_mat,
@@ -826,6 +826,20 @@ CIBStrategy::constructMobilityMatrix(const std::string& /*mat_name*/,
     return;
 } // constructMobilityMatrix
 
+void
+CIBStrategy::getMatrixFreeMobilityData(const std::string& /*mat_name*/,
+                                       const std::vector<unsigned>& /*prototype_struct_ids*/,
+                                       const bool /*initial_time*/,
+                                       std::vector<double>& /*X*/,
+                                       std::vector<double>& /*W*/,
+                                       std::string& /*kernel_fcn*/,
+                                       const int /*managing_rank*/)
+{
+    // intentionally left blank.
+
+    return;
+} // getMatrixFreeMobilityData
+
 void
 CIBStrategy::constructGeometricMatrix(const std::string& /*mat_name*/,
                                       Mat& /*geometric_mat*/,
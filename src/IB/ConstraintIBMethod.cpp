@@ -193,6 +193,37 @@ solveSystemOfEqns(std::vector<double>& ang_mom, const Eigen::Matrix3d& inertiaTe
     return;
 }
 #endif
+
+// Collects the per-structure quantities that are summed over all processes so
+// that all of them are reduced by a single call to IBTK_MPI::sumReduction().
+// The quantities must be added in the same order on all processes.
+class PackedSumReduction
+{
+public:
+    void add(double* const data, const int size)
+    {
+        d_entries.emplace_back(data, size);
+        return;
+    }
+
+    void sumReduction()
+    {
+        std::vector<double> buffer;
+        for (const auto& entry : d_entries) buffer.insert(buffer.end(), entry.first, entry.first + entry.second);
+        if (!buffer.empty()) IBTK_MPI::sumReduction(buffer.data(), static_cast<int>(buffer.size()));
+        auto buffer_it = buffer.cbegin();
+        for (const auto& entry : d_entries)
+        {
+            std::copy(buffer_it, buffer_it + entry.second, entry.first);
+            buffer_it += entry.second;
+        }
+        d_entries.clear();
+        return;
+    }
+
+private:
+    std::vector<std::pair<double*, int> > d_entries;
+};
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -446,8 +477,7 @@ ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, double n
     IBTK_TIMER_STOP(t_calculateKinematicsVelocity);
 
     IBTK_TIMER_START(t_calculateRigidMomentum);
-    calculateRigidTranslationalMomentum();
-    calculateRigidRotationalMomentum();
+    calculateRigidMomentum();
     IBTK_TIMER_STOP(t_calculateRigidMomentum);
 
     IBTK_TIMER_START(t_correctVelocityOnLagrangianMesh);
@@ -988,16 +1018,24 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    // Sum the centers of mass and the tagged point positions of all structures
+    // in a single reduction.
+    PackedSumReduction com_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        com_reduction.add(d_center_of_mass_unshifted_current[struct_no].data(),
+                          static_cast<int>(d_center_of_mass_unshifted_current[struct_no].size()));
+        com_reduction.add(d_center_of_mass_unshifted_new[struct_no].data(),
+                          static_cast<int>(d_center_of_mass_unshifted_new[struct_no].size()));
+        com_reduction.add(tagged_position[struct_no].data(), 3);
+    }
+    com_reduction.sumReduction();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        IBTK_MPI::sumReduction(d_center_of_mass_unshifted_current[struct_no].data(),
-                               d_center_of_mass_unshifted_current[struct_no].size());
-        IBTK_MPI::sumReduction(d_center_of_mass_unshifted_new[struct_no].data(),
-                               d_center_of_mass_unshifted_new[struct_no].size());
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_unshifted_current[struct_no][i] /= total_nodes;
@@ -1038,7 +1076,6 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1153,15 +1190,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    PackedSumReduction moi_reduction;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_reduction.add(&d_moment_of_inertia_current[struct_no](0, 0), 9);
+            moi_reduction.add(&d_moment_of_inertia_new[struct_no](0, 0), 9);
         }
     }
+    moi_reduction.sumReduction();
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1210,13 +1249,10 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 void
 ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1227,77 +1263,39 @@ ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
 
+    calculateMomentumOfKinematicsVelocity();
+
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    tbox::Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
 
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
+    // Compute the local contributions to the linear and angular momentum of
+    // the kinematics velocity of all self-translating structures, and then sum
+    // all of them in a single reduction.
+    PackedSumReduction mom_reduction;
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
     {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
+        Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
+        const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
 
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+        const int coarsest_ln = struct_param.getCoarsestLevelNumber();
+        const int finest_ln = struct_param.getFinestLevelNumber();
+        const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
+        const bool is_self_rotating = struct_param.getStructureIsSelfRotating();
 
-        for (const auto& node_idx : local_nodes)
-        {
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
-        }
-        for (int d = 0; d < NDIM; ++d)
+        // Zero out linear and angular momentum of kinematics velocity of the structure.
+        for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
+        if (is_self_rotating)
         {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
         }
-    }
-    IBTK_MPI::sumReduction(d_vel_com_def_new[position_handle].data(), d_vel_com_def_new[position_handle].size());
-
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
-
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
 
         for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
              ++ln, ++itr)
@@ -1308,43 +1306,54 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
 
             std::pair<int, int> lag_idx_range = range[itr];
             const int offset = lag_idx_range.first;
+            double U_com_def[NDIM] = { 0.0 };
             double R_cross_U_def[3] = { 0.0 };
 
             // Get LData corresponding to the present position of the structures.
             Pointer<LData> ptr_x_lag_data;
-            if (IBTK::abs_equal_eps(d_FuRMoRP_current_time, 0.0))
+            if (is_self_rotating)
             {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
-            {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+                if (IBTK::abs_equal_eps(d_FuRMoRP_current_time, 0.0))
+                {
+                    ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
+                }
+                else
+                {
+                    ptr_x_lag_data = d_l_data_X_half_Euler[ln];
+                }
             }
+            const boost::multi_array_ref<double, 2>* const X_data =
+                is_self_rotating ? ptr_x_lag_data->getLocalFormVecArray() : nullptr;
 
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
             const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
             const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
             const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            const std::vector<double>& X_com = d_center_of_mass_unshifted_new[position_handle];
 
             for (const auto& node_idx : local_nodes)
             {
                 const int lag_idx = node_idx->getLagrangianIndex();
                 if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
                 {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        U_com_def[d] += def_vel[d][lag_idx - offset];
+                    }
+                    if (!is_self_rotating) continue;
+
                     const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
+                    const double* const X = &(*X_data)[local_idx][0];
                     const IBTK::Vector& displacement = node_idx->getPeriodicDisplacement();
 #if (NDIM == 2)
-                    double x = displacement[0] + X[0] - d_center_of_mass_unshifted_new[position_handle][0];
-                    double y = displacement[1] + X[1] - d_center_of_mass_unshifted_new[position_handle][1];
+                    double x = displacement[0] + X[0] - X_com[0];
+                    double y = displacement[1] + X[1] - X_com[1];
                     R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
-
 #endif
 
 #if (NDIM == 3)
-                    double x = displacement[0] + X[0] - d_center_of_mass_unshifted_new[position_handle][0];
-                    double y = displacement[1] + X[1] - d_center_of_mass_unshifted_new[position_handle][1];
-                    double z = displacement[2] + X[2] - d_center_of_mass_unshifted_new[position_handle][2];
+                    double x = displacement[0] + X[0] - X_com[0];
+                    double y = displacement[1] + X[1] - X_com[1];
+                    double z = displacement[2] + X[2] - X_com[2];
 
                     R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
@@ -1354,13 +1363,43 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
 #endif
                 }
             }
-            for (int d = 0; d < 3; ++d)
+            for (int d = 0; d < NDIM; ++d)
+            {
+                d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            }
+            if (is_self_rotating)
             {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
+                for (int d = 0; d < 3; ++d)
+                {
+                    d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
+                }
+                ptr_x_lag_data->restoreArrays();
             }
-            ptr_x_lag_data->restoreArrays();
         } // all levels
-        IBTK_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+
+        mom_reduction.add(d_vel_com_def_new[position_handle].data(),
+                          static_cast<int>(d_vel_com_def_new[position_handle].size()));
+        if (is_self_rotating) mom_reduction.add(&d_omega_com_def_new[position_handle][0], 3);
+    } // all structs
+    mom_reduction.sumReduction();
+
+    for (int position_handle = 0; position_handle < d_no_structures; ++position_handle)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[position_handle]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+
+        // Find linear velocity of deformational velocity.
+        tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[position_handle][d] /= total_nodes;
+            else
+                d_vel_com_def_new[position_handle][d] = 0.0;
+        }
+
+        if (!struct_param.getStructureIsSelfRotating()) continue;
 
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
@@ -1368,11 +1407,12 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
 #endif
 
 #if (NDIM == 3)
+        tbox::Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
         solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
         for (int d = 0; d < 3; ++d)
             if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
 #endif
-    } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1525,110 +1565,23 @@ ConstraintIBMethod::calculateVolumeElement()
 } // calculateVolumeElement
 
 void
-ConstraintIBMethod::calculateRigidTranslationalMomentum()
+ConstraintIBMethod::calculateRigidMomentum()
 {
     // Zero out new rigid momentum.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        for (int d = 0; d < 3; ++d) d_rigid_trans_vel_new[struct_no][d] = 0.0;
-    }
-
-    using StructureParameters = ConstraintIBKinematics::StructureParameters;
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-
-    // Calculate rigid translational velocity.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        // Get LData corresponding to the present position of the structures.
-        const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfTranslating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double U_rigid[NDIM] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_rigid[d] += U[d];
-                    }
-                }
-            }
-            for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
-        } // all structs
-        d_l_data_U_interp[ln]->restoreArrays();
-    } // all levels
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfTranslating())
-        {
-            IBTK_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
-            tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-            for (int d = 0; d < NDIM; ++d)
-            {
-                if (calculate_trans_mom[d])
-                    d_rigid_trans_vel_new[struct_no][d] /= struct_param.getTotalNodes();
-                else
-                    d_rigid_trans_vel_new[struct_no][d] = 0.0;
-            }
-        }
-    }
-
-    if (!IBTK_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
-    {
-        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        for (int d = 0; d < 3; ++d)
         {
-            *d_trans_vel_stream[struct_no]
-                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
-                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
-                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
-                << d_vel_com_def_new[struct_no][2] << std::endl;
+            d_rigid_trans_vel_new[struct_no][d] = 0.0;
+            d_rigid_rot_vel_new[struct_no][d] = 0.0;
         }
     }
 
-    return;
-
-} // calculateRigidTranslationalMomentum
-
-void
-ConstraintIBMethod::calculateRigidRotationalMomentum()
-{
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = 0.0;
-    }
-
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Calculate rigid rotational velocity.
+    // Calculate rigid translational and rotational velocity.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -1650,11 +1603,15 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
             Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
                 *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
+            const bool is_self_translating = struct_param.getStructureIsSelfTranslating();
+            const bool is_self_rotating = struct_param.getStructureIsSelfRotating();
+            if (!is_self_translating && !is_self_rotating) continue;
 
             const int location_struct_handle =
                 find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const std::vector<double>& X_com = d_center_of_mass_unshifted_new[location_struct_handle];
 
+            double U_rigid[NDIM] = { 0.0 };
             double Omega_rigid[3] = { 0.0 };
             for (const auto& node_idx : local_nodes)
             {
@@ -1662,37 +1619,74 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
                 if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
                 {
                     const int local_idx = node_idx->getLocalPETScIndex();
-                    const IBTK::Vector& displacement = node_idx->getPeriodicDisplacement();
                     const double* const U = &U_interp_data[local_idx][0];
+                    if (is_self_translating)
+                    {
+                        for (int d = 0; d < NDIM; ++d)
+                        {
+                            U_rigid[d] += U[d];
+                        }
+                    }
+                    if (!is_self_rotating) continue;
+
+                    const IBTK::Vector& displacement = node_idx->getPeriodicDisplacement();
                     const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    const double x = displacement[0] + X[0] - d_center_of_mass_unshifted_new[location_struct_handle][0];
-                    const double y = displacement[1] + X[1] - d_center_of_mass_unshifted_new[location_struct_handle][1];
+                    const double x = displacement[0] + X[0] - X_com[0];
+                    const double y = displacement[1] + X[1] - X_com[1];
                     Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
 
 #if (NDIM == 3)
-                    const double x = displacement[0] + X[0] - d_center_of_mass_unshifted_new[location_struct_handle][0];
-                    const double y = displacement[1] + X[1] - d_center_of_mass_unshifted_new[location_struct_handle][1];
-                    const double z = displacement[2] + X[2] - d_center_of_mass_unshifted_new[location_struct_handle][2];
+                    const double x = displacement[0] + X[0] - X_com[0];
+                    const double y = displacement[1] + X[1] - X_com[1];
+                    const double z = displacement[2] + X[2] - X_com[2];
                     Omega_rigid[0] += y * U[2] - z * U[1];
                     Omega_rigid[1] += -x * U[2] + z * U[0];
                     Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
                 }
             }
+            for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
             for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[location_struct_handle][d] += Omega_rigid[d];
         } // all structs
         d_l_data_U_interp[ln]->restoreArrays();
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    // Sum the rigid momentum of all structures in a single reduction.
+    PackedSumReduction rigid_mom_reduction;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            rigid_mom_reduction.add(d_rigid_trans_vel_new[struct_no].data(),
+                                    static_cast<int>(d_rigid_trans_vel_new[struct_no].size()));
+        }
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            rigid_mom_reduction.add(&d_rigid_rot_vel_new[struct_no][0], 3);
+        }
+    }
+    rigid_mom_reduction.sumReduction();
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
+            tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+            for (int d = 0; d < NDIM; ++d)
+            {
+                if (calculate_trans_mom[d])
+                    d_rigid_trans_vel_new[struct_no][d] /= struct_param.getTotalNodes();
+                else
+                    d_rigid_trans_vel_new[struct_no][d] = 0.0;
+            }
+        }
         if (struct_param.getStructureIsSelfRotating())
         {
-            IBTK_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1708,6 +1702,18 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         }
     }
 
+    if (!IBTK_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
+    {
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            *d_trans_vel_stream[struct_no]
+                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
+                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
+                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
+                << d_vel_com_def_new[struct_no][2] << std::endl;
+        }
+    }
+
     if (!IBTK_MPI::getRank() && d_print_output && d_output_rot_vel && (d_timestep_counter % d_output_interval) == 0)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1722,8 +1728,7 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
     }
 
     return;
-
-} // calculateRigidRotationalMomentum
+} // calculateRigidMomentum
 
 void
 ConstraintIBMethod::calculateCurrentLagrangianVelocity()
@@ -2535,10 +2540,15 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    PackedSumReduction force_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        force_reduction.add(&inertia_force[struct_no][0], 3);
+        force_reduction.add(&constraint_force[struct_no][0], 3);
+    }
+    force_reduction.sumReduction();
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        IBTK_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2646,10 +2656,15 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    PackedSumReduction torque_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        torque_reduction.add(&inertia_torque[struct_no][0], 3);
+        torque_reduction.add(&constraint_torque[struct_no][0], 3);
+    }
+    torque_reduction.sumReduction();
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        IBTK_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2728,10 +2743,15 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    PackedSumReduction power_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        power_reduction.add(&inertia_power[struct_no][0], 3);
+        power_reduction.add(&constraint_power[struct_no][0], 3);
+    }
+    power_reduction.sumReduction();
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        IBTK_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2798,9 +2818,14 @@ ConstraintIBMethod::calculateStructureMomentum()
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    PackedSumReduction mom_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        mom_reduction.add(&d_structure_mom[struct_no][0], 3);
+    }
+    mom_reduction.sumReduction();
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -2878,9 +2903,14 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    PackedSumReduction mom_reduction;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        mom_reduction.add(&d_structure_rotational_mom[struct_no][0], 3);
+    }
+    mom_reduction.sumReduction();
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -0,0 +1,184 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/DenseFactorizationPreconditioner.h"
+#include "ibamr/ibamr_enums.h"
+
+#include "tbox/Utilities.h"
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+DenseFactorizationPreconditioner::DenseFactorizationPreconditioner(const MobilityMatrixInverseType inv_type)
+    : d_inv_type(inv_type)
+{
+    if (d_inv_type != LAPACK_CHOLESKY && d_inv_type != LAPACK_LU)
+    {
+        TBOX_ERROR("DenseFactorizationPreconditioner::DenseFactorizationPreconditioner(): "
+                   << "only LAPACK_CHOLESKY and LAPACK_LU factorizations are supported." << std::endl);
+    }
+    return;
+} // DenseFactorizationPreconditioner
+
+void
+DenseFactorizationPreconditioner::factorize(const double* const mat_data, const int mat_size)
+{
+    d_mat_size = mat_size;
+    Eigen::Map<const MatrixType> mat_view(mat_data, mat_size, mat_size);
+    if (d_inv_type == LAPACK_CHOLESKY)
+    {
+        d_cholesky_factorization.compute(mat_view);
+        if (d_cholesky_factorization.info() != Eigen::Success)
+        {
+            TBOX_ERROR("DenseFactorizationPreconditioner::factorize(): "
+                       << "the matrix is not positive definite." << std::endl);
+        }
+    }
+    else
+    {
+        d_lu_factorization.compute(mat_view);
+    }
+    return;
+} // factorize
+
+bool
+DenseFactorizationPreconditioner::isFactorized() const
+{
+    return d_mat_size > 0;
+} // isFactorized
+
+void
+DenseFactorizationPreconditioner::applyInverse(double* const rhs) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(isFactorized());
+#endif
+    Eigen::Map<Eigen::VectorXd> rhs_view(rhs, d_mat_size);
+    if (d_inv_type == LAPACK_CHOLESKY)
+    {
+        d_cholesky_factorization.solveInPlace(rhs_view);
+    }
+    else
+    {
+        rhs_view = d_lu_factorization.solve(rhs_view);
+    }
+    return;
+} // applyInverse
+
+bool
+DenseFactorizationPreconditioner::solve(const double* const mat_data,
+                                        double* const rhs,
+                                        const double rel_tol,
+                                        const int max_iterations)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(isFactorized());
+#endif
+    using VectorType = Eigen::VectorXd;
+    Eigen::Map<const MatrixType> mat_view(mat_data, d_mat_size, d_mat_size);
+    Eigen::Map<VectorType> rhs_view(rhs, d_mat_size);
+
+    // Apply the current matrix. As in the factorization, only the lower
+    // triangle is used for the Cholesky factorization.
+    const auto apply_matrix = [&](const VectorType& in, VectorType& out)
+    {
+        if (d_inv_type == LAPACK_LU)
+        {
+            out.noalias() = mat_view * in;
+        }
+        else
+        {
+            out.noalias() = mat_view.selfadjointView<Eigen::Lower>() * in;
+        }
+    };
+    const auto apply_preconditioner = [&](const VectorType& in, VectorType& out)
+    {
+        out = in;
+        applyInverse(out.data());
+    };
+
+    VectorType x = VectorType::Zero(d_mat_size);
+    VectorType r = rhs_view;
+    VectorType z(d_mat_size), Ar(d_mat_size);
+    const double rhs_norm = r.norm();
+    bool converged = rhs_norm == 0.0;
+    int it = 0;
+    if (!converged) apply_preconditioner(r, z);
+    if (d_inv_type == LAPACK_LU)
+    {
+        while (!converged && it < max_iterations)
+        {
+            x += z;
+            apply_matrix(x, Ar);
+            r = rhs_view - Ar;
+            converged = r.norm() <= rel_tol * rhs_norm;
+            ++it;
+            if (!converged) apply_preconditioner(r, z);
+        }
+    }
+    else
+    {
+        VectorType p = z;
+        double r_dot_z = r.dot(z);
+        while (!converged && it < max_iterations)
+        {
+            apply_matrix(p, Ar);
+            const double p_dot_Ar = p.dot(Ar);
+            if (p_dot_Ar <= 0.0) break;
+            const double alpha = r_dot_z / p_dot_Ar;
+            x += alpha * p;
+            r -= alpha * Ar;
+            converged = r.norm() <= rel_tol * rhs_norm;
+            ++it;
+            if (converged) break;
+            apply_preconditioner(r, z);
+            const double r_dot_z_new = r.dot(z);
+            p = z + (r_dot_z_new / r_dot_z) * p;
+            r_dot_z = r_dot_z_new;
+        }
+    }
+    d_num_iterations = it;
+    d_rel_residual_norm = rhs_norm == 0.0 ? 0.0 : r.norm() / rhs_norm;
+
+    if (converged) rhs_view = x;
+    return converged;
+} // solve
+
+int
+DenseFactorizationPreconditioner::getNumberOfIterations() const
+{
+    return d_num_iterations;
+} // getNumberOfIterations
+
+double
+DenseFactorizationPreconditioner::getRelativeResidualNorm() const
+{
+    return d_rel_residual_norm;
+} // getRelativeResidualNorm
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
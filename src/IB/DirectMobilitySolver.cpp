@@ -14,7 +14,9 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/CIBStrategy.h"
+#include "ibamr/DenseFactorizationPreconditioner.h"
 #include "ibamr/DirectMobilitySolver.h"
+#include "ibamr/MobilityFunctions.h"
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
@@ -151,6 +153,23 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     TBOX_ASSERT(inv_type.first != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
     TBOX_ASSERT(inv_type.second != UNKNOWN_MOBILITY_MATRIX_INVERSE_TYPE);
 #endif
+    if (inv_type.first == MATRIX_FREE_CG && mat_type != RPY)
+    {
+        TBOX_ERROR("DirectMobilitySolver::registerMobilityMat(): MATRIX_FREE_CG "
+                   << "inversion is supported only for RPY mobility matrices." << std::endl);
+    }
+    if (inv_type.second == MATRIX_FREE_CG)
+    {
+        TBOX_ERROR("DirectMobilitySolver::registerMobilityMat(): MATRIX_FREE_CG "
+                   << "inversion is not supported for body mobility matrices." << std::endl);
+    }
+    if (d_reuse_factorization && inv_type.first == LAPACK_SVD)
+    {
+        // The SVD inverse is a regularized pseudo-inverse, which is not a
+        // consistent preconditioner for the mobility matrix itself.
+        TBOX_ERROR("DirectMobilitySolver::registerMobilityMat(): reuse_factorization "
+                   << "is supported only for LAPACK_CHOLESKY and LAPACK_LU mobility matrix inverses." << std::endl);
+    }
 
     unsigned int num_nodes = 0;
     for (const auto& prototype_struct_id : prototype_struct_ids)
@@ -180,12 +199,16 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
 
     if (rank == managing_proc)
     {
-        d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
-        MatCreateSeqDense(PETSC_COMM_SELF,
-                          mobility_mat_size,
-                          mobility_mat_size,
-                          d_mat_map[mat_name].first.data(),
-                          &d_petsc_mat_map[mat_name].first);
+        // The matrix-free mobility matrix is never formed.
+        if (d_mat_inv_type_map[mat_name].first != MATRIX_FREE_CG)
+        {
+            d_mat_map[mat_name].first.resize(mobility_mat_size * mobility_mat_size);
+            MatCreateSeqDense(PETSC_COMM_SELF,
+                              mobility_mat_size,
+                              mobility_mat_size,
+                              d_mat_map[mat_name].first.data(),
+                              &d_petsc_mat_map[mat_name].first);
+        }
 
         d_mat_map[mat_name].second.resize(body_mobility_mat_size * body_mobility_mat_size);
         MatCreateSeqDense(PETSC_COMM_SELF,
@@ -280,8 +303,6 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
     for (const auto& petsc_mat_pair : d_petsc_mat_map)
     {
         const std::string& mat_name = petsc_mat_pair.first;
-        Mat& mat = d_petsc_mat_map[mat_name].first;
-        const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
         const std::vector<std::vector<unsigned> >& struct_ids = d_mat_actual_id_map[mat_name];
         const int managing_proc = d_mat_proc_map[mat_name];
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
@@ -300,7 +321,7 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
+            if (rank == managing_proc) solveMobilitySystem(mat_name, rhs.data());
             if (!d_recompute_mob_mat)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
@@ -419,7 +440,18 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
             const int managing_proc = d_mat_proc_map[mat_name];
 
-            if (mat_type == READ_FROM_FILE && !read_files[file_counter])
+            if (d_mat_inv_type_map[mat_name].first == MATRIX_FREE_CG)
+            {
+                d_mat_free_dx = dx[0];
+                d_cib_strategy->getMatrixFreeMobilityData(mat_name,
+                                                          struct_ids,
+                                                          initial_time,
+                                                          d_mat_free_X_map[mat_name],
+                                                          d_mat_free_W_map[mat_name],
+                                                          d_mat_free_kernel_map[mat_name],
+                                                          managing_proc);
+            }
+            else if (mat_type == READ_FROM_FILE && !read_files[file_counter])
             {
                 // Get the matrix from file.
                 const std::string& filename = d_mat_filename_map[mat_name];
@@ -507,9 +539,28 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
         d_svd_eps = comp_db->getDouble("min_eigenvalue_threshold");
     }
 
+    comp_db =
+        input_db->isDatabase("MATRIX_FREE_CG") ? input_db->getDatabase("MATRIX_FREE_CG") : Pointer<Database>(nullptr);
+    if (comp_db)
+    {
+        d_cg_rel_tol = comp_db->getDoubleWithDefault("rel_residual_tol", d_cg_rel_tol);
+        d_cg_max_iterations = comp_db->getIntegerWithDefault("max_iterations", d_cg_max_iterations);
+    }
+
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_reuse_factorization = input_db->getBoolWithDefault("reuse_factorization", d_reuse_factorization);
+    d_reuse_rel_tol = input_db->getDoubleWithDefault("reuse_factorization_rel_tol", d_reuse_rel_tol);
+    d_reuse_max_iterations =
+        input_db->getIntegerWithDefault("reuse_factorization_max_iterations", d_reuse_max_iterations);
+    if (d_reuse_factorization && !d_recompute_mob_mat)
+    {
+        TBOX_WARNING(d_object_name << "::getFromInput():\n"
+                                   << "  reuse_factorization has no effect unless recompute_mob_mat_perstep = TRUE"
+                                   << std::endl);
+        d_reuse_factorization = false;
+    }
 
     return;
 } // getFromInput
@@ -525,6 +576,16 @@ DirectMobilitySolver::factorizeMobilityMatrix()
 
         Mat& mat = d_petsc_mat_map[mat_name].first;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+        if (inv_type == MATRIX_FREE_CG) continue;
+
+        // When reusing factorizations, the matrix is kept unfactorized and a
+        // factorization is only computed the first time.
+        if (d_reuse_factorization)
+        {
+            if (!d_mob_factorization_map.count(mat_name)) refactorizeMobilityMatrix(mat_name);
+            continue;
+        }
+
         const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
@@ -546,9 +607,7 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
 
         const int row_size = d_mat_nodes_map[mat_name] * NDIM;
         const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
-        const MobilityMatrixInverseType& mobility_inv_type = d_mat_inv_type_map[mat_name].first;
 
-        Mat& mobility_mat = d_petsc_mat_map[mat_name].first;
         Mat& body_mob_mat = d_petsc_mat_map[mat_name].second;
         Mat& geometric_mat = d_petsc_geometric_mat_map[mat_name];
 
@@ -563,8 +622,7 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         {
             double* col_data;
             MatDenseGetArray(product_mat, &col_data);
-            computeSolution(
-                mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), &col_data[col * row_size]);
+            solveMobilitySystem(mat_name, &col_data[col * row_size]);
             MatDenseRestoreArray(product_mat, &col_data);
         }
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
@@ -747,6 +805,132 @@ DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType&
     return;
 } // computeSolution
 
+void
+DirectMobilitySolver::solveMobilitySystem(const std::string& mat_name, double* rhs)
+{
+    const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
+    if (inv_type == MATRIX_FREE_CG)
+    {
+        computeMatrixFreeSolution(mat_name, rhs);
+    }
+    else if (d_reuse_factorization)
+    {
+        computeReusedFactorizationSolution(mat_name, rhs);
+    }
+    else
+    {
+        computeSolution(d_petsc_mat_map[mat_name].first, inv_type, d_ipiv_map[mat_name].first.data(), rhs);
+    }
+    return;
+} // solveMobilitySystem
+
+void
+DirectMobilitySolver::computeReusedFactorizationSolution(const std::string& mat_name, double* rhs)
+{
+    Mat& mat = d_petsc_mat_map[mat_name].first;
+    DenseFactorizationPreconditioner& factorization = d_mob_factorization_map.at(mat_name);
+    double* mat_data = nullptr;
+    MatDenseGetArray(mat, &mat_data);
+    const bool converged = factorization.solve(mat_data, rhs, d_reuse_rel_tol, d_reuse_max_iterations);
+    MatDenseRestoreArray(mat, &mat_data);
+    if (converged) return;
+
+    // The configuration has changed too much for the stored factorization to
+    // be an effective preconditioner, so factorize the current matrix.
+    plog << "DirectMobilitySolver::computeReusedFactorizationSolution(): For matrix with handle " << mat_name
+         << " the iterations did not converge in " << factorization.getNumberOfIterations()
+         << " iterations. Relative residual norm = " << factorization.getRelativeResidualNorm()
+         << ". Refactorizing the mobility matrix." << std::endl;
+    refactorizeMobilityMatrix(mat_name);
+    factorization.applyInverse(rhs);
+
+    return;
+} // computeReusedFactorizationSolution
+
+void
+DirectMobilitySolver::refactorizeMobilityMatrix(const std::string& mat_name)
+{
+    Mat& mat = d_petsc_mat_map[mat_name].first;
+    const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+    auto it = d_mob_factorization_map.find(mat_name);
+    if (it == d_mob_factorization_map.end())
+    {
+        const DenseFactorizationPreconditioner factorization(d_mat_inv_type_map[mat_name].first);
+        it = d_mob_factorization_map.emplace(mat_name, factorization).first;
+    }
+
+    // The matrix itself is not modified, so it remains available to the
+    // iterations.
+    double* mat_data = nullptr;
+    MatDenseGetArray(mat, &mat_data);
+    it->second.factorize(mat_data, mat_size);
+    MatDenseRestoreArray(mat, &mat_data);
+
+    return;
+} // refactorizeMobilityMatrix
+
+void
+DirectMobilitySolver::computeMatrixFreeSolution(const std::string& mat_name, double* rhs)
+{
+    const int num_nodes = d_mat_nodes_map[mat_name];
+    const int mat_size = num_nodes * NDIM;
+    const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
+    const std::vector<double>& X = d_mat_free_X_map[mat_name];
+    const std::vector<double>& W = d_mat_free_W_map[mat_name];
+    const char* ib_kernel = d_mat_free_kernel_map[mat_name].c_str();
+
+    using VectorType = Eigen::Matrix<double, Eigen::Dynamic, 1>;
+    Eigen::Map<VectorType> rhs_view(rhs, mat_size);
+    Eigen::Map<const VectorType> W_view(W.data(), mat_size);
+
+    // Apply the regularized mobility operator alpha*M + beta*diag(W).
+    auto apply_mobility = [&](const VectorType& in, VectorType& out) {
+        MobilityFunctions::applyRPYMobility(
+            ib_kernel, d_mu, d_mat_free_dx, X.data(), num_nodes, d_f_periodic_corr, in.data(), out.data());
+        out = scale.first * out + scale.second * W_view.cwiseProduct(in);
+    };
+
+    // Solve the symmetric positive definite system with the conjugate
+    // gradient method, starting from a zero initial guess.
+    VectorType x = VectorType::Zero(mat_size);
+    VectorType r = rhs_view;
+    VectorType p = r;
+    VectorType Ap(mat_size);
+    const double rhs_norm = r.norm();
+    double r_dot_r = r.squaredNorm();
+    int it = 0;
+    bool converged = rhs_norm == 0.0;
+    for (; it < d_cg_max_iterations && !converged; ++it)
+    {
+        apply_mobility(p, Ap);
+        const double p_dot_Ap = p.dot(Ap);
+        if (p_dot_Ap <= 0.0)
+        {
+            TBOX_ERROR(d_object_name << "::computeMatrixFreeSolution(): For matrix with handle " << mat_name
+                                     << " the regularized mobility operator is not positive definite.\n"
+                                     << "CG broke down after " << it << " iterations." << std::endl);
+        }
+        const double alpha = r_dot_r / p_dot_Ap;
+        x += alpha * p;
+        r -= alpha * Ap;
+        const double r_dot_r_new = r.squaredNorm();
+        converged = std::sqrt(r_dot_r_new) <= d_cg_rel_tol * rhs_norm;
+        p = r + (r_dot_r_new / r_dot_r) * p;
+        r_dot_r = r_dot_r_new;
+    }
+
+    if (!converged)
+    {
+        TBOX_ERROR(d_object_name << "::computeMatrixFreeSolution(): For matrix with handle " << mat_name
+                                 << " CG did not converge in " << it << " iterations.\n"
+                                 << "Relative residual norm = " << std::sqrt(r_dot_r) / rhs_norm
+                                 << ". Increase MATRIX_FREE_CG::max_iterations or rel_residual_tol." << std::endl);
+    }
+    rhs_view = x;
+
+    return;
+} // computeMatrixFreeSolution
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -69,6 +69,12 @@
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
 
+#if defined(IBTK_HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+#include <array>
+#include <memory>
 #include <utility>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
@@ -883,8 +889,6 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     double* F_rhs_local_soln = nullptr;
     ierr = VecGetArray(F_rhs_vec_local, &F_rhs_local_soln);
     IBTK_CHKERRQ(ierr);
-    std::array<DenseVector<double>, NDIM> F_rhs_e;
-    std::vector<libMesh::dof_id_type> dof_id_scratch;
 
     // For efficiency, combine loops over PK1 functions corresponding to the
     // same quadrature rules and systems.
@@ -909,7 +913,7 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<PK1StressFcnData> current_pk1(remaining_pk1.begin(), next_group_start);
         remaining_pk1.erase(remaining_pk1.begin(), next_group_start);
 
-        // Extract the FE systems and DOF maps, and setup the FE object.
+        // Extract the FE systems and DOF maps.
         const DofMap& F_dof_map = F_system.get_dof_map();
         FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(FORCE_SYSTEM_NAME);
         FEType F_fe_type = F_dof_map.variable_type(0);
@@ -921,39 +925,46 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<int> vars(NDIM);
         for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
 
-        FEDataInterpolation fe(dim, d_fe_data[part]);
-        std::unique_ptr<QBase> qrule = QBase::build(exemplar_pk1.quad_type, dim, exemplar_pk1.quad_order);
-        qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-        std::unique_ptr<QBase> qrule_face = QBase::build(exemplar_pk1.quad_type, dim - 1, exemplar_pk1.quad_order);
-        qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-        fe.attachQuadratureRule(qrule.get());
-        fe.attachQuadratureRuleFace(qrule_face.get());
-        fe.evalNormalsFace();
-        fe.evalQuadraturePoints();
-        fe.evalQuadraturePointsFace();
-        fe.evalQuadratureWeights();
-        fe.evalQuadratureWeightsFace();
-        fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
-        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-        std::vector<size_t> PK1_fcn_system_idxs;
-        fe.setupInterpolatedSystemDataIndexes(PK1_fcn_system_idxs, exemplar_pk1.system_data, &equation_systems);
-        fe.init();
-
-        const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-        const std::vector<double>& JxW = fe.getQuadratureWeights();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
-
-        const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-        const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-        const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-        const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
-
-        const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-        const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-            fe.getGradVarInterpolation();
-
-        std::vector<const std::vector<double>*> PK1_var_data;
-        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+        // Setup the FE objects.  When using threaded assembly, each thread uses
+        // its own FE objects (and thus its own shape function and mapping data)
+        // and accumulates its contributions into a private copy of the local
+        // right-hand-side vector.
+        int n_threads = 1;
+#if defined(IBTK_HAVE_OPENMP)
+        if (d_use_threaded_force_assembly) n_threads = omp_get_max_threads();
+#endif
+        struct AssemblyThreadData
+        {
+            std::unique_ptr<QBase> qrule, qrule_face;
+            std::unique_ptr<FEDataInterpolation> fe;
+            size_t X_sys_idx;
+            std::vector<size_t> PK1_fcn_system_idxs;
+            std::array<DenseVector<double>, NDIM> F_rhs_e;
+            std::vector<libMesh::dof_id_type> dof_id_scratch;
+            std::vector<double> F_rhs;
+        };
+        std::vector<AssemblyThreadData> thread_data(n_threads);
+        for (AssemblyThreadData& td : thread_data)
+        {
+            td.fe = std::unique_ptr<FEDataInterpolation>(new FEDataInterpolation(dim, d_fe_data[part]));
+            td.qrule = QBase::build(exemplar_pk1.quad_type, dim, exemplar_pk1.quad_order);
+            td.qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            td.qrule_face = QBase::build(exemplar_pk1.quad_type, dim - 1, exemplar_pk1.quad_order);
+            td.qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            FEDataInterpolation& fe = *td.fe;
+            fe.attachQuadratureRule(td.qrule.get());
+            fe.attachQuadratureRuleFace(td.qrule_face.get());
+            fe.evalNormalsFace();
+            fe.evalQuadraturePoints();
+            fe.evalQuadraturePointsFace();
+            fe.evalQuadratureWeights();
+            fe.evalQuadratureWeightsFace();
+            fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
+            td.X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+            fe.setupInterpolatedSystemDataIndexes(
+                td.PK1_fcn_system_idxs, exemplar_pk1.system_data, &equation_systems);
+            fe.init();
+        }
 
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
@@ -963,13 +974,30 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         //
         // This right-hand side vector is used to solve for the nodal values of
         // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n, x;
-        const auto el_begin = mesh.active_local_elements_begin();
-        const auto el_end = mesh.active_local_elements_end();
-        for (auto el_it = el_begin; el_it != el_end; ++el_it)
+        auto assemble_elem = [&](AssemblyThreadData& td, Elem* const elem, double* const F_rhs_data)
         {
-            auto elem = *el_it;
+            FEDataInterpolation& fe = *td.fe;
+            std::array<DenseVector<double>, NDIM>& F_rhs_e = td.F_rhs_e;
+            const size_t X_sys_idx = td.X_sys_idx;
+
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            std::vector<const std::vector<double>*> PK1_var_data;
+            std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_qp, n, x;
             const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
@@ -978,7 +1006,7 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
             fe.reinit(elem);
             fe.collectDataForInterpolation(elem);
             fe.interpolate(elem);
-            const unsigned int n_qp = qrule->n_points();
+            const unsigned int n_qp = td.qrule->n_points();
             const size_t n_basis = dphi.size();
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
@@ -990,7 +1018,7 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                 // Compute the value of the first Piola-Kirchhoff stress tensor
                 // at the quadrature point and add the corresponding forces to
                 // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, td.PK1_fcn_system_idxs, elem, qp);
                 for (const PK1StressFcnData& pk1 : current_pk1)
                 {
                     pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
@@ -1023,7 +1051,7 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
 
                 fe.reinit(elem, side);
                 fe.interpolate(elem, side);
-                const unsigned int n_qp_face = qrule_face->n_points();
+                const unsigned int n_qp_face = td.qrule_face->n_points();
                 const size_t n_basis_face = phi_face.size();
                 for (unsigned int qp = 0; qp < n_qp_face; ++qp)
                 {
@@ -1038,7 +1066,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
                     // traction force to the right-hand-side vector.
-                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    fe.setInterpolatedDataPointers(
+                        PK1_var_data, PK1_grad_var_data, td.PK1_fcn_system_idxs, elem, qp);
                     for (const PK1StressFcnData& pk1 : current_pk1)
                     {
                         pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
@@ -1073,13 +1102,71 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
             // and add the elemental contributions to the global vector.
             for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
             {
-                copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-                F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
-                for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                copy_dof_ids_to_vector(var_n, F_dof_indices, td.dof_id_scratch);
+                F_dof_map.constrain_element_vector(F_rhs_e[var_n], td.dof_id_scratch);
+                for (unsigned int j = 0; j < td.dof_id_scratch.size(); ++j)
+                {
+                    F_rhs_data[F_rhs_vec.map_global_to_local_index(td.dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                }
+            }
+        };
+
+        const std::vector<Elem*> elems(mesh.active_local_elements_begin(), mesh.active_local_elements_end());
+        if (n_threads == 1)
+        {
+            for (Elem* const elem : elems) assemble_elem(thread_data[0], elem, F_rhs_local_soln);
+        }
+        else
+        {
+#if defined(IBTK_HAVE_OPENMP)
+            // The DOF caches are populated lazily and are shared between the
+            // threads, so fill them before entering the threaded region.
+            std::vector<FEDataManager::SystemDofMapCache*> dof_map_caches = {
+                &F_dof_map_cache, d_fe_data[part]->getDofMapCache(COORDS_SYSTEM_NAME)
+            };
+            for (const SystemData& system_data : exemplar_pk1.system_data)
+            {
+                dof_map_caches.push_back(d_fe_data[part]->getDofMapCache(system_data.system_name));
+            }
+            for (Elem* const elem : elems)
+            {
+                for (FEDataManager::SystemDofMapCache* dof_map_cache : dof_map_caches)
                 {
-                    F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    dof_map_cache->dof_indices(elem);
                 }
             }
+            // Get the arrays of the interpolated system vectors once and share
+            // them with the FE objects of the other threads.
+            FEDataInterpolation& array_owner_fe = *thread_data[0].fe;
+            array_owner_fe.getSystemVectorArrays();
+            for (int k = 1; k < n_threads; ++k) thread_data[k].fe->shareSystemVectorArrays(array_owner_fe);
+
+            PetscInt n_local;
+            ierr = VecGetLocalSize(F_rhs_vec_local, &n_local);
+            IBTK_CHKERRQ(ierr);
+            // The runtime may provide fewer than n_threads threads, so size
+            // every buffer here: unused buffers then contribute zero to the sum.
+            for (AssemblyThreadData& td : thread_data) td.F_rhs.assign(n_local, 0.0);
+            const int n_elems = static_cast<int>(elems.size());
+#pragma omp parallel num_threads(n_threads)
+            {
+                AssemblyThreadData& td = thread_data[omp_get_thread_num()];
+#pragma omp for schedule(static)
+                for (int k = 0; k < n_elems; ++k)
+                {
+                    assemble_elem(td, elems[k], td.F_rhs.data());
+                }
+            }
+
+            // Sum the per-thread contributions.
+#pragma omp parallel for schedule(static)
+            for (PetscInt i = 0; i < n_local; ++i)
+            {
+                for (const AssemblyThreadData& td : thread_data) F_rhs_local_soln[i] += td.F_rhs[i];
+            }
+            for (int k = 1; k < n_threads; ++k) thread_data[k].fe->releaseSystemVectorArrays();
+            array_owner_fe.restoreSystemVectorArrays();
+#endif
         }
     }
 
@@ -1147,6 +1234,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         surface_pressure_grad_var_data;
 
     // Loop over the elements to compute the right-hand side vector.
+    std::array<DenseVector<double>, NDIM> F_rhs_e;
+    std::vector<libMesh::dof_id_type> dof_id_scratch;
     TensorValue<double> PP, FF, FF_inv_trans;
     VectorValue<double> F, F_b, F_s, F_qp, n, x;
     boost::multi_array<double, 2> X_node;
@@ -1699,6 +1788,16 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
     if (db->isBool("allow_rules_with_negative_weights"))
         d_allow_rules_with_negative_weights = db->getBool("allow_rules_with_negative_weights");
+    if (db->isBool("use_threaded_force_assembly"))
+        d_use_threaded_force_assembly = db->getBool("use_threaded_force_assembly");
+#if !defined(IBTK_HAVE_OPENMP)
+    if (d_use_threaded_force_assembly)
+    {
+        TBOX_WARNING(d_object_name << "::getFromInput():\n"
+                                   << "  use_threaded_force_assembly = TRUE but IBAMR was configured without OpenMP.\n"
+                                   << "  Falling back to serial force assembly." << std::endl);
+    }
+#endif
 
     // Pressure settings.
     if (db->isDouble("static_pressure_kappa")) d_static_pressure_kappa = db->getDouble("static_pressure_kappa");
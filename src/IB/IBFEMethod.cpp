@@ -579,6 +579,12 @@ IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int nu
     }
     if (do_reinit_element_mappings) reinitElementMappings();
 
+    // Quadrature point geometry data are only reused within a time step.
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        d_active_fe_data_managers[part]->clearQuadraturePointGeometryCache();
+    }
+
     // Update direct forcing data.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
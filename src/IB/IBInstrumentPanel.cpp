@@ -24,9 +24,9 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 
-#include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianGridGeometry.h"
@@ -38,6 +38,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SideData.h"
 #include "SideIndex.h"
 #include "tbox/Database.h"
@@ -66,6 +67,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -302,135 +304,62 @@ build_meter_web(DBfile* dbfile,
 } // build_meter_web
 #endif
 
-double
-linear_interp(const Point& X,
-              const hier::Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+void
+compute_stencil_weights(hier::Index<NDIM>& cc_lower_idx,
+                        Vector& cc_wgt_lower,
+                        Vector& sc_wgt_lower,
+                        const Point& X,
+                        const hier::Index<NDIM>& i_cell,
+                        const Patch<NDIM>& patch)
 {
-    std::array<bool, NDIM> is_lower;
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const hier::Index<NDIM>& patch_lower = patch.getBox().lower();
     for (unsigned int d = 0; d < NDIM; ++d)
     {
-        is_lower[d] = X[d] < X_cell[d];
-    }
-    double U = 0.0;
-#if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-    {
-#endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
-        {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-            {
-                const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                     X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                     ,
-                                     X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
-#endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                U += v(i_c) * wgt;
-            }
-        }
-#if (NDIM == 3)
+        const double X_cell = x_lower[d] + dx[d] * (static_cast<double>(i_cell(d) - patch_lower(d)) + 0.5);
+        const bool is_lower = X[d] < X_cell;
+        cc_lower_idx(d) = is_lower ? i_cell(d) - 1 : i_cell(d);
+        cc_wgt_lower[d] = is_lower ? (X_cell - X[d]) / dx[d] : 1.0 - (X[d] - X_cell) / dx[d];
+        sc_wgt_lower[d] = (X_cell + 0.5 * dx[d] - X[d]) / dx[d];
     }
-#endif
-    return U;
-} // linear_interp
+    return;
+} // compute_stencil_weights
 
 template <int N>
 Eigen::Matrix<double, N, 1>
-linear_interp(const Point& X,
-              const hier::Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+interpolate_cc(const CellData<NDIM, double>& v, const hier::Index<NDIM>& i_lower, const Vector& wgt_lower)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(v.getDepth() == N);
 #endif
-    std::array<bool, NDIM> is_lower;
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        is_lower[d] = X[d] < X_cell[d];
-    }
     Eigen::Matrix<double, N, 1> U(Eigen::Matrix<double, N, 1>::Zero());
-#if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
+    for (unsigned int corner = 0; corner < (1U << NDIM); ++corner)
     {
-#endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
+        hier::Index<NDIM> i = i_lower;
+        double wgt = 1.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-            {
-                const Point X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                     X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                     ,
-                                     X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
-#endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                for (int k = 0; k < N; ++k)
-                {
-                    U[k] += v(i_c, k) * wgt;
-                }
-            }
+            const bool is_upper = (corner >> d) & 1U;
+            i(d) += is_upper ? 1 : 0;
+            wgt *= is_upper ? 1.0 - wgt_lower[d] : wgt_lower[d];
+        }
+        const CellIndex<NDIM> i_c(i);
+        for (int k = 0; k < N; ++k)
+        {
+            U[k] += v(i_c, k) * wgt;
         }
-#if (NDIM == 3)
     }
-#endif
     return U;
-} // linear_interp
+} // interpolate_cc
 
 Vector
-linear_interp(const Point& X,
-              const hier::Index<NDIM>& i_cell,
-              const Point& X_cell,
-              const SideData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+interpolate_sc(const SideData<NDIM, double>& v,
+               const hier::Index<NDIM>& i_cell,
+               const hier::Index<NDIM>& cc_lower_idx,
+               const Vector& cc_wgt_lower,
+               const Vector& sc_wgt_lower)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(v.getDepth() == 1);
@@ -438,57 +367,26 @@ linear_interp(const Point& X,
     Vector U(Vector::Zero());
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        std::array<bool, NDIM> is_lower;
-        for (unsigned int d = 0; d < NDIM; ++d)
+        hier::Index<NDIM> i_lower = cc_lower_idx;
+        i_lower(axis) = i_cell(axis);
+        Vector wgt_lower = cc_wgt_lower;
+        wgt_lower[axis] = sc_wgt_lower[axis];
+        for (unsigned int corner = 0; corner < (1U << NDIM); ++corner)
         {
-            if (d == axis)
-            {
-                is_lower[d] = false;
-            }
-            else
-            {
-                is_lower[d] = X[d] < X_cell[d];
-            }
-        }
-#if (NDIM == 3)
-        for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-        {
-#endif
-            for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
+            hier::Index<NDIM> i = i_lower;
+            double wgt = 1.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-                {
-                    const Point X_side(X_cell[0] + (static_cast<double>(i_shift0) + (axis == 0 ? -0.5 : 0.0)) * dx[0],
-                                       X_cell[1] + (static_cast<double>(i_shift1) + (axis == 1 ? -0.5 : 0.0)) * dx[1]
-#if (NDIM == 3)
-                                       ,
-                                       X_cell[2] + (static_cast<double>(i_shift2) + (axis == 2 ? -0.5 : 0.0)) * dx[2]
-#endif
-                    );
-                    const double wgt =
-                        (((X[0] < X_side[0] ? X[0] - (X_side[0] - dx[0]) : (X_side[0] + dx[0]) - X[0]) / dx[0]) *
-                         ((X[1] < X_side[1] ? X[1] - (X_side[1] - dx[1]) : (X_side[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                         * ((X[2] < X_side[2] ? X[2] - (X_side[2] - dx[2]) : (X_side[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                        );
-                    const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                              i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                                  ,
-                                              i_shift2 + i_cell(2)
-#endif
-                    );
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    U[axis] += v(i_s) * wgt;
-                }
+                const bool is_upper = (corner >> d) & 1U;
+                i(d) += is_upper ? 1 : 0;
+                wgt *= is_upper ? 1.0 - wgt_lower[d] : wgt_lower[d];
             }
-#if (NDIM == 3)
+            const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
+            U[axis] += v(i_s) * wgt;
         }
-#endif
     }
     return U;
-} // linear_interp
+} // interpolate_sc
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -744,7 +642,7 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
             }
 
             // Restore the local position array.
-            ierr = VecGetArray(X_vec, &X_arr);
+            ierr = VecRestoreArray(X_vec, &X_arr);
             IBTK_CHKERRQ(ierr);
         }
     }
@@ -794,11 +692,8 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
 
     // Determine the finest grid spacing in the Cartesian grid hierarchy.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
-    const double* const domainXLower = grid_geom->getXLower();
-    const double* const domainXUpper = grid_geom->getXUpper();
     const double* const dx_coarsest = grid_geom->getDx();
     TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
-    const Box<NDIM> domain_box = grid_geom->getPhysicalDomain()[0];
 
     const IntVector<NDIM>& ratio_to_level_zero = hierarchy->getPatchLevel(finest_ln)->getRatio();
     std::array<double, NDIM> dx_finest;
@@ -808,21 +703,40 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     }
     const double h_finest = *std::min_element(dx_finest.begin(), dx_finest.end());
 
+    // Determine whether the patch configuration has changed since the
+    // interpolation stencils were last built.
+    std::vector<std::vector<std::pair<Box<NDIM>, int> > > level_layout(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        const ProcessorMapping& proc_mapping = level->getProcessorMapping();
+        level_layout[ln].reserve(boxes.getNumberOfBoxes());
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+        {
+            level_layout[ln].push_back(std::make_pair(boxes[k], proc_mapping.getProcessorAssignment(k)));
+        }
+    }
+    const bool layout_changed = level_layout != d_stencil_level_layout;
+    d_stencil_level_layout = std::move(level_layout);
+
     // Build the meter web patch centroids and area elements.
     //
     // Note that we set the number of web nodes in each meter to that the
     // spacing is approximately half a meshwidth on the finest level of the
     // Cartesian grid hierarchy.
+    std::vector<int> rebuild_stencils(d_num_meters, layout_changed ? 1 : 0);
     for (unsigned int m = 0; m < d_num_meters; ++m)
     {
         const int num_web_nodes = 2 * static_cast<int>(ceil(r_max[m] / h_finest));
+        if (static_cast<int>(d_X_web[m].shape()[1]) != num_web_nodes) rebuild_stencils[m] = 1;
         d_X_web[m].resize(boost::extents[d_num_perimeter_nodes[m]][num_web_nodes]);
         d_dA_web[m].resize(boost::extents[d_num_perimeter_nodes[m]][num_web_nodes]);
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
-    // data.
+    // Setup the interpolation stencils for the web patch centroids and meter
+    // centroids.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
     // Cartesian grid cell in precisely one level.  In particular, each web
@@ -831,81 +745,22 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
     // which the web centroid is located.
-    d_web_patch_map.clear();
-    d_web_patch_map.resize(finest_ln + 1);
-    d_web_centroid_map.clear();
-    d_web_centroid_map.resize(finest_ln + 1);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    //
+    // Meters typically move by much less than a grid cell between reads, so we
+    // only update the interpolation weights of the existing stencils unless the
+    // patch configuration has changed or some point of the meter has moved to
+    // a different grid cell.  Because a point may move into a cell owned by
+    // another process, the decision to rebuild the stencils of a meter is made
+    // collectively.
+    d_web_stencils.resize(d_num_meters);
+    for (unsigned int m = 0; m < d_num_meters; ++m)
     {
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        const IntVector<NDIM>& ratio = level->getRatio();
-        const Box<NDIM> domain_box_level = Box<NDIM>::refine(domain_box, ratio);
-        const hier::Index<NDIM>& domain_box_level_lower = domain_box_level.lower();
-        const hier::Index<NDIM>& domain_box_level_upper = domain_box_level.upper();
-        std::array<double, NDIM> dx;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
-        }
-
-        Pointer<PatchLevel<NDIM> > finer_level =
-            (ln < finest_ln ? hierarchy->getPatchLevel(ln + 1) : Pointer<BasePatchLevel<NDIM> >(nullptr));
-        const IntVector<NDIM>& finer_ratio = (ln < finest_ln ? finer_level->getRatio() : IntVector<NDIM>(1));
-        const Box<NDIM> finer_domain_box_level = Box<NDIM>::refine(domain_box, finer_ratio);
-        const hier::Index<NDIM>& finer_domain_box_level_lower = finer_domain_box_level.lower();
-        const hier::Index<NDIM>& finer_domain_box_level_upper = finer_domain_box_level.upper();
-        std::array<double, NDIM> finer_dx;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
-        }
-
-        for (unsigned int l = 0; l < d_num_meters; ++l)
-        {
-            // Setup the web patch mapping.
-            for (unsigned int m = 0; m < d_X_web[l].shape()[0]; ++m)
-            {
-                for (unsigned int n = 0; n < d_X_web[l].shape()[1]; ++n)
-                {
-                    const Point& X = d_X_web[l][m][n];
-                    const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
-                        X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-                    const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                                   domainXLower,
-                                                                                   domainXUpper,
-                                                                                   finer_dx.data(),
-                                                                                   finer_domain_box_level_lower,
-                                                                                   finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
-                    {
-                        WebPatch p;
-                        p.meter_num = l;
-                        p.X = &d_X_web[l][m][n];
-                        p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
-                    }
-                }
-            }
-
-            // Setup the web centroid mapping.
-            const Point& X = d_X_centroid[l];
-            const hier::Index<NDIM> i = IndexUtilities::getCellIndex(
-                X, domainXLower, domainXUpper, dx.data(), domain_box_level_lower, domain_box_level_upper);
-            const hier::Index<NDIM> finer_i = IndexUtilities::getCellIndex(X,
-                                                                           domainXLower,
-                                                                           domainXUpper,
-                                                                           finer_dx.data(),
-                                                                           finer_domain_box_level_lower,
-                                                                           finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
-            {
-                WebCentroid c;
-                c.meter_num = l;
-                c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
-            }
-        }
+        if (!rebuild_stencils[m] && !updateWebStencils(m, hierarchy)) rebuild_stencils[m] = 1;
+    }
+    IBTK_MPI::maxReduction(rebuild_stencils.data(), static_cast<int>(d_num_meters));
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        if (rebuild_stencils[m]) buildWebStencils(m, hierarchy);
     }
 
     IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
@@ -952,101 +807,53 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
     // Compute the local contributions to the flux of U through the flow meter,
     // the average value of P in the flow meter, and the pointwise value of P at
     // the centroid of the meter.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    //
+    // All quantities are evaluated in a single pass over the precomputed
+    // stencils of each meter.  Because the stencils are sorted by level and
+    // patch number, the patch data only need to be looked up when the patch
+    // changes.
+    for (unsigned int m = 0; m < d_num_meters; ++m)
     {
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        int ln = -1, patch_num = -1;
+        Pointer<CellData<NDIM, double> > U_cc_data, P_cc_data;
+        Pointer<SideData<NDIM, double> > U_sc_data;
+        for (const auto& stencil : d_web_stencils[m])
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const hier::Index<NDIM>& patch_lower = patch_box.lower();
-            const hier::Index<NDIM>& patch_upper = patch_box.upper();
-
-            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const x_lower = pgeom->getXLower();
-            const double* const x_upper = pgeom->getXUpper();
-            const double* const dx = pgeom->getDx();
-
-            Pointer<CellData<NDIM, double> > U_cc_data = patch->getPatchData(U_data_idx);
-            Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
-            Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
-
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (stencil.level_num != ln || stencil.patch_num != patch_num)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
-                {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (U_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
-                }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+                ln = stencil.level_num;
+                patch_num = stencil.patch_num;
+                Pointer<Patch<NDIM> > patch = hierarchy->getPatchLevel(ln)->getPatch(patch_num);
+                U_cc_data = patch->getPatchData(U_data_idx);
+                U_sc_data = patch->getPatchData(U_data_idx);
+                P_cc_data = patch->getPatchData(P_data_idx);
+            }
+            if (stencil.web_idx < 0)
+            {
+                if (P_cc_data)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (P_cc_data)
-                    {
-                        for (auto it = centroid_range.first; it != centroid_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    d_point_pres_values[m] =
+                        interpolate_cc<1>(*P_cc_data, stencil.cc_lower_idx, stencil.cc_wgt_lower)[0];
                 }
+                continue;
+            }
+            const Vector& dA = d_dA_web[m].data()[stencil.web_idx];
+            if (U_cc_data)
+            {
+                const Vector U = interpolate_cc<NDIM>(*U_cc_data, stencil.cc_lower_idx, stencil.cc_wgt_lower);
+                d_flow_values[m] += U.dot(dA);
+            }
+            if (U_sc_data)
+            {
+                const Vector U = interpolate_sc(
+                    *U_sc_data, stencil.cell_idx, stencil.cc_lower_idx, stencil.cc_wgt_lower, stencil.sc_wgt_lower);
+                d_flow_values[m] += U.dot(dA);
+            }
+            if (P_cc_data)
+            {
+                const double P = interpolate_cc<1>(*P_cc_data, stencil.cc_lower_idx, stencil.cc_wgt_lower)[0];
+                d_mean_pres_values[m] += P * dA.norm();
+                A[m] += dA.norm();
             }
         }
     }
@@ -1101,8 +908,8 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
                 }
             }
 
-            // Restore the local position array.
-            ierr = VecGetArray(U_vec, &U_arr);
+            // Restore the local velocity array.
+            ierr = VecRestoreArray(U_vec, &U_arr);
             IBTK_CHKERRQ(ierr);
         }
     }
@@ -1215,6 +1022,10 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
 
     Utilities::recursiveMkdir(dump_dirname);
 
+    // Silo is not thread safe, and Lagrangian data may be written on a
+    // background thread while these files are written.
+    std::lock_guard<std::mutex> silo_lock(LSiloDataWriter::getSiloMutex());
+
     // Create one local DBfile per MPI process.
     sprintf(temp_buf, "%04d", mpi_rank);
     current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
@@ -1352,6 +1163,64 @@ IBInstrumentPanel::getFromInput(Pointer<Database> db)
     return;
 } // getFromInput
 
+void
+IBInstrumentPanel::buildWebStencils(const unsigned int meter_num, const Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+
+    std::vector<WebStencil>& stencils = d_web_stencils[meter_num];
+    stencils.clear();
+    const int num_web_patches = static_cast<int>(d_X_web[meter_num].num_elements());
+    for (int k = -1; k < num_web_patches; ++k)
+    {
+        const Point& X = (k < 0 ? d_X_centroid[meter_num] : d_X_web[meter_num].data()[k]);
+        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X, grid_geom, level->getRatio());
+            if (!level->getBoxes().contains(i)) continue;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                if (!patch->getBox().contains(i)) continue;
+                WebStencil stencil;
+                stencil.web_idx = k;
+                stencil.level_num = ln;
+                stencil.patch_num = p();
+                stencil.cell_idx = i;
+                compute_stencil_weights(
+                    stencil.cc_lower_idx, stencil.cc_wgt_lower, stencil.sc_wgt_lower, X, i, *patch);
+                stencils.push_back(stencil);
+                break;
+            }
+            break;
+        }
+    }
+    std::stable_sort(stencils.begin(), stencils.end(), [](const WebStencil& lhs, const WebStencil& rhs) {
+        return lhs.level_num < rhs.level_num || (lhs.level_num == rhs.level_num && lhs.patch_num < rhs.patch_num);
+    });
+    return;
+} // buildWebStencils
+
+bool
+IBInstrumentPanel::updateWebStencils(const unsigned int meter_num, const Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    for (auto& stencil : d_web_stencils[meter_num])
+    {
+        const Point& X =
+            (stencil.web_idx < 0 ? d_X_centroid[meter_num] : d_X_web[meter_num].data()[stencil.web_idx]);
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(stencil.level_num);
+        const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X, grid_geom, level->getRatio());
+        if (i != stencil.cell_idx) return false;
+        Pointer<Patch<NDIM> > patch = level->getPatch(stencil.patch_num);
+        compute_stencil_weights(stencil.cc_lower_idx, stencil.cc_wgt_lower, stencil.sc_wgt_lower, X, i, *patch);
+    }
+    return true;
+} // updateWebStencils
+
 void
 IBInstrumentPanel::outputLogData(std::ostream& os)
 {
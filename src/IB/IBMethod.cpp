@@ -30,6 +30,7 @@
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
@@ -64,6 +65,8 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 #include "petscmat.h"
@@ -113,6 +116,10 @@ namespace IBAMR
 
 namespace
 {
+// Timers.
+static Timer* t_interpolate_velocity;
+static Timer* t_spread_force;
+
 inline double
 cos_kernel(const double x, const double eps)
 {
@@ -160,6 +167,11 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                 "interpolation and spreading.\n";
     }
 
+    // Get handles for caching interaction weights.
+    d_X_current_plan_handle = LEInteractor::getNewInteractionPlanHandle();
+    d_X_half_plan_handle = LEInteractor::getNewInteractionPlanHandle();
+    d_X_new_plan_handle = LEInteractor::getNewInteractionPlanHandle();
+
     // Get the Lagrangian Data Manager.
     d_l_data_manager = LDataManager::getManager(d_object_name + "::LDataManager",
                                                 d_interp_kernel_fcn,
@@ -174,6 +186,11 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
         new IBInstrumentPanel(d_object_name + "::IBInstrumentPanel",
                               (input_db->isDatabase("IBInstrumentPanel") ? input_db->getDatabase("IBInstrumentPanel") :
                                                                            Pointer<Database>(nullptr)));
+
+    // Setup Timers.
+    auto set_timer = [&](const char* name) { return TimerManager::getManager()->getTimer(name); };
+    IBAMR_DO_ONCE(t_interpolate_velocity = set_timer("IBAMR::IBMethod::interpolateVelocity()");
+                  t_spread_force = set_timer("IBAMR::IBMethod::spreadForce()"););
     return;
 } // IBMethod
 
@@ -262,6 +279,17 @@ IBMethod::registerLSiloDataWriter(Pointer<LSiloDataWriter> silo_writer)
     return;
 } // registerLSiloDataWriter
 
+void
+IBMethod::registerLHDF5DataWriter(Pointer<LHDF5DataWriter> hdf5_writer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hdf5_writer);
+#endif
+    d_hdf5_writer = hdf5_writer;
+    d_l_data_manager->registerLHDF5DataWriter(d_hdf5_writer);
+    return;
+} // registerLHDF5DataWriter
+
 const IntVector<NDIM>&
 IBMethod::getMinimumGhostCellWidth() const
 {
@@ -474,6 +502,10 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     d_F_half_data.clear();
     d_F_jac_data.clear();
 
+    // Invalidate the interaction weights cached for the (now swapped or
+    // deallocated) position data.
+    ++d_plan_version;
+
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
     d_new_time = std::numeric_limits<double>::quiet_NaN();
@@ -673,11 +705,15 @@ IBMethod::interpolateVelocity(const int u_data_idx,
                               const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                               const double data_time)
 {
+    IBAMR_TIMER_START(t_interpolate_velocity);
     std::vector<Pointer<LData> >*U_data, *X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getVelocityData(&U_data, data_time);
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
+    const int plan_handle = getLECouplingPlanHandle(data_time);
+    if (plan_handle >= 0) LEInteractor::setInteractionPlanHandle(plan_handle, d_plan_version);
     d_l_data_manager->interp(u_data_idx, *U_data, *X_LE_data, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    LEInteractor::unsetInteractionPlanHandle();
     resetAnchorPointValues(*U_data,
                            /*coarsest_ln*/ 0,
                            /*finest_ln*/ d_hierarchy->getFinestLevelNumber());
@@ -688,7 +724,7 @@ IBMethod::interpolateVelocity(const int u_data_idx,
         getVelocityData(&U_half_data, d_half_time);
         reinitMidpointData(d_U_current_data, d_U_new_data, *U_half_data);
     }
-
+    IBAMR_TIMER_STOP(t_interpolate_velocity);
     return;
 } // interpolateVelocity
 
@@ -973,6 +1009,7 @@ IBMethod::spreadForce(const int f_data_idx,
                       const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                       const double data_time)
 {
+    IBAMR_TIMER_START(t_spread_force);
     std::vector<Pointer<LData> >*F_data, *X_LE_data;
     bool *F_needs_ghost_fill, *X_LE_needs_ghost_fill;
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
@@ -980,6 +1017,8 @@ IBMethod::spreadForce(const int f_data_idx,
     resetAnchorPointValues(*F_data,
                            /*coarsest_ln*/ 0,
                            /*finest_ln*/ d_hierarchy->getFinestLevelNumber());
+    const int plan_handle = getLECouplingPlanHandle(data_time);
+    if (plan_handle >= 0) LEInteractor::setInteractionPlanHandle(plan_handle, d_plan_version);
     d_l_data_manager->spread(f_data_idx,
                              *F_data,
                              *X_LE_data,
@@ -988,8 +1027,10 @@ IBMethod::spreadForce(const int f_data_idx,
                              data_time,
                              *F_needs_ghost_fill,
                              *X_LE_needs_ghost_fill);
+    LEInteractor::unsetInteractionPlanHandle();
     *F_needs_ghost_fill = false;
     *X_LE_needs_ghost_fill = false;
+    IBAMR_TIMER_STOP(t_spread_force);
     return;
 } // spreadForce
 
@@ -1772,6 +1813,18 @@ IBMethod::getLECouplingPositionData(std::vector<Pointer<LData> >** X_LE_data,
     return;
 } // getLECouplingPositionData
 
+int
+IBMethod::getLECouplingPlanHandle(const double data_time) const
+{
+    // Positions that are updated within a time step (e.g., between cycles) do
+    // not need a new version: LEInteractor recomputes the weights of the
+    // markers that moved.
+    if (IBTK::rel_equal_eps(data_time, d_current_time)) return d_X_current_plan_handle;
+    if (IBTK::rel_equal_eps(data_time, d_half_time)) return d_X_half_plan_handle;
+    if (IBTK::rel_equal_eps(data_time, d_new_time)) return d_X_new_plan_handle;
+    return -1;
+} // getLECouplingPlanHandle
+
 void
 IBMethod::getVelocityData(std::vector<Pointer<LData> >** U_data, double data_time)
 {
@@ -2030,6 +2083,7 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->isDatabase("LEInteractor")) LEInteractor::setFromDatabase(db->getDatabase("LEInteractor"));
     return;
 } // getFromInput
 
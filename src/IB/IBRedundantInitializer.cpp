@@ -26,6 +26,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
+#include "ibtk/LHDF5DataWriter.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeSet.h"
@@ -35,6 +36,7 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -43,6 +45,8 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
@@ -50,6 +54,8 @@
 #include "tbox/RestartManager.h"
 #include "tbox/Utilities.h"
 
+#include <mpi.h>
+
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 IBTK_DISABLE_EXTRA_WARNINGS
@@ -59,6 +65,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <numeric>
@@ -75,6 +82,8 @@ class LDataManager;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBRedundantInitializer::IBRedundantInitializer(std::string object_name, Pointer<Database> input_db)
@@ -130,13 +139,42 @@ IBRedundantInitializer::registerLSiloDataWriter(Pointer<LSiloDataWriter> silo_wr
         {
             if (d_level_is_initialized[ln])
             {
-                initializeLSiloDataWriter(ln);
+                initializeLagrangianDataWriters(ln);
             }
         }
     }
     return;
 } // registerLSiloDataWriter
 
+void
+IBRedundantInitializer::registerLHDF5DataWriter(Pointer<LHDF5DataWriter> hdf5_writer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hdf5_writer);
+#endif
+
+    // Cache a pointer to the data writer.
+    d_hdf5_writer = hdf5_writer;
+
+    // Initialize the HDF5 data writer only if we are not starting from a
+    // restart file.
+    if (!RestartManager::getManager()->isFromRestart())
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_data_processed);
+#endif
+
+        for (int ln = 0; ln < d_max_levels; ++ln)
+        {
+            if (d_level_is_initialized[ln])
+            {
+                initializeLagrangianDataWriters(ln);
+            }
+        }
+    }
+    return;
+} // registerLHDF5DataWriter
+
 bool
 IBRedundantInitializer::getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const
 {
@@ -155,6 +193,29 @@ IBRedundantInitializer::getIsAllLagrangianDataInDomain(const Pointer<PatchHierar
     const double* const domain_x_upper = grid_geom->getXUpper();
     const IntVector<NDIM> periodic_shift = grid_geom->getPeriodicShift();
 
+    if (d_use_distributed_vertices)
+    {
+        int data_in_domain = 1;
+        for (const auto& level_vertices : d_local_vertex_posn)
+        {
+            for (const auto& strct_vertices : level_vertices)
+            {
+                for (const auto& vertex : strct_vertices)
+                {
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        const double X = vertex.second[d];
+                        if (!periodic_shift(d) && ((X < domain_x_lower[d]) || (domain_x_upper[d] < X)))
+                        {
+                            data_in_domain = 0;
+                        }
+                    }
+                }
+            }
+        }
+        return IBTK_MPI::minReduction(data_in_domain) == 1;
+    }
+
     for (unsigned int vertex_level_number = 0; vertex_level_number < d_num_vertex.size(); ++vertex_level_number)
     {
         for (int j = 0; j < int(d_num_vertex[vertex_level_number].size()); ++j)
@@ -205,6 +266,9 @@ IBRedundantInitializer::computeLocalNodeCountOnPatchLevel(const Pointer<PatchHie
     TBOX_ASSERT(d_data_processed);
 #endif
 
+    // Move the vertices to the processes that own them.
+    distributeVertexData(hierarchy, level_number, level_number);
+
     // Loop over all patches in the specified level of the patch level and count
     // the number of local vertices.
     int local_node_count = 0;
@@ -993,6 +1057,9 @@ IBRedundantInitializer::initializeDataOnPatchLevel(const int lag_node_index_idx,
     // indices that have already been initialized on the specified level.
     d_global_index_offset[level_number] = global_index_offset;
 
+    // Move the vertices to the processes that own them.
+    distributeVertexData(hierarchy, level_number, level_number);
+
     // Loop over all patches in the specified level of the patch level and
     // initialize the local vertices.
     boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
@@ -1098,12 +1165,12 @@ IBRedundantInitializer::initializeDataOnPatchLevel(const int lag_node_index_idx,
 
     d_level_is_initialized[level_number] = true;
 
-    // If a Lagrangian Silo data writer is registered with the initializer,
-    // setup the visualization data corresponding to the present level of the
-    // locally refined grid.
-    if (d_silo_writer)
+    // If a Lagrangian Silo or HDF5 data writer is registered with the
+    // initializer, setup the visualization data corresponding to the present
+    // level of the locally refined grid.
+    if (d_silo_writer || d_hdf5_writer)
     {
-        initializeLSiloDataWriter(level_number);
+        initializeLagrangianDataWriters(level_number);
     }
     return local_node_count;
 } // initializeDataOnPatchLevel
@@ -1235,6 +1302,10 @@ IBRedundantInitializer::tagCellsForInitialRefinement(const Pointer<PatchHierarch
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     const IntVector<NDIM>& ratio = level->getRatio();
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+    for (int ln = level_number + 1; ln < d_max_levels; ++ln)
+    {
+        distributeVertexData(hierarchy, level_number, ln);
+    }
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -1310,7 +1381,7 @@ IBRedundantInitializer::init()
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
-IBRedundantInitializer::initializeLSiloDataWriter(const int level_number)
+IBRedundantInitializer::initializeLagrangianDataWriters(const int level_number)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(level_number >= 0);
@@ -1327,9 +1398,27 @@ IBRedundantInitializer::initializeLSiloDataWriter(const int level_number)
             "this error.\n");
     }
 
-    // WARNING: For now, we just register the visualization data on MPI process
-    // 0.  This will fail if the structure is too large to be stored in the
-    // memory available to a single MPI process.
+    // When vertex data is distributed, no process holds the complete spring
+    // connectivity. Each process instead registers the springs that it holds
+    // under the name of the structure's mesh, and the data writers combine the
+    // pieces from all processes.
+    bool registered_spring_edge_map = false;
+    for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
+    {
+        registered_spring_edge_map = registered_spring_edge_map || !d_spring_edge_map[level_number][j].empty();
+    }
+    if (d_use_distributed_vertices)
+    {
+        registered_spring_edge_map = IBTK_MPI::maxReduction(static_cast<int>(registered_spring_edge_map)) != 0;
+        for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
+        {
+            registerSpringMesh(level_number, j);
+        }
+    }
+
+    // WARNING: For now, we just register the remaining visualization data on
+    // MPI process 0.  This will fail if the structure is too large to be stored
+    // in the memory available to a single MPI process.
     if (IBTK_MPI::getRank() == 0)
     {
         for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
@@ -1337,22 +1426,25 @@ IBRedundantInitializer::initializeLSiloDataWriter(const int level_number)
             if (d_num_vertex[level_number][j] > 0)
             {
                 const std::string postfix = "_vertices";
-                d_silo_writer->registerMarkerCloud(d_base_filename[level_number][j] + postfix,
-                                                   d_num_vertex[level_number][j],
-                                                   d_vertex_offset[level_number][j],
-                                                   level_number);
+                const std::string cloud_name = d_base_filename[level_number][j] + postfix;
+                const int nmarks = d_num_vertex[level_number][j];
+                const int first_lag_idx = d_vertex_offset[level_number][j];
+                if (d_silo_writer)
+                {
+                    d_silo_writer->registerMarkerCloud(cloud_name, nmarks, first_lag_idx, level_number);
+                }
+                if (d_hdf5_writer)
+                {
+                    d_hdf5_writer->registerMarkerCloud(cloud_name, nmarks, first_lag_idx, level_number);
+                }
             }
         }
 
-        bool registered_spring_edge_map = false;
-        for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
+        if (!d_use_distributed_vertices)
         {
-            if (d_spring_edge_map[level_number][j].size() > 0)
+            for (unsigned int j = 0; j < d_num_vertex[level_number].size(); ++j)
             {
-                registered_spring_edge_map = true;
-                const std::string postfix = "_mesh";
-                d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_spring_edge_map[level_number][j], level_number);
+                registerSpringMesh(level_number, j);
             }
         }
 
@@ -1361,8 +1453,17 @@ IBRedundantInitializer::initializeLSiloDataWriter(const int level_number)
             if (d_xspring_edge_map[level_number][j].size() > 0)
             {
                 const std::string postfix = "_xmesh";
-                d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_xspring_edge_map[level_number][j], level_number);
+                const std::string mesh_name = d_base_filename[level_number][j] + postfix;
+                if (d_silo_writer)
+                {
+                    d_silo_writer->registerUnstructuredMesh(
+                        mesh_name, d_xspring_edge_map[level_number][j], level_number);
+                }
+                if (d_hdf5_writer)
+                {
+                    d_hdf5_writer->registerUnstructuredMesh(
+                        mesh_name, d_xspring_edge_map[level_number][j], level_number);
+                }
             }
         }
 
@@ -1371,13 +1472,163 @@ IBRedundantInitializer::initializeLSiloDataWriter(const int level_number)
             if (d_rod_edge_map[level_number][j].size() > 0)
             {
                 const std::string postfix = registered_spring_edge_map ? "_rod_mesh" : "_mesh";
-                d_silo_writer->registerUnstructuredMesh(
-                    d_base_filename[level_number][j] + postfix, d_rod_edge_map[level_number][j], level_number);
+                const std::string mesh_name = d_base_filename[level_number][j] + postfix;
+                if (d_silo_writer)
+                {
+                    d_silo_writer->registerUnstructuredMesh(mesh_name, d_rod_edge_map[level_number][j], level_number);
+                }
+                if (d_hdf5_writer)
+                {
+                    d_hdf5_writer->registerUnstructuredMesh(mesh_name, d_rod_edge_map[level_number][j], level_number);
+                }
+            }
+        }
+    }
+    return;
+} // initializeLagrangianDataWriters
+
+void
+IBRedundantInitializer::registerSpringMesh(const int level_number, const unsigned int j)
+{
+    const std::multimap<int, Edge>& spring_edge_map = d_spring_edge_map[level_number][j];
+    if (spring_edge_map.empty()) return;
+    const std::string mesh_name = d_base_filename[level_number][j] + "_mesh";
+    if (d_silo_writer) d_silo_writer->registerUnstructuredMesh(mesh_name, spring_edge_map, level_number);
+    if (d_hdf5_writer) d_hdf5_writer->registerUnstructuredMesh(mesh_name, spring_edge_map, level_number);
+    return;
+} // registerSpringMesh
+
+void
+IBRedundantInitializer::distributeVertexData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                             const int patch_level_number,
+                                             const int vertex_level_number)
+{
+    if (!d_use_distributed_vertices) return;
+
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(patch_level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
+    const Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+    const ProcessorMapping& processor_mapping = level->getProcessorMapping();
+
+    // Pack each vertex that is located in a patch owned by another process,
+    // along with the springs that it owns, as
+    //
+    //    j, k, X, num_springs, [slave_idx, force_fcn_idx, num_params, params]
+    //
+    // and remove it from the local data.
+    std::vector<std::vector<double> > send_data(nodes);
+    for (unsigned int j = 0; j < d_local_vertex_posn[vertex_level_number].size(); ++j)
+    {
+        LocalVertexMap& local_vertices = d_local_vertex_posn[vertex_level_number][j];
+        std::multimap<int, Edge>& spring_edge_map = d_spring_edge_map[vertex_level_number][j];
+        std::map<Edge, SpringSpec, EdgeComp>& spring_spec_data = d_spring_spec_data[vertex_level_number][j];
+        for (auto it = local_vertices.begin(); it != local_vertices.end();)
+        {
+            const std::pair<int, int> point_index(j, it->first);
+            const Point X =
+                getShiftedVertexPosn(point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
+            const CellIndex<NDIM> idx = IndexUtilities::getAssignedCellIndex(X, grid_geom, ratio);
+            Array<int> patch_nums;
+            box_tree->findOverlapIndices(patch_nums, Box<NDIM>(idx, idx));
+            const int owner = patch_nums.size() > 0 ? processor_mapping.getProcessorAssignment(patch_nums[0]) : rank;
+            if (owner == rank)
+            {
+                ++it;
+                continue;
+            }
+
+            std::vector<double>& buffer = send_data[owner];
+            buffer.push_back(j);
+            buffer.push_back(it->first);
+            buffer.insert(buffer.end(), it->second.data(), it->second.data() + NDIM);
+            const int mastr_idx = getCanonicalLagrangianIndex(point_index, vertex_level_number);
+            const auto range = spring_edge_map.equal_range(mastr_idx);
+            buffer.push_back(std::distance(range.first, range.second));
+            for (auto e_it = range.first; e_it != range.second; ++e_it)
+            {
+                const auto spec_it = spring_spec_data.find(e_it->second);
+                const SpringSpec& spec_data = spec_it->second;
+                buffer.push_back(e_it->second.second);
+                buffer.push_back(spec_data.force_fcn_idx);
+                buffer.push_back(spec_data.parameters.size());
+                buffer.insert(buffer.end(), spec_data.parameters.begin(), spec_data.parameters.end());
+                spring_spec_data.erase(spec_it);
             }
+            spring_edge_map.erase(range.first, range.second);
+            it = local_vertices.erase(it);
         }
     }
+
+    // Unpack the vertices sent to this process.
+    std::vector<double> recv_data;
+    exchangeData(send_data, recv_data);
+    std::size_t pos = 0;
+    while (pos < recv_data.size())
+    {
+        const auto j = static_cast<int>(recv_data[pos++]);
+        const auto k = static_cast<int>(recv_data[pos++]);
+        Point X;
+        std::copy(&recv_data[pos], &recv_data[pos] + NDIM, X.data());
+        pos += NDIM;
+        d_local_vertex_posn[vertex_level_number][j][k] = X;
+        const int mastr_idx = getCanonicalLagrangianIndex(std::make_pair(j, k), vertex_level_number);
+        const auto num_springs = static_cast<int>(recv_data[pos++]);
+        for (int s = 0; s < num_springs; ++s)
+        {
+            const Edge e(mastr_idx, static_cast<int>(recv_data[pos++]));
+            SpringSpec spec_data;
+            spec_data.force_fcn_idx = static_cast<int>(recv_data[pos++]);
+            const auto num_params = static_cast<std::size_t>(recv_data[pos++]);
+            spec_data.parameters.assign(&recv_data[pos], &recv_data[pos] + num_params);
+            pos += num_params;
+            d_spring_edge_map[vertex_level_number][j].insert(std::make_pair(e.first, e));
+            d_spring_spec_data[vertex_level_number][j][e] = spec_data;
+        }
+    }
+    return;
+} // distributeVertexData
+
+void
+IBRedundantInitializer::exchangeData(const std::vector<std::vector<double> >& send_data, std::vector<double>& recv_data)
+{
+    const int nodes = IBTK_MPI::getNodes();
+    MPI_Comm communicator = IBTK_MPI::getCommunicator();
+    std::vector<int> send_counts(nodes), send_displs(nodes, 0), recv_counts(nodes), recv_displs(nodes, 0);
+    for (int r = 0; r < nodes; ++r)
+    {
+        send_counts[r] = static_cast<int>(send_data[r].size());
+        if (r > 0) send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+    }
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, communicator);
+    for (int r = 1; r < nodes; ++r)
+    {
+        recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+    }
+
+    std::vector<double> send_buffer;
+    send_buffer.reserve(send_displs[nodes - 1] + send_counts[nodes - 1]);
+    for (const auto& buffer : send_data)
+    {
+        send_buffer.insert(send_buffer.end(), buffer.begin(), buffer.end());
+    }
+    recv_data.resize(recv_displs[nodes - 1] + recv_counts[nodes - 1]);
+    MPI_Alltoallv(send_buffer.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  MPI_DOUBLE,
+                  recv_data.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  MPI_DOUBLE,
+                  communicator);
     return;
-} // initializeLSiloDataWriter
+} // exchangeData
 
 void
 IBRedundantInitializer::getPatchVertices(std::vector<std::pair<int, int> >& patch_vertices,
@@ -1422,6 +1673,24 @@ IBRedundantInitializer::getPatchVerticesAtLevel(std::vector<std::pair<int, int>
     // NOTE: This is clearly not the best way to do this, but it will work for
     // now.
     const Box<NDIM>& patch_box = patch->getBox();
+    if (d_use_distributed_vertices)
+    {
+        for (unsigned int j = 0; j < d_local_vertex_posn[vertex_level_number].size(); ++j)
+        {
+            for (const auto& vertex : d_local_vertex_posn[vertex_level_number][j])
+            {
+                std::pair<int, int> point_index(j, vertex.first);
+                const Point& X = getShiftedVertexPosn(
+                    point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
+                CellIndex<NDIM> idx = IndexUtilities::getAssignedCellIndex(X, grid_geom, ratio);
+                if (patch_box.contains(idx))
+                {
+                    patch_vertices.push_back(point_index);
+                }
+            }
+        }
+        return;
+    }
     for (unsigned int j = 0; j < d_num_vertex[vertex_level_number].size(); ++j)
     {
         for (int k = 0; k < d_num_vertex[vertex_level_number][j]; ++k)
@@ -1449,6 +1718,15 @@ IBRedundantInitializer::getCanonicalLagrangianIndex(const std::pair<int, int>& p
 Point
 IBRedundantInitializer::getVertexPosn(const std::pair<int, int>& point_index, const int level_number) const
 {
+    if (d_use_distributed_vertices)
+    {
+        const LocalVertexMap& local_vertices = d_local_vertex_posn[level_number][point_index.first];
+        const auto it = local_vertices.find(point_index.second);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(it != local_vertices.end());
+#endif
+        return it->second;
+    }
     return d_vertex_posn[level_number][point_index.first][point_index.second];
 } // getVertexPosn
 
@@ -1727,6 +2005,7 @@ IBRedundantInitializer::getFromInput(Pointer<Database> db)
     d_num_vertex.resize(d_max_levels);
     d_vertex_offset.resize(d_max_levels);
     d_vertex_posn.resize(d_max_levels);
+    d_local_vertex_posn.resize(d_max_levels);
     d_spring_edge_map.resize(d_max_levels);
     d_spring_spec_data.resize(d_max_levels);
     d_xspring_edge_map.resize(d_max_levels);
@@ -111,6 +111,57 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+// Accumulate the forces generated by a group of springs whose parameters are
+// stored contiguously.  The springs are evaluated in blocks: the spring forces
+// are first computed into a temporary array (a loop without indirect writes
+// that the compiler is able to vectorize) and then accumulated into the force
+// vector.  The tension function is a template parameter so that it is inlined
+// into the blocked loop.
+template <class TensionFcn>
+void
+accumulate_contiguous_spring_forces(double* const F_node,
+                                    const double* const X_node,
+                                    const int num_springs,
+                                    const int* const mastr_idxs,
+                                    const int* const slave_idxs,
+                                    const TensionFcn& tension_fcn)
+{
+    static const int BLOCKSIZE = 64;
+    double D[NDIM * BLOCKSIZE];
+    for (int k_begin = 0; k_begin < num_springs; k_begin += BLOCKSIZE)
+    {
+        const int n = std::min(BLOCKSIZE, num_springs - k_begin);
+        for (int j = 0; j < n; ++j)
+        {
+            const int mastr_idx = mastr_idxs[k_begin + j];
+            const int slave_idx = slave_idxs[k_begin + j];
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+            for (int d = 0; d < NDIM; ++d) D[NDIM * j + d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+        }
+        for (int j = 0; j < n; ++j)
+        {
+            double R_sq = 0.0;
+            for (int d = 0; d < NDIM; ++d) R_sq += D[NDIM * j + d] * D[NDIM * j + d];
+            const double R = std::sqrt(R_sq);
+            const double T_over_R = R < std::numeric_limits<double>::epsilon() ? 0.0 : tension_fcn(k_begin + j, R) / R;
+            for (int d = 0; d < NDIM; ++d) D[NDIM * j + d] *= T_over_R;
+        }
+        for (int j = 0; j < n; ++j)
+        {
+            const int mastr_idx = mastr_idxs[k_begin + j];
+            const int slave_idx = slave_idxs[k_begin + j];
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F_node[mastr_idx + d] += D[NDIM * j + d];
+                F_node[slave_idx + d] -= D[NDIM * j + d];
+            }
+        }
+    }
+    return;
+} // accumulate_contiguous_spring_forces
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -125,6 +176,8 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("use_contiguous_force_data"))
+            d_use_contiguous_force_data = input_db->getBool("use_contiguous_force_data");
     }
     return;
 } // IBStandardForceGen
@@ -139,6 +192,13 @@ IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
     return;
 } // registerSpringForceFunction
 
+void
+IBStandardForceGen::markForceParametersModified()
+{
+    std::fill(d_contiguous_force_data_is_current.begin(), d_contiguous_force_data_is_current.end(), false);
+    return;
+} // markForceParametersModified
+
 void
 IBStandardForceGen::setUniformBodyForce(IBTK::Vector F, int structure_id, int level_number)
 {
@@ -169,6 +229,7 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
     d_F_ghost_data.resize(new_size);
     d_dX_data.resize(new_size);
     d_is_initialized.resize(new_size, false);
+    d_contiguous_force_data_is_current.resize(new_size, false);
 
     // Keep track of all of the nonlocal PETSc indices required to compute the
     // forces.
@@ -244,6 +305,9 @@ IBStandardForceGen::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hie
         std::for_each(v_ptr->begin(), v_ptr->end(), [](int& i) { i *= NDIM; });
     }
 
+    // Setup the data used by the specialized force kernels.
+    if (d_use_contiguous_force_data) initializeContiguousForceData(level_number);
+
     // Indicate that the level data has been initialized.
     d_is_initialized[level_number] = true;
     return;
@@ -281,6 +345,13 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
 
+    // Refresh the contiguous copies of the force parameters if they have been
+    // modified since they were last copied.
+    if (d_use_contiguous_force_data && !d_contiguous_force_data_is_current[level_number])
+    {
+        updateContiguousForceData(level_number);
+    }
+
     // Compute the forces.
     computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
     computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
@@ -830,6 +901,14 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
+    if (d_use_contiguous_force_data)
+    {
+        computeContiguousSpringForce(F_node, X_node, level_number);
+        F_data->restoreArrays();
+        X_data->restoreArrays();
+        return;
+    }
+
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
     int k, kblock, kunroll, mastr_idx, slave_idx;
     double F[NDIM], D[NDIM], R, T_over_R;
@@ -1051,6 +1130,14 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
+    if (d_use_contiguous_force_data)
+    {
+        computeContiguousBeamForce(F_node, X_node, level_number);
+        F_data->restoreArrays();
+        X_data->restoreArrays();
+        return;
+    }
+
     static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
     int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
     double K;
@@ -1219,6 +1306,20 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     const double* const X_node = X_data->getLocalFormVecArray()->data();
     const double* const U_node = U_data->getLocalFormVecArray()->data();
 
+    if (d_use_contiguous_force_data)
+    {
+        max_displacement = computeContiguousTargetPointForce(F_node, X_node, U_node, level_number);
+        if (d_log_target_point_displacements)
+        {
+            max_displacement = IBTK_MPI::maxReduction(max_displacement);
+            plog << "IBStandardForceGen: maximum target point displacement: " << max_displacement << "\n";
+        }
+        F_data->restoreArrays();
+        X_data->restoreArrays();
+        U_data->restoreArrays();
+        return;
+    }
+
     static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
     int k, kblock, kunroll, idx;
     double K, E, dX;
@@ -1297,6 +1398,242 @@ IBStandardForceGen::computeLagrangianTargetPointForce(Pointer<LData> F_data,
     return;
 } // computeLagrangianTargetPointForce
 
+void
+IBStandardForceGen::initializeContiguousForceData(const int level_number)
+{
+    // Springs that use the built-in linear and stiff linear force functions
+    // are evaluated by specialized kernels that do not require an indirect
+    // function call.
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_springs = static_cast<int>(spring_data.petsc_mastr_node_idxs.size());
+    spring_data.linear_spring_idxs.clear();
+    spring_data.linear_petsc_mastr_node_idxs.clear();
+    spring_data.linear_petsc_slave_node_idxs.clear();
+    spring_data.stiff_linear_spring_idxs.clear();
+    spring_data.stiff_linear_petsc_mastr_node_idxs.clear();
+    spring_data.stiff_linear_petsc_slave_node_idxs.clear();
+    spring_data.generic_spring_idxs.clear();
+    for (int k = 0; k < num_springs; ++k)
+    {
+        if (spring_data.force_fcns[k] == &default_spring_force)
+        {
+            spring_data.linear_spring_idxs.push_back(k);
+            spring_data.linear_petsc_mastr_node_idxs.push_back(spring_data.petsc_mastr_node_idxs[k]);
+            spring_data.linear_petsc_slave_node_idxs.push_back(spring_data.petsc_slave_node_idxs[k]);
+        }
+        else if (spring_data.force_fcns[k] == &stiff_linear_spring_force)
+        {
+            spring_data.stiff_linear_spring_idxs.push_back(k);
+            spring_data.stiff_linear_petsc_mastr_node_idxs.push_back(spring_data.petsc_mastr_node_idxs[k]);
+            spring_data.stiff_linear_petsc_slave_node_idxs.push_back(spring_data.petsc_slave_node_idxs[k]);
+        }
+        else
+        {
+            spring_data.generic_spring_idxs.push_back(k);
+        }
+    }
+    updateContiguousForceData(level_number);
+    return;
+} // initializeContiguousForceData
+
+void
+IBStandardForceGen::updateContiguousForceData(const int level_number)
+{
+    // The parameters are gathered from the force specification objects when
+    // the level data are initialized and after markForceParametersModified()
+    // is called.
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_linear_springs = static_cast<int>(spring_data.linear_spring_idxs.size());
+    spring_data.linear_stiffnesses.resize(num_linear_springs);
+    spring_data.linear_rest_lengths.resize(num_linear_springs);
+    for (int j = 0; j < num_linear_springs; ++j)
+    {
+        const double* const parameters = spring_data.parameters[spring_data.linear_spring_idxs[j]];
+        spring_data.linear_stiffnesses[j] = parameters[0];
+        spring_data.linear_rest_lengths[j] = parameters[1];
+    }
+    const int num_stiff_linear_springs = static_cast<int>(spring_data.stiff_linear_spring_idxs.size());
+    spring_data.stiff_linear_stiffnesses.resize(num_stiff_linear_springs);
+    spring_data.stiff_linear_rest_lengths.resize(num_stiff_linear_springs);
+    spring_data.stiff_linear_threshold_stretches.resize(num_stiff_linear_springs);
+    spring_data.stiff_linear_stiffening_ratios.resize(num_stiff_linear_springs);
+    for (int j = 0; j < num_stiff_linear_springs; ++j)
+    {
+        const double* const parameters = spring_data.parameters[spring_data.stiff_linear_spring_idxs[j]];
+        spring_data.stiff_linear_stiffnesses[j] = parameters[0];
+        spring_data.stiff_linear_rest_lengths[j] = parameters[1];
+        spring_data.stiff_linear_threshold_stretches[j] = parameters[2] * parameters[1];
+        spring_data.stiff_linear_stiffening_ratios[j] = parameters[3];
+    }
+
+    BeamData& beam_data = d_beam_data[level_number];
+    const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+    beam_data.contiguous_rigidities.resize(num_beams);
+    beam_data.contiguous_curvatures.resize(NDIM * num_beams);
+    for (int k = 0; k < num_beams; ++k)
+    {
+        beam_data.contiguous_rigidities[k] = *beam_data.rigidities[k];
+        for (int d = 0; d < NDIM; ++d) beam_data.contiguous_curvatures[NDIM * k + d] = (*beam_data.curvatures[k])[d];
+    }
+
+    TargetPointData& target_point_data = d_target_point_data[level_number];
+    const int num_target_points = static_cast<int>(target_point_data.petsc_node_idxs.size());
+    target_point_data.contiguous_kappa.resize(num_target_points);
+    target_point_data.contiguous_eta.resize(num_target_points);
+    target_point_data.contiguous_X0.resize(NDIM * num_target_points);
+    for (int k = 0; k < num_target_points; ++k)
+    {
+        target_point_data.contiguous_kappa[k] = *target_point_data.kappa[k];
+        target_point_data.contiguous_eta[k] = *target_point_data.eta[k];
+        for (int d = 0; d < NDIM; ++d) target_point_data.contiguous_X0[NDIM * k + d] = (*target_point_data.X0[k])[d];
+    }
+    d_contiguous_force_data_is_current[level_number] = true;
+    return;
+} // updateContiguousForceData
+
+void
+IBStandardForceGen::computeContiguousSpringForce(double* const F_node,
+                                                 const double* const X_node,
+                                                 const int level_number)
+{
+    const SpringData& spring_data = d_spring_data[level_number];
+
+    // Evaluate the linear springs.
+    const double* const stiffnesses = spring_data.linear_stiffnesses.data();
+    const double* const rest_lengths = spring_data.linear_rest_lengths.data();
+    accumulate_contiguous_spring_forces(F_node,
+                                        X_node,
+                                        static_cast<int>(spring_data.linear_petsc_mastr_node_idxs.size()),
+                                        spring_data.linear_petsc_mastr_node_idxs.data(),
+                                        spring_data.linear_petsc_slave_node_idxs.data(),
+                                        [stiffnesses, rest_lengths](const int k, const double R)
+                                        { return stiffnesses[k] * (R - rest_lengths[k]); });
+
+    // Evaluate the stiff linear springs.  The tension is written without a
+    // branch so that the loop remains vectorizable.
+    const double* const stiff_stiffnesses = spring_data.stiff_linear_stiffnesses.data();
+    const double* const stiff_rest_lengths = spring_data.stiff_linear_rest_lengths.data();
+    const double* const threshold_stretches = spring_data.stiff_linear_threshold_stretches.data();
+    const double* const stiffening_ratios = spring_data.stiff_linear_stiffening_ratios.data();
+    accumulate_contiguous_spring_forces(
+        F_node,
+        X_node,
+        static_cast<int>(spring_data.stiff_linear_petsc_mastr_node_idxs.size()),
+        spring_data.stiff_linear_petsc_mastr_node_idxs.data(),
+        spring_data.stiff_linear_petsc_slave_node_idxs.data(),
+        [stiff_stiffnesses, stiff_rest_lengths, threshold_stretches, stiffening_ratios](const int k, const double R)
+        {
+            const double stretch = R - stiff_rest_lengths[k];
+            const double excess_stretch = std::max(stretch - threshold_stretches[k], 0.0);
+            return stiff_stiffnesses[k] * (stretch + (stiffening_ratios[k] - 1.0) * excess_stretch);
+        });
+
+    // Evaluate the remaining springs via their force functions.
+    for (const int k : spring_data.generic_spring_idxs)
+    {
+        const int mastr_idx = spring_data.petsc_mastr_node_idxs[k];
+        const int slave_idx = spring_data.petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+        double F[NDIM];
+        double R_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+            R_sq += F[d] * F[d];
+        }
+        const double R = std::sqrt(R_sq);
+        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
+        const double T_over_R = (spring_data.force_fcns[k])(R,
+                                                            spring_data.parameters[k],
+                                                            spring_data.lag_mastr_node_idxs[k],
+                                                            spring_data.lag_slave_node_idxs[k]) /
+                                R;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            F_node[mastr_idx + d] += T_over_R * F[d];
+            F_node[slave_idx + d] -= T_over_R * F[d];
+        }
+    }
+    return;
+} // computeContiguousSpringForce
+
+void
+IBStandardForceGen::computeContiguousBeamForce(double* const F_node,
+                                               const double* const X_node,
+                                               const int level_number)
+{
+    const BeamData& beam_data = d_beam_data[level_number];
+    static const int BLOCKSIZE = 64;
+    const int num_beams = static_cast<int>(beam_data.petsc_mastr_node_idxs.size());
+    const int* const mastr_idxs = beam_data.petsc_mastr_node_idxs.data();
+    const int* const next_idxs = beam_data.petsc_next_node_idxs.data();
+    const int* const prev_idxs = beam_data.petsc_prev_node_idxs.data();
+    const double* const rigidities = beam_data.contiguous_rigidities.data();
+    const double* const curvatures = beam_data.contiguous_curvatures.data();
+    double F[NDIM * BLOCKSIZE];
+    for (int k_begin = 0; k_begin < num_beams; k_begin += BLOCKSIZE)
+    {
+        const int n = std::min(BLOCKSIZE, num_beams - k_begin);
+        for (int j = 0; j < n; ++j)
+        {
+            const int k = k_begin + j;
+            const int mastr_idx = mastr_idxs[k];
+            const int next_idx = next_idxs[k];
+            const int prev_idx = prev_idxs[k];
+#if !defined(NDEBUG)
+            TBOX_ASSERT(mastr_idx != next_idx);
+            TBOX_ASSERT(mastr_idx != prev_idx);
+#endif
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F[NDIM * j + d] = rigidities[k] * (X_node[next_idx + d] + X_node[prev_idx + d] -
+                                                   2.0 * X_node[mastr_idx + d] - curvatures[NDIM * k + d]);
+            }
+        }
+        for (int j = 0; j < n; ++j)
+        {
+            const int k = k_begin + j;
+            for (int d = 0; d < NDIM; ++d)
+            {
+                F_node[mastr_idxs[k] + d] += 2.0 * F[NDIM * j + d];
+                F_node[next_idxs[k] + d] -= F[NDIM * j + d];
+                F_node[prev_idxs[k] + d] -= F[NDIM * j + d];
+            }
+        }
+    }
+    return;
+} // computeContiguousBeamForce
+
+double
+IBStandardForceGen::computeContiguousTargetPointForce(double* const F_node,
+                                                      const double* const X_node,
+                                                      const double* const U_node,
+                                                      const int level_number)
+{
+    const TargetPointData& target_point_data = d_target_point_data[level_number];
+    const int num_target_points = static_cast<int>(target_point_data.petsc_node_idxs.size());
+    const int* const idxs = target_point_data.petsc_node_idxs.data();
+    const double* const kappa = target_point_data.contiguous_kappa.data();
+    const double* const eta = target_point_data.contiguous_eta.data();
+    const double* const X0 = target_point_data.contiguous_X0.data();
+    double max_displacement_sq = 0.0;
+    for (int k = 0; k < num_target_points; ++k)
+    {
+        const int idx = idxs[k];
+        double dX_sq = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double dX = X0[NDIM * k + d] - X_node[idx + d];
+            F_node[idx + d] += kappa[k] * dX - eta[k] * U_node[idx + d];
+            dX_sq += dX * dX;
+        }
+        max_displacement_sq = std::max(max_displacement_sq, dX_sq);
+    }
+    return std::sqrt(max_displacement_sq);
+} // computeContiguousTargetPointForce
+
 void
 IBStandardForceGen::computeLagrangianBodyForce(Pointer<LData> F_data,
                                                Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
@@ -36,9 +36,17 @@
 #include "tbox/RestartManager.h"
 #include "tbox/Utilities.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <istream>
 #include <limits>
 #include <map>
@@ -85,6 +93,175 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Layout of the binary structure files. All values are stored in the native
+// byte order of the machine that wrote the file, which is recorded in the
+// header so that files written with a different byte order are rejected.
+// Every section starts at an offset that is a multiple of eight bytes.
+const char BINARY_FILE_MAGIC[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+const std::int32_t BINARY_FILE_VERSION = 2;
+const std::uint32_t BINARY_FILE_BYTE_ORDER_MARK = 0x01020304;
+
+// Flags stored in the header of a binary structure file.
+const std::int32_t BINARY_FILE_USES_GLOBAL_IDXS = 1;
+
+enum BinarySectionType : std::int32_t
+{
+    BINARY_VERTEX_SECTION = 1,
+    BINARY_SPRING_SECTION = 2,
+    BINARY_SPRING_PARAMETER_SECTION = 3
+};
+
+struct BinaryFileHeader
+{
+    char magic[8];
+    std::int32_t version;
+    std::uint32_t byte_order;
+    std::int32_t ndim;
+    std::int32_t num_sections;
+    std::int32_t flags;
+    std::int32_t reserved;
+};
+
+struct BinarySectionHeader
+{
+    std::int32_t type;
+    std::int32_t reserved;
+    std::int64_t count;
+    std::int64_t offset;
+    std::int64_t num_bytes;
+};
+
+struct BinarySpringRecord
+{
+    std::int32_t first;
+    std::int32_t second;
+    std::int32_t force_fcn_idx;
+    std::int32_t num_parameters;
+    std::int64_t parameter_offset;
+};
+
+/*!
+ * Read-only memory mapping of a file. Only the pages that are actually
+ * accessed are read from disk.
+ */
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& filename)
+    {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+        {
+            void* data = ::mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                d_data = static_cast<const char*>(data);
+                d_size = static_cast<std::size_t>(file_stat.st_size);
+            }
+        }
+        ::close(fd);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if (d_data) ::munmap(const_cast<char*>(d_data), d_size);
+    }
+
+    bool isOpen() const
+    {
+        return d_data != nullptr;
+    }
+
+    /*!
+     * Return the header of the file. Errors out if the file is not a valid
+     * binary structure file that can be read on this machine.
+     */
+    const BinaryFileHeader& getHeader(const std::string& filename, const std::string& object_name) const
+    {
+        if (d_size < sizeof(BinaryFileHeader))
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid binary structure file " << filename << std::endl);
+        }
+        const auto header = reinterpret_cast<const BinaryFileHeader*>(d_data);
+        if (std::memcmp(header->magic, BINARY_FILE_MAGIC, sizeof(BINARY_FILE_MAGIC)) != 0)
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid binary structure file " << filename << std::endl);
+        }
+        if (header->byte_order != BINARY_FILE_BYTE_ORDER_MARK)
+        {
+            TBOX_ERROR(object_name << ":\n  Binary structure file " << filename
+                                   << " was written on a machine with a different byte order" << std::endl);
+        }
+        if (header->version != BINARY_FILE_VERSION)
+        {
+            TBOX_ERROR(object_name << ":\n  Binary structure file " << filename << " has format version "
+                                   << header->version << " but version " << BINARY_FILE_VERSION
+                                   << " is required" << std::endl);
+        }
+        if (header->ndim != NDIM)
+        {
+            TBOX_ERROR(object_name << ":\n  Binary structure file " << filename << " was written for NDIM = "
+                                   << header->ndim << std::endl);
+        }
+        if (header->num_sections < 0 ||
+            sizeof(BinaryFileHeader) + header->num_sections * sizeof(BinarySectionHeader) > d_size)
+        {
+            TBOX_ERROR(object_name << ":\n  Invalid binary structure file " << filename << std::endl);
+        }
+        return *header;
+    }
+
+    /*!
+     * Return the header of the section of the given type, or nullptr if the
+     * file does not contain such a section. Errors out if the file is not a
+     * valid binary structure file.
+     */
+    const BinarySectionHeader* getSection(const BinarySectionType type,
+                                          const std::string& filename,
+                                          const std::string& object_name) const
+    {
+        const BinaryFileHeader& header = getHeader(filename, object_name);
+        const auto sections = reinterpret_cast<const BinarySectionHeader*>(d_data + sizeof(BinaryFileHeader));
+        for (int k = 0; k < header.num_sections; ++k)
+        {
+            if (sections[k].type != type) continue;
+            if (sections[k].offset < 0 || sections[k].offset % 8 != 0 || sections[k].num_bytes < 0 ||
+                static_cast<std::size_t>(sections[k].offset + sections[k].num_bytes) > d_size)
+            {
+                TBOX_ERROR(object_name << ":\n  Truncated binary structure file " << filename << std::endl);
+            }
+            return &sections[k];
+        }
+        return nullptr;
+    }
+
+    template <class T>
+    const T* getSectionData(const BinarySectionHeader& section) const
+    {
+        return reinterpret_cast<const T*>(d_data + section.offset);
+    }
+
+private:
+    const char* d_data = nullptr;
+    std::size_t d_size = 0;
+};
+
+// Return the range of the n entries of a binary section read by this MPI
+// process when the structure data are distributed.
+std::pair<std::int64_t, std::int64_t>
+get_binary_slice(const std::int64_t n)
+{
+    const std::int64_t rank = IBTK_MPI::getRank();
+    const std::int64_t nodes = IBTK_MPI::getNodes();
+    return std::make_pair((n * rank) / nodes, (n * (rank + 1)) / nodes);
+} // get_binary_slice
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -168,6 +345,9 @@ IBStandardInitializer::init()
 
         // Process the source information.
         readSourceFiles(".source");
+
+        // Convert the ASCII input into binary structure files, if requested.
+        if (d_write_binary_structure_files) writeBinaryStructureFiles(".ibstruct");
     }
 
     // Indicate that we have processed data.
@@ -195,8 +375,17 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
         d_num_vertex[ln].resize(num_base_filename, 0);
         d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
         d_vertex_posn[ln].resize(num_base_filename);
+        d_local_vertex_posn[ln].resize(num_base_filename);
         for (unsigned int j = 0; j < num_base_filename; ++j)
         {
+            if (d_use_binary_structure_files)
+            {
+                // Memory-mapped files can be read by all processes at once.
+                d_vertex_offset[ln][j] = (j == 0 ? 0 : d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1]);
+                readBinaryVertexFile(ln, j, d_base_filename[ln][j] + ".ibstruct");
+                continue;
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) IBTK_MPI::recv(&flag, sz, rank - 1, false, j);
 
@@ -289,10 +478,76 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
     }
 
     // Synchronize the processes.
-    if (d_use_file_batons) IBTK_MPI::barrier();
+    if (d_use_file_batons && !d_use_binary_structure_files) IBTK_MPI::barrier();
     return;
 } // readVertexFiles
 
+void
+IBStandardInitializer::readBinaryVertexFile(const int ln, const unsigned int j, const std::string& filename)
+{
+    MappedFile file(filename);
+    if (!file.isOpen())
+    {
+        TBOX_ERROR(d_object_name << ":\n  Cannot find required binary structure file: " << filename << std::endl);
+    }
+    const BinarySectionHeader* section = file.getSection(BINARY_VERTEX_SECTION, filename, d_object_name);
+    if (!section || section->count <= 0 ||
+        section->num_bytes != static_cast<std::int64_t>(section->count * NDIM * sizeof(double)))
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid vertex data in binary structure file " << filename << std::endl);
+    }
+
+    d_num_vertex[ln][j] = static_cast<int>(section->count);
+    const double* const posn_data = file.getSectionData<double>(*section);
+    if (d_use_distributed_vertices)
+    {
+        // Each process reads only its own contiguous range of vertices. Only
+        // the pages of the file in that range are read from disk.
+        const std::pair<int, int> range = getDistributedVertexRange(d_num_vertex[ln][j], IBTK_MPI::getRank());
+        LocalVertexMap& local_vertices = d_local_vertex_posn[ln][j];
+        for (int k = range.first; k < range.second; ++k)
+        {
+            Point& X = local_vertices[k];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X[d] = d_length_scale_factor * (posn_data[k * NDIM + d] + d_posn_shift[d]);
+            }
+        }
+
+        plog << d_object_name << ":  "
+             << "read vertices " << range.first << " to " << range.second - 1 << " of " << d_num_vertex[ln][j]
+             << " from binary input file named " << filename << std::endl
+             << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+        return;
+    }
+
+    // Otherwise, every process needs all of the vertices. Each process reads
+    // them directly from its own mapping of the file, which needs no
+    // communication.
+    d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+    {
+        Point& X = d_vertex_posn[ln][j][k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = d_length_scale_factor * (posn_data[k * NDIM + d] + d_posn_shift[d]);
+        }
+    }
+
+    plog << d_object_name << ":  "
+         << "read " << d_num_vertex[ln][j] << " vertices from binary input file named " << filename << std::endl
+         << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+    return;
+} // readBinaryVertexFile
+
+std::pair<int, int>
+IBStandardInitializer::getDistributedVertexRange(const int num_vertex, const int rank) const
+{
+    const int nodes = IBTK_MPI::getNodes();
+    return std::make_pair(static_cast<int>(static_cast<std::int64_t>(num_vertex) * rank / nodes),
+                          static_cast<int>(static_cast<std::int64_t>(num_vertex) * (rank + 1) / nodes));
+} // getDistributedVertexRange
+
 void
 IBStandardInitializer::readSpringFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -317,6 +572,12 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                 (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
                                           d_num_vertex[ln][j]);
 
+            if (d_use_binary_structure_files)
+            {
+                readBinarySpringFile(ln, j, d_base_filename[ln][j] + ".ibstruct", input_uses_global_idxs);
+                continue;
+            }
+
             // Wait for the previous MPI process to finish reading the current file.
             if (d_use_file_batons && rank != 0) IBTK_MPI::recv(&flag, sz, rank - 1, false, j);
 
@@ -523,10 +784,280 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
     }
 
     // Synchronize the processes.
-    if (d_use_file_batons) IBTK_MPI::barrier();
+    if (d_use_file_batons && !d_use_binary_structure_files) IBTK_MPI::barrier();
     return;
 } // readSpringFiles
 
+void
+IBStandardInitializer::readBinarySpringFile(const int ln,
+                                            const unsigned int j,
+                                            const std::string& filename,
+                                            const bool input_uses_global_idxs)
+{
+    MappedFile file(filename);
+    if (!file.isOpen())
+    {
+        TBOX_ERROR(d_object_name << ":\n  Cannot find required binary structure file: " << filename << std::endl);
+    }
+    const BinarySectionHeader* section = file.getSection(BINARY_SPRING_SECTION, filename, d_object_name);
+    if (!section)
+    {
+        plog << d_object_name << ":  "
+             << "binary structure file " << filename << " contains no spring data: skipping read." << std::endl;
+        return;
+    }
+    const BinarySectionHeader* param_section =
+        file.getSection(BINARY_SPRING_PARAMETER_SECTION, filename, d_object_name);
+    if (!param_section ||
+        section->num_bytes != static_cast<std::int64_t>(section->count * sizeof(BinarySpringRecord)) ||
+        param_section->num_bytes != static_cast<std::int64_t>(param_section->count * sizeof(double)))
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid spring data in binary structure file " << filename << std::endl);
+    }
+
+    // The file records whether its vertex indices are local to the structure
+    // or global, which must agree with how this type of file is interpreted.
+    const bool file_uses_global_idxs = file.getHeader(filename, d_object_name).flags & BINARY_FILE_USES_GLOBAL_IDXS;
+    if (file_uses_global_idxs != input_uses_global_idxs)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Binary structure file " << filename << " uses "
+                                 << (file_uses_global_idxs ? "global" : "structure-local")
+                                 << " vertex indices but spring data require "
+                                 << (input_uses_global_idxs ? "global" : "structure-local") << " indices"
+                                 << std::endl);
+    }
+    const int min_idx = 0;
+    const int max_idx =
+        (input_uses_global_idxs ? std::accumulate(d_num_vertex[ln].begin(), d_num_vertex[ln].end(), 0) :
+                                  d_num_vertex[ln][j]);
+    const int idx_offset = input_uses_global_idxs ? 0 : d_vertex_offset[ln][j];
+
+    const auto records = file.getSectionData<BinarySpringRecord>(*section);
+    const double* const param_data = file.getSectionData<double>(*param_section);
+    bool warned = false;
+
+    // When vertex data is distributed, each process reads only its own
+    // contiguous range of spring records and sends each spring to the process
+    // that holds its first vertex. Otherwise, each process reads all of the
+    // spring records directly from its own mapping of the file.
+    const int nodes = IBTK_MPI::getNodes();
+    const std::pair<std::int64_t, std::int64_t> slice =
+        d_use_distributed_vertices ? get_binary_slice(section->count) :
+                                     std::pair<std::int64_t, std::int64_t>(0, section->count);
+    std::vector<std::vector<double> > send_data(d_use_distributed_vertices ? nodes : 0);
+    const auto get_owner = [&](const int lag_idx)
+    {
+        const unsigned int struct_idx = static_cast<unsigned int>(
+            std::upper_bound(d_vertex_offset[ln].begin(), d_vertex_offset[ln].end(), lag_idx) -
+            d_vertex_offset[ln].begin() - 1);
+        const int vertex_idx = lag_idx - d_vertex_offset[ln][struct_idx];
+        int owner = 0, upper = nodes;
+        while (upper - owner > 1)
+        {
+            const int mid = (owner + upper) / 2;
+            if (getDistributedVertexRange(d_num_vertex[ln][struct_idx], mid).first <= vertex_idx)
+            {
+                owner = mid;
+            }
+            else
+            {
+                upper = mid;
+            }
+        }
+        return owner;
+    };
+
+    for (std::int64_t k = slice.first; k < slice.second; ++k)
+    {
+        const BinarySpringRecord& record = records[k];
+        if (record.first < min_idx || record.first >= max_idx || record.second < min_idx ||
+            record.second >= max_idx || record.num_parameters < 2 || record.parameter_offset < 0 ||
+            record.parameter_offset + record.num_parameters > param_section->count)
+        {
+            TBOX_ERROR(d_object_name << ":\n  Invalid spring record " << k << " in binary structure file "
+                                     << filename << std::endl);
+        }
+
+        SpringSpec spec_data;
+        spec_data.parameters.assign(param_data + record.parameter_offset,
+                                    param_data + record.parameter_offset + record.num_parameters);
+        spec_data.parameters[1] *= d_length_scale_factor;
+        spec_data.force_fcn_idx = record.force_fcn_idx;
+
+        // Modify kappa and length according to whether uniform values are to
+        // be employed for this particular structure.
+        if (d_using_uniform_spring_stiffness[ln][j])
+        {
+            spec_data.parameters[0] = d_uniform_spring_stiffness[ln][j];
+        }
+        if (d_using_uniform_spring_rest_length[ln][j])
+        {
+            spec_data.parameters[1] = d_uniform_spring_rest_length[ln][j];
+        }
+        if (d_using_uniform_spring_force_fcn_idx[ln][j])
+        {
+            spec_data.force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+        }
+
+        if (!warned && d_enable_springs[ln][j] &&
+            (spec_data.parameters[0] == 0.0 || IBTK::abs_equal_eps(spec_data.parameters[0], 0.0)))
+        {
+            TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
+                                          "encountered in binary input file named "
+                                       << filename << "." << std::endl);
+            warned = true;
+        }
+
+        // Correct the edge numbers to be in the global Lagrangian indexing
+        // scheme. Edges are associated with their first vertex.
+        Edge e(record.first + idx_offset, record.second + idx_offset);
+        if (e.first > e.second) std::swap<int>(e.first, e.second);
+        if (!d_use_distributed_vertices)
+        {
+            if (d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data)).second)
+            {
+                d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+            }
+            continue;
+        }
+        std::vector<double>& buffer = send_data[get_owner(e.first)];
+        buffer.push_back(e.first);
+        buffer.push_back(e.second);
+        buffer.push_back(spec_data.force_fcn_idx);
+        buffer.push_back(spec_data.parameters.size());
+        buffer.insert(buffer.end(), spec_data.parameters.begin(), spec_data.parameters.end());
+    }
+
+    std::vector<double> recv_data;
+    if (d_use_distributed_vertices) exchangeData(send_data, recv_data);
+    std::size_t pos = 0;
+    while (pos < recv_data.size())
+    {
+        Edge e;
+        e.first = static_cast<int>(recv_data[pos++]);
+        e.second = static_cast<int>(recv_data[pos++]);
+        SpringSpec spec_data;
+        spec_data.force_fcn_idx = static_cast<int>(recv_data[pos++]);
+        const auto num_params = static_cast<std::size_t>(recv_data[pos++]);
+        spec_data.parameters.assign(&recv_data[pos], &recv_data[pos] + num_params);
+        pos += num_params;
+        if (d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data)).second)
+        {
+            d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        }
+    }
+
+    plog << d_object_name << ":  "
+         << "read edges " << slice.first << " to " << slice.second - 1 << " of " << section->count
+         << " from binary input file named " << filename << std::endl
+         << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+    return;
+} // readBinarySpringFile
+
+void
+IBStandardInitializer::writeBinaryStructureFiles(const std::string& extension)
+{
+    if (IBTK_MPI::getRank() != 0) return;
+
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        for (unsigned int j = 0; j < d_base_filename[ln].size(); ++j)
+        {
+            // Store the positions as they appear in the ASCII input files, so
+            // that the shift and scale factors are applied when reading.
+            std::vector<double> posn_data(d_num_vertex[ln][j] * NDIM);
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    posn_data[k * NDIM + d] = d_vertex_posn[ln][j][k][d] / d_length_scale_factor - d_posn_shift[d];
+                }
+            }
+
+            std::vector<BinarySpringRecord> spring_records;
+            std::vector<double> spring_params;
+            spring_records.reserve(d_spring_spec_data[ln][j].size());
+            for (const auto& edge_spec_pair : d_spring_spec_data[ln][j])
+            {
+                const Edge& e = edge_spec_pair.first;
+                const SpringSpec& spec_data = edge_spec_pair.second;
+                BinarySpringRecord record;
+                record.first = e.first - d_vertex_offset[ln][j];
+                record.second = e.second - d_vertex_offset[ln][j];
+                record.force_fcn_idx = spec_data.force_fcn_idx;
+                record.num_parameters = static_cast<std::int32_t>(spec_data.parameters.size());
+                record.parameter_offset = static_cast<std::int64_t>(spring_params.size());
+                spring_records.push_back(record);
+                spring_params.insert(spring_params.end(), spec_data.parameters.begin(), spec_data.parameters.end());
+                spring_params[record.parameter_offset + 1] /= d_length_scale_factor;
+            }
+
+            const bool has_springs = !spring_records.empty();
+            BinaryFileHeader header;
+            std::memcpy(header.magic, BINARY_FILE_MAGIC, sizeof(BINARY_FILE_MAGIC));
+            header.version = BINARY_FILE_VERSION;
+            header.byte_order = BINARY_FILE_BYTE_ORDER_MARK;
+            header.ndim = NDIM;
+            header.num_sections = has_springs ? 3 : 1;
+            // Spring vertex indices are local to the structure, as in the
+            // ASCII spring files.
+            header.flags = 0;
+            header.reserved = 0;
+
+            std::vector<BinarySectionHeader> sections(header.num_sections);
+            std::int64_t offset = sizeof(BinaryFileHeader) + header.num_sections * sizeof(BinarySectionHeader);
+            const auto set_section = [&offset](BinarySectionHeader& section,
+                                               const BinarySectionType type,
+                                               const std::size_t count,
+                                               const std::size_t num_bytes) {
+                section.type = type;
+                section.reserved = 0;
+                section.count = static_cast<std::int64_t>(count);
+                section.offset = offset;
+                section.num_bytes = static_cast<std::int64_t>(num_bytes);
+                offset += section.num_bytes;
+            };
+            set_section(sections[0], BINARY_VERTEX_SECTION, d_num_vertex[ln][j], posn_data.size() * sizeof(double));
+            if (has_springs)
+            {
+                set_section(sections[1],
+                            BINARY_SPRING_SECTION,
+                            spring_records.size(),
+                            spring_records.size() * sizeof(BinarySpringRecord));
+                set_section(sections[2],
+                            BINARY_SPRING_PARAMETER_SECTION,
+                            spring_params.size(),
+                            spring_params.size() * sizeof(double));
+            }
+
+            const std::string filename = d_base_filename[ln][j] + extension;
+            std::ofstream file_stream(filename, std::ios::binary);
+            if (!file_stream.is_open())
+            {
+                TBOX_ERROR(d_object_name << ":\n  Cannot open binary structure file " << filename
+                                         << " for writing." << std::endl);
+            }
+            file_stream.write(reinterpret_cast<const char*>(&header), sizeof(BinaryFileHeader));
+            file_stream.write(reinterpret_cast<const char*>(sections.data()),
+                              sections.size() * sizeof(BinarySectionHeader));
+            file_stream.write(reinterpret_cast<const char*>(posn_data.data()), posn_data.size() * sizeof(double));
+            if (has_springs)
+            {
+                file_stream.write(reinterpret_cast<const char*>(spring_records.data()),
+                                  spring_records.size() * sizeof(BinarySpringRecord));
+                file_stream.write(reinterpret_cast<const char*>(spring_params.data()),
+                                  spring_params.size() * sizeof(double));
+            }
+            file_stream.close();
+
+            plog << d_object_name << ":  "
+                 << "wrote " << d_num_vertex[ln][j] << " vertices and " << spring_records.size()
+                 << " edges to binary structure file named " << filename << std::endl;
+        }
+    }
+    return;
+} // writeBinaryStructureFiles
+
 void
 IBStandardInitializer::readXSpringFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -2578,6 +3109,38 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine the format of the vertex and spring input files and whether
+    // binary copies of the ASCII input files are to be written.
+    if (db->keyExists("structure_file_format"))
+    {
+        const std::string structure_file_format = db->getString("structure_file_format");
+        if (structure_file_format == "BINARY")
+        {
+            d_use_binary_structure_files = true;
+        }
+        else if (structure_file_format != "ASCII")
+        {
+            TBOX_ERROR(d_object_name << ":  "
+                                     << "Key data `structure_file_format' must be either ASCII or BINARY.");
+        }
+    }
+    d_write_binary_structure_files =
+        db->getBoolWithDefault("write_binary_structure_files", d_write_binary_structure_files);
+    if (d_use_binary_structure_files && d_write_binary_structure_files)
+    {
+        TBOX_ERROR(d_object_name << ":  "
+                                 << "Binary structure files can only be written from ASCII input files.");
+    }
+
+    // Determine whether the vertex and spring data are to be distributed among
+    // the MPI processes instead of being replicated on every process.
+    d_use_distributed_vertices = db->getBoolWithDefault("distribute_structure_data", d_use_distributed_vertices);
+    if (d_use_distributed_vertices && !d_use_binary_structure_files)
+    {
+        TBOX_ERROR(d_object_name << ":  "
+                                 << "Distributed structure data requires binary structure files.");
+    }
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
@@ -2605,6 +3168,7 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     d_num_vertex.resize(d_max_levels);
     d_vertex_offset.resize(d_max_levels);
     d_vertex_posn.resize(d_max_levels);
+    d_local_vertex_posn.resize(d_max_levels);
 
     d_enable_springs.resize(d_max_levels);
     d_spring_edge_map.resize(d_max_levels);
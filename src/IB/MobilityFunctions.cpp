@@ -684,6 +684,69 @@ MobilityFunctions::constructRPYMobilityMatrix(const char* IBKernelName,
     return;
 } // constructRPYMobilityMatrix
 
+void
+MobilityFunctions::applyRPYMobility(const char* IBKernelName,
+                                    const double MU,
+                                    const double DX,
+                                    const double* X,
+                                    const int N,
+                                    const double PERIODIC_CORRECTION,
+                                    const double* F,
+                                    double* U)
+{
+    HRad = getHydroRadius(IBKernelName) * DX;
+    const double mu_tt = 1. / (6.0 * M_PI * MU * HRad);
+
+    // Self mobility.
+    for (int row = 0; row < N * NDIM; row++)
+    {
+        U[row] = (mu_tt - PERIODIC_CORRECTION) * F[row];
+    }
+
+    // Pair mobility, evaluated on the fly for each pair and applied to both
+    // nodes of the pair.
+    double r_vec[NDIM];
+    for (int row = 0; row < N; row++)
+    {
+        for (int col = 0; col < row; col++)
+        {
+            int cdir;
+            for (cdir = 0; cdir < NDIM; cdir++)
+            {
+                r_vec[cdir] = X[row * NDIM + cdir] - X[col * NDIM + cdir]; // r(i) - r(j)
+            }
+
+            const double rsq = get_sqnorm(r_vec);
+            const double r = std::sqrt(rsq);
+            double diag_coef, rr_coef;
+            if (r <= 2.0 * HRad)
+            {
+                diag_coef = mu_tt * (1 - 9.0 / 32.0 * r / HRad) - PERIODIC_CORRECTION;
+                rr_coef = mu_tt / rsq * 3.0 * r / 32. / HRad;
+            }
+            else
+            {
+                double cube = HRad * HRad * HRad / r / r / r;
+                diag_coef = mu_tt * (3.0 / 4.0 * HRad / r + 1.0 / 2.0 * cube) - PERIODIC_CORRECTION;
+                rr_coef = mu_tt / rsq * (3.0 / 4.0 * HRad / r - 3.0 / 2.0 * cube);
+            }
+
+            double r_dot_F_col = 0.0, r_dot_F_row = 0.0;
+            for (cdir = 0; cdir < NDIM; cdir++)
+            {
+                r_dot_F_col += r_vec[cdir] * F[col * NDIM + cdir];
+                r_dot_F_row += r_vec[cdir] * F[row * NDIM + cdir];
+            }
+            for (cdir = 0; cdir < NDIM; cdir++)
+            {
+                U[row * NDIM + cdir] += diag_coef * F[col * NDIM + cdir] + rr_coef * r_vec[cdir] * r_dot_F_col;
+                U[col * NDIM + cdir] += diag_coef * F[row * NDIM + cdir] + rr_coef * r_vec[cdir] * r_dot_F_row;
+            }
+        } // column loop
+    }
+    return;
+} // applyRPYMobility
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -14,7 +14,9 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/NonbondedForceEvaluator.h"
+#include "ibamr/ibamr_utilities.h"
 
+#include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LIndexSetData.h"
@@ -32,11 +34,15 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "tbox/Database.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 #include "petscvec.h"
 #include <petscsys.h>
 
+#include <boost/multi_array.hpp>
+
 #include <assert.h>
 
 #include <algorithm>
@@ -51,6 +57,14 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Timers.
+static Timer* t_compute_lagrangian_force;
+static Timer* t_build_neighbor_list;
+static Timer* t_evaluate_neighbor_forces;
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
@@ -77,11 +91,25 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
         TBOX_ERROR("Must specify regrid_alpha for NonbondedForceEvaluator.");
     }
 
+    // get Verlet list options
+    if (input_db->keyExists("use_verlet_lists")) d_use_verlet_lists = input_db->getBool("use_verlet_lists");
+    if (input_db->keyExists("verlet_skin")) d_verlet_skin = input_db->getDouble("verlet_skin");
+    if (d_verlet_skin < 0.0) TBOX_ERROR("verlet_skin for NonbondedForceEvaluator must be nonnegative.");
+
     // this will only work if the domain is a single box.
     assert(d_grid_geometry->getDomainIsSingleBox());
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(
+        t_compute_lagrangian_force =
+            TimerManager::getManager()->getTimer("IBAMR::NonbondedForceEvaluator::computeLagrangianForce()");
+        t_build_neighbor_list =
+            TimerManager::getManager()->getTimer("IBAMR::NonbondedForceEvaluator::buildNeighborList()");
+        t_evaluate_neighbor_forces =
+            TimerManager::getManager()->getTimer("IBAMR::NonbondedForceEvaluator::evaluateNeighborForces()"););
 }
 
 void
@@ -106,38 +134,17 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //          F_data - pointer to LData object containing forces on particles.  Will
     //                   be added to by this function.
     //
+    //   NOTE: Forces on ghost nodes are not added to the nodes' owners.
+    //   This accesses the PETSc arrays for every pair. Use
+    //   evaluateNeighborForces() to evaluate the forces for many pairs at once.
+    //
     //////////////////////////////////////////////////////////////////////////////////
 
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
-    PetscScalar* position;
-    VecGetArray(X_data->getVec(), &position);
-    PetscScalar* force;
-    VecGetArray(F_data->getVec(), &force);
-
-    // get domain bounds
-    const double* x_lower = d_grid_geometry->getXLower();
-    const double* x_upper = d_grid_geometry->getXUpper();
-
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
-    for (int k = 0; k < NDIM; ++k)
-    {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += std::pow(D[k], 2);
-    }
-    R = std::sqrt(R);
-
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
-    {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
-    }
-    VecRestoreArray(F_data->getVec(), &force);
+    const double* const position = X_data->getGhostedLocalFormVecArray()->data();
+    double* const force = F_data->getGhostedLocalFormVecArray()->data();
+    evaluateForces(mstr_petsc_idx, search_petsc_idx, position, cell_offset.data(), force);
+    F_data->restoreArrays();
+    X_data->restoreArrays();
     return;
 } // evaluateForces
 
@@ -150,19 +157,73 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 const double /*data_time*/,
                                                 LDataManager* const l_data_manager)
 {
-    // Get grid geometry and relevant lower and upper limits.
+    IBAMR_TIMER_START(t_compute_lagrangian_force);
+
+    // Get grid geometry.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
 
+    // Nodes in the ghost cell region of the patches are indexed by their
+    // local PETSc indices, so we work with the ghosted local forms of the
+    // position and force data. The arrays are obtained once for all of the
+    // pairs.
+    X_data->beginGhostUpdate();
+    X_data->endGhostUpdate();
+    const double* const position = X_data->getGhostedLocalFormVecArray()->data();
+    double* const force = F_data->getGhostedLocalFormVecArray()->data();
+    const int local_size = NDIM * static_cast<int>(X_data->getLocalNodeCount());
+    const int ghosted_local_size = local_size + NDIM * static_cast<int>(X_data->getGhostNodeCount());
+    std::fill(force + local_size, force + ghosted_local_size, 0.0);
+
+    // Rebuild the neighbor list unless we may reuse the one from a previous
+    // call.
+    if (!d_use_verlet_lists ||
+        !neighborListIsCurrent(hierarchy, level_number, position, ghosted_local_size, l_data_manager))
+    {
+        buildNeighborList(hierarchy, level_number, position, ghosted_local_size, l_data_manager);
+    }
+
+    evaluateNeighborForces(position, force);
+
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+
+    // Add the forces on ghost nodes to the nodes' owners.
+    int ierr = VecGhostUpdateBegin(F_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostUpdateEnd(F_data->getVec(), ADD_VALUES, SCATTER_REVERSE);
+    IBTK_CHKERRQ(ierr);
+
+    IBAMR_TIMER_STOP(t_compute_lagrangian_force);
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::buildNeighborList(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           const double* const position,
+                                           const int ghosted_local_size,
+                                           LDataManager* const l_data_manager)
+{
+    IBAMR_TIMER_START(t_build_neighbor_list);
+
+    // Get grid geometry and relevant lower and upper limits.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+
     // These will only work if the domain is a single box.
     assert(grid_geom->getDomainIsSingleBox());
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
 
     // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(static_cast<int>(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
+    // (plus the Verlet skin when we retain the list across calls).
+    const double search_radius = d_interaction_radius + (d_use_verlet_lists ? d_verlet_skin : 0.0);
+    IntVector<NDIM> grow_amount(static_cast<int>(ceil(search_radius + 2.0 * d_regrid_alpha)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
+    d_neighbor_pairs.clear();
+    d_neighbor_lag_idxs.clear();
+
     // iterate through levels.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -172,8 +233,19 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
+        for (unsigned int d = 0; d < NDIM; ++d) d_neighbor_dx[d] = patch_dx[d];
+
+        // Record the nodes that the list refers to so that we can detect
+        // changes in the data distribution.
+        for (LNodeSetData::DataIterator it = current_idx_data->data_begin(current_idx_data->getGhostBox());
+             it != current_idx_data->data_end();
+             ++it)
+        {
+            d_neighbor_lag_idxs.push_back((*it)->getLagrangianIndex());
+            d_neighbor_lag_idxs.push_back((*it)->getLocalPETScIndex());
+        }
 
-        std::vector<int> cell_offset(NDIM);
+        NeighborPair pair;
         // Loop through cells in this processors patch. For each iteration, this
         // is the "master" cell. Iterate through particles in the box, and add
         // springs.
@@ -194,6 +266,8 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                     // point we know both cells, need to figure out periodic
                     // additions.
                     const hier::Index<NDIM>& search_cell_idx = *scit;
+                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
+                    if (!search_node_set) continue;
 
                     // search across periodic boundaries.
                     for (int k = 0; k < NDIM; ++k)
@@ -201,38 +275,67 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                         // Difference between lower boundary and this search cell.
                         double absolute_diff = search_cell_idx[k] * patch_dx[k];
                         // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
+                        pair.cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
                     }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+
+                    // we have a set of nodes in the first cell and the search
+                    // cell, record the pairs of nodes that interact.
+                    for (const auto& mstr_node_idx : *mstr_node_set)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (const auto& mstr_node_idx : *mstr_node_set)
-                        {
-                            // master nodes
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                        // master nodes
+                        const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                        pair.mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
 
-                            for (const auto& search_node_idx : *search_node_set)
+                        for (const auto& search_node_idx : *search_node_set)
+                        {
+                            const int search_lag_idx = search_node_idx->getLagrangianIndex();
+                            pair.search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                            if (mstr_lag_idx >= search_lag_idx) continue;
+
+                            // With Verlet lists, skip pairs that cannot
+                            // come within the interaction radius before the
+                            // list is rebuilt.
+                            if (d_use_verlet_lists)
                             {
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
+                                double R2 = 0.0;
+                                for (int k = 0; k < NDIM; ++k)
                                 {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
+                                    const double D = (position[pair.mstr_petsc_idx * NDIM + k] -
+                                                      position[pair.search_petsc_idx * NDIM + k] -
+                                                      pair.cell_offset[k] * (x_upper[k] - x_lower[k])) /
+                                                     patch_dx[k];
+                                    R2 += D * D;
                                 }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
+                                if (R2 > search_radius * search_radius) continue;
+                            }
+                            d_neighbor_pairs.push_back(pair);
+                        } // search node index
+                    }     // mstr node index
+                }         // search cell loop
+            }             // if mastr_node_idx
+        }                 // first cell
+    }                     // patches
+
+    // Record the positions of the local and ghost nodes at which the list was
+    // built.
+    d_neighbor_X.assign(position, position + ghosted_local_size);
+    d_neighbor_level_number = level_number;
+
+    IBAMR_TIMER_STOP(t_build_neighbor_list);
     return;
-} // computeLagrangianForce
+} // buildNeighborList
+
+void
+NonbondedForceEvaluator::evaluateNeighborForces(const double* const position, double* const force)
+{
+    IBAMR_TIMER_START(t_evaluate_neighbor_forces);
+    for (const NeighborPair& pair : d_neighbor_pairs)
+    {
+        evaluateForces(pair.mstr_petsc_idx, pair.search_petsc_idx, position, pair.cell_offset.data(), force);
+    }
+    IBAMR_TIMER_STOP(t_evaluate_neighbor_forces);
+    return;
+} // evaluateNeighborForces
 
 void
 NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
@@ -242,6 +345,84 @@ NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
     return;
 } // registerForceFcnPtr
 
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::evaluateForces(const int mstr_petsc_idx,
+                                        const int search_petsc_idx,
+                                        const double* const position,
+                                        const int* const cell_offset,
+                                        double* const force)
+{
+    // get domain bounds
+    const double* x_lower = d_grid_geometry->getXLower();
+    const double* x_upper = d_grid_geometry->getXUpper();
+
+    double D[NDIM]; // vector connecting particles.
+    for (int k = 0; k < NDIM; ++k)
+    {
+        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
+                cell_offset[k] * (x_upper[k] - x_lower[k]));
+    }
+
+    double nonbdd_force[NDIM];
+    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    for (int k = 0; k < NDIM; ++k)
+    {
+        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
+    }
+    return;
+} // evaluateForces
+
+bool
+NonbondedForceEvaluator::neighborListIsCurrent(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                               const int level_number,
+                                               const double* const position,
+                                               const int ghosted_local_size,
+                                               LDataManager* const l_data_manager) const
+{
+    if (level_number != d_neighbor_level_number) return false;
+    if (static_cast<int>(d_neighbor_X.size()) != ghosted_local_size) return false;
+
+    // The list is stale if the nodes have been redistributed.
+    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    std::size_t k = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
+        for (LNodeSetData::DataIterator it = current_idx_data->data_begin(current_idx_data->getGhostBox());
+             it != current_idx_data->data_end();
+             ++it)
+        {
+            if (k + 1 >= d_neighbor_lag_idxs.size() || d_neighbor_lag_idxs[k] != (*it)->getLagrangianIndex() ||
+                d_neighbor_lag_idxs[k + 1] != (*it)->getLocalPETScIndex())
+            {
+                return false;
+            }
+            k += 2;
+        }
+    }
+    if (k != d_neighbor_lag_idxs.size()) return false;
+
+    // The list is stale if any local or ghost node has moved by more than half
+    // of the skin width.
+    const double max_displacement = 0.5 * d_verlet_skin;
+    for (int i = 0; i < ghosted_local_size / NDIM; ++i)
+    {
+        double R2 = 0.0;
+        for (int d = 0; d < NDIM; ++d)
+        {
+            const double D = (position[i * NDIM + d] - d_neighbor_X[i * NDIM + d]) / d_neighbor_dx[d];
+            R2 += D * D;
+        }
+        if (R2 > max_displacement * max_displacement) return false;
+    }
+    return true;
+} // neighborListIsCurrent
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
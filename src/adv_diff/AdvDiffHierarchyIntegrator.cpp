@@ -1109,6 +1109,13 @@ AdvDiffHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     return;
 } // putToDatabaseSpecialized
 
+void
+AdvDiffHierarchyIntegrator::registerPerformanceReportValuesSpecialized()
+{
+    registerSolverIterationsWithPerformanceReport("helmholtz_solver");
+    return;
+} // registerPerformanceReportValuesSpecialized
+
 void
 AdvDiffHierarchyIntegrator::registerVariables()
 {
@@ -17,6 +17,7 @@
 
 #include "CellData.h"
 #include "CellIterator.h"
+#include "IntVector.h"
 #include "Patch.h"
 #include "tbox/Database.h"
 
@@ -63,28 +64,15 @@ CFGiesekusRelaxation::setDataOnPatch(const int data_idx,
     ret_data->fillAll(0.0);
     if (initial_time) return;
     const double l_inv = 1.0 / d_lambda;
+    CellData<NDIM, double> C_data(patch_box, NDIM * (NDIM + 1) / 2, IntVector<NDIM>(0));
+    convertPatchDataToConformation(*in_data, C_data, patch_box);
     for (CellIterator<NDIM> i(patch_box); i; i++)
     {
         const CellIndex<NDIM>& idx = i();
-        MatrixNd mat;
 #if (NDIM == 2)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 2);
-#endif
-#if (NDIM == 3)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(2, 2) = (*in_data)(idx, 2);
-        mat(1, 2) = mat(2, 1) = (*in_data)(idx, 3);
-        mat(0, 2) = mat(2, 0) = (*in_data)(idx, 4);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 5);
-#endif
-        mat = convertToConformation(mat);
-#if (NDIM == 2)
-        double Qxx = mat(0, 0);
-        double Qyy = mat(1, 1);
-        double Qxy = mat(0, 1);
+        double Qxx = C_data(idx, 0);
+        double Qyy = C_data(idx, 1);
+        double Qxy = C_data(idx, 2);
         (*ret_data)(idx, 0) =
             l_inv * (-1.0 * (d_alpha * (Qxx * Qxx + Qxy * Qxy) + (1.0 - 2.0 * d_alpha) * Qxx + (d_alpha - 1.0)));
         (*ret_data)(idx, 1) =
@@ -92,12 +80,12 @@ CFGiesekusRelaxation::setDataOnPatch(const int data_idx,
         (*ret_data)(idx, 2) = l_inv * (-1.0 * (d_alpha * (Qxx * Qxy + Qxy * Qyy) + (1.0 - 2.0 * d_alpha) * Qxy));
 #endif
 #if (NDIM == 3)
-        double Qxx = mat(0, 0);
-        double Qyy = mat(1, 1);
-        double Qzz = mat(2, 2);
-        double Qxy = mat(0, 1);
-        double Qxz = mat(0, 2);
-        double Qyz = mat(1, 2);
+        double Qxx = C_data(idx, 0);
+        double Qyy = C_data(idx, 1);
+        double Qzz = C_data(idx, 2);
+        double Qxy = C_data(idx, 5);
+        double Qxz = C_data(idx, 4);
+        double Qyz = C_data(idx, 3);
         (*ret_data)(idx, 0) = l_inv * (1.0 - Qxx - d_alpha * ((-1.0 + Qxx) * (-1.0 + Qxx) + Qxy * Qxy + Qxz * Qxz));
         (*ret_data)(idx, 1) = l_inv * (1.0 - Qyy - d_alpha * ((-1.0 + Qyy) * (-1.0 + Qyy) + Qxy * Qxy + Qyz * Qyz));
         (*ret_data)(idx, 2) = l_inv * (1.0 - Qzz - d_alpha * ((-1.0 + Qzz) * (-1.0 + Qzz) + Qxz * Qxz + Qyz * Qyz));
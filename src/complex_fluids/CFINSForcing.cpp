@@ -16,6 +16,7 @@
 #include "ibamr/CFOldroydBRelaxation.h"
 #include "ibamr/CFRelaxationOperator.h"
 #include "ibamr/CFRoliePolyRelaxation.h"
+#include "ibamr/CFTensorUtilities.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/INSHierarchyIntegrator.h"
 
@@ -47,13 +48,6 @@
 #include "tbox/PIO.h"
 #include "tbox/Utilities.h"
 
-IBTK_DISABLE_EXTRA_WARNINGS
-#include <Eigen/Cholesky>
-#include <Eigen/Core>
-#include <Eigen/Eigenvalues>
-#include <unsupported/Eigen/MatrixFunctions>
-IBTK_ENABLE_EXTRA_WARNINGS
-
 #include <algorithm>
 #include <cmath>
 #include <ostream>
@@ -695,19 +689,7 @@ CFINSForcing::checkPositiveDefinite(const int data_idx,
             const Pointer<PatchGeometry<NDIM> > p_geom = patch->getPatchGeometry();
             if (initial_time) return;
             Pointer<CellData<NDIM, double> > s_data = patch->getPatchData(data_idx);
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                const CellIndex<NDIM>& ci = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*s_data)(ci, k);
-                }
-                Eigen::LLT<MatrixNd> llt;
-                llt.compute(tens);
-                if (llt.info() == Eigen::NumericalIssue) d_positive_def = false;
-            }
+            if (!CFTensorUtilities::isPositiveDefinite(*s_data, box)) d_positive_def = false;
         }
     }
     return;
@@ -734,22 +716,7 @@ CFINSForcing::squareMatrix(const int data_idx,
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
             const Pointer<PatchGeometry<NDIM> > p_geom = patch->getPatchGeometry();
 
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                tens = tens * tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            CFTensorUtilities::square(*data, *data, box);
         }
     }
     return;
@@ -761,7 +728,6 @@ CFINSForcing::findDeterminant(const int data_idx,
                               const double /*data_time*/,
                               const bool /*initial_time*/)
 {
-    double det;
     for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -770,21 +736,7 @@ CFINSForcing::findDeterminant(const int data_idx,
             Pointer<Patch<NDIM> > patch = level->getPatch(i());
             const Box<NDIM>& box = patch->getBox();
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-#if (NDIM == 2)
-                det = (*data)(i, 0) * (*data)(i, 1) - (*data)(i, 2) * (*data)(i, 2);
-#endif
-#if (NDIM == 3)
-                det = (*data)(i, 0) * (*data)(i, 1) * (*data)(i, 2) - (*data)(i, 0) * (*data)(i, 3) * (*data)(i, 3) -
-                      (*data)(i, 1) * (*data)(i, 4) * (*data)(i, 4) +
-                      2.0 * (*data)(i, 3) * (*data)(i, 4) * (*data)(i, 5) -
-                      (*data)(i, 2) * (*data)(i, 5) * (*data)(i, 5);
-#endif
-                d_max_det = det > d_max_det ? det : d_max_det;
-                d_min_det = det < d_min_det ? det : d_min_det;
-            }
+            CFTensorUtilities::determinantBounds(*data, box, d_min_det, d_max_det);
         }
     }
     return;
@@ -808,22 +760,7 @@ CFINSForcing::exponentiateMatrix(const int data_idx,
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                tens = tens.exp();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            CFTensorUtilities::exp(*data, *data, box);
         }
     }
     return;
@@ -846,30 +783,7 @@ CFINSForcing::projectTensor(const int data_idx,
             if (initial_time) return;
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
             const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                eigs.computeDirect(tens);
-                MatrixNd eig_vals(MatrixNd::Zero());
-                for (int d = 0; d < NDIM; ++d)
-                {
-                    eig_vals(d, d) = std::max(eigs.eigenvalues()(d), 0.0);
-                }
-                MatrixNd eig_vecs = eigs.eigenvectors();
-                tens = eig_vecs * eig_vals * eig_vecs.transpose();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            CFTensorUtilities::projectToPositiveSemiDefinite(*data, *data, box);
         }
     }
     return;
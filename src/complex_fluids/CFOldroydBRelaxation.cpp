@@ -17,6 +17,7 @@
 
 #include "CellData.h"
 #include "CellIterator.h"
+#include "IntVector.h"
 #include "Patch.h"
 #include "tbox/Database.h"
 
@@ -62,36 +63,23 @@ CFOldroydBRelaxation::setDataOnPatch(const int data_idx,
     ret_data->fillAll(0.0);
     if (initial_time) return;
     const double l_inv = 1.0 / d_lambda;
+    CellData<NDIM, double> C_data(patch_box, NDIM * (NDIM + 1) / 2, IntVector<NDIM>(0));
+    convertPatchDataToConformation(*in_data, C_data, patch_box);
     for (CellIterator<NDIM> i(patch_box); i; i++)
     {
         const CellIndex<NDIM>& idx = i();
-        MatrixNd mat;
 #if (NDIM == 2)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 2);
+        (*ret_data)(idx, 0) = l_inv * (1.0 - C_data(idx, 0));
+        (*ret_data)(idx, 1) = l_inv * (1.0 - C_data(idx, 1));
+        (*ret_data)(idx, 2) = l_inv * (-C_data(idx, 2));
 #endif
 #if (NDIM == 3)
-        mat(0, 0) = (*in_data)(idx, 0);
-        mat(1, 1) = (*in_data)(idx, 1);
-        mat(2, 2) = (*in_data)(idx, 2);
-        mat(1, 2) = mat(2, 1) = (*in_data)(idx, 3);
-        mat(0, 2) = mat(2, 0) = (*in_data)(idx, 4);
-        mat(0, 1) = mat(1, 0) = (*in_data)(idx, 5);
-#endif
-        mat = convertToConformation(mat);
-#if (NDIM == 2)
-        (*ret_data)(idx, 0) = l_inv * (1.0 - mat(0, 0));
-        (*ret_data)(idx, 1) = l_inv * (1.0 - mat(1, 1));
-        (*ret_data)(idx, 2) = l_inv * (-mat(1, 0));
-#endif
-#if (NDIM == 3)
-        (*ret_data)(idx, 0) = l_inv * (1.0 - mat(0, 0));
-        (*ret_data)(idx, 1) = l_inv * (1.0 - mat(1, 1));
-        (*ret_data)(idx, 2) = l_inv * (1.0 - mat(2, 2));
-        (*ret_data)(idx, 3) = l_inv * (-mat(1, 2));
-        (*ret_data)(idx, 4) = l_inv * (-mat(0, 2));
-        (*ret_data)(idx, 5) = l_inv * (-mat(0, 1));
+        (*ret_data)(idx, 0) = l_inv * (1.0 - C_data(idx, 0));
+        (*ret_data)(idx, 1) = l_inv * (1.0 - C_data(idx, 1));
+        (*ret_data)(idx, 2) = l_inv * (1.0 - C_data(idx, 2));
+        (*ret_data)(idx, 3) = l_inv * (-C_data(idx, 3));
+        (*ret_data)(idx, 4) = l_inv * (-C_data(idx, 4));
+        (*ret_data)(idx, 5) = l_inv * (-C_data(idx, 5));
 #endif
     }
 } // setDataOnPatch
@@ -12,9 +12,13 @@
 // ---------------------------------------------------------------------
 
 #include "ibamr/CFRelaxationOperator.h"
+#include "ibamr/CFTensorUtilities.h"
 
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
 #include "tbox/Utilities.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
@@ -74,4 +78,31 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
     return mat;
 }
 
+void
+CFRelaxationOperator::convertPatchDataToConformation(const CellData<NDIM, double>& W_data,
+                                                     CellData<NDIM, double>& C_data,
+                                                     const Box<NDIM>& box)
+{
+    switch (d_evolve_type)
+    {
+    case SQUARE_ROOT:
+        CFTensorUtilities::square(W_data, C_data, box);
+        break;
+    case LOGARITHM:
+        CFTensorUtilities::exp(W_data, C_data, box);
+        break;
+    case STANDARD:
+        C_data.getArrayData().copy(W_data.getArrayData(), box);
+        break;
+    case UNKNOWN_TENSOR_EVOLUTION_TYPE:
+        TBOX_ERROR(d_object_name << ":\n"
+                                 << "  Uknown tensor evolution type.");
+        break;
+    default:
+        TBOX_ERROR("Should not reach this statement.");
+        break;
+    }
+    return;
+} // convertPatchDataToConformation
+
 } // namespace IBAMR
@@ -0,0 +1,535 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/CFTensorUtilities.h"
+
+#include "Box.h"
+#include "CellData.h"
+#include "Index.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "ibamr/app_namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const int NUM_COMPONENTS = CFTensorUtilities::NUM_COMPONENTS;
+
+// Compute the eigenpair of the largest eigenvalue of the symmetric 2x2 matrix
+// [a c; c b].  The other eigenvector is the rotation of (v0, v1) by pi/2.
+inline void
+eig_2x2(const double a, const double b, const double c, double& lam_min, double& lam_max, double& v0, double& v1)
+{
+    const double m = 0.5 * (a + b);
+    const double h = 0.5 * (a - b);
+    const double r = std::hypot(h, c);
+    lam_min = m - r;
+    lam_max = m + r;
+    if (r == 0.0)
+    {
+        v0 = 1.0;
+        v1 = 0.0;
+        return;
+    }
+    // Of the two (parallel) candidate eigenvectors, use the one with the larger
+    // norm to avoid cancellation.
+    if (h >= 0.0)
+    {
+        v0 = h + r;
+        v1 = c;
+    }
+    else
+    {
+        v0 = c;
+        v1 = r - h;
+    }
+    const double norm = std::sqrt(v0 * v0 + v1 * v1);
+    v0 /= norm;
+    v1 /= norm;
+    return;
+} // eig_2x2
+
+#if (NDIM == 3)
+inline void
+cross(const double a[3], const double b[3], double c[3])
+{
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+    return;
+} // cross
+
+inline double
+dot(const double a[3], const double b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+} // dot
+
+inline void
+eig_3x3(const double A[6], double eig_vals[3], double eig_vecs[3][3])
+{
+    // Scale the matrix to avoid overflow and underflow.
+    double scale = 0.0;
+    for (int k = 0; k < 6; ++k) scale = std::max(scale, std::abs(A[k]));
+    if (scale == 0.0)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            eig_vals[i] = 0.0;
+            for (int j = 0; j < 3; ++j) eig_vecs[i][j] = (i == j ? 1.0 : 0.0);
+        }
+        return;
+    }
+    const double b00 = A[0] / scale, b11 = A[1] / scale, b22 = A[2] / scale;
+    const double b12 = A[3] / scale, b02 = A[4] / scale, b01 = A[5] / scale;
+
+    // Compute the eigenvalues via the trigonometric solution of the
+    // characteristic polynomial of the shifted and scaled matrix.
+    const double q = (b00 + b11 + b22) / 3.0;
+    const double d0 = b00 - q, d1 = b11 - q, d2 = b22 - q;
+    const double p1 = b01 * b01 + b02 * b02 + b12 * b12;
+    const double p = std::sqrt((d0 * d0 + d1 * d1 + d2 * d2 + 2.0 * p1) / 6.0);
+    if (p <= std::numeric_limits<double>::epsilon())
+    {
+        // The matrix is (numerically) a multiple of the identity.
+        for (int i = 0; i < 3; ++i)
+        {
+            eig_vals[i] = q * scale;
+            for (int j = 0; j < 3; ++j) eig_vecs[i][j] = (i == j ? 1.0 : 0.0);
+        }
+        return;
+    }
+    const double c00 = d0 / p, c11 = d1 / p, c22 = d2 / p;
+    const double c12 = b12 / p, c02 = b02 / p, c01 = b01 / p;
+    const double det_c =
+        c00 * (c11 * c22 - c12 * c12) - c01 * (c01 * c22 - c12 * c02) + c02 * (c01 * c12 - c11 * c02);
+    const double r = std::max(-1.0, std::min(1.0, 0.5 * det_c));
+    const double phi = std::acos(r) / 3.0;
+    const double mu_max = q + 2.0 * p * std::cos(phi);
+    const double mu_min = q + 2.0 * p * std::cos(phi + 2.0 * M_PI / 3.0);
+    const double mu_mid = 3.0 * q - mu_min - mu_max;
+
+    // Compute the eigenvector of the eigenvalue that is best separated from the
+    // others as the largest cross product of two rows of (B - mu I).
+    const bool max_is_isolated = (mu_max - mu_mid) > (mu_mid - mu_min);
+    const double mu = max_is_isolated ? mu_max : mu_min;
+    const double r0[3] = { b00 - mu, b01, b02 };
+    const double r1[3] = { b01, b11 - mu, b12 };
+    const double r2[3] = { b02, b12, b22 - mu };
+    double x01[3], x02[3], x12[3];
+    cross(r0, r1, x01);
+    cross(r0, r2, x02);
+    cross(r1, r2, x12);
+    const double n01 = dot(x01, x01), n02 = dot(x02, x02), n12 = dot(x12, x12);
+    double v[3];
+    const double* x_max = (n01 >= n02 && n01 >= n12) ? x01 : (n02 >= n12 ? x02 : x12);
+    const double n_max = std::max(n01, std::max(n02, n12));
+    if (n_max > 0.0)
+    {
+        for (int d = 0; d < 3; ++d) v[d] = x_max[d] / std::sqrt(n_max);
+    }
+    else
+    {
+        v[0] = 1.0;
+        v[1] = 0.0;
+        v[2] = 0.0;
+    }
+
+    // The remaining eigenvectors lie in the plane orthogonal to v.  Restrict
+    // the matrix to that plane and diagonalize the resulting 2x2 matrix, which
+    // is robust even if the remaining eigenvalues coincide.
+    double u[3], w[3];
+    if (std::abs(v[0]) > std::abs(v[1]))
+    {
+        const double n = std::sqrt(v[0] * v[0] + v[2] * v[2]);
+        u[0] = -v[2] / n;
+        u[1] = 0.0;
+        u[2] = v[0] / n;
+    }
+    else
+    {
+        const double n = std::sqrt(v[1] * v[1] + v[2] * v[2]);
+        u[0] = 0.0;
+        u[1] = v[2] / n;
+        u[2] = -v[1] / n;
+    }
+    cross(v, u, w);
+    const double Bu[3] = { b00 * u[0] + b01 * u[1] + b02 * u[2],
+                           b01 * u[0] + b11 * u[1] + b12 * u[2],
+                           b02 * u[0] + b12 * u[1] + b22 * u[2] };
+    const double Bw[3] = { b00 * w[0] + b01 * w[1] + b02 * w[2],
+                           b01 * w[0] + b11 * w[1] + b12 * w[2],
+                           b02 * w[0] + b12 * w[1] + b22 * w[2] };
+    double lam_min, lam_max, s0, s1;
+    eig_2x2(dot(u, Bu), dot(w, Bw), dot(u, Bw), lam_min, lam_max, s0, s1);
+    const double e_max[3] = { s0 * u[0] + s1 * w[0], s0 * u[1] + s1 * w[1], s0 * u[2] + s1 * w[2] };
+    const double e_min[3] = { -s1 * u[0] + s0 * w[0], -s1 * u[1] + s0 * w[1], -s1 * u[2] + s0 * w[2] };
+
+    // Store the eigenpairs in ascending order.
+    const double* vecs[3];
+    if (max_is_isolated)
+    {
+        eig_vals[0] = lam_min;
+        eig_vals[1] = lam_max;
+        eig_vals[2] = mu;
+        vecs[0] = e_min;
+        vecs[1] = e_max;
+        vecs[2] = v;
+    }
+    else
+    {
+        eig_vals[0] = mu;
+        eig_vals[1] = lam_min;
+        eig_vals[2] = lam_max;
+        vecs[0] = v;
+        vecs[1] = e_min;
+        vecs[2] = e_max;
+    }
+    for (int j = 0; j < 3; ++j)
+    {
+        eig_vals[j] *= scale;
+        for (int d = 0; d < 3; ++d) eig_vecs[d][j] = vecs[j][d];
+    }
+    return;
+} // eig_3x3
+#endif
+
+// Compute f(A) = sum_j f(lambda_j) v_j v_j^T for a single tensor.
+template <class Function>
+inline void
+apply_function(const double A[NUM_COMPONENTS], double F[NUM_COMPONENTS], const Function& f)
+{
+#if (NDIM == 2)
+    double lam_min, lam_max, v0, v1;
+    eig_2x2(A[0], A[1], A[2], lam_min, lam_max, v0, v1);
+    const double f_min = f(lam_min), f_max = f(lam_max);
+    F[0] = f_max * v0 * v0 + f_min * v1 * v1;
+    F[1] = f_max * v1 * v1 + f_min * v0 * v0;
+    F[2] = (f_max - f_min) * v0 * v1;
+#endif
+#if (NDIM == 3)
+    double eig_vals[3], V[3][3];
+    eig_3x3(A, eig_vals, V);
+    const double f0 = f(eig_vals[0]), f1 = f(eig_vals[1]), f2 = f(eig_vals[2]);
+    F[0] = f0 * V[0][0] * V[0][0] + f1 * V[0][1] * V[0][1] + f2 * V[0][2] * V[0][2];
+    F[1] = f0 * V[1][0] * V[1][0] + f1 * V[1][1] * V[1][1] + f2 * V[1][2] * V[1][2];
+    F[2] = f0 * V[2][0] * V[2][0] + f1 * V[2][1] * V[2][1] + f2 * V[2][2] * V[2][2];
+    F[3] = f0 * V[1][0] * V[2][0] + f1 * V[1][1] * V[2][1] + f2 * V[1][2] * V[2][2];
+    F[4] = f0 * V[0][0] * V[2][0] + f1 * V[0][1] * V[2][1] + f2 * V[0][2] * V[2][2];
+    F[5] = f0 * V[0][0] * V[1][0] + f1 * V[0][1] * V[1][1] + f2 * V[0][2] * V[1][2];
+#endif
+    return;
+} // apply_function
+
+template <class Function>
+inline void
+apply_function(const double* const in[NUM_COMPONENTS],
+               double* const out[NUM_COMPONENTS],
+               const int n,
+               const Function& f)
+{
+    double A[NUM_COMPONENTS], F[NUM_COMPONENTS];
+    for (int i = 0; i < n; ++i)
+    {
+        for (int k = 0; k < NUM_COMPONENTS; ++k) A[k] = in[k][i];
+        apply_function(A, F, f);
+        for (int k = 0; k < NUM_COMPONENTS; ++k) out[k][i] = F[k];
+    }
+    return;
+} // apply_function
+
+inline double
+compute_determinant(const double A[NUM_COMPONENTS])
+{
+#if (NDIM == 2)
+    return A[0] * A[1] - A[2] * A[2];
+#endif
+#if (NDIM == 3)
+    return A[0] * (A[1] * A[2] - A[3] * A[3]) - A[5] * (A[5] * A[2] - A[3] * A[4]) +
+           A[4] * (A[5] * A[3] - A[1] * A[4]);
+#endif
+} // compute_determinant
+
+inline int
+compute_offset(const Box<NDIM>& data_box, const hier::Index<NDIM>& i)
+{
+    int offset = 0, stride = 1;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        offset += (i(d) - data_box.lower(d)) * stride;
+        stride *= data_box.numberCells(d);
+    }
+    return offset;
+} // compute_offset
+
+// Apply a slab kernel to each row (in the first coordinate direction) of the
+// cells in box.
+template <class Kernel>
+inline void
+apply_on_rows(const CellData<NDIM, double>& in_data,
+              CellData<NDIM, double>& out_data,
+              const Box<NDIM>& box,
+              const Kernel& kernel)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(in_data.getDepth() == NUM_COMPONENTS);
+    TBOX_ASSERT(out_data.getDepth() == NUM_COMPONENTS);
+    TBOX_ASSERT(in_data.getGhostBox().contains(box));
+    TBOX_ASSERT(out_data.getGhostBox().contains(box));
+#endif
+    if (box.empty()) return;
+    const Box<NDIM>& in_box = in_data.getGhostBox();
+    const Box<NDIM>& out_box = out_data.getGhostBox();
+    const int n = box.numberCells(0);
+    Box<NDIM> row_starts = box;
+    row_starts.upper(0) = box.lower(0);
+    const double* in[NUM_COMPONENTS];
+    double* out[NUM_COMPONENTS];
+    for (Box<NDIM>::Iterator b(row_starts); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        const int in_offset = compute_offset(in_box, i);
+        const int out_offset = compute_offset(out_box, i);
+        for (int k = 0; k < NUM_COMPONENTS; ++k)
+        {
+            in[k] = in_data.getPointer(k) + in_offset;
+            out[k] = out_data.getPointer(k) + out_offset;
+        }
+        kernel(in, out, n);
+    }
+    return;
+} // apply_on_rows
+
+// Apply a read-only slab kernel to each row of the cells in box.
+template <class Kernel>
+inline void
+apply_on_rows(const CellData<NDIM, double>& in_data, const Box<NDIM>& box, const Kernel& kernel)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(in_data.getDepth() == NUM_COMPONENTS);
+    TBOX_ASSERT(in_data.getGhostBox().contains(box));
+#endif
+    if (box.empty()) return;
+    const Box<NDIM>& in_box = in_data.getGhostBox();
+    const int n = box.numberCells(0);
+    Box<NDIM> row_starts = box;
+    row_starts.upper(0) = box.lower(0);
+    const double* in[NUM_COMPONENTS];
+    for (Box<NDIM>::Iterator b(row_starts); b; b++)
+    {
+        const int in_offset = compute_offset(in_box, b());
+        for (int k = 0; k < NUM_COMPONENTS; ++k) in[k] = in_data.getPointer(k) + in_offset;
+        kernel(in, n);
+    }
+    return;
+} // apply_on_rows
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+CFTensorUtilities::computeEigenDecomposition(const double A[NUM_COMPONENTS],
+                                             double eig_vals[NDIM],
+                                             double eig_vecs[NDIM][NDIM])
+{
+#if (NDIM == 2)
+    double v0, v1;
+    eig_2x2(A[0], A[1], A[2], eig_vals[0], eig_vals[1], v0, v1);
+    eig_vecs[0][0] = -v1;
+    eig_vecs[1][0] = v0;
+    eig_vecs[0][1] = v0;
+    eig_vecs[1][1] = v1;
+#endif
+#if (NDIM == 3)
+    eig_3x3(A, eig_vals, eig_vecs);
+#endif
+    return;
+} // computeEigenDecomposition
+
+void
+CFTensorUtilities::exp(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], const int n)
+{
+    apply_function(in, out, n, [](const double lam) { return std::exp(lam); });
+    return;
+} // exp
+
+void
+CFTensorUtilities::log(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], const int n)
+{
+    apply_function(in, out, n, [](const double lam) { return std::log(lam); });
+    return;
+} // log
+
+void
+CFTensorUtilities::sqrt(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], const int n)
+{
+    apply_function(in, out, n, [](const double lam) { return std::sqrt(std::max(lam, 0.0)); });
+    return;
+} // sqrt
+
+void
+CFTensorUtilities::square(const double* const in[NUM_COMPONENTS], double* const out[NUM_COMPONENTS], const int n)
+{
+    for (int i = 0; i < n; ++i)
+    {
+#if (NDIM == 2)
+        const double xx = in[0][i], yy = in[1][i], xy = in[2][i];
+        out[0][i] = xx * xx + xy * xy;
+        out[1][i] = yy * yy + xy * xy;
+        out[2][i] = xy * (xx + yy);
+#endif
+#if (NDIM == 3)
+        const double xx = in[0][i], yy = in[1][i], zz = in[2][i];
+        const double yz = in[3][i], xz = in[4][i], xy = in[5][i];
+        out[0][i] = xx * xx + xy * xy + xz * xz;
+        out[1][i] = xy * xy + yy * yy + yz * yz;
+        out[2][i] = xz * xz + yz * yz + zz * zz;
+        out[3][i] = xy * xz + yy * yz + yz * zz;
+        out[4][i] = xx * xz + xy * yz + xz * zz;
+        out[5][i] = xx * xy + xy * yy + xz * yz;
+#endif
+    }
+    return;
+} // square
+
+void
+CFTensorUtilities::projectToPositiveSemiDefinite(const double* const in[NUM_COMPONENTS],
+                                                 double* const out[NUM_COMPONENTS],
+                                                 const int n,
+                                                 const double min_eig_val)
+{
+    apply_function(in, out, n, [min_eig_val](const double lam) { return std::max(lam, min_eig_val); });
+    return;
+} // projectToPositiveSemiDefinite
+
+void
+CFTensorUtilities::determinant(const double* const in[NUM_COMPONENTS], double* const det, const int n)
+{
+    double A[NUM_COMPONENTS];
+    for (int i = 0; i < n; ++i)
+    {
+        for (int k = 0; k < NUM_COMPONENTS; ++k) A[k] = in[k][i];
+        det[i] = compute_determinant(A);
+    }
+    return;
+} // determinant
+
+bool
+CFTensorUtilities::isPositiveDefinite(const double* const in[NUM_COMPONENTS], const int n)
+{
+    bool positive_definite = true;
+    double A[NUM_COMPONENTS];
+    for (int i = 0; i < n; ++i)
+    {
+        for (int k = 0; k < NUM_COMPONENTS; ++k) A[k] = in[k][i];
+#if (NDIM == 3)
+        positive_definite = positive_definite && (A[0] * A[1] - A[5] * A[5] > 0.0);
+#endif
+        positive_definite = positive_definite && (A[0] > 0.0) && (compute_determinant(A) > 0.0);
+    }
+    return positive_definite;
+} // isPositiveDefinite
+
+void
+CFTensorUtilities::exp(const CellData<NDIM, double>& in_data, CellData<NDIM, double>& out_data, const Box<NDIM>& box)
+{
+    apply_on_rows(in_data, out_data, box, [](const double* const* in, double* const* out, const int n) {
+        CFTensorUtilities::exp(in, out, n);
+    });
+    return;
+} // exp
+
+void
+CFTensorUtilities::log(const CellData<NDIM, double>& in_data, CellData<NDIM, double>& out_data, const Box<NDIM>& box)
+{
+    apply_on_rows(in_data, out_data, box, [](const double* const* in, double* const* out, const int n) {
+        CFTensorUtilities::log(in, out, n);
+    });
+    return;
+} // log
+
+void
+CFTensorUtilities::sqrt(const CellData<NDIM, double>& in_data, CellData<NDIM, double>& out_data, const Box<NDIM>& box)
+{
+    apply_on_rows(in_data, out_data, box, [](const double* const* in, double* const* out, const int n) {
+        CFTensorUtilities::sqrt(in, out, n);
+    });
+    return;
+} // sqrt
+
+void
+CFTensorUtilities::square(const CellData<NDIM, double>& in_data,
+                          CellData<NDIM, double>& out_data,
+                          const Box<NDIM>& box)
+{
+    apply_on_rows(in_data, out_data, box, [](const double* const* in, double* const* out, const int n) {
+        CFTensorUtilities::square(in, out, n);
+    });
+    return;
+} // square
+
+void
+CFTensorUtilities::projectToPositiveSemiDefinite(const CellData<NDIM, double>& in_data,
+                                                 CellData<NDIM, double>& out_data,
+                                                 const Box<NDIM>& box,
+                                                 const double min_eig_val)
+{
+    apply_on_rows(in_data, out_data, box, [min_eig_val](const double* const* in, double* const* out, const int n) {
+        CFTensorUtilities::projectToPositiveSemiDefinite(in, out, n, min_eig_val);
+    });
+    return;
+} // projectToPositiveSemiDefinite
+
+void
+CFTensorUtilities::determinantBounds(const CellData<NDIM, double>& in_data,
+                                     const Box<NDIM>& box,
+                                     double& min_det,
+                                     double& max_det)
+{
+    apply_on_rows(in_data, box, [&min_det, &max_det](const double* const* in, const int n) {
+        double A[NUM_COMPONENTS];
+        for (int i = 0; i < n; ++i)
+        {
+            for (int k = 0; k < NUM_COMPONENTS; ++k) A[k] = in[k][i];
+            const double det = compute_determinant(A);
+            min_det = std::min(min_det, det);
+            max_det = std::max(max_det, det);
+        }
+    });
+    return;
+} // determinantBounds
+
+bool
+CFTensorUtilities::isPositiveDefinite(const CellData<NDIM, double>& in_data, const Box<NDIM>& box)
+{
+    bool positive_definite = true;
+    apply_on_rows(in_data, box, [&positive_definite](const double* const* in, const int n) {
+        positive_definite = CFTensorUtilities::isPositiveDefinite(in, n) && positive_definite;
+    });
+    return positive_definite;
+} // isPositiveDefinite
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
@@ -25,6 +25,7 @@
 #include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IntVector.h"
@@ -40,6 +41,11 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -88,6 +94,112 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Minimum number of independent cell rows on a hyperplane for which the
+// wavefront sweeps are distributed among threads.
+const int MIN_THREADED_WAVEFRONT_ROWS = 16;
+
+// Minimum number of narrow band cells on a hyperplane for which the narrow band
+// sweeps are distributed among threads.
+const int MIN_THREADED_NARROW_BAND_CELLS = 256;
+
+// The sweep directions, in the order used by fastsweep1storder2d and
+// fastsweep1storder3d.
+const int NUM_SWEEP_DIRECTIONS = 1 << NDIM;
+#if (NDIM == 2)
+const int SWEEP_DIRECTIONS[NUM_SWEEP_DIRECTIONS][NDIM] = { { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+#endif
+#if (NDIM == 3)
+const int SWEEP_DIRECTIONS[NUM_SWEEP_DIRECTIONS][NDIM] = { { 1, 1, 1 },   { -1, 1, 1 },  { 1, -1, 1 },
+                                                           { 1, 1, -1 },  { -1, -1, 1 }, { 1, -1, -1 },
+                                                           { -1, 1, -1 }, { -1, -1, -1 } };
+#endif
+
+// Update the distance at a single cell.  This is the same update as the one
+// computed by evalsweep1storder2d and evalsweep1storder3d.  It is implemented
+// here so that the threaded sweeps do not call a Fortran routine for every
+// cell.
+inline void
+eval_sweep_1st_order(double* const D,
+                     const int offset,
+                     const std::array<int, NDIM>& stride,
+                     const hier::Index<NDIM>& i,
+                     const Box<NDIM>& domain_box,
+                     const double* const dx,
+                     const int patch_touches_bdry,
+                     const int* const touches_wall_loc_idx)
+{
+    double& U = D[offset];
+    if (U == 0.0) return;
+    const double sgn = U > 0.0 ? 1.0 : -1.0;
+
+    // Find the upwind neighbor values.  At a wall, the grid spacing to the
+    // boundary is h/2 and the distance imposed at the boundary is zero.
+    std::array<double, NDIM> a, h;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        a[d] = sgn * std::min(sgn * D[offset - stride[d]], sgn * D[offset + stride[d]]);
+        h[d] = dx[d];
+        if (patch_touches_bdry && ((i(d) == domain_box.lower(d) && touches_wall_loc_idx[2 * d]) ||
+                                   (i(d) == domain_box.upper(d) && touches_wall_loc_idx[2 * d + 1])))
+        {
+            a[d] = 0.0;
+            h[d] *= 0.5;
+        }
+    }
+
+#if (NDIM == 2)
+    double dbar;
+    if (sgn * (a[1] - a[0]) > h[0])
+    {
+        dbar = a[0] + sgn * h[0];
+    }
+    else if (sgn * (a[0] - a[1]) > h[1])
+    {
+        dbar = a[1] + sgn * h[1];
+    }
+    else
+    {
+        const double Q = h[0] * h[0] + h[1] * h[1];
+        const double R = -2.0 * (h[1] * h[1] * a[0] + h[0] * h[0] * a[1]);
+        const double S = h[1] * h[1] * a[0] * a[0] + h[0] * h[0] * a[1] * a[1] - h[0] * h[0] * h[1] * h[1];
+        dbar = (-R + sgn * std::sqrt(R * R - 4.0 * Q * S)) / (2.0 * Q);
+    }
+#endif
+#if (NDIM == 3)
+    // Sort the neighbor values so that sgn * a1 <= sgn * a2 <= sgn * a3.  The
+    // sort is stable, which matches the ordering of ties in the Fortran code.
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        for (unsigned int k = d; k > 0 && sgn * a[k] < sgn * a[k - 1]; --k)
+        {
+            std::swap(a[k], a[k - 1]);
+            std::swap(h[k], h[k - 1]);
+        }
+    }
+    double dbar = a[0] + sgn * h[0];
+    if (sgn * dbar > sgn * a[1])
+    {
+        const double Q = h[0] * h[0] + h[1] * h[1];
+        const double R = -2.0 * (h[1] * h[1] * a[0] + h[0] * h[0] * a[1]);
+        const double S = h[1] * h[1] * a[0] * a[0] + h[0] * h[0] * a[1] * a[1] - h[0] * h[0] * h[1] * h[1];
+        dbar = (-R + sgn * std::sqrt(R * R - 4.0 * Q * S)) / (2.0 * Q);
+    }
+    if (sgn * dbar >= sgn * a[2])
+    {
+        const double Q = 1.0 / (h[0] * h[0]) + 1.0 / (h[1] * h[1]) + 1.0 / (h[2] * h[2]);
+        const double R = -2.0 * (a[0] / (h[0] * h[0]) + a[1] / (h[1] * h[1]) + a[2] / (h[2] * h[2]));
+        const double S =
+            a[0] * a[0] / (h[0] * h[0]) + a[1] * a[1] / (h[1] * h[1]) + a[2] * a[2] / (h[2] * h[2]) - 1.0;
+        dbar = (-R + sgn * std::sqrt(R * R - 4.0 * Q * S)) / (2.0 * Q);
+    }
+#endif
+    U = sgn * std::min(sgn * U, sgn * dbar);
+    return;
+} // eval_sweep_1st_order
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(std::string object_name, Pointer<Database> db, bool register_for_restart)
@@ -204,6 +316,26 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    // Cap the values outside of the narrow band.
+    if (d_narrow_band_width > 0.0)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_scratch_idx);
+                for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                {
+                    const CellIndex<NDIM> ic(b());
+                    double& D = (*D_data)(ic);
+                    if (std::abs(D) > d_narrow_band_width) D = std::copysign(d_narrow_band_width, D);
+                }
+            }
+        }
+    }
+
     // Copy signed distance into supplied patch data index
     hier_cc_data_ops.copyData(D_idx, D_scratch_idx);
 
@@ -283,37 +415,336 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 
     const Box<NDIM>& patch_box = patch->getBox();
     const double* const dx = pgeom->getDx();
-    if (d_ls_order == FIRST_ORDER_LS)
+    if (d_ls_order != FIRST_ORDER_LS)
+    {
+        TBOX_ERROR("FastSweepingLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
+    }
+
+    // Find the cells that may be within the narrow band.  Only these cells are
+    // visited by the sweeps.
+    const bool use_narrow_band = d_narrow_band_width > 0.0;
+    std::vector<hier::Index<NDIM> > band_cells;
+    if (use_narrow_band)
+    {
+        findNarrowBandCells(dist_data, patch, domain_box, patch_touches_bdry, touches_wall_loc_idx, band_cells);
+        if (band_cells.empty()) return;
+    }
+
+    // Carry out the sweeps.  Additional sets of sweeps reuse the ghost cell
+    // values from the most recent fill, which reduces the number of outer
+    // iterations required to propagate the distance through the patch.
+    const int D_size = dist_data->getGhostBox().size();
+    std::vector<double> D_old;
+    for (int local_sweep = 0; local_sweep < d_max_local_sweeps; ++local_sweep)
     {
-        FAST_SWEEP_1ST_ORDER_FC(D,
-                                D_ghosts,
-                                patch_box.lower(0),
-                                patch_box.upper(0),
-                                patch_box.lower(1),
-                                patch_box.upper(1),
+        if (d_max_local_sweeps > 1)
+        {
+            if (use_narrow_band)
+            {
+                D_old.resize(band_cells.size());
+                for (std::size_t k = 0; k < band_cells.size(); ++k)
+                {
+                    D_old[k] = (*dist_data)(CellIndex<NDIM>(band_cells[k]));
+                }
+            }
+            else
+            {
+                D_old.assign(D, D + D_size);
+            }
+        }
+
+        if (use_narrow_band)
+        {
+            narrowBandSweep(dist_data, patch, domain_box, patch_touches_bdry, touches_wall_loc_idx, band_cells);
+        }
+        else if (d_use_wavefront_sweeping)
+        {
+            wavefrontSweep(dist_data, patch, domain_box, patch_touches_bdry, touches_wall_loc_idx);
+        }
+        else
+        {
+            FAST_SWEEP_1ST_ORDER_FC(D,
+                                    D_ghosts,
+                                    patch_box.lower(0),
+                                    patch_box.upper(0),
+                                    patch_box.lower(1),
+                                    patch_box.upper(1),
 #if (NDIM == 3)
-                                patch_box.lower(2),
-                                patch_box.upper(2),
+                                    patch_box.lower(2),
+                                    patch_box.upper(2),
 #endif
-                                domain_box.lower(0),
-                                domain_box.upper(0),
-                                domain_box.lower(1),
-                                domain_box.upper(1),
+                                    domain_box.lower(0),
+                                    domain_box.upper(0),
+                                    domain_box.lower(1),
+                                    domain_box.upper(1),
 #if (NDIM == 3)
-                                domain_box.lower(2),
-                                domain_box.upper(2),
+                                    domain_box.lower(2),
+                                    domain_box.upper(2),
 #endif
-                                dx,
-                                patch_touches_bdry,
-                                touches_wall_loc_idx);
+                                    dx,
+                                    patch_touches_bdry,
+                                    touches_wall_loc_idx);
+        }
+
+        if (d_max_local_sweeps > 1)
+        {
+            double max_diff = 0.0;
+            if (use_narrow_band)
+            {
+                for (std::size_t k = 0; k < band_cells.size(); ++k)
+                {
+                    max_diff = std::max(max_diff, std::abs((*dist_data)(CellIndex<NDIM>(band_cells[k])) - D_old[k]));
+                }
+            }
+            else
+            {
+                for (int k = 0; k < D_size; ++k)
+                {
+                    max_diff = std::max(max_diff, std::abs(D[k] - D_old[k]));
+                }
+            }
+            if (max_diff <= d_abs_tol) break;
+        }
     }
-    else
+
+    return;
+} // fastSweep
+
+void
+FastSweepingLSMethod::wavefrontSweep(Pointer<CellData<NDIM, double> > dist_data,
+                                     const Pointer<Patch<NDIM> > patch,
+                                     const Box<NDIM>& domain_box,
+                                     const int patch_touches_bdry,
+                                     const int* const touches_wall_loc_idx) const
+{
+    double* const D = dist_data->getPointer(0);
+    const int D_ghosts = (dist_data->getGhostCellWidth()).max();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const Box<NDIM>& patch_box = patch->getBox();
+    const hier::Index<NDIM>& ilower = patch_box.lower();
+    const hier::Index<NDIM>& iupper = patch_box.upper();
+
+    std::array<int, NDIM> n, stride;
+    int num_planes = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        TBOX_ERROR("FastSweepingLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
+        n[d] = iupper(d) - ilower(d) + 1;
+        stride[d] = (d == 0 ? 1 : stride[d - 1] * (n[d - 1] + 2 * D_ghosts));
+        num_planes += n[d] - 1;
     }
 
+    // Sweep in each of the 2^NDIM directions.  In a given direction, the
+    // cells on hyperplane k = j0 + j1 (+ j2), in which j is the cell offset
+    // from the upwind corner of the patch, only depend on the values on
+    // hyperplanes k - 1 and k + 1, so they can be updated concurrently.  The
+    // result is the same as that of the lexicographic Gauss-Seidel sweeps.
+    for (const auto& sgn : SWEEP_DIRECTIONS)
+    {
+        auto get_index = [&](const unsigned int d, const int j) { return sgn[d] > 0 ? ilower(d) + j : iupper(d) - j; };
+        for (int k = 0; k < num_planes; ++k)
+        {
+            const int j_outer_min = std::max(0, k - (num_planes - n[NDIM - 1]));
+            const int j_outer_max = std::min(n[NDIM - 1] - 1, k);
+#if defined(IBTK_HAVE_OPENMP)
+#pragma omp parallel for schedule(static) if (j_outer_max - j_outer_min + 1 >= MIN_THREADED_WAVEFRONT_ROWS)
+#endif
+            for (int j_outer = j_outer_min; j_outer <= j_outer_max; ++j_outer)
+            {
+                hier::Index<NDIM> i;
+                i(NDIM - 1) = get_index(NDIM - 1, j_outer);
+#if (NDIM == 2)
+                i(0) = get_index(0, k - j_outer);
+                const int offset =
+                    (i(0) - ilower(0) + D_ghosts) * stride[0] + (i(1) - ilower(1) + D_ghosts) * stride[1];
+                eval_sweep_1st_order(D, offset, stride, i, domain_box, dx, patch_touches_bdry, touches_wall_loc_idx);
+#endif
+#if (NDIM == 3)
+                const int j1_min = std::max(0, k - j_outer - (n[0] - 1));
+                const int j1_max = std::min(n[1] - 1, k - j_outer);
+                for (int j1 = j1_min; j1 <= j1_max; ++j1)
+                {
+                    i(1) = get_index(1, j1);
+                    i(0) = get_index(0, k - j_outer - j1);
+                    const int offset = (i(0) - ilower(0) + D_ghosts) * stride[0] +
+                                       (i(1) - ilower(1) + D_ghosts) * stride[1] +
+                                       (i(2) - ilower(2) + D_ghosts) * stride[2];
+                    eval_sweep_1st_order(
+                        D, offset, stride, i, domain_box, dx, patch_touches_bdry, touches_wall_loc_idx);
+                }
+#endif
+            }
+        }
+    }
     return;
-} // fastSweep
+} // wavefrontSweep
+
+void
+FastSweepingLSMethod::narrowBandSweep(Pointer<CellData<NDIM, double> > dist_data,
+                                      const Pointer<Patch<NDIM> > patch,
+                                      const Box<NDIM>& domain_box,
+                                      const int patch_touches_bdry,
+                                      const int* const touches_wall_loc_idx,
+                                      const std::vector<hier::Index<NDIM> >& band_cells) const
+{
+    double* const D = dist_data->getPointer(0);
+    const int D_ghosts = (dist_data->getGhostCellWidth()).max();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const Box<NDIM>& patch_box = patch->getBox();
+    const hier::Index<NDIM>& ilower = patch_box.lower();
+    const hier::Index<NDIM>& iupper = patch_box.upper();
+
+    std::array<int, NDIM> stride;
+    int num_planes = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        stride[d] = (d == 0 ? 1 : stride[d - 1] * (iupper(d - 1) - ilower(d - 1) + 1 + 2 * D_ghosts));
+        num_planes += iupper(d) - ilower(d);
+    }
+    const int num_cells = static_cast<int>(band_cells.size());
+    std::vector<int> band_offsets(num_cells);
+    for (int c = 0; c < num_cells; ++c)
+    {
+        band_offsets[c] = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            band_offsets[c] += (band_cells[c](d) - ilower(d) + D_ghosts) * stride[d];
+        }
+    }
+
+    // Sweep in each of the 2^NDIM directions, visiting the hyperplanes in the
+    // same order as wavefrontSweep().  The band cells are bucketed by
+    // hyperplane with a counting sort so that only the band is visited.
+    std::vector<int> plane_start(num_planes + 1), plane_cells(num_cells), cell_plane(num_cells);
+    for (const auto& sgn : SWEEP_DIRECTIONS)
+    {
+        std::fill(plane_start.begin(), plane_start.end(), 0);
+        for (int c = 0; c < num_cells; ++c)
+        {
+            int k = 0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                k += sgn[d] > 0 ? band_cells[c](d) - ilower(d) : iupper(d) - band_cells[c](d);
+            }
+            cell_plane[c] = k;
+            ++plane_start[k + 1];
+        }
+        for (int k = 0; k < num_planes; ++k) plane_start[k + 1] += plane_start[k];
+        for (int c = 0; c < num_cells; ++c) plane_cells[plane_start[cell_plane[c]]++] = c;
+        for (int k = num_planes; k > 0; --k) plane_start[k] = plane_start[k - 1];
+        plane_start[0] = 0;
+
+        for (int k = 0; k < num_planes; ++k)
+        {
+            const int plane_begin = plane_start[k];
+            const int plane_end = plane_start[k + 1];
+#if defined(IBTK_HAVE_OPENMP)
+#pragma omp parallel for schedule(static) if (plane_end - plane_begin >= MIN_THREADED_NARROW_BAND_CELLS)
+#endif
+            for (int m = plane_begin; m < plane_end; ++m)
+            {
+                const int c = plane_cells[m];
+                eval_sweep_1st_order(D,
+                                     band_offsets[c],
+                                     stride,
+                                     band_cells[c],
+                                     domain_box,
+                                     dx,
+                                     patch_touches_bdry,
+                                     touches_wall_loc_idx);
+            }
+        }
+    }
+    return;
+} // narrowBandSweep
+
+void
+FastSweepingLSMethod::findNarrowBandCells(Pointer<CellData<NDIM, double> > dist_data,
+                                          const Pointer<Patch<NDIM> > patch,
+                                          const Box<NDIM>& domain_box,
+                                          const int patch_touches_bdry,
+                                          const int* const touches_wall_loc_idx,
+                                          std::vector<hier::Index<NDIM> >& band_cells) const
+{
+    band_cells.clear();
+    const double* const D = dist_data->getPointer(0);
+    const Box<NDIM>& ghost_box = dist_data->getGhostBox();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    // Estimate the distance of each cell from the interface (in units of the
+    // grid spacing) as the smallest sum of the current distance at a cell,
+    // possibly a ghost cell, that is within the band and the number of cells
+    // between the two.  Cells adjacent to a wall are within the band.  This
+    // estimate is computed by a forward and a backward pass along each axis in
+    // turn.  Cells that are not found on one outer iteration are found on a
+    // later one, once the distance has propagated towards them.
+    const double dx_min = *std::min_element(dx, dx + NDIM);
+    const double band_cell_width = d_narrow_band_width / dx_min + 1.0;
+    std::array<int, NDIM> n, stride;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        n[d] = ghost_box.upper(d) - ghost_box.lower(d) + 1;
+        stride[d] = (d == 0 ? 1 : stride[d - 1] * n[d - 1]);
+    }
+    const int num_ghost_cells = ghost_box.size();
+    std::vector<double> band_dist(num_ghost_cells);
+    for (Box<NDIM>::Iterator b(ghost_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        int offset = 0;
+        bool at_wall = false;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            offset += (i(d) - ghost_box.lower(d)) * stride[d];
+            if (patch_touches_bdry)
+            {
+                at_wall = at_wall || (i(d) == domain_box.lower(d) && touches_wall_loc_idx[2 * d]) ||
+                          (i(d) == domain_box.upper(d) && touches_wall_loc_idx[2 * d + 1]);
+            }
+        }
+        if (at_wall)
+        {
+            band_dist[offset] = 0.0;
+        }
+        else if (std::abs(D[offset]) <= d_narrow_band_width)
+        {
+            band_dist[offset] = std::abs(D[offset]) / dx_min;
+        }
+        else
+        {
+            band_dist[offset] = std::numeric_limits<double>::max();
+        }
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (int offset = 0; offset < num_ghost_cells; ++offset)
+        {
+            // Visit each line along this axis once, starting from its first cell.
+            if ((offset / stride[axis]) % n[axis] != 0) continue;
+            for (int j = 1; j < n[axis]; ++j)
+            {
+                double& dist = band_dist[offset + j * stride[axis]];
+                dist = std::min(dist, band_dist[offset + (j - 1) * stride[axis]] + 1.0);
+            }
+            for (int j = n[axis] - 2; j >= 0; --j)
+            {
+                double& dist = band_dist[offset + j * stride[axis]];
+                dist = std::min(dist, band_dist[offset + (j + 1) * stride[axis]] + 1.0);
+            }
+        }
+    }
+
+    for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        int offset = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) offset += (i(d) - ghost_box.lower(d)) * stride[d];
+        if (band_dist[offset] <= band_cell_width) band_cells.push_back(i);
+    }
+    return;
+} // findNarrowBandCells
 
 void
 FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
@@ -331,6 +762,15 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_use_wavefront_sweeping = input_db->getBoolWithDefault("use_wavefront_sweeping", d_use_wavefront_sweeping);
+    d_max_local_sweeps = input_db->getIntegerWithDefault("max_local_sweeps", d_max_local_sweeps);
+    if (d_max_local_sweeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  max_local_sweeps must be positive." << std::endl);
+    }
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
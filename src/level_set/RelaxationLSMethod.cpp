@@ -19,6 +19,7 @@
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
 
 #include "BasePatchLevel.h"
 #include "Box.h"
@@ -27,6 +28,7 @@
 #include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
@@ -41,6 +43,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -87,6 +90,14 @@ extern "C"
 #if (NDIM == 3)
                                     const int& ilower2,
                                     const int& iupper2,
+#endif
+                                    const int& tlower0,
+                                    const int& tupper0,
+                                    const int& tlower1,
+                                    const int& tupper1,
+#if (NDIM == 3)
+                                    const int& tlower2,
+                                    const int& tupper2,
 #endif
                                     const double* dx,
                                     const int& dir);
@@ -102,6 +113,14 @@ extern "C"
 #if (NDIM == 3)
                                         const int& ilower2,
                                         const int& iupper2,
+#endif
+                                        const int& tlower0,
+                                        const int& tupper0,
+                                        const int& tlower1,
+                                        const int& tupper1,
+#if (NDIM == 3)
+                                        const int& tlower2,
+                                        const int& tupper2,
 #endif
                                         const double* dx,
                                         const int& dir,
@@ -134,6 +153,14 @@ extern "C"
 #if (NDIM == 3)
                                          const int& ilower2,
                                          const int& iupper2,
+#endif
+                                         const int& tlower0,
+                                         const int& tupper0,
+                                         const int& tlower1,
+                                         const int& tupper1,
+#if (NDIM == 3)
+                                         const int& tlower2,
+                                         const int& tupper2,
 #endif
                                          const double* dx,
                                          const int& dir,
@@ -166,6 +193,14 @@ extern "C"
 #if (NDIM == 3)
                                          const int& ilower2,
                                          const int& iupper2,
+#endif
+                                         const int& tlower0,
+                                         const int& tupper0,
+                                         const int& tlower1,
+                                         const int& tupper1,
+#if (NDIM == 3)
+                                         const int& tlower2,
+                                         const int& tupper2,
 #endif
                                          const double* dx,
                                          const int& dir,
@@ -361,6 +396,9 @@ RelaxationLSMethod::initializeLSData(int D_idx,
     D_fill_op->fillData(time);
     hier_cc_data_ops.copyData(D_init_idx, D_scratch_idx, /*interior_only*/ false);
 
+    // Determine the part of the domain that is relaxed.
+    if (d_narrow_band_cells > 0) updateNarrowBand(hier_math_ops, D_init_idx);
+
     // Compute the volume of the initial level set variable
     if (d_apply_volume_shift && initial_time)
     {
@@ -539,16 +577,159 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
-            relax(dist_data, dist_init_data, patch, iter);
+            if (d_narrow_band_cells <= 0)
+            {
+                relax(dist_data, dist_init_data, patch->getBox(), patch, iter);
+                continue;
+            }
+
+            // Relax each tile within the narrow band in place.  The tiles are
+            // relaxed in turn, so that each one uses the values already
+            // updated on the neighboring tiles.
+            const auto tiles_it = d_narrow_band_tiles[ln].find(p());
+            if (tiles_it == d_narrow_band_tiles[ln].end()) continue;
+            for (const Box<NDIM>& tile_box : tiles_it->second)
+            {
+                relax(dist_data, dist_init_data, tile_box, patch, iter);
+            }
         }
     }
     return;
-
 } // relax
 
+void
+RelaxationLSMethod::updateNarrowBand(Pointer<HierarchyMathOps> hier_math_ops, int dist_idx)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    d_narrow_band_tiles.resize(finest_ln + 1);
+    d_narrow_band_patch_boxes.resize(finest_ln + 1);
+    int num_tiles = 0, num_examined_tiles = 0, num_band_tiles = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        std::map<int, std::vector<Box<NDIM> > > level_tiles;
+        std::map<int, Box<NDIM> > level_patch_boxes;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double band_width =
+                static_cast<double>(d_narrow_band_cells) * (*std::max_element(dx, dx + NDIM));
+            const Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+
+            // Divide the patch into tiles.  If the patch has not changed since
+            // the band was last determined, only the tiles that were within the
+            // band, their neighbors, and the tiles along the patch boundary
+            // (through which the interface may enter the patch) are examined.
+            // Otherwise, all of the tiles are examined.
+            const Box<NDIM> tile_index_box(hier::Index<NDIM>(0),
+                                           (patch_box.numberCells() - 1) / d_narrow_band_tile_size);
+            const auto patch_box_it = d_narrow_band_patch_boxes[ln].find(p());
+            const bool update_band =
+                patch_box_it != d_narrow_band_patch_boxes[ln].end() && patch_box_it->second == patch_box;
+            std::vector<bool> examine_tile(tile_index_box.size(), !update_band);
+            if (update_band)
+            {
+                for (const Box<NDIM>& tile_box : d_narrow_band_tiles[ln][p()])
+                {
+                    const hier::Index<NDIM> t = (tile_box.lower() - patch_box.lower()) / d_narrow_band_tile_size;
+                    for (Box<NDIM>::Iterator n(Box<NDIM>::grow(Box<NDIM>(t, t), 1) * tile_index_box); n; n++)
+                    {
+                        examine_tile[tile_index_box.offset(n())] = true;
+                    }
+                }
+                for (Box<NDIM>::Iterator t(tile_index_box); t; t++)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        if (t()(d) == tile_index_box.lower(d) || t()(d) == tile_index_box.upper(d))
+                        {
+                            examine_tile[tile_index_box.offset(t())] = true;
+                        }
+                    }
+                }
+            }
+
+            // Keep the examined tiles that contain a cell that is within the
+            // band.
+            std::vector<Box<NDIM> >& patch_tiles = level_tiles[p()];
+            std::vector<hier::Index<NDIM> > band_tile_idxs;
+            const auto find_band_tiles = [&]()
+            {
+                for (Box<NDIM>::Iterator t(tile_index_box); t; t++)
+                {
+                    if (!examine_tile[tile_index_box.offset(t())]) continue;
+                    ++num_examined_tiles;
+                    const hier::Index<NDIM> tile_lower = patch_box.lower() + t() * d_narrow_band_tile_size;
+                    const Box<NDIM> tile_box =
+                        Box<NDIM>(tile_lower, tile_lower + (d_narrow_band_tile_size - 1)) * patch_box;
+                    for (Box<NDIM>::Iterator b(tile_box); b; b++)
+                    {
+                        if (std::abs((*dist_data)(CellIndex<NDIM>(b()))) <= band_width)
+                        {
+                            patch_tiles.push_back(tile_box);
+                            band_tile_idxs.push_back(t());
+                            break;
+                        }
+                    }
+                }
+            };
+            find_band_tiles();
+
+            // The incremental update misses the parts of the interface that
+            // have moved by more than one tile.  Examine all of the tiles if
+            // no tile is within the band or if a tile within the band has a
+            // neighbor that was not examined.
+            if (update_band)
+            {
+                bool full_scan = patch_tiles.empty();
+                for (auto it = band_tile_idxs.begin(); it != band_tile_idxs.end() && !full_scan; ++it)
+                {
+                    for (Box<NDIM>::Iterator n(Box<NDIM>::grow(Box<NDIM>(*it, *it), 1) * tile_index_box); n; n++)
+                    {
+                        if (!examine_tile[tile_index_box.offset(n())])
+                        {
+                            full_scan = true;
+                            break;
+                        }
+                    }
+                }
+                if (full_scan)
+                {
+                    patch_tiles.clear();
+                    band_tile_idxs.clear();
+                    std::fill(examine_tile.begin(), examine_tile.end(), true);
+                    find_band_tiles();
+                }
+            }
+            num_tiles += tile_index_box.size();
+            num_band_tiles += static_cast<int>(patch_tiles.size());
+            level_patch_boxes[p()] = patch_box;
+        }
+        d_narrow_band_tiles[ln] = std::move(level_tiles);
+        d_narrow_band_patch_boxes[ln] = std::move(level_patch_boxes);
+    }
+
+    if (d_enable_logging)
+    {
+        num_tiles = IBTK_MPI::sumReduction(num_tiles);
+        num_examined_tiles = IBTK_MPI::sumReduction(num_examined_tiles);
+        num_band_tiles = IBTK_MPI::sumReduction(num_band_tiles);
+        plog << d_object_name << "::updateNarrowBand(): " << num_band_tiles << " of " << num_tiles
+             << " tiles are within the narrow band (" << num_examined_tiles << " tiles examined)" << std::endl;
+    }
+    return;
+} // updateNarrowBand
+
 void
 RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
                           const Pointer<CellData<NDIM, double> > dist_init_data,
+                          const Box<NDIM>& relax_box,
                           const Pointer<Patch<NDIM> > patch,
                           const int iter) const
 {
@@ -576,7 +757,10 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
     }
 #endif
 
-    const Box<NDIM>& patch_box = patch->getBox();
+    const Box<NDIM>& patch_box = dist_data->getBox();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(patch_box.contains(relax_box));
+#endif
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
@@ -597,6 +781,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                    patch_box.lower(2),
                                    patch_box.upper(2),
+#endif
+                                   relax_box.lower(0),
+                                   relax_box.upper(0),
+                                   relax_box.lower(1),
+                                   relax_box.upper(1),
+#if (NDIM == 3)
+                                   relax_box.lower(2),
+                                   relax_box.upper(2),
 #endif
                                    dx,
                                    dir);
@@ -614,6 +806,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                        patch_box.lower(2),
                                        patch_box.upper(2),
+#endif
+                                       relax_box.lower(0),
+                                       relax_box.upper(0),
+                                       relax_box.lower(1),
+                                       relax_box.upper(1),
+#if (NDIM == 3)
+                                       relax_box.lower(2),
+                                       relax_box.upper(2),
 #endif
                                        dx,
                                        dir,
@@ -633,6 +833,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                         patch_box.lower(2),
                                         patch_box.upper(2),
+#endif
+                                        relax_box.lower(0),
+                                        relax_box.upper(0),
+                                        relax_box.lower(1),
+                                        relax_box.upper(1),
+#if (NDIM == 3)
+                                        relax_box.lower(2),
+                                        relax_box.upper(2),
 #endif
                                         dx,
                                         dir,
@@ -652,6 +860,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                         patch_box.lower(2),
                                         patch_box.upper(2),
+#endif
+                                        relax_box.lower(0),
+                                        relax_box.upper(0),
+                                        relax_box.lower(1),
+                                        relax_box.upper(1),
+#if (NDIM == 3)
+                                        relax_box.lower(2),
+                                        relax_box.upper(2),
 #endif
                                         dx,
                                         dir,
@@ -1014,6 +1230,14 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_apply_volume_shift = input_db->getBoolWithDefault("apply_volume_shift", d_apply_volume_shift);
 
+    d_narrow_band_cells = input_db->getIntegerWithDefault("narrow_band_cells", d_narrow_band_cells);
+    d_narrow_band_tile_size = input_db->getIntegerWithDefault("narrow_band_tile_size", d_narrow_band_tile_size);
+    if (d_narrow_band_tile_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  narrow_band_tile_size must be positive." << std::endl);
+    }
+
     return;
 } // getFromInput
 
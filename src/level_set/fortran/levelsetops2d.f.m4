@@ -331,6 +331,7 @@ c     The distance value imposed at the boundary should be zero
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
@@ -339,6 +340,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
      &     dx,
      &     dir)
 c
@@ -350,6 +353,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -365,8 +370,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = tlower1,tupper1
+          do i0 = tlower0,tupper0
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -374,8 +379,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tlower1,tupper1
+          do i0 = tupper0,tlower0,-1
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -383,8 +388,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = tupper1,tlower1,-1
+          do i0 = tlower0,tupper0
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -392,8 +397,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tupper1,tlower1,-1
+          do i0 = tupper0,tlower0,-1
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -471,6 +476,7 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out third order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c     NOTE: this scheme is between between third and fourth
 c     order near the interface and second order everywhere else
 c
@@ -484,6 +490,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
      &     dx,
      &     dir,
      &     use_subcell,
@@ -497,6 +505,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
       INTEGER use_subcell,use_sign_fix
@@ -513,8 +523,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = tlower1,tupper1
+          do i0 = tlower0,tupper0
               call evalrelax3rdordereno2d(U,U_gcw,V,V_gcw,
      &                                    ilower0,iupper0,
      &                                    ilower1,iupper1,
@@ -523,8 +533,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tlower1,tupper1
+          do i0 = tupper0,tlower0,-1
               call evalrelax3rdordereno2d(U,U_gcw,V,V_gcw,
      &                                    ilower0,iupper0,
      &                                    ilower1,iupper1,
@@ -533,8 +543,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = tupper1,tlower1,-1
+          do i0 = tlower0,tupper0
               call evalrelax3rdordereno2d(U,U_gcw,V,V_gcw,
      &                                    ilower0,iupper0,
      &                                    ilower1,iupper1,
@@ -543,8 +553,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tupper1,tlower1,-1
+          do i0 = tupper0,tlower0,-1
               call evalrelax3rdordereno2d(U,U_gcw,V,V_gcw,
      &                                    ilower0,iupper0,
      &                                    ilower1,iupper1,
@@ -878,6 +888,7 @@ c         Compute ENO differences with subcell fix
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out third order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c
 c     Uses third order WENO for spatial discretization with a subcell
 c     fix near the interface
@@ -889,6 +900,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
      &     dx,
      &     dir,
      &     use_subcell,
@@ -902,6 +915,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
       INTEGER use_subcell,use_sign_fix
@@ -918,8 +933,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = tlower1,tupper1
+          do i0 = tlower0,tupper0
               call evalrelax3rdorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -928,8 +943,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tlower1,tupper1
+          do i0 = tupper0,tlower0,-1
               call evalrelax3rdorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -938,8 +953,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = tupper1,tlower1,-1
+          do i0 = tlower0,tupper0
               call evalrelax3rdorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -948,8 +963,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tupper1,tlower1,-1
+          do i0 = tupper0,tlower0,-1
               call evalrelax3rdorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -1386,6 +1401,7 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out fifth order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c
 c     Uses fifth order WENO for spatial discretization
 c
@@ -1396,6 +1412,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
      &     dx,
      &     dir,
      &     use_sign_fix)
@@ -1408,6 +1426,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
       INTEGER U_gcw,V_gcw
       INTEGER dir,use_sign_fix
 
@@ -1423,8 +1443,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = tlower1,tupper1
+          do i0 = tlower0,tupper0
               call evalrelax5thorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -1432,8 +1452,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tlower1,tupper1
+          do i0 = tupper0,tlower0,-1
               call evalrelax5thorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -1441,8 +1461,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = tupper1,tlower1,-1
+          do i0 = tlower0,tupper0
               call evalrelax5thorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
@@ -1450,8 +1470,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tupper1,tlower1,-1
+          do i0 = tupper0,tlower0,-1
               call evalrelax5thorderweno2d(U,U_gcw,V,V_gcw,
      &                                     ilower0,iupper0,
      &                                     ilower1,iupper1,
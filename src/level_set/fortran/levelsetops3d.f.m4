@@ -491,6 +491,7 @@ c     Algorithm to find dbar
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
@@ -500,6 +501,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
+     &     tlower2,tupper2,
      &     dx,
      &     dir)
 c
@@ -512,6 +516,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
+      INTEGER tlower2,tupper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -527,9 +534,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -539,9 +546,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -551,9 +558,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -563,9 +570,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -575,9 +582,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -587,9 +594,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -599,9 +606,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -611,9 +618,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -702,6 +709,7 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out third order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c     NOTE: this scheme is between third and fourth
 c     order near the interface and second order everywhere else
 c
@@ -716,6 +724,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
+     &     tlower2,tupper2,
      &     dx,
      &     dir,use_subcell,
      &     use_sign_fix)
@@ -729,6 +740,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
+      INTEGER tlower2,tupper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
       INTEGER use_subcell,use_sign_fix
@@ -745,9 +759,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -758,9 +772,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -771,9 +785,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -784,9 +798,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -797,9 +811,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -810,9 +824,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -823,9 +837,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -836,9 +850,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdordereno3d(U,U_gcw,V,V_gcw,
      &                                      ilower0,iupper0,
      &                                      ilower1,iupper1,
@@ -1288,6 +1302,7 @@ c         Compute ENO differences with subcell fix
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out third order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c
 c     Uses third order WENO for spatial discretization with a subcell
 c     fix near the interface
@@ -1300,6 +1315,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
+     &     tlower2,tupper2,
      &     dx,
      &     dir,
      &     use_subcell,
@@ -1314,6 +1332,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
+      INTEGER tlower2,tupper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
       INTEGER use_subcell,use_sign_fix
@@ -1330,9 +1351,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1343,9 +1364,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1356,9 +1377,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1369,9 +1390,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1382,9 +1403,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1395,9 +1416,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1408,9 +1429,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -1421,9 +1442,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2025,6 +2046,7 @@ c           Compute first order derivatives
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out fifth order relaxation scheme using Gauss Seidel updates
+c     on the cells of the box (tlower,tupper) contained in the patch
 c
 c     Uses fifth order WENO for spatial discretization
 c
@@ -2036,6 +2058,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
+     &     tlower2,tupper2,
      &     dx,
      &     dir,
      &     use_sign_fix)
@@ -2048,6 +2073,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
+      INTEGER tlower2,tupper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
       INTEGER use_sign_fix
@@ -2064,9 +2092,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2077,9 +2105,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2090,9 +2118,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2103,9 +2131,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2116,9 +2144,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2129,9 +2157,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2142,9 +2170,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
@@ -2155,9 +2183,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax5thorderweno3d(U,U_gcw,V,V_gcw,
      &                                       ilower0,iupper0,
      &                                       ilower1,iupper1,
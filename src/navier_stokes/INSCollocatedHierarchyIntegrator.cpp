@@ -1248,6 +1248,7 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Solve for U(*) and compute u_ADV(*).
     d_hier_cc_data_ops->copyData(d_U_scratch_idx, d_U_new_idx);
     d_velocity_solver->solveSystem(*d_U_scratch_vec, *d_U_rhs_vec);
+    addSolverIterationsToPerformanceReport("velocity_solver", d_velocity_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name << "::integrateHierarchy(): velocity solve number of iterations = "
              << d_velocity_solver->getNumIterations() << "\n";
@@ -1292,6 +1293,7 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
         d_hier_cc_data_ops->setToScalar(d_Phi_idx, 0.0);
     }
     d_pressure_solver->solveSystem(*d_Phi_vec, *d_Phi_rhs_vec);
+    addSolverIterationsToPerformanceReport("pressure_solver", d_pressure_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name << "::integrateHierarchy(): pressure solve number of iterations = "
              << d_pressure_solver->getNumIterations() << "\n";
@@ -1870,6 +1872,14 @@ INSCollocatedHierarchyIntegrator::setupPlotDataSpecialized()
     return;
 } // setupPlotDataSpecialized
 
+void
+INSCollocatedHierarchyIntegrator::registerPerformanceReportValuesSpecialized()
+{
+    registerSolverIterationsWithPerformanceReport("velocity_solver");
+    registerSolverIterationsWithPerformanceReport("pressure_solver");
+    return;
+} // registerPerformanceReportValuesSpecialized
+
 void
 INSCollocatedHierarchyIntegrator::regridProjection()
 {
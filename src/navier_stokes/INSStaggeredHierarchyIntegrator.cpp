@@ -1428,6 +1428,7 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
 
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    addSolverIterationsToPerformanceReport("stokes_solver", d_stokes_solver->getNumIterations());
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -2392,6 +2393,13 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     return;
 } // setupPlotDataSpecialized
 
+void
+INSStaggeredHierarchyIntegrator::registerPerformanceReportValuesSpecialized()
+{
+    registerSolverIterationsWithPerformanceReport("stokes_solver");
+    return;
+} // registerPerformanceReportValuesSpecialized
+
 void
 INSStaggeredHierarchyIntegrator::regridProjection()
 {
@@ -1991,6 +1991,13 @@ INSVCStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     return;
 } // setupPlotDataSpecialized
 
+void
+INSVCStaggeredHierarchyIntegrator::registerPerformanceReportValuesSpecialized()
+{
+    registerSolverIterationsWithPerformanceReport("stokes_solver");
+    return;
+} // registerPerformanceReportValuesSpecialized
+
 void
 INSVCStaggeredHierarchyIntegrator::copySideToFace(const int U_fc_idx,
                                                   const int U_sc_idx,
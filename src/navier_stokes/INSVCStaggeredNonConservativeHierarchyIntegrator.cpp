@@ -764,6 +764,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy(const doubl
 
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    addSolverIterationsToPerformanceReport("stokes_solver", d_stokes_solver->getNumIterations());
 
     // Unscale rhs if necessary
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
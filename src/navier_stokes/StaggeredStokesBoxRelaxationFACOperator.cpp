@@ -18,6 +18,7 @@
 
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/box_utilities.h"
 
 #include "ArrayData.h"
 #include "BasePatchLevel.h"
@@ -43,14 +44,14 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-#include "petscksp.h"
 #include "petscmat.h"
-#include "petscpc.h"
 #include "petscsys.h"
-#include "petscvec.h"
+
+#include <Eigen/Dense>
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -283,150 +284,206 @@ buildBoxOperator(Mat& A,
     return;
 } // buildBoxOperator
 
-void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
-{
-    int ierr;
+// Number of degrees of freedom in the single-cell box operator: the 2*NDIM
+// velocity components on the faces of the cell and the cell pressure.
+static const int BOX_SIZE = 2 * NDIM + 1;
 
-    const double D = U_problem_coefs.getDConstant();
+// Under-relaxation factor used by the box smoother.
+static const double OMEGA = 0.65;
+
+// Raw access to the patch data used by the box smoother.
+struct BoxRelaxationPatchData
+{
+    std::array<double*, NDIM> U_e;
+    std::array<const double*, NDIM> U_r;
+    std::array<hier::Index<NDIM>, NDIM> U_lower;
+    std::array<std::array<int, NDIM>, NDIM> U_stride;
+    double* P_e;
+    const double* P_r;
+    hier::Index<NDIM> P_lower;
+    std::array<int, NDIM> P_stride;
+};
+
+BoxRelaxationPatchData
+getPatchData(SideData<NDIM, double>& U_error_data,
+             CellData<NDIM, double>& P_error_data,
+             const SideData<NDIM, double>& U_residual_data,
+             const CellData<NDIM, double>& P_residual_data)
+{
+    BoxRelaxationPatchData data;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const Box<NDIM>& data_box = U_error_data.getArrayData(axis).getBox();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(data_box == U_residual_data.getArrayData(axis).getBox());
+#endif
+        data.U_e[axis] = U_error_data.getPointer(axis);
+        data.U_r[axis] = U_residual_data.getPointer(axis);
+        data.U_lower[axis] = data_box.lower();
+        compute_strides(data.U_stride[axis], data_box);
+    }
+    const Box<NDIM>& data_box = P_error_data.getArrayData().getBox();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(data_box == P_residual_data.getArrayData().getBox());
+#endif
+    data.P_e = P_error_data.getPointer();
+    data.P_r = P_residual_data.getPointer();
+    data.P_lower = data_box.lower();
+    compute_strides(data.P_stride, data_box);
+    return data;
+} // getPatchData
+
+// Solve the local Stokes problem on the cell with index i using the current
+// values of the error at the surrounding degrees of freedom as boundary
+// values.  The local ordering of the unknowns is the same as the one used by
+// buildBoxOperator().
+inline void
+solveBox(double* const x,
+         const BoxRelaxationPatchData& data,
+         const hier::Index<NDIM>& i,
+         const double* const A_inv,
+         const double D,
+         const double* const dx)
+{
+    std::array<double, BOX_SIZE> rhs;
+    const int P_idx = compute_offset(i, data.P_lower, data.P_stride);
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        const double* const U_e = data.U_e[axis];
+        const std::array<int, NDIM>& stride = data.U_stride[axis];
+        const int lower_idx = compute_offset(i, data.U_lower[axis], stride);
+        const int upper_idx = lower_idx + stride[axis];
+        double rhs_lower = data.U_r[axis][lower_idx];
+        double rhs_upper = data.U_r[axis][upper_idx];
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            hier::Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
-            for (unsigned int d = 0; d < NDIM; ++d)
+            const double fac = D / (dx[d] * dx[d]);
+            if (d == axis)
             {
-                hier::Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
-                if (!side_box.contains(u_rght))
-                {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
-                }
+                rhs_lower += fac * U_e[lower_idx - stride[d]];
+                rhs_upper += fac * U_e[upper_idx + stride[d]];
             }
-
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
-            {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            if (!box.contains(p_rght))
+            else
             {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
+                rhs_lower += fac * (U_e[lower_idx - stride[d]] + U_e[lower_idx + stride[d]]);
+                rhs_upper += fac * (U_e[upper_idx - stride[d]] + U_e[upper_idx + stride[d]]);
             }
         }
+        rhs_lower += data.P_e[P_idx - data.P_stride[axis]] / dx[axis];
+        rhs_upper -= data.P_e[P_idx + data.P_stride[axis]] / dx[axis];
+        rhs[2 * axis] = rhs_lower;
+        rhs[2 * axis + 1] = rhs_upper;
     }
+    rhs[2 * NDIM] = data.P_r[P_idx];
 
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // modifyRhsForBcs
-
-inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    for (int k = 0; k < BOX_SIZE; ++k)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        double sum = 0.0;
+        for (int l = 0; l < BOX_SIZE; ++l)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            sum += A_inv[k * BOX_SIZE + l] * rhs[l];
         }
+        x[k] = sum;
     }
+    return;
+} // solveBox
 
-    for (Box<NDIM>::Iterator b(box); b; b++)
+// Update the error on the cell with index i using the (under-relaxed) solution
+// of the local Stokes problem.
+inline void
+updateBox(BoxRelaxationPatchData& data, const hier::Index<NDIM>& i, const double* const x)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
+        double* const U_e = data.U_e[axis];
+        const int lower_idx = compute_offset(i, data.U_lower[axis], data.U_stride[axis]);
+        const int upper_idx = lower_idx + data.U_stride[axis][axis];
+        U_e[lower_idx] = (1.0 - OMEGA) * U_e[lower_idx] + OMEGA * x[2 * axis];
+        U_e[upper_idx] = (1.0 - OMEGA) * U_e[upper_idx] + OMEGA * x[2 * axis + 1];
     }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
+    double& P_e = data.P_e[compute_offset(i, data.P_lower, data.P_stride)];
+    P_e = (1.0 - OMEGA) * P_e + OMEGA * x[2 * NDIM];
     return;
-} // copyToVec
+} // updateBox
 
-inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
+// Perform one lexicographically ordered (multiplicative) sweep over the cells
+// in the patch box.
+void
+smoothPatchLexicographic(BoxRelaxationPatchData& data,
+                         const Box<NDIM>& patch_box,
+                         const double* const A_inv,
+                         const double D,
+                         const double* const dx)
 {
-    int ierr;
-
-    const double omega = 0.65;
-
-    double U;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    std::array<double, BOX_SIZE> x;
+    const int num_rows = get_number_of_rows(patch_box);
+    const int row_length = patch_box.numberCells(0);
+    for (int row = 0; row < num_rows; ++row)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        hier::Index<NDIM> i = get_row_start(patch_box, row);
+        for (int k = 0; k < row_length; ++k, ++i(0))
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            solveBox(x.data(), data, i, A_inv, D, dx);
+            updateBox(data, i, x.data());
         }
     }
+    return;
+} // smoothPatchLexicographic
 
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
+// Perform one red-black ordered sweep over the cells in the patch box.  Cells
+// of one color do not share any degrees of freedom, so all of the local
+// problems of a color are solved before any of the corresponding updates are
+// applied.  This makes the result independent of the order in which cells of
+// the same color are processed, so the cells may be processed concurrently.
+void
+smoothPatchRedBlack(BoxRelaxationPatchData& data,
+                    const Box<NDIM>& patch_box,
+                    const double* const A_inv,
+                    const double D,
+                    const double* const dx,
+                    std::vector<double>& x_buffer)
+{
+    const int num_rows = get_number_of_rows(patch_box);
+    const int row_length = patch_box.numberCells(0);
+    x_buffer.resize(static_cast<std::size_t>(BOX_SIZE) * num_rows * ((row_length + 1) / 2));
+    double* const x_data = x_buffer.data();
+    for (int color = 0; color < 2; ++color)
     {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
+#if defined(IBTK_HAVE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int row = 0; row < num_rows; ++row)
+        {
+            hier::Index<NDIM> i = get_row_start(patch_box, row);
+            int parity = 0;
+            for (unsigned int d = 0; d < NDIM; ++d) parity += i(d);
+            const int k_start = ((parity % 2) + 2 + color) % 2;
+            i(0) += k_start;
+            double* x = x_data + static_cast<std::size_t>(BOX_SIZE) * row * ((row_length + 1) / 2);
+            for (int k = k_start; k < row_length; k += 2, i(0) += 2, x += BOX_SIZE)
+            {
+                solveBox(x, data, i, A_inv, D, dx);
+            }
+        }
+#if defined(IBTK_HAVE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int row = 0; row < num_rows; ++row)
+        {
+            hier::Index<NDIM> i = get_row_start(patch_box, row);
+            int parity = 0;
+            for (unsigned int d = 0; d < NDIM; ++d) parity += i(d);
+            const int k_start = ((parity % 2) + 2 + color) % 2;
+            i(0) += k_start;
+            const double* x = x_data + static_cast<std::size_t>(BOX_SIZE) * row * ((row_length + 1) / 2);
+            for (int k = k_start; k < row_length; k += 2, i(0) += 2, x += BOX_SIZE)
+            {
+                updateBox(data, i, x);
+            }
+        }
     }
     return;
-} // copyFromVec
+} // smoothPatchRedBlack
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -437,7 +494,11 @@ StaggeredStokesBoxRelaxationFACOperator::StaggeredStokesBoxRelaxationFACOperator
     const std::string& default_options_prefix)
     : StaggeredStokesFACPreconditionerStrategy(object_name, GHOSTS, input_db, default_options_prefix)
 {
-    // intentionally blank
+    if (input_db)
+    {
+        if (input_db->keyExists("use_red_black_ordering"))
+            d_use_red_black_ordering = input_db->getBool("use_red_black_ordering");
+    }
     return;
 } // StaggeredStokesBoxRelaxationFACOperator
 
@@ -457,7 +518,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -570,11 +630,9 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
         }
 
         // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        const double* const A_inv = d_box_op_inv[level_num].data();
+        const double D = d_U_problem_coefs.getDConstant();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<SideData<NDIM, double> > U_error_data = error.getComponentPatchData(0, *patch);
@@ -597,16 +655,15 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            BoxRelaxationPatchData data =
+                getPatchData(*U_error_data, *P_error_data, *U_residual_data, *P_residual_data);
+            if (d_use_red_black_ordering)
             {
-                const hier::Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                smoothPatchRedBlack(data, patch_box, A_inv, D, dx, d_box_x_buffer);
+            }
+            else
+            {
+                smoothPatchLexicographic(data, patch_box, A_inv, D, dx);
             }
         }
     }
@@ -627,14 +684,16 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
+    //
+    // The single-cell box operator has constant coefficients on each level, so
+    // we form its inverse once per level and apply it directly in the smoother.
+    d_box_op_inv.resize(d_finest_ln + 1);
     const Box<NDIM> box(hier::Index<NDIM>(0), hier::Index<NDIM>(0));
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
     std::array<double, NDIM> dx;
+    std::array<int, BOX_SIZE> idxs;
+    for (int k = 0; k < BOX_SIZE; ++k) idxs[k] = k;
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
     {
         const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
@@ -642,27 +701,21 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
+        Mat box_op;
+        buildBoxOperator(box_op, d_U_problem_coefs, box, box, dx);
+        Eigen::Matrix<double, BOX_SIZE, BOX_SIZE, Eigen::RowMajor> A;
+        int ierr = MatGetValues(box_op, BOX_SIZE, idxs.data(), BOX_SIZE, idxs.data(), A.data());
         IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
+        ierr = MatDestroy(&box_op);
         IBTK_CHKERRQ(ierr);
+        const Eigen::FullPivLU<Eigen::Matrix<double, BOX_SIZE, BOX_SIZE, Eigen::RowMajor> > A_lu(A);
+        if (!A_lu.isInvertible())
+        {
+            TBOX_ERROR(d_object_name << "::initializeOperatorStateSpecialized():\n"
+                                     << "  box operator on level " << ln << " is singular" << std::endl);
+        }
+        const Eigen::Matrix<double, BOX_SIZE, BOX_SIZE, Eigen::RowMajor> A_inv = A_lu.inverse();
+        d_box_op_inv[ln].assign(A_inv.data(), A_inv.data() + BOX_SIZE * BOX_SIZE);
     }
 
     // Get overlap information for setting patch boundary conditions.
@@ -716,15 +769,7 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        d_box_op_inv[ln].clear();
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
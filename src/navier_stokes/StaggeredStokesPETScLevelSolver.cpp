@@ -162,11 +162,15 @@ void
 StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVectorReal<NDIM, double>& x,
                                                                   const SAMRAIVectorReal<NDIM, double>& /*b*/)
 {
-    // Allocate DOF index data.
+    // Allocate DOF index data.  The DOF indices are kept from the previous call
+    // when the matrix structure is reused.
     if (!d_level->checkAllocated(d_u_dof_index_idx)) d_level->allocatePatchData(d_u_dof_index_idx);
     if (!d_level->checkAllocated(d_p_dof_index_idx)) d_level->allocatePatchData(d_p_dof_index_idx);
-    StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
-        d_num_dofs_per_proc, d_u_dof_index_idx, d_p_dof_index_idx, d_level);
+    if (!d_reuse_level_data)
+    {
+        StaggeredStokesPETScVecUtilities::constructPatchLevelDOFIndices(
+            d_num_dofs_per_proc, d_u_dof_index_idx, d_p_dof_index_idx, d_level);
+    }
 
     // Setup PETSc objects.
     int ierr;
@@ -182,7 +186,8 @@ StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVe
                                                                      d_num_dofs_per_proc,
                                                                      d_u_dof_index_idx,
                                                                      d_p_dof_index_idx,
-                                                                     d_level);
+                                                                     d_level,
+                                                                     d_reuse_level_data);
     d_petsc_pc = d_petsc_mat;
 
     // Set pressure nullspace if the level covers the entire domain.
@@ -236,7 +241,8 @@ StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVe
 void
 StaggeredStokesPETScLevelSolver::deallocateSolverStateSpecialized()
 {
-    // Deallocate DOF index data.
+    // Deallocate DOF index data unless it may be reused.
+    if (d_reuse_mat_structure) return;
     if (d_level->checkAllocated(d_u_dof_index_idx)) d_level->deallocatePatchData(d_u_dof_index_idx);
     if (d_level->checkAllocated(d_p_dof_index_idx)) d_level->deallocatePatchData(d_p_dof_index_idx);
     return;
@@ -14,7 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/IrregularWaveBcCoef.h"
-#include "ibamr/RNG.h"
+#include "ibamr/IrregularWaveSpectrum.h"
 
 #include "ibtk/IBTK_MPI.h"
 
@@ -34,6 +34,7 @@
 #include <fstream>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "ibamr/namespaces.h"
 
@@ -46,7 +47,6 @@ namespace IBAMR
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
-static const unsigned SEED = 1234567;
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -68,70 +68,9 @@ IrregularWaveBcCoef::IrregularWaveBcCoef(std::string object_name,
     // Get wave parameters.
     getFromInput(input_db);
 
-    // Resize vectors according to number of wave components
-    d_amplitude.resize(d_num_waves);
-    d_wave_number.resize(d_num_waves);
-    d_omega.resize(d_num_waves);
-    d_phase.resize(d_num_waves);
-
-    double delta_omega = std::abs(d_omega_end - d_omega_begin) / (d_num_waves - 1);
-    double omega_s = 2 * M_PI / d_Ts;
-
-    RNG::srandgen(SEED);
-
-    // Calculating component waves
-    {
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            double rn;
-            RNG::genrand(&rn);
-            d_phase[i] = 2 * M_PI * rn;
-
-            d_omega[i] = d_omega_begin + i * delta_omega;
-
-            // Using an approximate formula for the dispersion relationship, calculate
-            // the wave number.
-            // See Eqn. (5.4.22) in WAVES IN OCEANIC AND COASTAL WATERS by LEO H.
-            // HOLTHUIJSEN.
-            const double alpha = std::pow(d_omega[i], 2) * d_depth / d_gravity;
-            const double beta = alpha * std::pow(tanh(alpha), -0.5);
-            d_wave_number[i] = (alpha + std::pow(beta, 2) * std::pow(cosh(beta), -2)) /
-                               (d_depth * (tanh(beta) + beta * std::pow(cosh(beta), -2)));
-
-            double spectral_density = std::numeric_limits<double>::quiet_NaN();
-            ;
-            if (d_wave_spectrum == "JONSWAP")
-            {
-                double sigma, A, gamma = 3.3;
-                ;
-                if (d_omega[i] <= omega_s)
-                    sigma = 0.07;
-                else
-                    sigma = 0.09;
-
-                A = std::exp(-std::pow((d_omega[i] / omega_s - 1) / (sigma * std::sqrt(2)), 2));
-
-                spectral_density = 320 * std::pow(d_Hs, 2) / (std::pow(d_Ts, 4) * std::pow(d_omega[i], 5)) *
-                                   std::exp(-1950.0 / (std::pow(d_Ts * d_omega[i], 4))) * std::pow(gamma, A);
-            }
-            else if (d_wave_spectrum == "BRETSCHNEIDER")
-            {
-                spectral_density = 173 * std::pow(d_Hs, 2) / (std::pow(d_Ts, 4) * std::pow(d_omega[i], 5)) *
-                                   std::exp(-692.0 / (std::pow(d_Ts * d_omega[i], 4)));
-            }
-            else
-            {
-                TBOX_ERROR(
-                    "IrregularWaveBcCoef::IrregularWaveBcCoef(): Unknown wave "
-                    "spectrum type "
-                    << d_wave_spectrum
-                    << " .This class supports only JONSWAP "
-                       "and BRETSCHNEIDER wave spectra.");
-            }
-
-            d_amplitude[i] = std::sqrt(2.0 * spectral_density * delta_omega);
-        }
-    }
+    // Calculate the component waves.
+    d_spectrum.reset(new IrregularWaveSpectrum(
+        d_num_waves, d_omega_begin, d_omega_end, d_Hs, d_Ts, d_wave_spectrum, d_depth, d_gravity));
 
     if (!IBTK_MPI::getRank())
     {
@@ -139,10 +78,13 @@ IrregularWaveBcCoef::IrregularWaveBcCoef(std::string object_name,
         wave_stream.open("irregular_wave.txt", std::fstream::out);
         wave_stream.precision(10);
 
+        const std::vector<double>& amplitude = d_spectrum->getAmplitudes();
+        const std::vector<double>& omega = d_spectrum->getAngularFrequencies();
+        const std::vector<double>& wave_number = d_spectrum->getWaveNumbers();
+        const std::vector<double>& phase = d_spectrum->getPhases();
         for (int i = 0; i < d_num_waves; ++i)
         {
-            wave_stream << d_amplitude[i] << "\t" << d_omega[i] << "\t" << d_wave_number[i] << "\t" << d_phase[i]
-                        << std::endl;
+            wave_stream << amplitude[i] << "\t" << omega[i] << "\t" << wave_number[i] << "\t" << phase[i] << std::endl;
         }
 
         wave_stream.close();
@@ -199,6 +141,15 @@ IrregularWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
         TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
+        // The inlet values only depend on the boundary box and the time, so reuse
+        // the values computed by an earlier call at the same time.
+        if (gcoef_data && d_inlet_cache.getCachedBcCoefs(*gcoef_data, patch, fill_time))
+        {
+            if (acoef_data) acoef_data->fillAll(1.0);
+            if (bcoef_data) bcoef_data->fillAll(0.0);
+            return;
+        }
+
         for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
         {
             const SAMRAI::hier::Index<NDIM>& i = b();
@@ -237,6 +188,7 @@ IrregularWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
                 (*gcoef_data)(i, 0) = h_phi * getVelocity(dof_posn[0], z_plus_d, fill_time);
             }
         }
+        if (gcoef_data) d_inlet_cache.cacheBcCoefs(*gcoef_data, patch, fill_time);
     }
     return;
 } // setBcCoefs
@@ -273,62 +225,13 @@ IrregularWaveBcCoef::getFromInput(Pointer<Database> input_db)
 double
 IrregularWaveBcCoef::getSurfaceElevation(double x, double time) const
 {
-    double eta = 0;
-    for (int i = 0; i < d_num_waves; i++)
-    {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
-    }
-
-    return eta;
+    return d_spectrum->getSurfaceElevation(x, time);
 } // getSurfaceElevation
 
 double
 IrregularWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
 {
-    if (d_comp_idx == 0)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
-    if (d_comp_idx == 1)
-    {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
-    }
-#if (NDIM == 3)
-    if (d_comp_idx == 2)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
-#endif
-
-    return std::numeric_limits<double>::signaling_NaN();
-    ;
+    return d_spectrum->getVelocity(x, z_plus_d, time, d_comp_idx);
 } // getVelocity
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
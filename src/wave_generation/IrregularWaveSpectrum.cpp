@@ -0,0 +1,251 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/IrregularWaveSpectrum.h"
+#include "ibamr/RNG.h"
+
+#include "tbox/Utilities.h"
+
+#include <cmath>
+#include <limits>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const unsigned SEED = 1234567;
+
+// The maximum number of cached time levels.  When this limit is reached, the
+// table for the earliest time is discarded.
+static const std::size_t MAX_CACHED_TIMES = 8;
+
+// The maximum number of cached positions.  The position tables are cleared
+// when this limit is reached.
+static const std::size_t MAX_CACHED_POSITIONS = 4096;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+IrregularWaveSpectrum::IrregularWaveSpectrum(const int num_waves,
+                                             const double omega_begin,
+                                             const double omega_end,
+                                             const double Hs,
+                                             const double Ts,
+                                             const std::string& wave_spectrum,
+                                             const double depth,
+                                             const double gravity)
+    : d_num_waves(num_waves),
+      d_depth(depth),
+      d_amplitude(num_waves),
+      d_omega(num_waves),
+      d_wave_number(num_waves),
+      d_phase(num_waves)
+{
+    const double delta_omega = std::abs(omega_end - omega_begin) / (d_num_waves - 1);
+    const double omega_s = 2 * M_PI / Ts;
+
+    RNG::srandgen(SEED);
+
+    // Calculating component waves
+    for (int i = 0; i < d_num_waves; i++)
+    {
+        double rn;
+        RNG::genrand(&rn);
+        d_phase[i] = 2 * M_PI * rn;
+
+        d_omega[i] = omega_begin + i * delta_omega;
+
+        // Using an approximate formula for the dispersion relationship, calculate the wave number.
+        // See Eqn. (5.4.22) in WAVES IN OCEANIC AND COASTAL WATERS by LEO H. HOLTHUIJSEN.
+        const double alpha = std::pow(d_omega[i], 2) * d_depth / gravity;
+        const double beta = alpha * std::pow(tanh(alpha), -0.5);
+        d_wave_number[i] = (alpha + std::pow(beta, 2) * std::pow(cosh(beta), -2)) /
+                           (d_depth * (tanh(beta) + beta * std::pow(cosh(beta), -2)));
+
+        double spectral_density = std::numeric_limits<double>::quiet_NaN();
+
+        if (wave_spectrum == "JONSWAP")
+        {
+            double sigma, A, gamma = 3.3;
+
+            sigma = d_omega[i] <= omega_s ? 0.07 : 0.09;
+
+            A = std::exp(-std::pow((d_omega[i] / omega_s - 1) / (sigma * std::sqrt(2)), 2));
+
+            spectral_density = 320 * std::pow(Hs, 2) / (std::pow(Ts, 4) * std::pow(d_omega[i], 5)) *
+                               std::exp(-1950.0 / (std::pow(Ts * d_omega[i], 4))) * std::pow(gamma, A);
+        }
+        else if (wave_spectrum == "BRETSCHNEIDER")
+        {
+            spectral_density = 173 * std::pow(Hs, 2) / (std::pow(Ts, 4) * std::pow(d_omega[i], 5)) *
+                               std::exp(-692.0 / (std::pow(Ts * d_omega[i], 4)));
+        }
+        else
+        {
+            TBOX_ERROR("IrregularWaveSpectrum::IrregularWaveSpectrum(): Unknown wave spectrum type "
+                       << wave_spectrum << " .This class supports only JONSWAP and BRETSCHNEIDER wave spectra.");
+        }
+        d_amplitude[i] = std::sqrt(2.0 * spectral_density * delta_omega);
+    }
+    return;
+} // IrregularWaveSpectrum
+
+int
+IrregularWaveSpectrum::getNumberOfWaves() const
+{
+    return d_num_waves;
+} // getNumberOfWaves
+
+const std::vector<double>&
+IrregularWaveSpectrum::getAmplitudes() const
+{
+    return d_amplitude;
+} // getAmplitudes
+
+const std::vector<double>&
+IrregularWaveSpectrum::getAngularFrequencies() const
+{
+    return d_omega;
+} // getAngularFrequencies
+
+const std::vector<double>&
+IrregularWaveSpectrum::getWaveNumbers() const
+{
+    return d_wave_number;
+} // getWaveNumbers
+
+const std::vector<double>&
+IrregularWaveSpectrum::getPhases() const
+{
+    return d_phase;
+} // getPhases
+
+double
+IrregularWaveSpectrum::getSurfaceElevation(const double x, const double time) const
+{
+    // cos(theta) = cos(k x) cos(phase - omega t) - sin(k x) sin(phase - omega t)
+    const double* const cos_kx = getHorizontalTable(x).data();
+    const double* const sin_kx = cos_kx + d_num_waves;
+    const double* const cos_psi = getTimeTable(time).data();
+    const double* const sin_psi = cos_psi + d_num_waves;
+    const double* const amplitude = d_amplitude.data();
+    double eta = 0.0;
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        eta += amplitude[i] * (cos_kx[i] * cos_psi[i] - sin_kx[i] * sin_psi[i]);
+    }
+    return eta;
+} // getSurfaceElevation
+
+double
+IrregularWaveSpectrum::getVelocity(const double x, const double z_plus_d, const double time, const int comp_idx) const
+{
+    const double* const cos_kx = getHorizontalTable(x).data();
+    const double* const sin_kx = cos_kx + d_num_waves;
+    const double* const cos_psi = getTimeTable(time).data();
+    const double* const sin_psi = cos_psi + d_num_waves;
+    const double* const cosh_kz = getVerticalTable(z_plus_d).data();
+    const double* const sinh_kz = cosh_kz + d_num_waves;
+    double velocity_component = 0.0;
+    if (comp_idx == 0)
+    {
+        for (int i = 0; i < d_num_waves; ++i)
+        {
+            velocity_component += cosh_kz[i] * (cos_kx[i] * cos_psi[i] - sin_kx[i] * sin_psi[i]);
+        }
+        return velocity_component;
+    }
+    if (comp_idx == NDIM - 1)
+    {
+        // sin(theta) = sin(k x) cos(phase - omega t) + cos(k x) sin(phase - omega t)
+        for (int i = 0; i < d_num_waves; ++i)
+        {
+            velocity_component += sinh_kz[i] * (sin_kx[i] * cos_psi[i] + cos_kx[i] * sin_psi[i]);
+        }
+        return velocity_component;
+    }
+#if (NDIM == 3)
+    if (comp_idx == 1)
+    {
+        return 0.0;
+    }
+#endif
+    return std::numeric_limits<double>::signaling_NaN();
+} // getVelocity
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+const std::vector<double>&
+IrregularWaveSpectrum::getTimeTable(const double time) const
+{
+    auto it = d_time_tables.find(time);
+    if (it != d_time_tables.end()) return it->second;
+    if (d_time_tables.size() >= MAX_CACHED_TIMES) d_time_tables.erase(d_time_tables.begin());
+    std::vector<double>& table = d_time_tables[time];
+    table.resize(2 * d_num_waves);
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        const double psi = d_phase[i] - d_omega[i] * time;
+        table[i] = std::cos(psi);
+        table[d_num_waves + i] = std::sin(psi);
+    }
+    return table;
+} // getTimeTable
+
+const std::vector<double>&
+IrregularWaveSpectrum::getHorizontalTable(const double x) const
+{
+    auto it = d_horizontal_tables.find(x);
+    if (it != d_horizontal_tables.end()) return it->second;
+    if (d_horizontal_tables.size() >= MAX_CACHED_POSITIONS) d_horizontal_tables.clear();
+    std::vector<double>& table = d_horizontal_tables[x];
+    table.resize(2 * d_num_waves);
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        const double kx = d_wave_number[i] * x;
+        table[i] = std::cos(kx);
+        table[d_num_waves + i] = std::sin(kx);
+    }
+    return table;
+} // getHorizontalTable
+
+const std::vector<double>&
+IrregularWaveSpectrum::getVerticalTable(const double z_plus_d) const
+{
+    auto it = d_vertical_tables.find(z_plus_d);
+    if (it != d_vertical_tables.end()) return it->second;
+    if (d_vertical_tables.size() >= MAX_CACHED_POSITIONS) d_vertical_tables.clear();
+    std::vector<double>& table = d_vertical_tables[z_plus_d];
+    table.resize(2 * d_num_waves);
+    for (int i = 0; i < d_num_waves; ++i)
+    {
+        const double fac = d_amplitude[i] * d_omega[i] / sinh(d_wave_number[i] * d_depth);
+        table[i] = fac * cosh(d_wave_number[i] * z_plus_d);
+        table[d_num_waves + i] = fac * sinh(d_wave_number[i] * z_plus_d);
+    }
+    return table;
+} // getVerticalTable
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -118,6 +118,15 @@ StokesFifthOrderWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_
         TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
+        // The inlet values only depend on the boundary box and the time, so reuse
+        // the values computed by an earlier call at the same time.
+        if (gcoef_data && d_inlet_cache.getCachedBcCoefs(*gcoef_data, patch, fill_time))
+        {
+            if (acoef_data) acoef_data->fillAll(1.0);
+            if (bcoef_data) bcoef_data->fillAll(0.0);
+            return;
+        }
+
         for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
         {
             const SAMRAI::hier::Index<NDIM>& i = b();
@@ -156,6 +165,7 @@ StokesFifthOrderWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_
                 (*gcoef_data)(i, 0) = h_phi * getVelocity(dof_posn[0], z_plus_d, fill_time);
             }
         }
+        if (gcoef_data) d_inlet_cache.cacheBcCoefs(*gcoef_data, patch, fill_time);
     }
     return;
 } // setBcCoefs
@@ -110,6 +110,15 @@ StokesFirstOrderWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_
         TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
+        // The inlet values only depend on the boundary box and the time, so reuse
+        // the values computed by an earlier call at the same time.
+        if (gcoef_data && d_inlet_cache.getCachedBcCoefs(*gcoef_data, patch, fill_time))
+        {
+            if (acoef_data) acoef_data->fillAll(1.0);
+            if (bcoef_data) bcoef_data->fillAll(0.0);
+            return;
+        }
+
         const double fac = (d_gravity * d_wave_number * d_amplitude) / d_omega;
         double dof_posn[NDIM];
         for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
@@ -169,6 +178,7 @@ StokesFirstOrderWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_
             }
 #endif
         }
+        if (gcoef_data) d_inlet_cache.cacheBcCoefs(*gcoef_data, patch, fill_time);
     }
     return;
 } // setBcCoefs
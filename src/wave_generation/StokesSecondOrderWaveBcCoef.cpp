@@ -110,6 +110,15 @@ StokesSecondOrderWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef
         TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
+        // The inlet values only depend on the boundary box and the time, so reuse
+        // the values computed by an earlier call at the same time.
+        if (gcoef_data && d_inlet_cache.getCachedBcCoefs(*gcoef_data, patch, fill_time))
+        {
+            if (acoef_data) acoef_data->fillAll(1.0);
+            if (bcoef_data) bcoef_data->fillAll(0.0);
+            return;
+        }
+
         const double H = 2.0 * d_amplitude;
         const double fac1 = (0.5 * H * d_gravity * d_wave_number) / d_omega;
         const double fac2 = (3.0 * H * H * d_omega * d_wave_number) / 16.0;
@@ -184,6 +193,7 @@ StokesSecondOrderWaveBcCoef::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef
             }
 #endif
         }
+        if (gcoef_data) d_inlet_cache.cacheBcCoefs(*gcoef_data, patch, fill_time);
     }
     return;
 } // setBcCoefs
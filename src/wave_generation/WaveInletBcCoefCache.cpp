@@ -0,0 +1,106 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/WaveInletBcCoefCache.h"
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "Index.h"
+#include "Patch.h"
+#include "tbox/Pointer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// The maximum number of times for which values are cached.  When this limit is
+// reached, the values for the earliest time are discarded.
+static const std::size_t MAX_CACHED_TIMES = 4;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+bool
+WaveInletBcCoefCache::getCachedBcCoefs(ArrayData<NDIM, double>& gcoef_data,
+                                       const Patch<NDIM>& patch,
+                                       const double fill_time) const
+{
+    const auto time_it = d_cached_values.find(fill_time);
+    if (time_it == d_cached_values.end()) return false;
+    const auto it = time_it->second.find(getCacheKey(gcoef_data, patch));
+    if (it == time_it->second.end()) return false;
+    std::copy(it->second.begin(), it->second.end(), gcoef_data.getPointer(0));
+    return true;
+} // getCachedBcCoefs
+
+void
+WaveInletBcCoefCache::cacheBcCoefs(const ArrayData<NDIM, double>& gcoef_data,
+                                   const Patch<NDIM>& patch,
+                                   const double fill_time)
+{
+    if (!d_cached_values.count(fill_time) && d_cached_values.size() >= MAX_CACHED_TIMES)
+    {
+        d_cached_values.erase(d_cached_values.begin());
+    }
+    const double* const gcoef_vals = gcoef_data.getPointer(0);
+    d_cached_values[fill_time][getCacheKey(gcoef_data, patch)].assign(
+        gcoef_vals, gcoef_vals + gcoef_data.getBox().size());
+    return;
+} // cacheBcCoefs
+
+void
+WaveInletBcCoefCache::clear()
+{
+    d_cached_values.clear();
+    return;
+} // clear
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+WaveInletBcCoefCache::CacheKey
+WaveInletBcCoefCache::getCacheKey(const ArrayData<NDIM, double>& gcoef_data, const Patch<NDIM>& patch)
+{
+    const Box<NDIM>& bc_coef_box = gcoef_data.getBox();
+    const SAMRAI::hier::Index<NDIM>& patch_lower = patch.getBox().lower();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    CacheKey key;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        key.first[d] = bc_coef_box.lower()(d);
+        key.first[NDIM + d] = bc_coef_box.upper()(d);
+        key.first[2 * NDIM + d] = patch_lower(d);
+        key.second[d] = x_lower[d];
+        key.second[NDIM + d] = dx[d];
+    }
+    return key;
+} // getCacheKey
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,151 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that reusing the factorization of an RPY mobility matrix to solve
+// systems with the mobility matrix of slightly displaced nodes agrees with
+// factorizing the new matrix, and that the iterations fail without modifying
+// the right-hand side when the nodes are rotated by a quarter turn.
+
+#include <ibamr/DenseFactorizationPreconditioner.h>
+#include <ibamr/MobilityFunctions.h>
+#include <ibamr/ibamr_enums.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+
+#include <tbox/PIO.h>
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// Place the nodes on a helix that is a few grid cells wide so that both
+// branches of the RPY tensor are used, displace them by a fraction of the grid
+// spacing, and rotate them about the x axis.
+std::vector<double>
+get_positions(const int num_nodes, const double dx, const double amplitude, const double angle)
+{
+    std::vector<double> X(num_nodes * NDIM);
+    const double pi = 4.0 * std::atan(1.0);
+    for (int i = 0; i < num_nodes; ++i)
+    {
+        const double theta = 2.0 * pi * i / num_nodes;
+        const double x = 4.0 * dx * std::cos(theta) + amplitude * dx * std::sin(i + 1.0);
+        const double y = 4.0 * dx * std::sin(theta) + amplitude * dx * std::cos(2.0 * i);
+        const double z = 0.5 * dx * i + amplitude * dx * std::sin(3.0 * i);
+        X[i * NDIM] = x;
+        X[i * NDIM + 1] = std::cos(angle) * y - std::sin(angle) * z;
+        X[i * NDIM + 2] = std::sin(angle) * y + std::cos(angle) * z;
+    }
+    return X;
+} // get_positions
+
+double
+norm(const std::vector<double>& u)
+{
+    double sum = 0.0;
+    for (const double u_i : u) sum += u_i * u_i;
+    return std::sqrt(sum);
+} // norm
+
+double
+relative_difference(const std::vector<double>& u, const std::vector<double>& v)
+{
+    std::vector<double> diff(u.size());
+    for (unsigned int i = 0; i < u.size(); ++i) diff[i] = u[i] - v[i];
+    return norm(diff) / norm(v);
+} // relative_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "dense_factorization.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const double mu = input_db->getDouble("MU");
+        const double dx = input_db->getDouble("DX");
+        const int num_nodes = input_db->getInteger("num_nodes");
+        const double amplitude = input_db->getDouble("displacement_amplitude");
+        const double angle = input_db->getDouble("rotation_angle");
+        const double rel_tol = input_db->getDouble("rel_tol");
+        const int max_iterations = input_db->getInteger("max_iterations");
+        const std::string kernel_fcn = input_db->getString("kernel");
+        const int size = num_nodes * NDIM;
+
+        std::vector<double> b(size);
+        for (int k = 0; k < size; ++k) b[k] = std::cos(0.5 * k) + 0.25;
+
+        const auto get_mobility_matrix = [&](const double node_amplitude, const double node_angle)
+        {
+            std::vector<double> mm(size * size);
+            const std::vector<double> X = get_positions(num_nodes, dx, node_amplitude, node_angle);
+            MobilityFunctions::constructRPYMobilityMatrix(
+                kernel_fcn.c_str(), mu, dx, X.data(), num_nodes, 0.0, mm.data());
+            return mm;
+        };
+        const std::vector<double> mm = get_mobility_matrix(0.0, 0.0);
+        const std::vector<double> displaced_mm = get_mobility_matrix(amplitude, 0.0);
+        const std::vector<double> rotated_mm = get_mobility_matrix(0.0, angle);
+
+        std::ostringstream out;
+        out << std::setprecision(10);
+        for (const MobilityMatrixInverseType inv_type : { LAPACK_CHOLESKY, LAPACK_LU })
+        {
+            out << "factorization: " << enum_to_string<MobilityMatrixInverseType>(inv_type) << "\n";
+            DenseFactorizationPreconditioner factorization(inv_type);
+            factorization.factorize(mm.data(), size);
+
+            // The factorized matrix is solved in a single iteration.
+            std::vector<double> x = b, x_direct = b;
+            factorization.applyInverse(x_direct.data());
+            bool converged = factorization.solve(mm.data(), x.data(), rel_tol, max_iterations);
+            out << "factorized nodes: converged: " << converged
+                << " iterations: " << factorization.getNumberOfIterations() << "\n";
+            out << "factorized nodes: relative difference from the direct solution: "
+                << relative_difference(x, x_direct) << "\n";
+
+            // Compare with factorizing the matrix of the displaced nodes.
+            DenseFactorizationPreconditioner displaced_factorization(inv_type);
+            displaced_factorization.factorize(displaced_mm.data(), size);
+            x = b;
+            x_direct = b;
+            displaced_factorization.applyInverse(x_direct.data());
+            converged = factorization.solve(displaced_mm.data(), x.data(), rel_tol, max_iterations);
+            out << "displaced nodes: converged: " << converged
+                << " iterations: " << factorization.getNumberOfIterations()
+                << " relative residual norm: " << factorization.getRelativeResidualNorm() << "\n";
+            out << "displaced nodes: norm of the solution: " << norm(x) << "\n";
+            out << "displaced nodes: relative difference from the direct solution: "
+                << relative_difference(x, x_direct) << "\n";
+
+            // The stored factorization is not rotated with the nodes.
+            x = b;
+            converged = factorization.solve(rotated_mm.data(), x.data(), rel_tol, max_iterations);
+            out << "rotated nodes: converged: " << converged
+                << " iterations: " << factorization.getNumberOfIterations()
+                << " relative residual norm: " << factorization.getRelativeResidualNorm() << "\n";
+            out << "rotated nodes: relative change in the right-hand side: " << relative_difference(x, b) << "\n";
+        }
+        plog << out.str();
+    }
+} // main
@@ -0,0 +1,89 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that applying the RPY mobility matrix without forming it agrees with
+// multiplying by the dense mobility matrix.
+
+#include <ibamr/MobilityFunctions.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+
+#include <tbox/Array.h>
+#include <tbox/PIO.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "mobility_functions.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const double mu = input_db->getDouble("MU");
+        const double dx = input_db->getDouble("DX");
+        const double periodic_correction = input_db->getDoubleWithDefault("periodic_correction", 0.0);
+        const int num_nodes = input_db->getInteger("num_nodes");
+        const int size = num_nodes * NDIM;
+
+        // Place the nodes randomly in a box that is a few grid cells wide so
+        // that both branches of the RPY tensor are exercised.
+        std::mt19937 std_seq(42u);
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        const double L = input_db->getDoubleWithDefault("box_width", 8.0) * dx;
+        std::vector<double> X(size), F(size);
+        for (double& x : X) x = L * distribution(std_seq);
+        for (double& f : F) f = 2.0 * distribution(std_seq) - 1.0;
+
+        std::ostringstream out;
+        out << std::setprecision(10);
+        const tbox::Array<std::string> kernel_fcns = input_db->getStringArray("kernels");
+        for (int k = 0; k < kernel_fcns.getSize(); ++k)
+        {
+            const std::string& kernel_fcn = kernel_fcns[k];
+            std::vector<double> mm(size * size), U_dense(size, 0.0), U(size);
+            MobilityFunctions::constructRPYMobilityMatrix(
+                kernel_fcn.c_str(), mu, dx, X.data(), num_nodes, periodic_correction, mm.data());
+            for (int col = 0; col < size; ++col)
+            {
+                for (int row = 0; row < size; ++row)
+                {
+                    U_dense[row] += mm[col * size + row] * F[col];
+                }
+            }
+            MobilityFunctions::applyRPYMobility(
+                kernel_fcn.c_str(), mu, dx, X.data(), num_nodes, periodic_correction, F.data(), U.data());
+
+            double U_norm = 0.0, diff_norm = 0.0;
+            for (int i = 0; i < size; ++i)
+            {
+                U_norm = std::max(U_norm, std::abs(U_dense[i]));
+                diff_norm = std::max(diff_norm, std::abs(U_dense[i] - U[i]));
+            }
+            out << "kernel: " << kernel_fcn << "\n";
+            out << "relative difference between matrix-free and dense RPY mobility: " << diff_norm / U_norm << "\n";
+        }
+        plog << out.str();
+    }
+} // main
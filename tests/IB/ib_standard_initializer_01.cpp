@@ -0,0 +1,201 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that a structure read from a binary .ibstruct file written by
+// IBStandardInitializer has the same vertices and springs as the structure
+// read from the ASCII .vertex and .spring files it was converted from.
+
+#include <SAMRAI_config.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBSpringForceSpec.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// Structure data indexed by Lagrangian index. Springs are stored with their
+// master node.
+struct StructureData
+{
+    std::vector<double> posn;
+    std::vector<double> num_springs, slave_idx_sum, stiffness_sum, rest_length_sum, force_fcn_idx_sum;
+};
+
+// Set up an IB solver that reads the structure with the initializer described
+// by the input database initializer_name and collect the resulting structure
+// data on every process.
+StructureData
+read_structure(Pointer<AppInitializer> app_initializer, const std::string& initializer_name)
+{
+    const std::string prefix = initializer_name + "::";
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+        prefix + "INSStaggeredHierarchyIntegrator",
+        app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+    Pointer<IBMethod> ib_method_ops =
+        new IBMethod(prefix + "IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+    Pointer<IBHierarchyIntegrator> time_integrator =
+        new IBExplicitHierarchyIntegrator(prefix + "IBHierarchyIntegrator",
+                                          app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                          ib_method_ops,
+                                          navier_stokes_integrator);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        prefix + "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>(prefix + "PatchHierarchy", grid_geometry);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(prefix + "StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>(prefix + "LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(prefix + "GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer);
+
+    Pointer<IBStandardInitializer> ib_initializer =
+        new IBStandardInitializer(initializer_name, app_initializer->getComponentDatabase(initializer_name));
+    ib_method_ops->registerLInitStrategy(ib_initializer);
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    ib_method_ops->freeLInitStrategy();
+    ib_initializer.setNull();
+
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+    const int num_nodes = l_data_manager->getNumberOfNodes(ln);
+    StructureData data;
+    data.posn.resize(num_nodes * NDIM, 0.0);
+    data.num_springs.resize(num_nodes, 0.0);
+    data.slave_idx_sum.resize(num_nodes, 0.0);
+    data.stiffness_sum.resize(num_nodes, 0.0);
+    data.rest_length_sum.resize(num_nodes, 0.0);
+    data.force_fcn_idx_sum.resize(num_nodes, 0.0);
+
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+    const boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+    for (const LNode* const node : l_data_manager->getLMesh(ln)->getLocalNodes())
+    {
+        const int lag_idx = node->getLagrangianIndex();
+        for (unsigned int d = 0; d < NDIM; ++d) data.posn[lag_idx * NDIM + d] = X[node->getLocalPETScIndex()][d];
+        const IBSpringForceSpec* const spring_spec = node->getNodeDataItem<IBSpringForceSpec>();
+        if (!spring_spec) continue;
+        for (unsigned int k = 0; k < spring_spec->getNumberOfSprings(); ++k)
+        {
+            data.num_springs[lag_idx] += 1.0;
+            data.slave_idx_sum[lag_idx] += spring_spec->getSlaveNodeIndices()[k];
+            data.stiffness_sum[lag_idx] += spring_spec->getParameters()[k][0];
+            data.rest_length_sum[lag_idx] += spring_spec->getParameters()[k][1];
+            data.force_fcn_idx_sum[lag_idx] += spring_spec->getForceFunctionIndices()[k];
+        }
+    }
+    X_data->restoreArrays();
+
+    IBTK_MPI::sumReduction(data.posn.data(), static_cast<int>(data.posn.size()));
+    IBTK_MPI::sumReduction(data.num_springs.data(), num_nodes);
+    IBTK_MPI::sumReduction(data.slave_idx_sum.data(), num_nodes);
+    IBTK_MPI::sumReduction(data.stiffness_sum.data(), num_nodes);
+    IBTK_MPI::sumReduction(data.rest_length_sum.data(), num_nodes);
+    IBTK_MPI::sumReduction(data.force_fcn_idx_sum.data(), num_nodes);
+    return data;
+} // read_structure
+
+double
+max_difference(const std::vector<double>& a, const std::vector<double>& b)
+{
+    if (a.size() != b.size()) return std::numeric_limits<double>::max();
+    double diff = 0.0;
+    for (std::size_t k = 0; k < a.size(); ++k) diff = std::max(diff, std::abs(a[k] - b[k]));
+    return diff;
+} // max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ifstream structure_vertex_stream(SOURCE_DIR "/curve2d_64.vertex");
+            std::ofstream structure_vertex_cwd("curve2d_64.vertex");
+            structure_vertex_cwd << structure_vertex_stream.rdbuf();
+            std::ifstream structure_spring_stream(SOURCE_DIR "/curve2d_64.spring");
+            std::ofstream structure_spring_cwd("curve2d_64.spring");
+            structure_spring_cwd << structure_spring_stream.rdbuf();
+        }
+        IBTK_MPI::barrier();
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+
+        // Read the ASCII files, which also writes the binary file, and then
+        // read the binary file once it is complete.
+        const StructureData ascii_data = read_structure(app_initializer, "ASCIIInitializer");
+        IBTK_MPI::barrier();
+        const StructureData binary_data = read_structure(app_initializer, "BinaryInitializer");
+
+        double num_springs = 0.0, stiffness = 0.0;
+        for (std::size_t k = 0; k < ascii_data.num_springs.size(); ++k)
+        {
+            num_springs += ascii_data.num_springs[k];
+            stiffness += ascii_data.stiffness_sum[k];
+        }
+        std::ostringstream out;
+        out << std::setprecision(10);
+        out << "number of vertices: " << ascii_data.num_springs.size() << "\n"
+            << "number of springs: " << num_springs << "\n"
+            << "total spring stiffness: " << stiffness << "\n"
+            << "max difference in vertex positions: " << max_difference(ascii_data.posn, binary_data.posn) << "\n"
+            << "max difference in number of springs: "
+            << max_difference(ascii_data.num_springs, binary_data.num_springs) << "\n"
+            << "max difference in spring slave indices: "
+            << max_difference(ascii_data.slave_idx_sum, binary_data.slave_idx_sum) << "\n"
+            << "max difference in spring stiffnesses: "
+            << max_difference(ascii_data.stiffness_sum, binary_data.stiffness_sum) << "\n"
+            << "max difference in spring rest lengths: "
+            << max_difference(ascii_data.rest_length_sum, binary_data.rest_length_sum) << "\n"
+            << "max difference in spring force functions: "
+            << max_difference(ascii_data.force_fcn_idx_sum, binary_data.force_fcn_idx_sum) << "\n";
+        plog << out.str();
+    }
+} // main
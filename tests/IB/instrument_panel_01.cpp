@@ -0,0 +1,285 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Move a flow meter through a grid with several patches and check that the
+// instrument panel owned by IBMethod, which only updates its interpolation
+// stencils when the meter stays in the same cells, reads the same flow rate and
+// pressures as a panel that builds its stencils from scratch at each position.
+// The meter alternately moves by a fraction of a cell, which keeps every point
+// of the meter in its cell, and by more than half a cell, which moves points
+// into new cells and moves the meter centroid across a patch boundary. The
+// velocity and pressure are linear, so the flow rate and the pressures are the
+// values of the fields at the meter centroid scaled by the meter area.
+
+#include <SAMRAI_config.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBInstrumentPanel.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/ibtk_utilities.h>
+
+#include <petscvec.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// The linear velocity and pressure fields.
+double
+exact_U(const IBTK::Point& X, const unsigned int axis)
+{
+    switch (axis)
+    {
+    case 0:
+        return 1.0 + 2.0 * X[0] + X[1] - X[2];
+    case 1:
+        return 3.0 - X[0] + 0.5 * X[2];
+    default:
+        return -2.0 + X[1];
+    }
+} // exact_U
+
+double
+exact_P(const IBTK::Point& X)
+{
+    return 2.0 + X[0] - 3.0 * X[1] + X[2];
+} // exact_P
+
+// Set the velocity and pressure on every patch, including the ghost cells, so
+// that no ghost cell filling is needed before reading the instruments.
+void
+fill_data(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int U_idx, const int P_idx)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            const hier::Index<NDIM>& patch_lower = patch->getBox().lower();
+
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(U_data->getGhostBox(), axis)); b; b++)
+                {
+                    const hier::Index<NDIM>& i = b();
+                    IBTK::Point X;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = x_lower[d] + dx[d] * (i(d) - patch_lower(d) + (d == axis ? 0.0 : 0.5));
+                    }
+                    (*U_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower)) = exact_U(X, axis);
+                }
+            }
+
+            Pointer<CellData<NDIM, double> > P_data = patch->getPatchData(P_idx);
+            for (Box<NDIM>::Iterator b(P_data->getGhostBox()); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                IBTK::Point X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = x_lower[d] + dx[d] * (i(d) - patch_lower(d) + 0.5);
+                }
+                (*P_data)(CellIndex<NDIM>(i)) = exact_P(X);
+            }
+        }
+    }
+} // fill_data
+
+// The largest difference between the values read by two instrument panels.
+double
+max_difference(const IBInstrumentPanel& panel_1, const IBInstrumentPanel& panel_2)
+{
+    double diff = 0.0;
+    for (unsigned int m = 0; m < panel_1.getFlowValues().size(); ++m)
+    {
+        diff = std::max(diff, std::abs(panel_1.getFlowValues()[m] - panel_2.getFlowValues()[m]));
+        diff = std::max(diff, std::abs(panel_1.getMeanPressureValues()[m] - panel_2.getMeanPressureValues()[m]));
+        diff = std::max(diff,
+                        std::abs(panel_1.getPointwisePressureValues()[m] - panel_2.getPointwisePressureValues()[m]));
+    }
+    return diff;
+} // max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Write a circular flow meter in the plane x = X_CENTER[0].
+        const int num_perimeter_nodes = input_db->getInteger("NUM_PERIMETER_NODES");
+        const double radius = input_db->getDouble("RADIUS");
+        std::vector<double> X_center(NDIM);
+        input_db->getDoubleArray("X_CENTER", X_center.data(), NDIM);
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream vertex_stream("meter.vertex");
+            vertex_stream << std::setprecision(17) << num_perimeter_nodes << "\n";
+            std::ofstream inst_stream("meter.inst");
+            inst_stream << "1\nmeter\n" << num_perimeter_nodes << "\n";
+            for (int n = 0; n < num_perimeter_nodes; ++n)
+            {
+                const double theta = 2.0 * M_PI * n / num_perimeter_nodes;
+                vertex_stream << X_center[0] << " " << X_center[1] + radius * std::cos(theta) << " "
+                              << X_center[2] + radius * std::sin(theta) << "\n";
+                inst_stream << n << " 0 " << n << "\n";
+            }
+        }
+        IBTK_MPI::barrier();
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Set up the Eulerian velocity and pressure.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("instrument_panel_01");
+        Pointer<SideVariable<NDIM, double> > U_var = new SideVariable<NDIM, double>("U");
+        Pointer<CellVariable<NDIM, double> > P_var = new CellVariable<NDIM, double>("P");
+        const int U_idx = var_db->registerVariableAndContext(U_var, ctx, IntVector<NDIM>(1));
+        const int P_idx = var_db->registerVariableAndContext(P_var, ctx, IntVector<NDIM>(1));
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(U_idx);
+            level->allocatePatchData(P_idx);
+        }
+        fill_data(patch_hierarchy, U_idx, P_idx);
+
+        // Record the initial positions of the local nodes, and hold the
+        // structure at rest so that the flow rate needs no correction for the
+        // motion of the meter.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        int ierr = VecSet(U_data->getVec(), 0.0);
+        IBTK_CHKERRQ(ierr);
+        std::vector<double> X_init;
+        {
+            const boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+            X_init.assign(X.data(), X.data() + l_data_manager->getNumberOfLocalNodes(finest_ln) * NDIM);
+            X_data->restoreArrays();
+        }
+
+        const double big_dy = input_db->getDouble("BIG_DY");
+        const double big_dz = input_db->getDouble("BIG_DZ");
+        const double small_dy = input_db->getDouble("SMALL_DY");
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        Pointer<IBInstrumentPanel> instrument_panel = ib_method_ops->getIBInstrumentPanel();
+        std::vector<double> displacement(NDIM, 0.0);
+        for (int k = 1; k <= num_steps; ++k)
+        {
+            // Alternate between large and small displacements.
+            displacement[1] += (k % 2 == 1 ? big_dy : small_dy);
+            displacement[2] += (k % 2 == 1 ? big_dz : 0.0);
+            {
+                boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+                const int num_local_nodes = l_data_manager->getNumberOfLocalNodes(finest_ln);
+                for (int i = 0; i < num_local_nodes; ++i)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d) X[i][d] = X_init[i * NDIM + d] + displacement[d];
+                }
+                X_data->restoreArrays();
+            }
+
+            const double data_time = 0.1 * k;
+            instrument_panel->initializeHierarchyDependentData(patch_hierarchy, l_data_manager, k, data_time);
+            instrument_panel->readInstrumentData(U_idx, P_idx, patch_hierarchy, l_data_manager, k, data_time);
+
+            IBInstrumentPanel rebuilt_panel("IBInstrumentPanel", Pointer<Database>(nullptr));
+            rebuilt_panel.initializeHierarchyDependentData(patch_hierarchy, l_data_manager, k, data_time);
+            rebuilt_panel.readInstrumentData(U_idx, P_idx, patch_hierarchy, l_data_manager, k, data_time);
+
+            plog << "step " << k
+                 << ": max difference from rebuilt stencils: " << max_difference(*instrument_panel, rebuilt_panel)
+                 << "\n";
+        }
+
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(U_idx);
+            level->deallocatePatchData(P_idx);
+        }
+    }
+} // main
@@ -0,0 +1,196 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that the nonbonded forces computed by NonbondedForceEvaluator with
+// reused Verlet lists agree with the forces computed with a neighbor list that
+// is rebuilt at every evaluation while the nodes move by small amounts.
+
+#include <SAMRAI_config.h>
+
+#include <petscsys.h>
+#include <petscvec.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/NonbondedForceEvaluator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+int finest_ln;
+int num_lattice_points;
+double lattice_spacing;
+
+// Place the nodes on a square lattice.
+void
+generate_structure(const unsigned int& /*struct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn,
+                   void* /*ctx*/)
+{
+    num_vertices = ln == finest_ln ? num_lattice_points * num_lattice_points : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        vertex_posn[k] = Point(0.5 + lattice_spacing * (k % num_lattice_points - 0.5 * num_lattice_points),
+                               0.5 + lattice_spacing * (k / num_lattice_points - 0.5 * num_lattice_points));
+    }
+    return;
+} // generate_structure
+
+// A linear repulsive force between the nodes that vanishes beyond the cutoff
+// distance params[1].
+void
+soft_repulsion(double* D, const Array<double> params, double* out_force)
+{
+    const double r = std::sqrt(D[0] * D[0] + D[1] * D[1]);
+    const double f = r < params[1] ? params[0] * (params[1] - r) / r : 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d) out_force[d] = f * D[d];
+    return;
+} // soft_repulsion
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_lattice_points = input_db->getInteger("NUM_LATTICE_POINTS");
+        lattice_spacing = input_db->getDouble("LATTICE_SPACING");
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "lattice" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Set up one force evaluator that reuses its Verlet lists and one that
+        // rebuilds its neighbor list at every evaluation.
+        Pointer<NonbondedForceEvaluator> verlet_force_evaluator =
+            new NonbondedForceEvaluator(app_initializer->getComponentDatabase("VerletForceEvaluator"), grid_geometry);
+        verlet_force_evaluator->registerForceFcnPtr(&soft_repulsion);
+        Pointer<NonbondedForceEvaluator> force_evaluator =
+            new NonbondedForceEvaluator(app_initializer->getComponentDatabase("ForceEvaluator"), grid_geometry);
+        force_evaluator->registerForceFcnPtr(&soft_repulsion);
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> F_verlet_data = l_data_manager->createLData("F_verlet", finest_ln, NDIM);
+        Pointer<LData> F_data = l_data_manager->createLData("F_rebuilt", finest_ln, NDIM);
+        Vec diff_vec;
+        int ierr = VecDuplicate(F_data->getVec(), &diff_vec);
+        IBTK_CHKERRQ(ierr);
+
+        // Move the nodes by a small amount at each step so that the Verlet
+        // lists are reused for a few steps before they are rebuilt.
+        const double dx = grid_geometry->getDx()[0];
+        const double max_step_displacement = input_db->getDouble("MAX_STEP_DISPLACEMENT") * dx;
+        const int num_steps = input_db->getInteger("NUM_STEPS");
+        std::ostringstream out;
+        out << std::setprecision(10);
+        for (int step = 0; step < num_steps; ++step)
+        {
+            if (step > 0)
+            {
+                boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+                for (unsigned int k = 0; k < X.shape()[0]; ++k)
+                {
+                    const double X0 = X[k][0], X1 = X[k][1];
+                    X[k][0] += max_step_displacement * std::sin(2.0 * M_PI * (3.0 * X1 + 0.37 * step));
+                    X[k][1] += max_step_displacement * std::cos(2.0 * M_PI * (5.0 * X0 - 0.21 * step));
+                }
+                X_data->restoreArrays();
+            }
+
+            ierr = VecSet(F_verlet_data->getVec(), 0.0);
+            IBTK_CHKERRQ(ierr);
+            verlet_force_evaluator->computeLagrangianForce(
+                F_verlet_data, X_data, X_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+            ierr = VecSet(F_data->getVec(), 0.0);
+            IBTK_CHKERRQ(ierr);
+            force_evaluator->computeLagrangianForce(
+                F_data, X_data, X_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+
+            double F_norm, diff_norm;
+            ierr = VecNorm(F_data->getVec(), NORM_INFINITY, &F_norm);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecWAXPY(diff_vec, -1.0, F_data->getVec(), F_verlet_data->getVec());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecNorm(diff_vec, NORM_INFINITY, &diff_norm);
+            IBTK_CHKERRQ(ierr);
+            out << "step " << step << ":\n"
+                << "  |F|_oo = " << F_norm << "\n"
+                << "  relative difference between reused and rebuilt neighbor lists = " << diff_norm / F_norm << "\n";
+        }
+        ierr = VecDestroy(&diff_vec);
+        IBTK_CHKERRQ(ierr);
+        plog << out.str();
+    }
+} // main
@@ -0,0 +1,321 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that the spring, beam, and target point forces computed by
+// IBStandardForceGen with contiguous force data agree with the forces computed
+// through the force specification objects, both initially and after the force
+// parameters are modified.
+
+#include <SAMRAI_config.h>
+
+#include <petscsys.h>
+#include <petscvec.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBSpringForceFunctions.h>
+#include <ibamr/IBSpringForceSpec.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBTargetPointForceSpec.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LMesh.h>
+#include <ibtk/LNode.h>
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+int finest_ln;
+int num_nodes;
+double radius;
+double spring_stiffness, beam_rigidity, target_stiffness, target_damping;
+double threshold_strain, stiffening_ratio;
+
+// Place the nodes on a circle.
+void
+generate_structure(const unsigned int& /*struct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn,
+                   void* /*ctx*/)
+{
+    num_vertices = ln == finest_ln ? num_nodes : 0;
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_nodes;
+        vertex_posn[k] = Point(0.5 + radius * std::cos(theta), 0.5 + radius * std::sin(theta));
+    }
+    return;
+} // generate_structure
+
+// Connect neighboring nodes alternately by linear and stiff linear springs, and
+// connect next-nearest neighbors by springs that use a user-registered force
+// function.
+void
+generate_springs(
+    const unsigned int& /*struct_num*/,
+    const int& ln,
+    std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>&
+        spring_spec,
+    void* /*ctx*/)
+{
+    if (ln != finest_ln) return;
+    const double chord = 2.0 * radius * std::sin(M_PI / num_nodes);
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::Edge e = std::make_pair(k, (k + 1) % num_nodes);
+        IBRedundantInitializer::SpringSpec spec_data;
+        if (k % 2 == 0)
+        {
+            spec_data.parameters = { spring_stiffness, chord };
+            spec_data.force_fcn_idx = 0;
+        }
+        else
+        {
+            spec_data.parameters = { spring_stiffness, chord, threshold_strain, stiffening_ratio };
+            spec_data.force_fcn_idx = 1;
+        }
+        spring_map.insert(std::make_pair(e.first, e));
+        spring_spec.insert(std::make_pair(e, spec_data));
+
+        e = std::make_pair(k, (k + 2) % num_nodes);
+        spec_data.parameters = { spring_stiffness, 2.0 * chord * std::cos(M_PI / num_nodes) };
+        spec_data.force_fcn_idx = 2;
+        spring_map.insert(std::make_pair(e.first, e));
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+// Attach a beam to every node.
+void
+generate_beams(const unsigned int& /*struct_num*/,
+               const int& ln,
+               std::multimap<int, IBRedundantInitializer::BeamSpec>& beam_spec,
+               void* /*ctx*/)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        IBRedundantInitializer::BeamSpec spec_data;
+        spec_data.neighbor_idxs = std::make_pair((k + num_nodes - 1) % num_nodes, (k + 1) % num_nodes);
+        spec_data.bend_rigidity = beam_rigidity;
+        spec_data.curvature = Vector(1.0e-3, -2.0e-3);
+        beam_spec.insert(std::make_pair(k, spec_data));
+    }
+    return;
+} // generate_beams
+
+// Make every fourth node a target point.
+void
+generate_targets(const unsigned int& /*struct_num*/,
+                 const int& ln,
+                 std::multimap<int, IBRedundantInitializer::TargetSpec>& tg_pt_spec,
+                 void* /*ctx*/)
+{
+    if (ln != finest_ln) return;
+    for (int k = 0; k < num_nodes; k += 4)
+    {
+        IBRedundantInitializer::TargetSpec spec_data;
+        spec_data.stiffness = target_stiffness;
+        spec_data.damping = target_damping;
+        tg_pt_spec.insert(std::make_pair(k, spec_data));
+    }
+    return;
+} // generate_targets
+
+// A nonlinear spring that is evaluated through its function pointer.
+double
+cubic_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    const double stretch = R - params[1];
+    return params[0] * (stretch + stretch * stretch * stretch / (params[1] * params[1]));
+} // cubic_spring_force
+
+double
+cubic_spring_force_deriv(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    const double stretch = R - params[1];
+    return params[0] * (1.0 + 3.0 * stretch * stretch / (params[1] * params[1]));
+} // cubic_spring_force_deriv
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        num_nodes = input_db->getInteger("NUM_NODES");
+        radius = input_db->getDouble("RADIUS");
+        spring_stiffness = input_db->getDouble("SPRING_STIFFNESS");
+        threshold_strain = input_db->getDouble("THRESHOLD_STRAIN");
+        stiffening_ratio = input_db->getDouble("STIFFENING_RATIO");
+        beam_rigidity = input_db->getDouble("BEAM_RIGIDITY");
+        target_stiffness = input_db->getDouble("TARGET_STIFFNESS");
+        target_damping = input_db->getDouble("TARGET_DAMPING");
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "ring" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_initializer->registerInitSpringDataFunction(generate_springs);
+        ib_initializer->registerInitBeamDataFunction(generate_beams);
+        ib_initializer->registerInitTargetPtFunction(generate_targets);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Set up one force generator that uses contiguous force data and one
+        // that evaluates the forces through the force specification objects.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        std::vector<Pointer<IBStandardForceGen> > force_gens = {
+            new IBStandardForceGen(app_initializer->getComponentDatabase("ContiguousForceGen")),
+            new IBStandardForceGen(app_initializer->getComponentDatabase("ForceGen"))
+        };
+        for (const Pointer<IBStandardForceGen>& force_gen : force_gens)
+        {
+            force_gen->registerSpringForceFunction(1, &stiff_linear_spring_force, &stiff_linear_spring_force_deriv);
+            force_gen->registerSpringForceFunction(2, &cubic_spring_force, &cubic_spring_force_deriv);
+            force_gen->initializeLevelData(patch_hierarchy, finest_ln, 0.0, true, l_data_manager);
+        }
+
+        // Displace the nodes and give them a velocity so that all of the force
+        // terms are nonzero.
+        const double dx = grid_geometry->getDx()[0];
+        const double displacement = input_db->getDouble("DISPLACEMENT") * dx;
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        {
+            boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+            boost::multi_array_ref<double, 2>& U = *U_data->getLocalFormVecArray();
+            for (unsigned int k = 0; k < X.shape()[0]; ++k)
+            {
+                const double X0 = X[k][0], X1 = X[k][1];
+                X[k][0] += displacement * std::sin(2.0 * M_PI * 3.0 * X1);
+                X[k][1] += displacement * std::cos(2.0 * M_PI * 5.0 * X0);
+                U[k][0] = -(X1 - 0.5);
+                U[k][1] = X0 - 0.5;
+            }
+            X_data->restoreArrays();
+            U_data->restoreArrays();
+        }
+
+        std::vector<Pointer<LData> > F_data = { l_data_manager->createLData("F_contiguous", finest_ln, NDIM),
+                                                l_data_manager->createLData("F", finest_ln, NDIM) };
+        Vec diff_vec;
+        int ierr = VecDuplicate(F_data[1]->getVec(), &diff_vec);
+        IBTK_CHKERRQ(ierr);
+        std::ostringstream out;
+        out << std::setprecision(10);
+        const std::vector<std::string> stages = { "initial parameters", "modified parameters" };
+        for (const std::string& stage : stages)
+        {
+            if (stage == "modified parameters")
+            {
+                // Change the stiffnesses and target point positions stored in
+                // the force specification objects.
+                for (LNode* const node : l_data_manager->getLMesh(finest_ln)->getLocalNodes())
+                {
+                    IBSpringForceSpec* const spring_spec = node->getNodeDataItem<IBSpringForceSpec>();
+                    if (spring_spec)
+                    {
+                        for (std::vector<double>& parameters : spring_spec->getParameters()) parameters[0] *= 1.5;
+                    }
+                    IBTargetPointForceSpec* const target_spec = node->getNodeDataItem<IBTargetPointForceSpec>();
+                    if (target_spec)
+                    {
+                        target_spec->getStiffness() *= 2.0;
+                        target_spec->getTargetPointPosition()[0] += 0.5 * dx;
+                    }
+                }
+                force_gens[0]->markForceParametersModified();
+            }
+
+            for (unsigned int k = 0; k < force_gens.size(); ++k)
+            {
+                ierr = VecSet(F_data[k]->getVec(), 0.0);
+                IBTK_CHKERRQ(ierr);
+                force_gens[k]->computeLagrangianForce(
+                    F_data[k], X_data, U_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+            }
+
+            double F_norm, diff_norm;
+            ierr = VecNorm(F_data[1]->getVec(), NORM_INFINITY, &F_norm);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecWAXPY(diff_vec, -1.0, F_data[1]->getVec(), F_data[0]->getVec());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecNorm(diff_vec, NORM_INFINITY, &diff_norm);
+            IBTK_CHKERRQ(ierr);
+            out << stage << ":\n"
+                << "  |F|_oo = " << F_norm << "\n"
+                << "  relative difference between contiguous and original forces = " << diff_norm / F_norm << "\n";
+        }
+        ierr = VecDestroy(&diff_vec);
+        IBTK_CHKERRQ(ierr);
+        plog << out.str();
+    }
+} // main
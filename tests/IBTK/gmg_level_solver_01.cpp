@@ -0,0 +1,184 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that the cell-centered and side-centered geometric multigrid level
+// solvers converge to the discrete solution of a Poisson problem within a
+// bounded number of V-cycles and print the error of the discrete solution.
+// The exact solutions are discrete eigenfunctions, so the printed errors are
+// known in closed form.
+
+#include <SAMRAI_config.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/LinearSolver.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <ibtk/app_namespaces.h>
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "gmg_level_solver.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        Pointer<CellVariable<NDIM, double> > c_cc_var = new CellVariable<NDIM, double>("c_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<SideVariable<NDIM, double> > e_sc_var = new SideVariable<NDIM, double>("e_sc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+        const int c_cc_idx = var_db->registerVariableAndContext(c_cc_var, ctx, IntVector<NDIM>(0));
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(1));
+        const int e_sc_idx = var_db->registerVariableAndContext(e_sc_var, ctx, IntVector<NDIM>(1));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        for (const int idx : { u_cc_idx, f_cc_idx, e_cc_idx, c_cc_idx, u_sc_idx, f_sc_idx, e_sc_idx })
+        {
+            patch_hierarchy->getPatchLevel(0)->allocatePatchData(idx, 0.0);
+        }
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_cc_vec("f_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_cc_vec("e_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_sc_vec("f_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> e_sc_vec("e_sc", patch_hierarchy, 0, 0);
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_cc_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        e_cc_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        f_sc_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        e_sc_vec.addComponent(e_sc_var, e_sc_idx, h_sc_idx);
+
+        // Setup the exact solutions and right-hand sides.  The cell-centered
+        // problem optionally uses a spatially varying C coefficient.
+        const bool use_nullspace = input_db->getBool("use_nullspace");
+        const bool use_variable_c = input_db->getBoolWithDefault("use_variable_c", false);
+        const int max_v_cycles = input_db->getInteger("max_v_cycles");
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction f_cc_fcn("f_cc", app_initializer->getComponentDatabase("f_cc"), grid_geometry);
+        muParserCartGridFunction f_sc_fcn("f_sc", app_initializer->getComponentDatabase("f_sc"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(e_cc_idx, e_cc_var, patch_hierarchy, 0.0);
+        u_fcn.setDataOnPatchHierarchy(e_sc_idx, e_sc_var, patch_hierarchy, 0.0);
+        f_cc_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        f_sc_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+
+        PoissonSpecifications cc_poisson_spec("cc_poisson_spec");
+        if (use_variable_c)
+        {
+            muParserCartGridFunction c_fcn("c", app_initializer->getComponentDatabase("c"), grid_geometry);
+            c_fcn.setDataOnPatchHierarchy(c_cc_idx, c_cc_var, patch_hierarchy, 0.0);
+            cc_poisson_spec.setCPatchDataId(c_cc_idx);
+        }
+        else
+        {
+            cc_poisson_spec.setCZero();
+        }
+        cc_poisson_spec.setDConstant(-1.0);
+        PoissonSpecifications sc_poisson_spec("sc_poisson_spec");
+        sc_poisson_spec.setCZero();
+        sc_poisson_spec.setDConstant(-1.0);
+
+        std::ostringstream out;
+        out << std::setprecision(10);
+        const std::string solver_type = input_db->getString("solver_type");
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+
+        // Solve the cell-centered problem.
+        {
+            RobinBcCoefStrategy<NDIM>* bc_coef = nullptr;
+            Pointer<PoissonSolver> poisson_solver =
+                CCPoissonSolverManager::getManager()->allocateSolver(solver_type, "cc_poisson_solver", solver_db, "");
+            poisson_solver->setPoissonSpecifications(cc_poisson_spec);
+            poisson_solver->setPhysicalBcCoef(bc_coef);
+            Pointer<LinearSolver> linear_solver = poisson_solver;
+            linear_solver->setNullspace(use_nullspace);
+            poisson_solver->initializeSolverState(u_cc_vec, f_cc_vec);
+            const bool converged = poisson_solver->solveSystem(u_cc_vec, f_cc_vec);
+            e_cc_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_cc_vec, false),
+                              Pointer<SAMRAIVectorReal<NDIM, double> >(&u_cc_vec, false));
+            out << "cell-centered solver converged in at most " << max_v_cycles << " V-cycles: "
+                << (converged && linear_solver->getNumIterations() <= max_v_cycles ? "yes" : "no") << "\n";
+            out << "cell-centered |u - u_exact|_oo = " << e_cc_vec.maxNorm() << "\n";
+        }
+
+        // Solve the side-centered problem.
+        {
+            std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, nullptr);
+            Pointer<PoissonSolver> poisson_solver =
+                SCPoissonSolverManager::getManager()->allocateSolver(solver_type, "sc_poisson_solver", solver_db, "");
+            poisson_solver->setPoissonSpecifications(sc_poisson_spec);
+            poisson_solver->setPhysicalBcCoefs(bc_coefs);
+            Pointer<LinearSolver> linear_solver = poisson_solver;
+            linear_solver->setNullspace(use_nullspace);
+            poisson_solver->initializeSolverState(u_sc_vec, f_sc_vec);
+            const bool converged = poisson_solver->solveSystem(u_sc_vec, f_sc_vec);
+            e_sc_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_sc_vec, false),
+                              Pointer<SAMRAIVectorReal<NDIM, double> >(&u_sc_vec, false));
+            out << "side-centered solver converged in at most " << max_v_cycles << " V-cycles: "
+                << (converged && linear_solver->getNumIterations() <= max_v_cycles ? "yes" : "no") << "\n";
+            out << "side-centered |u - u_exact|_oo = " << e_sc_vec.maxNorm() << "\n";
+        }
+        plog << out.str();
+    }
+} // main
@@ -0,0 +1,336 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAI_config.h>
+#include <StandardTagAndInitialize.h>
+
+#if defined(IBTK_HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <random>
+
+#include <ibtk/app_namespaces.h>
+
+// Test that the optional implementations of the interaction operations in
+// LEInteractor (threaded spreading, specialized interpolation, and cached
+// interaction plans) agree with the default implementations.
+
+namespace
+{
+// Get the values of a cell- or side-centered patch data object.
+std::vector<std::pair<double*, int> >
+get_values(Pointer<Patch<NDIM> > patch, const int idx, const bool use_cell)
+{
+    std::vector<std::pair<double*, int> > values;
+    if (use_cell)
+    {
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(idx);
+        ArrayData<NDIM, double>& array_data = data->getArrayData();
+        values.emplace_back(array_data.getPointer(), array_data.getDepth() * array_data.getBox().size());
+    }
+    else
+    {
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            ArrayData<NDIM, double>& array_data = data->getArrayData(axis);
+            values.emplace_back(array_data.getPointer(), array_data.getDepth() * array_data.getBox().size());
+        }
+    }
+    return values;
+} // get_values
+
+// Compute the maximum norm of the difference of two patch data objects (or of
+// the first one if idx_b is negative) on a level.
+double
+max_norm(Pointer<PatchLevel<NDIM> > level, const int idx_a, const int idx_b, const bool use_cell)
+{
+    double max_val = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const std::vector<std::pair<double*, int> > a = get_values(patch, idx_a, use_cell);
+        const std::vector<std::pair<double*, int> > b =
+            idx_b >= 0 ? get_values(patch, idx_b, use_cell) : std::vector<std::pair<double*, int> >();
+        for (unsigned int k = 0; k < a.size(); ++k)
+        {
+            for (int i = 0; i < a[k].second; ++i)
+            {
+                const double b_val = idx_b >= 0 ? b[k].first[i] : 0.0;
+                max_val = std::max(max_val, std::abs(a[k].first[i] - b_val));
+            }
+        }
+    }
+    return IBTK_MPI::maxReduction(max_val);
+} // max_norm
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "le_interactor.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const std::string kernel_fcn = input_db->getString("IB_DELTA_FUNCTION");
+        const int u_depth = input_db->getIntegerWithDefault("depth", 1);
+        const IntVector<NDIM> gcw(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        const bool use_cell = input_db->getStringWithDefault("var_type", "CELL") == "CELL";
+
+        // disambiguate between libMesh::Variable and SAMRAI::hier::Variable
+        auto u_var = use_cell ? Pointer<hier::Variable<NDIM> >(new CellVariable<NDIM, double>("u", u_depth)) :
+                                Pointer<hier::Variable<NDIM> >(new SideVariable<NDIM, double>("u", u_depth));
+        const int u_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("u"), gcw);
+        const int v_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("v"), gcw);
+        const int w_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("w"), gcw);
+
+        // set up grid
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > patch_level = patch_hierarchy->getPatchLevel(finest_ln);
+        patch_level->allocatePatchData(u_idx, 0.0);
+        patch_level->allocatePatchData(v_idx, 0.0);
+        patch_level->allocatePatchData(w_idx, 0.0);
+
+        // Set up random marker positions and values.
+        const int n_points = input_db->getIntegerWithDefault("n_points", 1000);
+        const int Q_depth = use_cell ? u_depth : NDIM * u_depth;
+        std::vector<double> Q_data(Q_depth * n_points);
+        const int X_depth = NDIM;
+        std::vector<double> X_data(X_depth * n_points);
+        std::mt19937 std_seq(42u);
+        const double* const x_lo = grid_geometry->getXLower();
+        const double* const x_up = grid_geometry->getXUpper();
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        for (double& Q : Q_data) Q = distribution(std_seq);
+        for (int l = 0; l < n_points; ++l)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_data[l * NDIM + d] = x_lo[d] + (x_up[d] - x_lo[d]) * distribution(std_seq);
+            }
+        }
+
+        // Spread the values of the markers located in the patch interiors.
+        auto spread = [&](const int idx)
+        {
+            for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+                const Box<NDIM>& box = patch->getBox();
+                if (use_cell)
+                {
+                    Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(idx);
+                    q_data->fillAll(0.0);
+                    LEInteractor::spread(q_data, Q_data, Q_depth, X_data, X_depth, patch, box, kernel_fcn);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > q_data = patch->getPatchData(idx);
+                    q_data->fillAll(0.0);
+                    LEInteractor::spread(q_data, Q_data, Q_depth, X_data, X_depth, patch, box, kernel_fcn);
+                }
+            }
+        };
+
+        // Interpolate onto the markers located in the patch interiors.
+        auto interpolate = [&](const int idx, std::vector<double>& V_data)
+        {
+            std::fill(V_data.begin(), V_data.end(), 0.0);
+            for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+                const Box<NDIM>& box = patch->getBox();
+                if (use_cell)
+                {
+                    Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(idx);
+                    LEInteractor::interpolate(V_data, Q_depth, X_data, X_depth, q_data, patch, box, kernel_fcn);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > q_data = patch->getPatchData(idx);
+                    LEInteractor::interpolate(V_data, Q_depth, X_data, X_depth, q_data, patch, box, kernel_fcn);
+                }
+            }
+            IBTK_MPI::sumReduction(V_data.data(), static_cast<int>(V_data.size()));
+        };
+
+        auto max_difference = [](const std::vector<double>& a, const std::vector<double>& b)
+        {
+            double max_diff = 0.0;
+            for (unsigned int i = 0; i < a.size(); ++i) max_diff = std::max(max_diff, std::abs(a[i] - b[i]));
+            return max_diff;
+        };
+
+        // Print relative differences so that changes in their magnitude show up
+        // in the output.
+        std::ostringstream out;
+        out << std::setprecision(10);
+        out << "kernel: " << kernel_fcn << "\n";
+        const std::string test = input_db->getString("test");
+        if (test == "threaded_spreading")
+        {
+            LEInteractor::s_use_threaded_spreading = false;
+            spread(u_idx);
+            LEInteractor::s_use_threaded_spreading = true;
+            spread(v_idx);
+
+            // The threaded implementation must give the same result with any
+            // number of threads.
+#if defined(IBTK_HAVE_OPENMP)
+            const int max_threads = omp_get_max_threads();
+            omp_set_num_threads(1);
+#endif
+            spread(w_idx);
+#if defined(IBTK_HAVE_OPENMP)
+            omp_set_num_threads(max_threads);
+#endif
+            LEInteractor::s_use_threaded_spreading = false;
+
+            const double u_norm = max_norm(patch_level, u_idx, -1, use_cell);
+            out << "relative difference between threaded and serial spreading: "
+                << max_norm(patch_level, u_idx, v_idx, use_cell) / u_norm << "\n";
+            out << "relative difference between threaded spreading with all threads and with one thread: "
+                << max_norm(patch_level, v_idx, w_idx, use_cell) / u_norm << "\n";
+        }
+        else if (test == "specialized_interpolation")
+        {
+            // Interpolate random grid values (including ghost values).
+            for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+                for (const std::pair<double*, int>& values : get_values(patch, u_idx, use_cell))
+                {
+                    for (int i = 0; i < values.second; ++i) values.first[i] = distribution(std_seq);
+                }
+            }
+            std::vector<double> V_generic(Q_data.size()), V_specialized(Q_data.size());
+            LEInteractor::s_use_specialized_interpolation = false;
+            interpolate(u_idx, V_generic);
+            LEInteractor::s_use_specialized_interpolation = true;
+            interpolate(u_idx, V_specialized);
+            LEInteractor::s_use_specialized_interpolation = false;
+
+            const double V_norm = max_difference(V_generic, std::vector<double>(V_generic.size(), 0.0));
+            out << "relative difference between specialized and generic interpolation: "
+                << max_difference(V_generic, V_specialized) / V_norm << "\n";
+        }
+        else if (test == "interaction_plans")
+        {
+            spread(u_idx);
+            const double u_norm_0 = max_norm(patch_level, u_idx, -1, use_cell);
+
+            // Compute, reuse, and then update (after moving half of the
+            // markers) cached plans, with and without threaded spreading.
+            LEInteractor::s_use_interaction_plans = true;
+            const int handle = LEInteractor::getNewInteractionPlanHandle();
+            double plans_diff = 0.0;
+            for (const bool threaded : { false, true })
+            {
+                LEInteractor::s_use_threaded_spreading = threaded;
+                LEInteractor::setInteractionPlanHandle(handle, 0);
+                spread(v_idx);
+                spread(w_idx);
+                plans_diff = std::max({ plans_diff,
+                                        max_norm(patch_level, u_idx, v_idx, use_cell),
+                                        max_norm(patch_level, u_idx, w_idx, use_cell) });
+                LEInteractor::unsetInteractionPlanHandle();
+            }
+            out << "relative difference between cached and uncached spreading: " << plans_diff / u_norm_0 << "\n";
+
+            for (int l = 0; l < n_points; l += 2)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_data[l * NDIM + d] = x_lo[d] + (x_up[d] - x_lo[d]) * distribution(std_seq);
+                }
+            }
+            LEInteractor::s_use_interaction_plans = false;
+            LEInteractor::s_use_threaded_spreading = false;
+            spread(u_idx);
+            const double u_norm_1 = max_norm(patch_level, u_idx, -1, use_cell);
+            LEInteractor::s_use_interaction_plans = true;
+            double updated_plans_diff = 0.0;
+            for (const bool threaded : { false, true })
+            {
+                LEInteractor::s_use_threaded_spreading = threaded;
+                LEInteractor::setInteractionPlanHandle(handle, 0);
+                spread(v_idx);
+                updated_plans_diff = std::max(updated_plans_diff, max_norm(patch_level, u_idx, v_idx, use_cell));
+                LEInteractor::unsetInteractionPlanHandle();
+            }
+            out << "relative difference between updated cached and uncached spreading: "
+                << updated_plans_diff / u_norm_1 << "\n";
+
+            // Interpolate with a new version of the handle.
+            std::vector<double> V_uncached(Q_data.size()), V_cached(Q_data.size());
+            LEInteractor::s_use_interaction_plans = false;
+            LEInteractor::s_use_threaded_spreading = false;
+            interpolate(u_idx, V_uncached);
+            LEInteractor::s_use_interaction_plans = true;
+            LEInteractor::setInteractionPlanHandle(handle, 1);
+            interpolate(u_idx, V_cached);
+            interpolate(u_idx, V_cached);
+            LEInteractor::unsetInteractionPlanHandle();
+            LEInteractor::s_use_interaction_plans = false;
+            LEInteractor::clearInteractionPlans();
+            const double V_norm = max_difference(V_uncached, std::vector<double>(V_uncached.size(), 0.0));
+            out << "relative difference between cached and uncached interpolation: "
+                << max_difference(V_uncached, V_cached) / V_norm << "\n";
+        }
+        else
+        {
+            TBOX_ERROR("unknown test " << test << "\n");
+        }
+
+        // All values are reduced so only print on rank 0.
+        plog << out.str();
+    }
+} // main
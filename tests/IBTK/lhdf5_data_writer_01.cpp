@@ -0,0 +1,188 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LHDF5DataWriter.h>
+
+#include <petscao.h>
+
+#include <hdf5.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Write marker clouds with LHDF5DataWriter and read the HDF5 datasets and the
+// XDMF description back.  Each process registers its own cloud, and the
+// Lagrangian indices are numbered in the reverse of the PETSc ordering so that
+// the data in each cloud are owned by other processes.  The rows of the
+// datasets are ordered by Lagrangian index within each cloud and by rank
+// between clouds, so row i of each dataset holds the data of marker i.
+
+namespace
+{
+// The number of markers owned by process rank.
+int
+num_local_markers(const int rank)
+{
+    return 3 + rank;
+} // num_local_markers
+
+// Print the extents, chunk sizes, number of filters, and values of a
+// two-dimensional dataset.
+void
+print_dataset(const hid_t file_id, const std::string& path)
+{
+    hid_t dataset_id = H5Dopen2(file_id, path.c_str(), H5P_DEFAULT);
+    if (dataset_id < 0) TBOX_ERROR("could not open the dataset " << path << "\n");
+    hid_t space_id = H5Dget_space(dataset_id);
+    TBOX_ASSERT(H5Sget_simple_extent_ndims(space_id) == 2);
+    hsize_t dims[2];
+    H5Sget_simple_extent_dims(space_id, dims, nullptr);
+    hid_t dcpl_id = H5Dget_create_plist(dataset_id);
+    hsize_t chunk_dims[2];
+    H5Pget_chunk(dcpl_id, 2, chunk_dims);
+    plog << path << ": " << dims[0] << " x " << dims[1] << ", chunks: " << chunk_dims[0] << " x " << chunk_dims[1]
+         << ", filters: " << H5Pget_nfilters(dcpl_id) << "\n";
+    std::vector<double> vals(dims[0] * dims[1]);
+    H5Dread(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, vals.data());
+    for (hsize_t i = 0; i < dims[0]; ++i)
+    {
+        plog << "  ";
+        for (hsize_t j = 0; j < dims[1]; ++j) plog << vals[i * dims[1] + j] << (j + 1 < dims[1] ? " " : "\n");
+    }
+    H5Pclose(dcpl_id);
+    H5Sclose(space_id);
+    H5Dclose(dataset_id);
+} // print_dataset
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const std::string dump_dirname = input_db->getString("DUMP_DIRNAME");
+
+        const int rank = IBTK_MPI::getRank();
+        const int nodes = IBTK_MPI::getNodes();
+        int first_idx = 0, num_markers = 0;
+        for (int proc = 0; proc < nodes; ++proc)
+        {
+            if (proc < rank) first_idx += num_local_markers(proc);
+            num_markers += num_local_markers(proc);
+        }
+        const int num_local = num_local_markers(rank);
+
+        // Number the Lagrangian indices in the reverse of the PETSc ordering.
+        std::vector<int> lag_idxs(num_local), petsc_idxs(num_local);
+        for (int i = 0; i < num_local; ++i)
+        {
+            petsc_idxs[i] = first_idx + i;
+            lag_idxs[i] = num_markers - 1 - petsc_idxs[i];
+        }
+        AO ao;
+        int ierr = AOCreateBasic(PETSC_COMM_WORLD, num_local, lag_idxs.data(), petsc_idxs.data(), &ao);
+        IBTK_CHKERRQ(ierr);
+
+        // Set the positions, a vector field, and a scalar field.
+        Pointer<LData> X_data = new LData("X", num_local, NDIM);
+        Pointer<LData> U_data = new LData("U", num_local, NDIM);
+        Pointer<LData> p_data = new LData("p", num_local, 1);
+        {
+            boost::multi_array_ref<double, 2>& X = *X_data->getLocalFormVecArray();
+            boost::multi_array_ref<double, 2>& U = *U_data->getLocalFormVecArray();
+            boost::multi_array_ref<double, 1>& p = *p_data->getLocalFormArray();
+            for (int i = 0; i < num_local; ++i)
+            {
+                const int lag_idx = lag_idxs[i];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[i][d] = lag_idx / static_cast<double>(1 << d);
+                    U[i][d] = (d + 1.0) * lag_idx - d;
+                }
+                p[i] = 100.0 + lag_idx;
+            }
+            X_data->restoreArrays();
+            U_data->restoreArrays();
+            p_data->restoreArrays();
+        }
+
+        LHDF5DataWriter hdf5_data_writer("LHDF5DataWriter", dump_dirname, false);
+        hdf5_data_writer.setChunkSize(input_db->getInteger("CHUNK_SIZE"));
+        hdf5_data_writer.setCompressionLevel(input_db->getInteger("COMPRESSION_LEVEL"));
+        hdf5_data_writer.registerMarkerCloud("cloud_" + std::to_string(rank), num_local, first_idx, 0);
+        hdf5_data_writer.registerCoordsData(X_data, 0);
+        hdf5_data_writer.registerVariableData("U", U_data, 0);
+        hdf5_data_writer.registerVariableData("p", p_data, 0);
+        hdf5_data_writer.registerLagrangianAO(ao, 0);
+        hdf5_data_writer.writePlotData(1, 0.5);
+
+        if (rank == 0)
+        {
+            // Print the XDMF grids, topologies, and attributes.
+            std::ifstream xdmf_file(dump_dirname + "/lag_data.cycle_000001.xmf");
+            std::string line;
+            while (std::getline(xdmf_file, line))
+            {
+                const std::size_t start = line.find_first_not_of(' ');
+                if (start == std::string::npos) continue;
+                line = line.substr(start);
+                if (line.find("<Grid ") == 0 || line.find("<Topology ") == 0 || line.find("<Geometry ") == 0 ||
+                    line.find("<Attribute ") == 0)
+                {
+                    plog << line << "\n";
+                }
+            }
+
+            // Print the contents of the HDF5 file.
+            const std::string h5_file_name = dump_dirname + "/lag_data.cycle_000001.h5";
+            hid_t file_id = H5Fopen(h5_file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+            if (file_id < 0) TBOX_ERROR("could not open " << h5_file_name << "\n");
+            double time;
+            int time_step_number;
+            hid_t attr_id = H5Aopen(file_id, "time", H5P_DEFAULT);
+            H5Aread(attr_id, H5T_NATIVE_DOUBLE, &time);
+            H5Aclose(attr_id);
+            attr_id = H5Aopen(file_id, "time_step_number", H5P_DEFAULT);
+            H5Aread(attr_id, H5T_NATIVE_INT, &time_step_number);
+            H5Aclose(attr_id);
+            plog << "time: " << time << " time step number: " << time_step_number << "\n";
+            print_dataset(file_id, "/level_0/coordinates");
+            print_dataset(file_id, "/level_0/U");
+            print_dataset(file_id, "/level_0/p");
+            H5Fclose(file_id);
+        }
+        IBTK_MPI::barrier();
+
+        ierr = AODestroy(&ao);
+        IBTK_CHKERRQ(ierr);
+    }
+    return 0;
+} // main
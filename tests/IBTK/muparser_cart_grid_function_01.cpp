@@ -0,0 +1,244 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that muParserCartGridFunction reports itself as time-dependent whether
+// or not its functions use the time variable, that it detects the use of the
+// time variable, and that the values it sets on cell-centered and
+// side-centered data are correct.  The norms of the values are printed so that
+// changes in them show up in the output.
+
+#include <SAMRAI_config.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+#include <ibtk/app_namespaces.h>
+
+namespace
+{
+// The functions specified in the input files.
+double
+steady_function(const double* const X, const double /*t*/)
+{
+    return std::sin(2.0 * M_PI * X[0]) * std::cos(2.0 * M_PI * X[1]) + X[0] * X[1];
+} // steady_function
+
+double
+unsteady_function(const double* const X, const double t)
+{
+    return std::exp(-t) * std::sin(2.0 * M_PI * X[0]) + X[1];
+} // unsteady_function
+
+// Compute the largest difference between the values set on cell-centered and
+// side-centered data and the exact values.
+void
+compute_errors(const int cc_idx,
+               const int sc_idx,
+               double (*fcn)(const double*, double),
+               const double time,
+               Pointer<PatchHierarchy<NDIM> > hierarchy,
+               double& cc_error,
+               double& sc_error)
+{
+    cc_error = 0.0;
+    sc_error = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const hier::Index<NDIM>& patch_lower = patch_box.lower();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(cc_idx);
+            Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(sc_idx);
+            double X[NDIM];
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+                cc_error = std::max(cc_error, std::abs((*cc_data)(i)-fcn(X, time)));
+            }
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                {
+                    const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = x_lower[d] +
+                               dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + (d == axis ? 0.0 : 0.5));
+                    }
+                    sc_error = std::max(sc_error, std::abs((*sc_data)(i)-fcn(X, time)));
+                }
+            }
+        }
+    }
+    cc_error = IBTK_MPI::maxReduction(cc_error);
+    sc_error = IBTK_MPI::maxReduction(sc_error);
+    return;
+} // compute_errors
+
+// Compute the discrete L2 norm of the cell-centered data and the max norm of
+// the side-centered data.
+void
+compute_norms(const int cc_idx,
+              const int sc_idx,
+              Pointer<PatchHierarchy<NDIM> > hierarchy,
+              double& cc_l2_norm,
+              double& sc_max_norm)
+{
+    cc_l2_norm = 0.0;
+    sc_max_norm = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double dV = std::accumulate(dx, dx + NDIM, 1.0, std::multiplies<double>());
+            Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(cc_idx);
+            Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(sc_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                cc_l2_norm += (*cc_data)(i) * (*cc_data)(i) * dV;
+            }
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                {
+                    const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                    sc_max_norm = std::max(sc_max_norm, std::abs((*sc_data)(i)));
+                }
+            }
+        }
+    }
+    cc_l2_norm = std::sqrt(IBTK_MPI::sumReduction(cc_l2_norm));
+    sc_max_norm = IBTK_MPI::maxReduction(sc_max_norm);
+    return;
+} // compute_norms
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "muparser_cart_grid_function.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc");
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, IntVector<NDIM>(0));
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, IntVector<NDIM>(0));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        for (const int idx : { cc_idx, sc_idx })
+        {
+            patch_hierarchy->getPatchLevel(0)->allocatePatchData(idx, 0.0);
+        }
+
+        muParserCartGridFunction steady_fcn(
+            "steady_fcn", app_initializer->getComponentDatabase("steady_fcn"), grid_geometry);
+        muParserCartGridFunction unsteady_fcn(
+            "unsteady_fcn", app_initializer->getComponentDatabase("unsteady_fcn"), grid_geometry);
+
+        std::ostringstream out;
+        out << "steady function is time dependent: " << (steady_fcn.isTimeDependent() ? "yes" : "no") << "\n";
+        out << "steady function uses the time variable: " << (steady_fcn.usesTimeVariable() ? "yes" : "no")
+            << "\n";
+        out << "unsteady function is time dependent: " << (unsteady_fcn.isTimeDependent() ? "yes" : "no") << "\n";
+        out << "unsteady function uses the time variable: " << (unsteady_fcn.usesTimeVariable() ? "yes" : "no")
+            << "\n";
+
+        // Evaluate both functions at two different times.
+        const double tol = input_db->getDouble("tolerance");
+        double max_cc_error = 0.0, max_sc_error = 0.0;
+        out << std::setprecision(10);
+        for (const double time : { 0.0, 0.5 })
+        {
+            double cc_error, sc_error, cc_l2_norm, sc_max_norm;
+            steady_fcn.setDataOnPatchHierarchy(cc_idx, cc_var, patch_hierarchy, time);
+            steady_fcn.setDataOnPatchHierarchy(sc_idx, sc_var, patch_hierarchy, time);
+            compute_errors(cc_idx, sc_idx, &steady_function, time, patch_hierarchy, cc_error, sc_error);
+            compute_norms(cc_idx, sc_idx, patch_hierarchy, cc_l2_norm, sc_max_norm);
+            max_cc_error = std::max(max_cc_error, cc_error);
+            max_sc_error = std::max(max_sc_error, sc_error);
+            out << "steady function at t = " << time << ": cell-centered |f|_2 = " << cc_l2_norm
+                << ", side-centered |f|_oo = " << sc_max_norm << "\n";
+
+            unsteady_fcn.setDataOnPatchHierarchy(cc_idx, cc_var, patch_hierarchy, time);
+            unsteady_fcn.setDataOnPatchHierarchy(sc_idx, sc_var, patch_hierarchy, time);
+            compute_errors(cc_idx, sc_idx, &unsteady_function, time, patch_hierarchy, cc_error, sc_error);
+            compute_norms(cc_idx, sc_idx, patch_hierarchy, cc_l2_norm, sc_max_norm);
+            max_cc_error = std::max(max_cc_error, cc_error);
+            max_sc_error = std::max(max_sc_error, sc_error);
+            out << "unsteady function at t = " << time << ": cell-centered |f|_2 = " << cc_l2_norm
+                << ", side-centered |f|_oo = " << sc_max_norm << "\n";
+        }
+        out << "cell-centered values are correct: " << (max_cc_error <= tol ? "yes" : "no") << "\n";
+        out << "side-centered values are correct: " << (max_sc_error <= tol ? "yes" : "no") << "\n";
+        plog << out.str();
+    }
+} // main
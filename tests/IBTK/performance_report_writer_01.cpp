@@ -0,0 +1,117 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PerformanceReportWriter.h>
+
+#include <tbox/RestartManager.h>
+
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Write a performance report, restart, and append to it, and print the report
+// with the wallclock times (which vary from run to run) masked out.  The
+// report contains a timer that is never started, a step value that is
+// evaluated at each record, and a step value that is accumulated between
+// records, both of which depend on the rank so that the minimum, maximum, and
+// average differ.
+
+namespace
+{
+// Replace the wallclock statistics of a JSON record with "...".
+std::string
+mask_json_wallclock(const std::string& line)
+{
+    const std::string key = "\"wallclock\":{";
+    const std::size_t start = line.find(key);
+    if (start == std::string::npos) return line;
+    const std::size_t stats_start = start + key.size();
+    const std::size_t stats_end = line.find('}', stats_start);
+    return line.substr(0, stats_start) + "..." + line.substr(stats_end);
+} // mask_json_wallclock
+
+// Replace the wallclock columns (the third through fifth columns) of a CSV
+// row with "...".
+std::string
+mask_csv_wallclock(const std::string& line)
+{
+    if (line.find("step,") == 0) return line;
+    std::size_t start = 0;
+    for (int k = 0; k < 2; ++k) start = line.find(',', start) + 1;
+    std::size_t end = start;
+    for (int k = 0; k < 3; ++k) end = line.find(',', end) + 1;
+    return line.substr(0, start) + "...,...,...," + line.substr(end);
+} // mask_csv_wallclock
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> report_db = input_db->getDatabase("PerformanceReportWriter");
+        const std::string file_name = report_db->getString("file_name");
+        const bool use_csv = report_db->getString("format") == "CSV";
+        const std::string restart_dirname = input_db->getString("RESTART_DIRNAME");
+
+        const int rank = IBTK_MPI::getRank();
+        int time_step = 0;
+        auto write_records = [&](const int num_steps)
+        {
+            PerformanceReportWriter report_writer("PerformanceReportWriter", report_db);
+            report_writer.registerStepValue("evaluated", [&]() { return (rank + 1.0) * time_step; });
+            report_writer.registerStepValue("accumulated");
+            for (int k = 0; k < num_steps; ++k)
+            {
+                ++time_step;
+                report_writer.addToStepValue("accumulated", rank + 1.0);
+                report_writer.addToStepValue("accumulated", time_step);
+                report_writer.writeStepReport(time_step, 0.5 * time_step);
+            }
+        };
+
+        // Write the first records, and then append to the report from a
+        // restarted run.
+        write_records(4);
+        RestartManager::getManager()->writeRestartFile(restart_dirname, time_step);
+        RestartManager::getManager()->openRestartFile(restart_dirname, time_step, IBTK_MPI::getNodes());
+        write_records(4);
+        RestartManager::getManager()->closeRestartFile();
+
+        if (rank == 0)
+        {
+            std::ifstream report_file(file_name);
+            std::string line;
+            while (std::getline(report_file, line))
+            {
+                plog << (use_csv ? mask_csv_wallclock(line) : mask_json_wallclock(line)) << "\n";
+            }
+        }
+        IBTK_MPI::barrier();
+    }
+    return 0;
+} // main
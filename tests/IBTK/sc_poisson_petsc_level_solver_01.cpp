@@ -0,0 +1,219 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscksp.h>
+
+// Headers for major SAMRAI objects
+#include <BoxArray.h>
+#include <CartesianGridGeometry.h>
+#include <PatchHierarchy.h>
+#include <PoissonSpecifications.h>
+#include <ProcessorMapping.h>
+#include <SAMRAIVectorReal.h>
+#include <SideVariable.h>
+#include <VariableDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/SCPoissonPETScLevelSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Solve the periodic Helmholtz problem C u - L u = f on a single level with
+// SCPoissonPETScLevelSolver, reusing the matrix structure when C changes and
+// after level 0 is replaced by a level with a different patch layout.  The
+// right-hand side is an eigenfunction of the discrete Laplacian on the unit
+// square, so the discrete solution is known in closed form.  The solutions are
+// also compared with those of a solver that rebuilds the matrix every time.
+
+namespace
+{
+// Replace level 0 of the hierarchy by a level whose patches tile the domain with
+// boxes of the size given by the input key and are assigned to the processes in
+// turn.
+void
+make_level(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+           const Box<NDIM>& domain_box,
+           Pointer<Database> input_db,
+           const std::string& patch_size_key,
+           const std::vector<int>& patch_data_idxs)
+{
+    int patch_size_arr[NDIM];
+    input_db->getIntegerArray(patch_size_key, patch_size_arr, NDIM);
+    IntVector<NDIM> patch_size;
+    for (unsigned int d = 0; d < NDIM; ++d) patch_size(d) = patch_size_arr[d];
+    const Box<NDIM> tile_box = Box<NDIM>::coarsen(domain_box, patch_size);
+    BoxArray<NDIM> boxes(tile_box.size());
+    ProcessorMapping mapping(tile_box.size());
+    int k = 0;
+    for (Box<NDIM>::Iterator b(tile_box); b; b++, ++k)
+    {
+        hier::Index<NDIM> lower, upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            lower(d) = b()(d) * patch_size(d);
+            upper(d) = std::min(lower(d) + patch_size(d) - 1, domain_box.upper(d));
+        }
+        boxes[k] = Box<NDIM>(lower, upper);
+        mapping.setProcessorAssignment(k, k % IBTK_MPI::getNodes());
+    }
+    patch_hierarchy->makeNewPatchLevel(0, IntVector<NDIM>(1), boxes, mapping);
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (const int idx : patch_data_idxs) level->allocatePatchData(idx, 0.0);
+    plog << "level 0: " << boxes.getNumberOfBoxes() << " patches of size";
+    for (unsigned int d = 0; d < NDIM; ++d) plog << " " << patch_size(d);
+    plog << "\n";
+} // make_level
+
+// Reinitialize the solver for the given value of C and solve the system.
+void
+solve(SCPoissonPETScLevelSolver& solver,
+      const double C,
+      SAMRAIVectorReal<NDIM, double>& u_vec,
+      SAMRAIVectorReal<NDIM, double>& f_vec)
+{
+    PoissonSpecifications poisson_spec("poisson_spec");
+    poisson_spec.setCConstant(C);
+    poisson_spec.setDConstant(-1.0);
+    solver.deallocateSolverState();
+    solver.setPoissonSpecifications(poisson_spec);
+    solver.initializeSolverState(u_vec, f_vec);
+    u_vec.setToScalar(0.0);
+    solver.solveSystem(u_vec, f_vec);
+} // solve
+
+// Get the matrix used by the solver.
+Mat
+get_mat(const SCPoissonPETScLevelSolver& solver)
+{
+    Mat mat;
+    int ierr = KSPGetOperators(solver.getPETScKSP(), &mat, nullptr);
+    IBTK_CHKERRQ(ierr);
+    return mat;
+} // get_mat
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "sc_poisson.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        const Box<NDIM> domain_box = grid_geometry->getPhysicalDomain()[0];
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > u_rebuilt_var = new SideVariable<NDIM, double>("u_rebuilt");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        Pointer<SideVariable<NDIM, double> > e_var = new SideVariable<NDIM, double>("e");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int u_rebuilt_idx = var_db->registerVariableAndContext(u_rebuilt_var, ctx, IntVector<NDIM>(1));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, IntVector<NDIM>(1));
+        const int e_idx = var_db->registerVariableAndContext(e_var, ctx, IntVector<NDIM>(1));
+        const std::vector<int> patch_data_idxs = { u_idx, u_rebuilt_idx, f_idx, e_idx };
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+
+        // f is an eigenfunction of the discrete Laplacian with eigenvalue -mu.
+        const double* const dx = grid_geometry->getDx();
+        const double pi = 4.0 * std::atan(1.0);
+        double mu = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d) mu += 4.0 * std::pow(std::sin(pi * dx[d]) / dx[d], 2);
+
+        SCPoissonPETScLevelSolver reuse_solver("reuse_solver", input_db->getDatabase("reuse_solver_db"), "reuse_");
+        SCPoissonPETScLevelSolver rebuilt_solver(
+            "rebuilt_solver", input_db->getDatabase("rebuilt_solver_db"), "rebuilt_");
+        reuse_solver.setPhysicalBcCoefs(std::vector<RobinBcCoefStrategy<NDIM>*>(NDIM, nullptr));
+        rebuilt_solver.setPhysicalBcCoefs(std::vector<RobinBcCoefStrategy<NDIM>*>(NDIM, nullptr));
+
+        // Solve with both solvers and print the max norms of the solution and of
+        // its differences from the discrete solution and the rebuilt solution.
+        const auto solve_and_print = [&](const double C)
+        {
+            SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, 0);
+            SAMRAIVectorReal<NDIM, double> u_rebuilt_vec("u_rebuilt", patch_hierarchy, 0, 0);
+            SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, 0);
+            SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, 0);
+            u_vec.addComponent(u_var, u_idx);
+            u_rebuilt_vec.addComponent(u_rebuilt_var, u_rebuilt_idx);
+            f_vec.addComponent(f_var, f_idx);
+            e_vec.addComponent(e_var, e_idx);
+
+            f_fcn.setDataOnPatchHierarchy(f_idx, f_var, patch_hierarchy, 0.0);
+            solve(reuse_solver, C, u_vec, f_vec);
+            solve(rebuilt_solver, C, u_rebuilt_vec, f_vec);
+
+            Pointer<SAMRAIVectorReal<NDIM, double> > u_ptr(&u_vec, false);
+            Pointer<SAMRAIVectorReal<NDIM, double> > u_rebuilt_ptr(&u_rebuilt_vec, false);
+            Pointer<SAMRAIVectorReal<NDIM, double> > f_ptr(&f_vec, false);
+            plog << "C = " << C << "\n";
+            plog << "|u|_oo                = " << u_vec.maxNorm() << "\n";
+            e_vec.scale(1.0 / (C + mu), f_ptr);
+            e_vec.subtract(u_ptr, Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false));
+            plog << "|u - u_exact|_oo      = " << e_vec.maxNorm() << "\n";
+            e_vec.subtract(u_ptr, u_rebuilt_ptr);
+            plog << "|u - u_rebuilt|_oo    = " << e_vec.maxNorm() << "\n";
+        };
+
+        plog << std::fixed << std::setprecision(10);
+        const double C_0 = input_db->getDouble("C_0");
+        const double C_1 = input_db->getDouble("C_1");
+        make_level(patch_hierarchy, domain_box, input_db, "patch_size_0", patch_data_idxs);
+        solve_and_print(C_0);
+
+        // Keep a reference to the matrix so that it cannot be reallocated at the
+        // same address.
+        Mat mat = get_mat(reuse_solver);
+        int ierr = PetscObjectReference(reinterpret_cast<PetscObject>(mat));
+        IBTK_CHKERRQ(ierr);
+
+        // Only the coefficients change, so the matrix is reused.
+        solve_and_print(C_1);
+        plog << "matrix reused: " << (get_mat(reuse_solver) == mat) << "\n";
+
+        // The level changes, so the matrix and the DOF indices are rebuilt.
+        make_level(patch_hierarchy, domain_box, input_db, "patch_size_1", patch_data_idxs);
+        solve_and_print(C_1);
+        plog << "matrix reused: " << (get_mat(reuse_solver) == mat) << "\n";
+
+        ierr = MatDestroy(&mat);
+        IBTK_CHKERRQ(ierr);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
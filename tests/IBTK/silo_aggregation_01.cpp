@@ -0,0 +1,205 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LSiloDataWriter.h>
+
+#include <petscao.h>
+
+#include <silo.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Write marker clouds with LSiloDataWriter, using the input keys that set the
+// number of output files and enable asynchronous output, and read them back
+// through the summary file.  Each process registers its own cloud, and the
+// Lagrangian indices are numbered in the reverse of the PETSc ordering so that
+// the data in each cloud are owned by other processes.  The Lagrangian data
+// are modified as soon as the first time step is written to check that the
+// values written are the ones passed to writePlotData().
+
+namespace
+{
+// The number of markers owned by process rank.
+int
+num_local_markers(const int rank)
+{
+    return 3 + rank;
+} // num_local_markers
+
+// Return the directory containing the Silo files for the given time step.
+std::string
+get_dump_dirname(const std::string& viz_dump_dirname, const int time_step)
+{
+    char temp_buf[128];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", time_step);
+    return viz_dump_dirname + "/lag_data.cycle_" + temp_buf;
+} // get_dump_dirname
+
+// Print the names of the local Silo files written for the given time step.
+void
+print_local_files(const std::string& viz_dump_dirname, const int time_step)
+{
+    const std::string dump_dirname = get_dump_dirname(viz_dump_dirname, time_step);
+    plog << "local files:";
+    for (int proc = 0; proc < IBTK_MPI::getNodes(); ++proc)
+    {
+        char temp_buf[128];
+        std::snprintf(temp_buf, sizeof(temp_buf), "lag_data.proc_%04d.silo", proc);
+        if (std::ifstream(dump_dirname + "/" + temp_buf)) plog << " " << temp_buf;
+    }
+    plog << "\n";
+} // print_local_files
+
+// Look up a marker cloud in the summary file for the given time step and print
+// the coordinates and values read from the local file that contains it.
+void
+print_marker_cloud(const std::string& viz_dump_dirname, const int time_step, const std::string& cloud_name)
+{
+    char temp_buf[128];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", time_step);
+    const std::string dump_dirname = get_dump_dirname(viz_dump_dirname, time_step);
+    const std::string summary_file_name = dump_dirname + "/lag_data.cycle_" + temp_buf + ".summary.silo";
+    DBfile* summary_file = DBOpen(summary_file_name.c_str(), DB_UNKNOWN, DB_READ);
+    if (!summary_file) TBOX_ERROR("could not open " << summary_file_name << "\n");
+    DBmultimesh* multimesh = DBGetMultimesh(summary_file, cloud_name.c_str());
+    if (!multimesh) TBOX_ERROR("could not read the multimesh " << cloud_name << "\n");
+    const std::string mesh_name = multimesh->meshnames[0];
+    DBFreeMultimesh(multimesh);
+    DBClose(summary_file);
+    plog << cloud_name << ": " << mesh_name << "\n";
+
+    // Mesh names are of the form file:path.
+    const std::size_t sep = mesh_name.find(':');
+    const std::string local_file_name = dump_dirname + "/" + mesh_name.substr(0, sep);
+    const std::string mesh_path = mesh_name.substr(sep + 1);
+    const std::string var_path = mesh_path.substr(0, mesh_path.rfind('/') + 1) + "U";
+    DBfile* local_file = DBOpen(local_file_name.c_str(), DB_UNKNOWN, DB_READ);
+    if (!local_file) TBOX_ERROR("could not open " << local_file_name << "\n");
+    DBpointmesh* mesh = DBGetPointmesh(local_file, mesh_path.c_str());
+    DBmeshvar* var = DBGetPointvar(local_file, var_path.c_str());
+    if (!mesh || !var) TBOX_ERROR("could not read the marker cloud " << mesh_path << "\n");
+    TBOX_ASSERT(mesh->datatype == DB_FLOAT && var->datatype == DB_FLOAT);
+    for (int i = 0; i < mesh->nels; ++i)
+    {
+        plog << "  X = (";
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            plog << static_cast<const float*>(mesh->coords[d])[i] << (d + 1 < NDIM ? ", " : ")");
+        }
+        plog << " U = " << static_cast<const float*>(var->vals[0])[i] << "\n";
+    }
+    DBFreeMeshvar(var);
+    DBFreePointmesh(mesh);
+    DBClose(local_file);
+} // print_marker_cloud
+
+// Set the values of the Lagrangian data for the given time step.
+void
+set_data(LData& X_data, LData& U_data, const int first_petsc_idx, const int num_markers, const int time_step)
+{
+    boost::multi_array_ref<double, 2>& X = *X_data.getLocalFormVecArray();
+    boost::multi_array_ref<double, 1>& U = *U_data.getLocalFormArray();
+    for (unsigned int i = 0; i < X.shape()[0]; ++i)
+    {
+        const int lag_idx = num_markers - 1 - (first_petsc_idx + static_cast<int>(i));
+        X[i][0] = lag_idx + 0.25 * (time_step - 1);
+        for (unsigned int d = 1; d < NDIM; ++d) X[i][d] = 0.5 * d * lag_idx;
+        U[i] = time_step == 1 ? lag_idx : 100 + lag_idx;
+    }
+    X_data.restoreArrays();
+    U_data.restoreArrays();
+} // set_data
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<LSiloDataWriter> silo_data_writer = app_initializer->getLSiloDataWriter();
+        TBOX_ASSERT(silo_data_writer);
+        const std::string viz_dump_dirname = app_initializer->getVizDumpDirectory();
+
+        const int rank = IBTK_MPI::getRank();
+        const int nodes = IBTK_MPI::getNodes();
+        int first_idx = 0, num_markers = 0;
+        for (int proc = 0; proc < nodes; ++proc)
+        {
+            if (proc < rank) first_idx += num_local_markers(proc);
+            num_markers += num_local_markers(proc);
+        }
+        const int num_local = num_local_markers(rank);
+
+        // Number the Lagrangian indices in the reverse of the PETSc ordering.
+        std::vector<int> lag_idxs(num_local), petsc_idxs(num_local);
+        for (int i = 0; i < num_local; ++i)
+        {
+            petsc_idxs[i] = first_idx + i;
+            lag_idxs[i] = num_markers - 1 - petsc_idxs[i];
+        }
+        AO ao;
+        int ierr = AOCreateBasic(PETSC_COMM_WORLD, num_local, lag_idxs.data(), petsc_idxs.data(), &ao);
+        IBTK_CHKERRQ(ierr);
+
+        Pointer<LData> X_data = new LData("X", num_local, NDIM);
+        Pointer<LData> U_data = new LData("U", num_local, 1);
+        silo_data_writer->registerMarkerCloud("cloud_" + std::to_string(rank), num_local, first_idx, 0);
+        silo_data_writer->registerCoordsData(X_data, 0);
+        silo_data_writer->registerVariableData("U", U_data, 0);
+        silo_data_writer->registerLagrangianAO(ao, 0);
+
+        set_data(*X_data, *U_data, first_idx, num_markers, 1);
+        silo_data_writer->writePlotData(1, 0.5);
+        set_data(*X_data, *U_data, first_idx, num_markers, 2);
+        silo_data_writer->writePlotData(2, 1.0);
+        silo_data_writer->waitForPendingOutput();
+        IBTK_MPI::barrier();
+
+        if (rank == 0)
+        {
+            for (int time_step = 1; time_step <= 2; ++time_step)
+            {
+                plog << "time step " << time_step << "\n";
+                print_local_files(viz_dump_dirname, time_step);
+                for (int proc = 0; proc < nodes; ++proc)
+                {
+                    print_marker_cloud(viz_dump_dirname, time_step, "cloud_" + std::to_string(proc));
+                }
+            }
+        }
+        IBTK_MPI::barrier();
+
+        ierr = AODestroy(&ao);
+        IBTK_CHKERRQ(ierr);
+    }
+    return 0;
+} // main
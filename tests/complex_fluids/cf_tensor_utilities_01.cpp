@@ -0,0 +1,228 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test the closed-form tensor kernels of CFTensorUtilities on tensors with
+// repeated and nearly repeated eigenvalues: the eigendecomposition, the
+// round trip through the matrix logarithm and exponential, and the projection
+// onto positive definite tensors.  The tensors are constructed from their
+// eigenvalues and a rotation, so the results can be compared with the
+// spectral definitions of the matrix functions.
+
+#include <ibamr/CFTensorUtilities.h>
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/ibtk_utilities.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <vector>
+
+using namespace IBAMR;
+using namespace IBTK;
+
+namespace
+{
+static const int NUM_COMPONENTS = CFTensorUtilities::NUM_COMPONENTS;
+
+using Eigenvalues = std::array<double, NDIM>;
+
+// Rotation used to construct the k-th test tensor.
+MatrixNd
+rotation(const int k)
+{
+#if (NDIM == 2)
+    const double theta = 0.3 + 0.7 * k;
+    MatrixNd Q;
+    Q << std::cos(theta), -std::sin(theta), std::sin(theta), std::cos(theta);
+    return Q;
+#endif
+#if (NDIM == 3)
+    const double alpha = 0.3 + 0.7 * k, beta = 1.1 - 0.4 * k, gamma = 0.5 + 0.9 * k;
+    MatrixNd R_z, R_y, R_x;
+    R_z << std::cos(alpha), -std::sin(alpha), 0.0, std::sin(alpha), std::cos(alpha), 0.0, 0.0, 0.0, 1.0;
+    R_y << std::cos(beta), 0.0, std::sin(beta), 0.0, 1.0, 0.0, -std::sin(beta), 0.0, std::cos(beta);
+    R_x << 1.0, 0.0, 0.0, 0.0, std::cos(gamma), -std::sin(gamma), 0.0, std::sin(gamma), std::cos(gamma);
+    return R_z * R_y * R_x;
+#endif
+} // rotation
+
+// Compute Q diag(f(lambda)) Q^T.
+MatrixNd
+spectral_function(const MatrixNd& Q, const Eigenvalues& lambda, const std::function<double(double)>& f)
+{
+    MatrixNd D = MatrixNd::Zero();
+    for (unsigned int d = 0; d < NDIM; ++d) D(d, d) = f(lambda[d]);
+    return Q * D * Q.transpose();
+} // spectral_function
+
+// Convert a symmetric matrix to Voigt notation.
+std::array<double, NUM_COMPONENTS>
+to_voigt(const MatrixNd& A)
+{
+#if (NDIM == 2)
+    return { { A(0, 0), A(1, 1), A(0, 1) } };
+#endif
+#if (NDIM == 3)
+    return { { A(0, 0), A(1, 1), A(2, 2), A(1, 2), A(0, 2), A(0, 1) } };
+#endif
+} // to_voigt
+
+// Tensors stored in the structure-of-arrays form used by the slab kernels.
+struct TensorBatch
+{
+    explicit TensorBatch(const int n) : n(n)
+    {
+        for (int k = 0; k < NUM_COMPONENTS; ++k)
+        {
+            data[k].resize(n, 0.0);
+            ptrs[k] = data[k].data();
+            const_ptrs[k] = data[k].data();
+        }
+    }
+
+    void set(const int i, const MatrixNd& A)
+    {
+        const std::array<double, NUM_COMPONENTS> A_voigt = to_voigt(A);
+        for (int k = 0; k < NUM_COMPONENTS; ++k) data[k][i] = A_voigt[k];
+    }
+
+    // Return max_i |A_i - B_i| / max_i |B_i| over all components.
+    double relative_difference(const std::vector<MatrixNd>& B) const
+    {
+        double diff = 0.0, norm = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            const std::array<double, NUM_COMPONENTS> B_voigt = to_voigt(B[i]);
+            for (int k = 0; k < NUM_COMPONENTS; ++k)
+            {
+                diff = std::max(diff, std::abs(data[k][i] - B_voigt[k]));
+                norm = std::max(norm, std::abs(B_voigt[k]));
+            }
+        }
+        return diff / norm;
+    }
+
+    int n;
+    std::array<std::vector<double>, NUM_COMPONENTS> data;
+    std::array<double*, NUM_COMPONENTS> ptrs;
+    std::array<const double*, NUM_COMPONENTS> const_ptrs;
+};
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    std::ofstream out("output");
+    out << std::setprecision(10);
+
+    // Symmetric positive definite tensors, including tensors with repeated and
+    // nearly repeated eigenvalues.
+#if (NDIM == 2)
+    const std::vector<Eigenvalues> spd_eig_vals = { { { 2.0, 2.0 } },
+                                                    { { 1.5, 1.5 + 1.0e-10 } },
+                                                    { { 0.5, 3.0 } },
+                                                    { { 1.0e-3, 10.0 } } };
+#endif
+#if (NDIM == 3)
+    const std::vector<Eigenvalues> spd_eig_vals = { { { 2.0, 2.0, 2.0 } },
+                                                    { { 1.0, 1.0, 4.0 } },
+                                                    { { 0.5, 3.0, 3.0 } },
+                                                    { { 1.0, 1.0 + 1.0e-10, 2.0 } },
+                                                    { { 0.25, 1.0, 5.0 } } };
+#endif
+    const int num_spd = static_cast<int>(spd_eig_vals.size());
+    std::vector<MatrixNd> Q(num_spd), A(num_spd), log_A(num_spd);
+    TensorBatch A_batch(num_spd);
+    for (int i = 0; i < num_spd; ++i)
+    {
+        Q[i] = rotation(i);
+        A[i] = spectral_function(Q[i], spd_eig_vals[i], [](const double lam) { return lam; });
+        log_A[i] = spectral_function(Q[i], spd_eig_vals[i], [](const double lam) { return std::log(lam); });
+        A_batch.set(i, A[i]);
+    }
+
+    // Check that the eigendecomposition reconstructs each tensor with
+    // orthonormal eigenvectors.
+    double decomposition_error = 0.0;
+    for (int i = 0; i < num_spd; ++i)
+    {
+        const std::array<double, NUM_COMPONENTS> A_voigt = to_voigt(A[i]);
+        double eig_vals[NDIM], eig_vecs[NDIM][NDIM];
+        CFTensorUtilities::computeEigenDecomposition(A_voigt.data(), eig_vals, eig_vecs);
+        MatrixNd V, D = MatrixNd::Zero();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            D(d, d) = eig_vals[d];
+            for (unsigned int j = 0; j < NDIM; ++j) V(d, j) = eig_vecs[d][j];
+        }
+        const double A_norm = A[i].cwiseAbs().maxCoeff();
+        decomposition_error =
+            std::max(decomposition_error, (V * D * V.transpose() - A[i]).cwiseAbs().maxCoeff() / A_norm);
+        decomposition_error =
+            std::max(decomposition_error, (V.transpose() * V - MatrixNd::Identity()).cwiseAbs().maxCoeff());
+        out << "eigenvalues of tensor " << i << ":";
+        for (unsigned int d = 0; d < NDIM; ++d) out << " " << eig_vals[d];
+        out << "\n";
+    }
+    out << "relative eigendecomposition error = " << decomposition_error << "\n";
+
+    // Check the logarithm against its spectral definition and the round trip
+    // through the exponential.
+    TensorBatch log_batch(num_spd), exp_log_batch(num_spd);
+    CFTensorUtilities::log(A_batch.const_ptrs.data(), log_batch.ptrs.data(), num_spd);
+    CFTensorUtilities::exp(log_batch.const_ptrs.data(), exp_log_batch.ptrs.data(), num_spd);
+    out << "relative difference between log(A) and the spectral logarithm = "
+        << log_batch.relative_difference(log_A) << "\n";
+    out << "relative difference between exp(log(A)) and A = " << exp_log_batch.relative_difference(A) << "\n";
+
+    // Project indefinite tensors, including tensors with repeated negative
+    // eigenvalues, onto the tensors with eigenvalues no smaller than
+    // min_eig_val.
+    static const double min_eig_val = 0.1;
+#if (NDIM == 2)
+    const std::vector<Eigenvalues> indef_eig_vals = { { { -1.0, 2.0 } }, { { -0.5, -0.5 } }, { { 0.05, 0.05 } } };
+#endif
+#if (NDIM == 3)
+    const std::vector<Eigenvalues> indef_eig_vals = { { { -1.0, 0.05, 2.0 } },
+                                                      { { -0.5, -0.5, 3.0 } },
+                                                      { { -2.0, -2.0, -2.0 } } };
+#endif
+    const int num_indef = static_cast<int>(indef_eig_vals.size());
+    std::vector<MatrixNd> P(num_indef);
+    TensorBatch B_batch(num_indef), P_batch(num_indef);
+    for (int i = 0; i < num_indef; ++i)
+    {
+        const MatrixNd Q_i = rotation(num_spd + i);
+        B_batch.set(i, spectral_function(Q_i, indef_eig_vals[i], [](const double lam) { return lam; }));
+        P[i] = spectral_function(
+            Q_i, indef_eig_vals[i], [](const double lam) { return std::max(lam, min_eig_val); });
+    }
+    CFTensorUtilities::projectToPositiveSemiDefinite(
+        B_batch.const_ptrs.data(), P_batch.ptrs.data(), num_indef, min_eig_val);
+    out << "relative difference between the projection and the spectral projection = "
+        << P_batch.relative_difference(P) << "\n";
+    std::vector<double> det(num_indef);
+    CFTensorUtilities::determinant(P_batch.const_ptrs.data(), det.data(), num_indef);
+    for (int i = 0; i < num_indef; ++i)
+    {
+        out << "determinant of projected tensor " << i << " = " << det[i] << "\n";
+    }
+    return 0;
+} // main
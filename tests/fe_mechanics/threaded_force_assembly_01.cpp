@@ -0,0 +1,162 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that the interior force density computed with threaded assembly agrees
+// with the one computed with serial assembly, including when the runtime
+// provides fewer threads than requested.
+
+#include <ibamr/FEMechanicsExplicitIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/config.h>
+
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/numeric_vector.h>
+#include <libmesh/tensor_value.h>
+
+#if defined(IBTK_HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+static double shear_mod = 1.0;
+static double bulk_mod = 1.0;
+
+void
+coordinate_mapping_function(libMesh::Point& x, const libMesh::Point& X, void* /*ctx*/)
+{
+    // Deform the reference configuration nonuniformly so that the interior
+    // forces do not vanish.
+    x = X;
+    x(0) += 0.1 * std::sin(M_PI * X(0)) * std::sin(M_PI * X(1));
+    x(1) += 0.05 * X(0) * X(0);
+}
+
+void
+PK1_stress_function(TensorValue<double>& PP,
+                    const TensorValue<double>& FF,
+                    const libMesh::Point& /*x*/,
+                    const libMesh::Point& /*X*/,
+                    Elem* const /*elem*/,
+                    const std::vector<const std::vector<double>*>& /*var_data*/,
+                    const std::vector<const std::vector<VectorValue<double> >*>& /*grad_var_data*/,
+                    double /*time*/,
+                    void* /*ctx*/)
+{
+    const TensorValue<double> FF_inv_trans = tensor_inverse_transpose(FF, NDIM);
+    PP = shear_mod * (FF - FF_inv_trans) + bulk_mod * std::log(FF.det()) * FF_inv_trans;
+}
+
+std::unique_ptr<NumericVector<double> >
+compute_force(const LibMeshInit& init, Pointer<Database> input_db, const bool use_threaded_force_assembly)
+{
+    Mesh mesh(init.comm(), NDIM);
+    const int n = input_db->getInteger("N");
+    MeshTools::Generation::build_cube(mesh,
+                                      n,
+                                      n,
+                                      NDIM > 2 ? n : 0,
+                                      0.0,
+                                      1.0,
+                                      0.0,
+                                      1.0,
+                                      0.0,
+                                      1.0,
+                                      Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE")));
+    mesh.prepare_for_use();
+
+    Pointer<Database> fem_db = input_db->getDatabase("FEMechanicsExplicitIntegrator");
+    fem_db->putBool("use_threaded_force_assembly", use_threaded_force_assembly);
+    const std::string object_name = use_threaded_force_assembly ? "threaded_fem_solver" : "serial_fem_solver";
+    Pointer<FEMechanicsExplicitIntegrator> fem_solver =
+        new FEMechanicsExplicitIntegrator(object_name, fem_db, &mesh, /*register_for_restart*/ false);
+    fem_solver->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+    FEMechanicsBase::PK1StressFcnData PK1_stress_data(PK1_stress_function);
+    PK1_stress_data.quad_order = Utility::string_to_enum<libMesh::Order>(input_db->getString("PK1_QUAD_ORDER"));
+    fem_solver->registerPK1StressFunction(PK1_stress_data);
+    fem_solver->initializeFEEquationSystems();
+    fem_solver->initializeFEData();
+
+    // Take one forward Euler step: the force used in that step is computed
+    // from the initial configuration and is stored in the force system.
+    const double dt = input_db->getDouble("DT");
+    fem_solver->preprocessIntegrateData(0.0, dt, /*num_cycles*/ 1);
+    fem_solver->forwardEulerStep(0.0, dt);
+    fem_solver->postprocessIntegrateData(0.0, dt, /*num_cycles*/ 1);
+    System& F_system = fem_solver->getEquationSystems()->get_system<System>(FEMechanicsBase::FORCE_SYSTEM_NAME);
+    return F_system.solution->clone();
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "threaded_force_assembly.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        shear_mod = input_db->getDouble("SHEAR_MOD");
+        bulk_mod = input_db->getDouble("BULK_MOD");
+
+        // Threaded assembly is only available when IBAMR is configured with
+        // OpenMP: otherwise, all computations are serial.
+        bool use_threaded_force_assembly = false;
+#if defined(IBTK_HAVE_OPENMP)
+        omp_set_num_threads(input_db->getInteger("NUM_THREADS"));
+        use_threaded_force_assembly = true;
+#endif
+        std::unique_ptr<NumericVector<double> > F_serial = compute_force(init, input_db, false);
+        std::unique_ptr<NumericVector<double> > F_threaded =
+            compute_force(init, input_db, use_threaded_force_assembly);
+
+        // Also assemble the force when the runtime provides fewer threads than
+        // requested: disabling active parallel regions runs every region with
+        // a single thread while omp_get_max_threads() is unchanged.
+#if defined(IBTK_HAVE_OPENMP)
+        const int max_active_levels = omp_get_max_active_levels();
+        omp_set_max_active_levels(0);
+#endif
+        std::unique_ptr<NumericVector<double> > F_fewer_threads =
+            compute_force(init, input_db, use_threaded_force_assembly);
+#if defined(IBTK_HAVE_OPENMP)
+        omp_set_max_active_levels(max_active_levels);
+#endif
+
+        const double F_norm = F_serial->linfty_norm();
+        *F_threaded -= *F_serial;
+        *F_fewer_threads -= *F_serial;
+
+        std::ostringstream out;
+        out << std::setprecision(10);
+        out << "relative difference between threaded and serial force assembly: "
+            << F_threaded->linfty_norm() / F_norm << "\n";
+        out << "relative difference between threaded assembly with fewer threads and serial force assembly: "
+            << F_fewer_threads->linfty_norm() / F_norm << "\n";
+        plog << out.str();
+    }
+} // main
@@ -0,0 +1,226 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that the wavefront, multiple local sweep, and narrow band variants of
+// FastSweepingLSMethod compute the same distance function as the default
+// lexicographic sweeps.
+
+#include <SAMRAI_config.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibamr/FastSweepingLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// A circle (or a sphere) in the periodic unit square (or cube).
+struct CircularInterface
+{
+    double R;
+    double X0[NDIM];
+};
+
+// Compute the signed distance from the cell center to the interface.
+double
+circle_distance(const CircularInterface& circle,
+                const Pointer<Patch<NDIM> > patch,
+                const hier::Index<NDIM>& i)
+{
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const hier::Index<NDIM>& patch_lower = patch->getBox().lower();
+    double r_sq = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double x = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+        double r = std::abs(x - circle.X0[d]);
+        r = std::min(r, 1.0 - r);
+        r_sq += r * r;
+    }
+    return std::sqrt(r_sq) - circle.R;
+} // circle_distance
+
+// Set the distance near the interface and large values with the correct sign
+// elsewhere.
+void
+circular_interface_neighborhood(int D_idx,
+                                Pointer<HierarchyMathOps> hier_math_ops,
+                                double /*time*/,
+                                bool /*initial_time*/,
+                                void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                const CellIndex<NDIM> ci(b());
+                const double distance = circle_distance(circle, patch, ci);
+                (*D_data)(ci) = std::abs(distance) <= 1.5 * dx[0] ? distance : std::copysign(1.0e8, distance);
+            }
+        }
+    }
+    return;
+} // circular_interface_neighborhood
+
+// Compute the largest difference between two distance functions, only
+// considering the cells at which |D_ref| <= max_distance.
+double
+max_difference(const int D_idx,
+               const int D_ref_idx,
+               const double max_distance,
+               Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    double max_diff = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            Pointer<CellData<NDIM, double> > D_ref_data = patch->getPatchData(D_ref_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                const CellIndex<NDIM> ci(b());
+                if (std::abs((*D_ref_data)(ci)) > max_distance) continue;
+                max_diff = std::max(max_diff, std::abs((*D_data)(ci) - (*D_ref_data)(ci)));
+            }
+        }
+    }
+    return IBTK_MPI::maxReduction(max_diff);
+} // max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fast_sweeping.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D");
+        const int D_ref_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("reference"));
+        const int D_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("current"));
+        const int D_exact_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("exact"));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        for (const int idx : { D_ref_idx, D_idx, D_exact_idx })
+        {
+            patch_hierarchy->getPatchLevel(0)->allocatePatchData(idx, 0.0);
+        }
+        Pointer<HierarchyMathOps> hier_math_ops = new HierarchyMathOps("hier_math_ops", patch_hierarchy);
+
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        input_db->getDoubleArray("X0", circle.X0, NDIM);
+
+        // Compute the distance function with the default lexicographic sweeps
+        // and compare it to the exact distance.
+        std::ostringstream out;
+        const double error_tol = input_db->getDouble("error_tolerance");
+        const double agreement_tol = input_db->getDouble("agreement_tolerance");
+        auto compute_distance = [&](const int idx, const std::string& db_name) {
+            Pointer<FastSweepingLSMethod> ls_method =
+                new FastSweepingLSMethod(db_name, input_db->getDatabase(db_name), /*register_for_restart*/ false);
+            ls_method->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+            ls_method->registerPhysicalBoundaryCondition(nullptr);
+            ls_method->initializeLSData(idx, hier_math_ops, 0, 0.0, /*initial_time*/ true);
+        };
+        compute_distance(D_ref_idx, "LexicographicSweeps");
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_exact_data = patch->getPatchData(D_exact_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                const CellIndex<NDIM> ci(b());
+                (*D_exact_data)(ci) = circle_distance(circle, patch, ci);
+            }
+        }
+        const double error = max_difference(D_exact_idx, D_ref_idx, 1.0e8, patch_hierarchy);
+        out << "lexicographic sweeps are accurate: " << (error <= error_tol ? "yes" : "no") << "\n";
+
+        // The other sweep orderings converge to the same distance function.
+        compute_distance(D_idx, "WavefrontSweeps");
+        const double wavefront_diff = max_difference(D_idx, D_ref_idx, 1.0e8, patch_hierarchy);
+        out << "wavefront sweeps agree with lexicographic sweeps: " << (wavefront_diff <= agreement_tol ? "yes" : "no")
+            << "\n";
+
+        compute_distance(D_idx, "LocalSweeps");
+        const double local_diff = max_difference(D_idx, D_ref_idx, 1.0e8, patch_hierarchy);
+        out << "local sweeps agree with lexicographic sweeps: " << (local_diff <= agreement_tol ? "yes" : "no")
+            << "\n";
+
+        // The narrow band sweeps agree with the others within the band and
+        // cap the distance outside of it.
+        compute_distance(D_idx, "NarrowBandSweeps");
+        const double band_width = input_db->getDatabase("NarrowBandSweeps")->getDouble("narrow_band_width");
+        const double band_diff = max_difference(D_idx, D_ref_idx, band_width, patch_hierarchy);
+        out << "narrow band sweeps agree with lexicographic sweeps in the band: "
+            << (band_diff <= agreement_tol ? "yes" : "no") << "\n";
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, 0);
+        out << "narrow band sweeps cap the distance outside the band: "
+            << (hier_cc_data_ops.maxNorm(D_idx) <= band_width ? "yes" : "no") << "\n";
+        plog << out.str();
+    }
+} // main
@@ -0,0 +1,202 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that RelaxationLSMethod restricted to a narrow band computes the same
+// distance function within the band as the relaxation of the entire domain.
+// The same narrow band object reinitializes the level set of a circle at
+// several positions that are more than one tile apart, so that the band
+// cannot be found by only examining the tiles near the previous band.
+
+#include <SAMRAI_config.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+#include <ibamr/RelaxationLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// A circle (or a sphere) in the periodic unit square (or cube).
+struct CircularInterface
+{
+    double R;
+    double X0[NDIM];
+};
+
+// Compute the signed distance from the cell center to the interface.
+double
+circle_distance(const CircularInterface& circle,
+                const Pointer<Patch<NDIM> > patch,
+                const hier::Index<NDIM>& i)
+{
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const hier::Index<NDIM>& patch_lower = patch->getBox().lower();
+    double r_sq = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double x = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+        double r = std::abs(x - circle.X0[d]);
+        r = std::min(r, 1.0 - r);
+        r_sq += r * r;
+    }
+    return std::sqrt(r_sq) - circle.R;
+} // circle_distance
+
+// Set a level set function that has the correct zero contour but that is not
+// a distance function.
+void
+circular_interface(int D_idx,
+                   Pointer<HierarchyMathOps> hier_math_ops,
+                   double /*time*/,
+                   bool /*initial_time*/,
+                   void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                const CellIndex<NDIM> ci(b());
+                (*D_data)(ci) = 2.0 * circle_distance(circle, patch, ci);
+            }
+        }
+    }
+    return;
+} // circular_interface
+
+// Compute the largest difference between two distance functions, only
+// considering the cells at which |D_ref| <= max_distance.
+double
+max_difference(const int D_idx,
+               const int D_ref_idx,
+               const double max_distance,
+               Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    double max_diff = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            Pointer<CellData<NDIM, double> > D_ref_data = patch->getPatchData(D_ref_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                const CellIndex<NDIM> ci(b());
+                if (std::abs((*D_ref_data)(ci)) > max_distance) continue;
+                max_diff = std::max(max_diff, std::abs((*D_data)(ci) - (*D_ref_data)(ci)));
+            }
+        }
+    }
+    return IBTK_MPI::maxReduction(max_diff);
+} // max_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "relaxation_ls.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D");
+        const int D_ref_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("reference"));
+        const int D_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("current"));
+
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        for (const int idx : { D_ref_idx, D_idx })
+        {
+            patch_hierarchy->getPatchLevel(0)->allocatePatchData(idx, 0.0);
+        }
+        Pointer<HierarchyMathOps> hier_math_ops = new HierarchyMathOps("hier_math_ops", patch_hierarchy);
+
+        CircularInterface circle;
+        circle.R = input_db->getDouble("R");
+        const int num_positions = input_db->getArraySize("X0") / NDIM;
+        std::vector<double> X0(num_positions * NDIM);
+        input_db->getDoubleArray("X0", X0.data(), num_positions * NDIM);
+
+        // Relax the entire domain with one object and only the narrow band
+        // with another one, which keeps track of the band between the
+        // reinitializations.
+        Pointer<RelaxationLSMethod> full_ls_method = new RelaxationLSMethod(
+            "FullRelaxation", input_db->getDatabase("FullRelaxation"), /*register_for_restart*/ false);
+        Pointer<RelaxationLSMethod> band_ls_method = new RelaxationLSMethod(
+            "NarrowBandRelaxation", input_db->getDatabase("NarrowBandRelaxation"), /*register_for_restart*/ false);
+        for (const Pointer<RelaxationLSMethod>& ls_method : { full_ls_method, band_ls_method })
+        {
+            ls_method->registerInterfaceNeighborhoodLocatingFcn(&circular_interface, &circle);
+            ls_method->registerPhysicalBoundaryCondition(nullptr);
+        }
+
+        std::ostringstream out;
+        const double agreement_distance = input_db->getDouble("agreement_distance");
+        const double agreement_tol = input_db->getDouble("agreement_tolerance");
+        for (int k = 0; k < num_positions; ++k)
+        {
+            std::copy(&X0[k * NDIM], &X0[k * NDIM] + NDIM, circle.X0);
+            full_ls_method->initializeLSData(D_ref_idx, hier_math_ops, k, 0.0, /*initial_time*/ true);
+            band_ls_method->initializeLSData(D_idx, hier_math_ops, k, 0.0, /*initial_time*/ true);
+            const double band_diff = max_difference(D_idx, D_ref_idx, agreement_distance, patch_hierarchy);
+            out << "position " << k + 1 << ": narrow band relaxation agrees with full relaxation in the band: "
+                << (band_diff <= agreement_tol ? "yes" : "no") << "\n";
+        }
+        plog << out.str();
+    }
+} // main
@@ -0,0 +1,413 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that one sweep of StaggeredStokesBoxRelaxationFACOperator, which applies
+// a pre-inverted box operator, agrees with a sweep in which every local Stokes
+// problem is solved with a dense LU factorization (i.e., by LAPACK through
+// PETSc), for both lexicographic and red-black ordering.
+
+#include <ibamr/StaggeredStokesBoxRelaxationFACOperator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+
+#include <petscksp.h>
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SAMRAI_config.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideIndex.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// Number of degrees of freedom in the single-cell box operator and the
+// under-relaxation factor used by the smoother.
+static const int BOX_SIZE = 2 * NDIM + 1;
+static const double OMEGA = 0.65;
+
+// Deterministic values used to fill all of the data, including ghost values.
+double
+fill_value(const hier::Index<NDIM>& i, const int component, const double phase)
+{
+    double arg = phase + 0.5 * component;
+    for (unsigned int d = 0; d < NDIM; ++d) arg += (0.7 + 0.4 * d) * i(d);
+    return std::sin(arg);
+} // fill_value
+
+void
+fill_data(SideData<NDIM, double>& U_data, CellData<NDIM, double>& P_data, const double phase)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        ArrayData<NDIM, double>& U_array = U_data.getArrayData(axis);
+        for (Box<NDIM>::Iterator b(U_array.getBox()); b; b++) U_array(b(), 0) = fill_value(b(), axis, phase);
+    }
+    ArrayData<NDIM, double>& P_array = P_data.getArrayData();
+    for (Box<NDIM>::Iterator b(P_array.getBox()); b; b++) P_array(b(), 0) = fill_value(b(), NDIM, phase);
+    return;
+} // fill_data
+
+// Index of face side of cell i in the direction axis, indexed by the cell
+// whose lower face it is.
+inline hier::Index<NDIM>
+face_index(const hier::Index<NDIM>& i, const unsigned int axis, const int side)
+{
+    hier::Index<NDIM> f = i;
+    f(axis) += side;
+    return f;
+} // face_index
+
+// Reference implementation of the box relaxation sweep: the right-hand side of
+// each local problem is assembled from the current error values and the local
+// problem is solved by the supplied direct solver.
+class ReferenceBoxRelaxation
+{
+public:
+    ReferenceBoxRelaxation(const double C, const double D, const double* const dx) : d_D(D)
+    {
+        std::copy(dx, dx + NDIM, d_dx.begin());
+
+        // Assemble the dense single-cell operator.  Unknowns are ordered as
+        // (lower face, upper face) for each axis followed by the pressure.
+        int ierr = MatCreateSeqDense(PETSC_COMM_SELF, BOX_SIZE, BOX_SIZE, nullptr, &d_A);
+        IBTK_CHKERRQ(ierr);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            double diag = C;
+            for (unsigned int d = 0; d < NDIM; ++d) diag -= 2.0 * D / (dx[d] * dx[d]);
+            const int lower = 2 * axis, upper = 2 * axis + 1;
+            ierr = MatSetValue(d_A, lower, lower, diag, INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, upper, upper, diag, INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, lower, upper, D / (dx[axis] * dx[axis]), INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, upper, lower, D / (dx[axis] * dx[axis]), INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, lower, BOX_SIZE - 1, 1.0 / dx[axis], INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, upper, BOX_SIZE - 1, -1.0 / dx[axis], INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, BOX_SIZE - 1, lower, 1.0 / dx[axis], INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+            ierr = MatSetValue(d_A, BOX_SIZE - 1, upper, -1.0 / dx[axis], INSERT_VALUES);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = MatAssemblyBegin(d_A, MAT_FINAL_ASSEMBLY);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatAssemblyEnd(d_A, MAT_FINAL_ASSEMBLY);
+        IBTK_CHKERRQ(ierr);
+
+        ierr = MatCreateVecs(d_A, &d_x, &d_b);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPCreate(PETSC_COMM_SELF, &d_ksp);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetOperators(d_ksp, d_A, d_A);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetType(d_ksp, KSPPREONLY);
+        IBTK_CHKERRQ(ierr);
+        PC pc;
+        ierr = KSPGetPC(d_ksp, &pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(pc, PCLU);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetUp(d_ksp);
+        IBTK_CHKERRQ(ierr);
+    } // ReferenceBoxRelaxation
+
+    ~ReferenceBoxRelaxation()
+    {
+        KSPDestroy(&d_ksp);
+        VecDestroy(&d_x);
+        VecDestroy(&d_b);
+        MatDestroy(&d_A);
+    } // ~ReferenceBoxRelaxation
+
+    // Perform one sweep over the cells of box.  With red-black ordering, all
+    // local problems of one color are solved before the corresponding updates
+    // are applied.
+    void sweep(SideData<NDIM, double>& U_e,
+               CellData<NDIM, double>& P_e,
+               const SideData<NDIM, double>& U_r,
+               const CellData<NDIM, double>& P_r,
+               const Box<NDIM>& box,
+               const bool use_red_black_ordering)
+    {
+        if (!use_red_black_ordering)
+        {
+            for (Box<NDIM>::Iterator b(box); b; b++)
+            {
+                std::array<double, BOX_SIZE> x;
+                solve(x, U_e, P_e, U_r, P_r, b());
+                update(U_e, P_e, b(), x);
+            }
+            return;
+        }
+        for (int color = 0; color < 2; ++color)
+        {
+            std::vector<hier::Index<NDIM> > cells;
+            std::vector<std::array<double, BOX_SIZE> > xs;
+            for (Box<NDIM>::Iterator b(box); b; b++)
+            {
+                int parity = 0;
+                for (unsigned int d = 0; d < NDIM; ++d) parity += b()(d);
+                if (((parity % 2) + 2) % 2 != color) continue;
+                cells.push_back(b());
+                xs.emplace_back();
+                solve(xs.back(), U_e, P_e, U_r, P_r, b());
+            }
+            for (std::size_t k = 0; k < cells.size(); ++k) update(U_e, P_e, cells[k], xs[k]);
+        }
+        return;
+    } // sweep
+
+private:
+    void solve(std::array<double, BOX_SIZE>& x,
+               const SideData<NDIM, double>& U_e,
+               const CellData<NDIM, double>& P_e,
+               const SideData<NDIM, double>& U_r,
+               const CellData<NDIM, double>& P_r,
+               const hier::Index<NDIM>& i)
+    {
+        // Move the values of the error outside of the cell to the right-hand
+        // side in the same way as the original PETSc-based smoother.
+        std::array<double, BOX_SIZE> rhs;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int side = 0; side < 2; ++side)
+            {
+                const hier::Index<NDIM> f = face_index(i, axis, side);
+                double val = U_r(SideIndex<NDIM>(f, axis, SideIndex<NDIM>::Lower));
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    hier::Index<NDIM> shift(0);
+                    shift(d) = 1;
+                    for (const hier::Index<NDIM>& g : { f - shift, f + shift })
+                    {
+                        const bool in_cell = d == axis && (g == i || g == face_index(i, axis, 1));
+                        if (!in_cell)
+                        {
+                            val += d_D * U_e(SideIndex<NDIM>(g, axis, SideIndex<NDIM>::Lower)) /
+                                   (d_dx[d] * d_dx[d]);
+                        }
+                    }
+                }
+                hier::Index<NDIM> shift(0);
+                shift(axis) = 1;
+                const hier::Index<NDIM> p_left = f - shift, p_rght = f;
+                if (p_left != i) val += P_e(CellIndex<NDIM>(p_left)) / d_dx[axis];
+                if (p_rght != i) val -= P_e(CellIndex<NDIM>(p_rght)) / d_dx[axis];
+                rhs[2 * axis + side] = val;
+            }
+        }
+        rhs[BOX_SIZE - 1] = P_r(CellIndex<NDIM>(i));
+
+        std::array<int, BOX_SIZE> idxs;
+        for (int k = 0; k < BOX_SIZE; ++k) idxs[k] = k;
+        int ierr = VecSetValues(d_b, BOX_SIZE, idxs.data(), rhs.data(), INSERT_VALUES);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyBegin(d_b);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecAssemblyEnd(d_b);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSolve(d_ksp, d_b, d_x);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGetValues(d_x, BOX_SIZE, idxs.data(), x.data());
+        IBTK_CHKERRQ(ierr);
+        return;
+    } // solve
+
+    static void update(SideData<NDIM, double>& U_e,
+                       CellData<NDIM, double>& P_e,
+                       const hier::Index<NDIM>& i,
+                       const std::array<double, BOX_SIZE>& x)
+    {
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int side = 0; side < 2; ++side)
+            {
+                double& U = U_e(SideIndex<NDIM>(face_index(i, axis, side), axis, SideIndex<NDIM>::Lower));
+                U = (1.0 - OMEGA) * U + OMEGA * x[2 * axis + side];
+            }
+        }
+        double& P = P_e(CellIndex<NDIM>(i));
+        P = (1.0 - OMEGA) * P + OMEGA * x[BOX_SIZE - 1];
+        return;
+    } // update
+
+    double d_D;
+    std::array<double, NDIM> d_dx;
+    Mat d_A;
+    Vec d_x, d_b;
+    KSP d_ksp;
+};
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "box_relaxation.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+
+        // Create the error, residual, and reference error data.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > U_e_var = new SideVariable<NDIM, double>("U_e");
+        Pointer<CellVariable<NDIM, double> > P_e_var = new CellVariable<NDIM, double>("P_e");
+        Pointer<SideVariable<NDIM, double> > U_r_var = new SideVariable<NDIM, double>("U_r");
+        Pointer<CellVariable<NDIM, double> > P_r_var = new CellVariable<NDIM, double>("P_r");
+        Pointer<SideVariable<NDIM, double> > U_ref_var = new SideVariable<NDIM, double>("U_ref");
+        Pointer<CellVariable<NDIM, double> > P_ref_var = new CellVariable<NDIM, double>("P_ref");
+        const int U_e_idx = var_db->registerVariableAndContext(U_e_var, ctx, IntVector<NDIM>(1));
+        const int P_e_idx = var_db->registerVariableAndContext(P_e_var, ctx, IntVector<NDIM>(1));
+        const int U_r_idx = var_db->registerVariableAndContext(U_r_var, ctx, IntVector<NDIM>(1));
+        const int P_r_idx = var_db->registerVariableAndContext(P_r_var, ctx, IntVector<NDIM>(1));
+        const int U_ref_idx = var_db->registerVariableAndContext(U_ref_var, ctx, IntVector<NDIM>(1));
+        const int P_ref_idx = var_db->registerVariableAndContext(P_ref_var, ctx, IntVector<NDIM>(1));
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        for (const int idx : { U_e_idx, P_e_idx, U_r_idx, P_r_idx, U_ref_idx, P_ref_idx })
+        {
+            level->allocatePatchData(idx, 0.0);
+        }
+
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, 0);
+        e_vec.addComponent(U_e_var, U_e_idx);
+        e_vec.addComponent(P_e_var, P_e_idx);
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, 0);
+        r_vec.addComponent(U_r_var, U_r_idx);
+        r_vec.addComponent(P_r_var, P_r_idx);
+
+        PoissonSpecifications U_problem_coefs("U_problem_coefs");
+        const double C = input_db->getDouble("C");
+        const double D = input_db->getDouble("D");
+        U_problem_coefs.setCConstant(C);
+        U_problem_coefs.setDConstant(D);
+
+        std::ostringstream out;
+        out << std::setprecision(10);
+        for (const bool use_red_black_ordering : { false, true })
+        {
+            const std::string ordering = use_red_black_ordering ? "red-black" : "lexicographic";
+            const std::string op_name = use_red_black_ordering ? "RedBlackFACOperator" : "LexicographicFACOperator";
+            StaggeredStokesBoxRelaxationFACOperator fac_op(
+                op_name, app_initializer->getComponentDatabase(op_name), "box_relaxation_");
+            fac_op.setVelocityPoissonSpecifications(U_problem_coefs);
+            fac_op.initializeOperatorState(e_vec, r_vec);
+
+            // Fill the error and residual and compute the reference sweep.
+            double ref_max = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > U_e_data = patch->getPatchData(U_e_idx);
+                Pointer<CellData<NDIM, double> > P_e_data = patch->getPatchData(P_e_idx);
+                Pointer<SideData<NDIM, double> > U_r_data = patch->getPatchData(U_r_idx);
+                Pointer<CellData<NDIM, double> > P_r_data = patch->getPatchData(P_r_idx);
+                Pointer<SideData<NDIM, double> > U_ref_data = patch->getPatchData(U_ref_idx);
+                Pointer<CellData<NDIM, double> > P_ref_data = patch->getPatchData(P_ref_idx);
+                fill_data(*U_e_data, *P_e_data, 1.3);
+                fill_data(*U_r_data, *P_r_data, 0.3);
+                fill_data(*U_ref_data, *P_ref_data, 1.3);
+
+                const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                ReferenceBoxRelaxation reference(C, D, pgeom->getDx());
+                reference.sweep(
+                    *U_ref_data, *P_ref_data, *U_r_data, *P_r_data, patch->getBox(), use_red_black_ordering);
+            }
+
+            fac_op.smoothError(e_vec, r_vec, 0, 1, false, false);
+
+            // Compare the interior values.
+            double diff_max = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<SideData<NDIM, double> > U_e_data = patch->getPatchData(U_e_idx);
+                Pointer<CellData<NDIM, double> > P_e_data = patch->getPatchData(P_e_idx);
+                Pointer<SideData<NDIM, double> > U_ref_data = patch->getPatchData(U_ref_idx);
+                Pointer<CellData<NDIM, double> > P_ref_data = patch->getPatchData(P_ref_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+                    {
+                        const SideIndex<NDIM> i_s(b(), axis, SideIndex<NDIM>::Lower);
+                        diff_max = std::max(diff_max, std::abs((*U_e_data)(i_s) - (*U_ref_data)(i_s)));
+                        ref_max = std::max(ref_max, std::abs((*U_ref_data)(i_s)));
+                    }
+                }
+                for (Box<NDIM>::Iterator b(patch_box); b; b++)
+                {
+                    const CellIndex<NDIM> i_c(b());
+                    diff_max = std::max(diff_max, std::abs((*P_e_data)(i_c) - (*P_ref_data)(i_c)));
+                    ref_max = std::max(ref_max, std::abs((*P_ref_data)(i_c)));
+                }
+            }
+            fac_op.deallocateOperatorState();
+
+            out << ordering << " ordering:\n"
+                << "  |e|_oo after one sweep = " << ref_max << "\n"
+                << "  relative difference between pre-inverted and LU box solves = " << diff_max / ref_max << "\n";
+        }
+        plog << out.str();
+
+        for (const int idx : { U_e_idx, P_e_idx, U_r_idx, P_r_idx, U_ref_idx, P_ref_idx })
+        {
+            level->deallocatePatchData(idx);
+        }
+    }
+} // main
@@ -0,0 +1,277 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/LEInteractor.h>
+
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Test that FEDataManager::spread() and FEDataManager::interp() give the same
+// results with and without stored quadrature point geometry data, and that the
+// stored data are discarded when the structure moves, by
+// reinitElementMappings(), and by a regrid.
+//
+// The structure is a square (or cube) with a constant force density, so the
+// integral of the spread force is the force density times the area (or
+// volume) of the structure, and interpolating a constant field reproduces that
+// field.
+
+namespace
+{
+// Move the structure by the specified amount in the x direction.
+void
+shift_structure(System& X_system, const double shift)
+{
+    MeshBase& mesh = X_system.get_mesh();
+    const unsigned int X_sys_num = X_system.number();
+    for (auto it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it)
+    {
+        X_system.solution->add((*it)->dof_number(X_sys_num, 0, 0), shift);
+    }
+    X_system.solution->close();
+    X_system.update();
+} // shift_structure
+
+void
+allocate_patch_data(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const std::vector<int>& data_idxs)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (const int data_idx : data_idxs)
+        {
+            if (!level->checkAllocated(data_idx)) level->allocatePatchData(data_idx);
+        }
+    }
+} // allocate_patch_data
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    PetscOptionsSetValue(nullptr, "-ksp_rtol", "1e-16");
+    PetscOptionsSetValue(nullptr, "-ksp_atol", "1e-16");
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a square (or cube) mesh.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double x_lo = input_db->getDouble("X_LO");
+        const double x_up = input_db->getDouble("X_UP");
+        const int n_elems = input_db->getInteger("N_ELEMS");
+        const auto elem_type = Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE"));
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(mesh, n_elems, n_elems, x_lo, x_up, x_lo, x_up, elem_type);
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(
+            mesh, n_elems, n_elems, n_elems, x_lo, x_up, x_lo, x_up, x_lo, x_up, elem_type);
+#endif
+        mesh.prepare_for_use();
+        LinearPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        // Create major algorithm and data objects that comprise the
+        // application.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+            new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry, false);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+            false);
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                           false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator,
+                                              false);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer,
+                                        false);
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Set up Eulerian data with enough ghost cells for spreading and
+        // interpolation.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<SAMRAI::hier::Variable<NDIM> > f_var = time_integrator->getBodyForceVariable();
+        const int n_ghosts = LEInteractor::getMinimumGhostWidth(input_db->getString("IB_DELTA_FUNCTION"));
+        const int f_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("f_cache_test"), n_ghosts);
+        const int f_ref_idx =
+            var_db->registerVariableAndContext(f_var, var_db->getContext("f_cache_test_ref"), n_ghosts);
+        allocate_patch_data(patch_hierarchy, { f_idx, f_ref_idx });
+
+        // Set up a constant force density and the structure positions.
+        FEDataManager& fe_data_manager = *ib_method_ops->getFEDataManager();
+        EquationSystems& equation_systems = *fe_data_manager.getEquationSystems();
+        System& F_system = equation_systems.get_system(IBFEMethod::FORCE_SYSTEM_NAME);
+        System& X_system = equation_systems.get_system(IBFEMethod::COORDS_SYSTEM_NAME);
+        NumericVector<double>& F_vec = F_system.get_vector("half");
+        NumericVector<double>& X_vec = *X_system.current_local_solution;
+        const unsigned int F_sys_num = F_system.number();
+        for (auto it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) F_vec.set((*it)->dof_number(F_sys_num, d, 0), d + 1.0);
+        }
+        F_vec.close();
+        std::unique_ptr<NumericVector<double> > F_interp_vec = F_vec.clone();
+        std::unique_ptr<NumericVector<double> > F_interp_ref_vec = F_vec.clone();
+
+        std::ostringstream out;
+        out << std::setprecision(10);
+
+        // Spread the force density into f_idx using the stored geometry data
+        // (if they are current), spread it into f_ref_idx after discarding the
+        // stored data, and print the difference.
+        auto check_spread = [&](const std::string& label) {
+            HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(
+                patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+            HierarchyMathOps hier_math_ops("HierarchyMathOps", patch_hierarchy);
+            hier_math_ops.setPatchHierarchy(patch_hierarchy);
+            hier_math_ops.resetLevels(0, patch_hierarchy->getFinestLevelNumber());
+            const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+            hier_sc_data_ops.setToScalar(f_idx, 0.0);
+            fe_data_manager.spread(f_idx, F_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME, nullptr, 0.0);
+            fe_data_manager.clearQuadraturePointGeometryCache();
+            hier_sc_data_ops.setToScalar(f_ref_idx, 0.0);
+            fe_data_manager.spread(f_ref_idx, F_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME, nullptr, 0.0);
+            const double f_integral = hier_sc_data_ops.integral(f_ref_idx, wgt_sc_idx);
+            const double f_norm = hier_sc_data_ops.maxNorm(f_ref_idx);
+            hier_sc_data_ops.subtract(f_idx, f_idx, f_ref_idx);
+            out << "spreading " << label << ":\n"
+                << "  integral of the spread force = " << f_integral << "\n"
+                << "  relative difference between spreading with stored and recomputed geometry = "
+                << hier_sc_data_ops.maxNorm(f_idx) / f_norm << "\n";
+        };
+
+        // Same as above, but for interpolation of a constant field.
+        auto check_interp = [&](const std::string& label) {
+            HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(
+                patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+            for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<SideData<NDIM, double> > f_data = level->getPatch(p())->getPatchData(f_idx);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis) f_data->getArrayData(axis).fillAll(axis + 1.0);
+                }
+            }
+            fe_data_manager.interp(f_idx, *F_interp_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME);
+            fe_data_manager.clearQuadraturePointGeometryCache();
+            fe_data_manager.interp(f_idx, *F_interp_ref_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME);
+            const double F_norm = F_interp_ref_vec->linfty_norm();
+            *F_interp_vec -= *F_interp_ref_vec;
+            const double interp_diff = F_interp_vec->linfty_norm() / F_norm;
+            *F_interp_ref_vec -= F_vec;
+            out << "interpolation " << label << ":\n"
+                << "  relative error in the interpolated constant field = "
+                << F_interp_ref_vec->linfty_norm() / F_norm << "\n"
+                << "  relative difference between interpolation with stored and recomputed geometry = "
+                << interp_diff << "\n";
+        };
+
+        // The first operation computes and stores the geometry data and the
+        // second one uses them.
+        fe_data_manager.clearQuadraturePointGeometryCache();
+        fe_data_manager.spread(f_idx, F_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME, nullptr, 0.0);
+        check_spread("in the initial configuration");
+        fe_data_manager.interp(f_idx, *F_interp_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME);
+        check_interp("in the initial configuration");
+
+        // Moving the structure changes the positions used to compute the stored
+        // data.
+        const double dx_fine = input_db->getDouble("DX");
+        fe_data_manager.spread(f_idx, F_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME, nullptr, 0.0);
+        shift_structure(X_system, 0.5 * dx_fine);
+        check_spread("after moving the structure");
+
+        // Store data computed with the current element mappings, then update
+        // the mappings for the new positions.
+        fe_data_manager.spread(f_idx, F_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME, nullptr, 0.0);
+        fe_data_manager.reinitElementMappings();
+        check_spread("after reinitElementMappings()");
+
+        // Store data computed on the current hierarchy, then move the
+        // structure far enough to change the finest level and regrid.
+        shift_structure(X_system, input_db->getDouble("REGRID_SHIFT"));
+        fe_data_manager.spread(f_idx, F_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME, nullptr, 0.0);
+        time_integrator->regridHierarchy();
+        allocate_patch_data(patch_hierarchy, { f_idx, f_ref_idx });
+        check_spread("after regridding");
+        fe_data_manager.interp(f_idx, *F_interp_vec, X_vec, IBFEMethod::FORCE_SYSTEM_NAME);
+        check_interp("after regridding");
+
+        plog << out.str();
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,261 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test that IrregularWaveSpectrum reproduces the closed-form sums over the
+// component waves of the surface elevation and velocity, and that the inlet
+// values that IrregularWaveBcCoef copies from its cache are the same as the
+// values computed by a new object.  The cached values are requested at more
+// times than the cache holds and on two grids with different spacings.
+
+#include <SAMRAI_config.h>
+
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <BoundaryBox.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/TimerManager.h>
+
+#include <ibamr/IrregularWaveBcCoef.h>
+#include <ibamr/IrregularWaveSpectrum.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/PhysicalBoundaryUtilities.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+// Compute the surface elevation as a sum over the component waves.
+double
+closed_form_elevation(const IrregularWaveSpectrum& spectrum, const double x, const double time)
+{
+    const std::vector<double>& amplitude = spectrum.getAmplitudes();
+    const std::vector<double>& omega = spectrum.getAngularFrequencies();
+    const std::vector<double>& wave_number = spectrum.getWaveNumbers();
+    const std::vector<double>& phase = spectrum.getPhases();
+    double eta = 0.0;
+    for (int i = 0; i < spectrum.getNumberOfWaves(); ++i)
+    {
+        const double theta = wave_number[i] * x - omega[i] * time + phase[i];
+        eta += amplitude[i] * std::cos(theta);
+    }
+    return eta;
+} // closed_form_elevation
+
+// Compute the horizontal (comp_idx = 0) or vertical (comp_idx = NDIM - 1)
+// velocity as a sum over the component waves.
+double
+closed_form_velocity(const IrregularWaveSpectrum& spectrum,
+                     const double depth,
+                     const double x,
+                     const double z_plus_d,
+                     const double time,
+                     const int comp_idx)
+{
+    const std::vector<double>& amplitude = spectrum.getAmplitudes();
+    const std::vector<double>& omega = spectrum.getAngularFrequencies();
+    const std::vector<double>& wave_number = spectrum.getWaveNumbers();
+    const std::vector<double>& phase = spectrum.getPhases();
+    double velocity_component = 0.0;
+    for (int i = 0; i < spectrum.getNumberOfWaves(); ++i)
+    {
+        const double theta = wave_number[i] * x - omega[i] * time + phase[i];
+        const double fac = amplitude[i] * omega[i] / std::sinh(wave_number[i] * depth);
+        velocity_component += comp_idx == 0 ? fac * std::cosh(wave_number[i] * z_plus_d) * std::cos(theta) :
+                                              fac * std::sinh(wave_number[i] * z_plus_d) * std::sin(theta);
+    }
+    return velocity_component;
+} // closed_form_velocity
+
+// Set up a patch hierarchy with a single level on the specified grid.
+Pointer<PatchHierarchy<NDIM> >
+make_hierarchy(Pointer<AppInitializer> app_initializer, Pointer<CartesianGridGeometry<NDIM> > grid_geometry)
+{
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(grid_geometry->getObjectName() + "::PatchHierarchy", grid_geometry);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+        "StandardTagAndInitialize", nullptr, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<LoadBalancer<NDIM> > load_balancer =
+        new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(grid_geometry->getObjectName() + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    /*register_for_restart*/ false);
+    gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+    return patch_hierarchy;
+} // make_hierarchy
+
+// Set the boundary coefficients at the inlet of every patch with bc_coef and
+// with ref_bc_coef and return the largest difference between them.
+double
+max_inlet_difference(const RobinBcCoefStrategy<NDIM>& bc_coef,
+                     const RobinBcCoefStrategy<NDIM>& ref_bc_coef,
+                     Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                     const double time)
+{
+    double max_diff = 0.0;
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Array<BoundaryBox<NDIM> > bdry_boxes = PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+        for (int k = 0; k < bdry_boxes.size(); ++k)
+        {
+            if (bdry_boxes[k].getLocationIndex() != 0) continue;
+            const BoundaryBox<NDIM> bdry_box = PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_boxes[k], *patch);
+            const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(bdry_box);
+            Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > ref_acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > ref_bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > ref_gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            bc_coef.setBcCoefs(acoef_data, bcoef_data, gcoef_data, nullptr, *patch, bdry_box, time);
+            ref_bc_coef.setBcCoefs(ref_acoef_data, ref_bcoef_data, ref_gcoef_data, nullptr, *patch, bdry_box, time);
+            for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                max_diff = std::max(max_diff, std::abs((*acoef_data)(i, 0) - (*ref_acoef_data)(i, 0)));
+                max_diff = std::max(max_diff, std::abs((*bcoef_data)(i, 0) - (*ref_bcoef_data)(i, 0)));
+                max_diff = std::max(max_diff, std::abs((*gcoef_data)(i, 0) - (*ref_gcoef_data)(i, 0)));
+            }
+        }
+    }
+    return IBTK_MPI::maxReduction(max_diff);
+} // max_inlet_difference
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "irregular_wave.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> bc_coefs_db = input_db->getDatabase("VelocityBcCoefs");
+        Pointer<Database> wave_db = bc_coefs_db->getDatabase("wave_parameters_db");
+        const double depth = wave_db->getDouble("depth");
+        const IrregularWaveSpectrum spectrum(wave_db->getInteger("num_waves"),
+                                             wave_db->getDouble("omega_begin"),
+                                             wave_db->getDouble("omega_end"),
+                                             wave_db->getDouble("significant_wave_height"),
+                                             wave_db->getDouble("significant_wave_period"),
+                                             wave_db->getString("wave_spectrum"),
+                                             depth,
+                                             wave_db->getDouble("gravitational_constant"));
+
+        // Print the tabulated elevation and velocity at a few points.
+        plog << std::setprecision(10);
+        for (const double time : { 0.0, 0.7 })
+        {
+            for (const double x : { 0.0, 0.45 })
+            {
+                plog << "t = " << time << ", x = " << x << ": eta = " << spectrum.getSurfaceElevation(x, time) << "\n";
+                for (const double z_plus_d : { 0.1, 0.3 })
+                {
+                    plog << "t = " << time << ", x = " << x << ", z + d = " << z_plus_d
+                         << ": u = " << spectrum.getVelocity(x, z_plus_d, time, 0)
+                         << ", w = " << spectrum.getVelocity(x, z_plus_d, time, NDIM - 1) << "\n";
+                }
+            }
+        }
+
+        // Compare the tabulated values to the closed-form sums at more times
+        // and positions than the tables hold.  The times are revisited after
+        // their tables have been evicted.
+        const double tol = input_db->getDouble("tolerance");
+        const int num_times = input_db->getInteger("num_times");
+        const int num_positions = input_db->getInteger("num_positions");
+        double max_eta = 0.0, max_eta_diff = 0.0;
+        std::array<double, 2> max_velocity = { 0.0, 0.0 }, max_velocity_diff = { 0.0, 0.0 };
+        for (int k = 0; k < num_times; ++k)
+        {
+            const double time = 0.37 * (k % 10);
+            for (int j = 0; j < num_positions; ++j)
+            {
+                const double x = 0.01 * j;
+                const double z_plus_d = depth * (j + 0.5) / num_positions;
+                const double eta = closed_form_elevation(spectrum, x, time);
+                max_eta = std::max(max_eta, std::abs(eta));
+                max_eta_diff = std::max(max_eta_diff, std::abs(spectrum.getSurfaceElevation(x, time) - eta));
+                for (int l = 0; l < 2; ++l)
+                {
+                    const int comp_idx = l == 0 ? 0 : NDIM - 1;
+                    const double velocity = closed_form_velocity(spectrum, depth, x, z_plus_d, time, comp_idx);
+                    max_velocity[l] = std::max(max_velocity[l], std::abs(velocity));
+                    max_velocity_diff[l] = std::max(
+                        max_velocity_diff[l], std::abs(spectrum.getVelocity(x, z_plus_d, time, comp_idx) - velocity));
+                }
+            }
+        }
+        plog << "max |eta| = " << max_eta << "\n";
+        plog << "max |u| = " << max_velocity[0] << ", max |w| = " << max_velocity[1] << "\n";
+        const bool agrees = max_eta_diff <= tol * max_eta && max_velocity_diff[0] <= tol * max_velocity[0] &&
+                            max_velocity_diff[1] <= tol * max_velocity[1];
+        plog << "relative differences from the closed form below " << tol << ": " << (agrees ? "yes" : "no") << "\n";
+
+        // Compare the cached inlet values with the values computed by a new
+        // object at each time, on two grids.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<CartesianGridGeometry<NDIM> > coarse_grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CoarseCartesianGeometry", app_initializer->getComponentDatabase("CoarseCartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = make_hierarchy(app_initializer, grid_geometry);
+        Pointer<PatchHierarchy<NDIM> > coarse_patch_hierarchy = make_hierarchy(app_initializer, coarse_grid_geometry);
+        const int num_cache_times = input_db->getArraySize("cache_times");
+        std::vector<double> cache_times(num_cache_times);
+        input_db->getDoubleArray("cache_times", cache_times.data(), num_cache_times);
+        for (const int comp_idx : { 0, NDIM - 1 })
+        {
+            IrregularWaveBcCoef bc_coef("VelocityBcCoefs", comp_idx, bc_coefs_db, grid_geometry);
+            double max_diff = 0.0;
+            for (const double time : cache_times)
+            {
+                IrregularWaveBcCoef ref_bc_coef("RefVelocityBcCoefs", comp_idx, bc_coefs_db, grid_geometry);
+                for (Pointer<PatchHierarchy<NDIM> > hierarchy : { patch_hierarchy, coarse_patch_hierarchy })
+                {
+                    // The first call may compute the values and the second one
+                    // copies them from the cache.
+                    for (int k = 0; k < 2; ++k)
+                    {
+                        max_diff = std::max(max_diff, max_inlet_difference(bc_coef, ref_bc_coef, hierarchy, time));
+                    }
+                }
+            }
+            plog << "component " << comp_idx
+                 << ": max difference between cached and recomputed inlet values: " << max_diff << "\n";
+        }
+    }
+    return 0;
+} // main